@@ -0,0 +1,447 @@
+#include "BatchingChannel.h"
+
+#include "sairediscommon.h"
+
+#include "meta/sai_serialize.h"
+#include "meta/Globals.h"
+
+#include "swss/logger.h"
+
+#include <inttypes.h>
+
+using namespace sairedis;
+
+BatchingChannel::BatchingChannel(
+        _In_ std::shared_ptr<Channel> channel,
+        _In_ bool syncMode,
+        _In_ size_t batchSize,
+        _In_ uint64_t batchTimeoutUs):
+    Channel(nullptr),
+    m_channel(channel),
+    m_syncMode(syncMode),
+    m_batchSize(batchSize),
+    m_batchTimeoutUs(batchTimeoutUs),
+    m_batchObjectType(SAI_OBJECT_TYPE_NULL),
+    m_buffered(false),
+    m_runTimerThread(true)
+{
+    SWSS_LOG_ENTER();
+
+    if (!channel)
+    {
+        SWSS_LOG_THROW("channel can't be nullptr");
+    }
+
+    m_responseTimeoutMs = channel->getResponseTimeout();
+
+    SWSS_LOG_NOTICE("batching entry operations, batch size: %zu, timeout: %" PRIu64 " us, sync mode: %s",
+            batchSize,
+            batchTimeoutUs,
+            (syncMode ? "true" : "false"));
+
+    if (m_batchTimeoutUs)
+    {
+        m_timerThread = std::make_shared<std::thread>(&BatchingChannel::timerThreadFunction, this);
+    }
+}
+
+BatchingChannel::~BatchingChannel()
+{
+    SWSS_LOG_ENTER();
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        m_runTimerThread = false;
+    }
+
+    m_cv.notify_all();
+
+    if (m_timerThread)
+    {
+        m_timerThread->join();
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    flushBatch();
+}
+
+std::shared_ptr<Channel> BatchingChannel::getChannel() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_channel;
+}
+
+void BatchingChannel::setResponseTimeout(
+        _In_ uint64_t responseTimeout)
+{
+    SWSS_LOG_ENTER();
+
+    Channel::setResponseTimeout(responseTimeout);
+
+    m_channel->setResponseTimeout(responseTimeout);
+}
+
+void BatchingChannel::setBuffered(
+        _In_ bool buffered)
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_buffered = buffered;
+
+    m_channel->setBuffered(buffered);
+}
+
+void BatchingChannel::flush()
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    flushBatch();
+
+    m_channel->flush();
+}
+
+void BatchingChannel::set(
+        _In_ const std::string& key,
+        _In_ const std::vector<swss::FieldValueTuple>& values,
+        _In_ const std::string& command)
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    nextCorrelationId();
+
+    sai_object_type_t objectType;
+
+    if (isBatchable(key, command, objectType))
+    {
+        addToBatch(objectType, key, values, command);
+        return;
+    }
+
+    flushBatch();
+
+    m_channel->set(key, values, command);
+
+    if (m_syncMode)
+    {
+        m_expectedResponses.push_back(0);
+    }
+}
+
+void BatchingChannel::del(
+        _In_ const std::string& key,
+        _In_ const std::string& command)
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    nextCorrelationId();
+
+    sai_object_type_t objectType;
+
+    if (isBatchable(key, command, objectType))
+    {
+        addToBatch(objectType, key, {}, command);
+        return;
+    }
+
+    flushBatch();
+
+    m_channel->del(key, command);
+
+    if (m_syncMode)
+    {
+        m_expectedResponses.push_back(0);
+    }
+}
+
+bool BatchingChannel::isPipelined() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_channel->isPipelined();
+}
+
+sai_status_t BatchingChannel::wait(
+        _In_ const std::string& command,
+        _Out_ swss::KeyOpFieldsValuesTuple& kco)
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (m_responses.size())
+    {
+        kco = m_responses.front();
+
+        m_responses.pop_front();
+
+        sai_status_t status;
+        sai_deserialize_status(kfvKey(kco), status);
+
+        return status;
+    }
+
+    // response may be for operation which is still in batch
+
+    flushBatch();
+
+    auto status = m_channel->wait(command, kco);
+
+    if (!m_syncMode || m_expectedResponses.empty())
+    {
+        return status;
+    }
+
+    if (kfvOp(kco).empty())
+    {
+        // no response, caller will fail all requests in flight
+
+        m_expectedResponses.clear();
+
+        return status;
+    }
+
+    size_t count = m_expectedResponses.front();
+
+    m_expectedResponses.pop_front();
+
+    if (count == 0)
+    {
+        return status;
+    }
+
+    // split bulk response into response per batched operation
+
+    const auto& values = kfvFieldsValues(kco);
+
+    if (values.size() != count)
+    {
+        SWSS_LOG_ERROR("bulk response has %zu statuses, expected %zu, using %s for all",
+                values.size(),
+                count,
+                sai_serialize_status(status).c_str());
+    }
+
+    for (size_t idx = 0; idx < count; idx++)
+    {
+        sai_status_t objectStatus = status;
+
+        if (values.size() == count)
+        {
+            sai_deserialize_status(fvField(values[idx]), objectStatus);
+        }
+
+        m_responses.emplace_back(sai_serialize_status(objectStatus), kfvOp(kco), std::vector<swss::FieldValueTuple>());
+    }
+
+    kco = m_responses.front();
+
+    m_responses.pop_front();
+
+    sai_deserialize_status(kfvKey(kco), status);
+
+    return status;
+}
+
+void BatchingChannel::notificationThreadFunction()
+{
+    SWSS_LOG_ENTER();
+
+    // notifications are handled by underlying channel
+}
+
+bool BatchingChannel::isBatchable(
+        _In_ const std::string& key,
+        _In_ const std::string& command,
+        _Out_ sai_object_type_t& objectType)
+{
+    SWSS_LOG_ENTER();
+
+    if (command != REDIS_ASIC_STATE_COMMAND_CREATE && command != REDIS_ASIC_STATE_COMMAND_REMOVE)
+    {
+        return false;
+    }
+
+    auto pos = key.find(':');
+
+    if (pos == std::string::npos)
+    {
+        return false;
+    }
+
+    sai_deserialize_object_type(key.substr(0, pos), objectType);
+
+    // only entries which syncd can execute one by one when vendor SAI don't
+    // support bulk API, see Syncd::processBulkEntry
+
+    switch ((int)objectType)
+    {
+        case SAI_OBJECT_TYPE_ROUTE_ENTRY:
+        case SAI_OBJECT_TYPE_NEIGHBOR_ENTRY:
+        case SAI_OBJECT_TYPE_NAT_ENTRY:
+        case SAI_OBJECT_TYPE_FDB_ENTRY:
+        case SAI_OBJECT_TYPE_INSEG_ENTRY:
+        case SAI_OBJECT_TYPE_DIRECTION_LOOKUP_ENTRY:
+        case SAI_OBJECT_TYPE_ENI_ETHER_ADDRESS_MAP_ENTRY:
+        case SAI_OBJECT_TYPE_VIP_ENTRY:
+        case SAI_OBJECT_TYPE_INBOUND_ROUTING_ENTRY:
+        case SAI_OBJECT_TYPE_PA_VALIDATION_ENTRY:
+        case SAI_OBJECT_TYPE_OUTBOUND_ROUTING_ENTRY:
+        case SAI_OBJECT_TYPE_OUTBOUND_CA_TO_PA_ENTRY:
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+void BatchingChannel::addToBatch(
+        _In_ sai_object_type_t objectType,
+        _In_ const std::string& key,
+        _In_ const std::vector<swss::FieldValueTuple>& values,
+        _In_ const std::string& command)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_batchKeys.size() && (objectType != m_batchObjectType || command != m_batchCommand))
+    {
+        flushBatch();
+    }
+
+    if (m_batchKeys.empty())
+    {
+        m_batchObjectType = objectType;
+        m_batchCommand = command;
+        m_batchStart = std::chrono::steady_clock::now();
+
+        m_cv.notify_all();
+    }
+
+    m_batchKeys.push_back(key);
+    m_batchValues.push_back(values);
+
+    if (m_batchKeys.size() >= m_batchSize)
+    {
+        flushBatch();
+    }
+}
+
+void BatchingChannel::flushBatch()
+{
+    SWSS_LOG_ENTER();
+
+    size_t count = m_batchKeys.size();
+
+    if (count == 0)
+    {
+        return;
+    }
+
+    if (count == 1)
+    {
+        // single operation is sent as it is
+
+        if (m_batchCommand == REDIS_ASIC_STATE_COMMAND_CREATE)
+        {
+            m_channel->set(m_batchKeys[0], m_batchValues[0], m_batchCommand);
+        }
+        else
+        {
+            m_channel->del(m_batchKeys[0], m_batchCommand);
+        }
+
+        count = 0;
+    }
+    else
+    {
+        std::vector<swss::FieldValueTuple> entries;
+
+        entries.reserve(count);
+
+        for (size_t idx = 0; idx < count; idx++)
+        {
+            const auto& key = m_batchKeys[idx];
+
+            // key: object_type:serialized_entry, same as bulk API
+            // field: serialized_entry
+            // value: attributes joined the same way as by bulk API
+
+            entries.emplace_back(key.substr(key.find(':') + 1), Globals::joinFieldValues(m_batchValues[idx]));
+        }
+
+        std::string bulkKey = sai_serialize_object_type(m_batchObjectType) + ":" + std::to_string(count);
+
+        if (m_batchCommand == REDIS_ASIC_STATE_COMMAND_CREATE)
+        {
+            m_channel->set(bulkKey, entries, REDIS_ASIC_STATE_COMMAND_BULK_CREATE);
+        }
+        else
+        {
+            m_channel->set(bulkKey, entries, REDIS_ASIC_STATE_COMMAND_BULK_REMOVE);
+        }
+
+        SWSS_LOG_DEBUG("flushed batch of %zu %s %s", count, m_batchCommand.c_str(), bulkKey.c_str());
+    }
+
+    if (m_syncMode)
+    {
+        m_expectedResponses.push_back(count);
+    }
+
+    m_batchKeys.clear();
+    m_batchValues.clear();
+}
+
+void BatchingChannel::timerThreadFunction()
+{
+    SWSS_LOG_ENTER();
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    while (m_runTimerThread)
+    {
+        if (m_batchKeys.empty())
+        {
+            m_cv.wait(lock);
+            continue;
+        }
+
+        auto deadline = m_batchStart + std::chrono::microseconds(m_batchTimeoutUs);
+
+        if (std::chrono::steady_clock::now() < deadline)
+        {
+            m_cv.wait_until(lock, deadline);
+            continue;
+        }
+
+        try
+        {
+            flushBatch();
+
+            if (m_buffered)
+            {
+                // otherwise batch would stay in underlying channel buffer
+                // until next flush
+
+                m_channel->flush();
+            }
+        }
+        catch (const std::exception& e)
+        {
+            SWSS_LOG_ERROR("failed to flush batch: %s", e.what());
+
+            m_batchKeys.clear();
+            m_batchValues.clear();
+        }
+    }
+}
@@ -0,0 +1,155 @@
+#pragma once
+
+#include "Channel.h"
+
+#include <memory>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <chrono>
+#include <condition_variable>
+
+namespace sairedis
+{
+    /**
+     * @brief Channel which batches entry operations.
+     *
+     * Consecutive create or remove operations on entries (route, neighbor,
+     * fdb, ...) of the same object type are accumulated
+     * and sent to underlying channel as single bulk create or bulk remove
+     * message, so syncd will dispatch them once.
+     *
+     * Batch is flushed when it reaches maximum size, when object type or
+     * operation changes, before any other message is sent, before waiting
+     * for response and when oldest operation in batch is older than batch
+     * timeout.
+     *
+     * In sync mode bulk response is split back into one response per batched
+     * operation, so each caller still gets its own status, in send order.
+     *
+     * This class is thread safe.
+     */
+    class BatchingChannel:
+        public Channel
+    {
+        public:
+
+            BatchingChannel(
+                    _In_ std::shared_ptr<Channel> channel,
+                    _In_ bool syncMode,
+                    _In_ size_t batchSize,
+                    _In_ uint64_t batchTimeoutUs);
+
+            virtual ~BatchingChannel();
+
+        public:
+
+            /**
+             * @brief Get underlying channel.
+             */
+            std::shared_ptr<Channel> getChannel() const;
+
+            virtual void setResponseTimeout(
+                    _In_ uint64_t responseTimeout) override;
+
+            virtual void setBuffered(
+                    _In_ bool buffered) override;
+
+            virtual void flush() override;
+
+            virtual void set(
+                    _In_ const std::string& key,
+                    _In_ const std::vector<swss::FieldValueTuple>& values,
+                    _In_ const std::string& command) override;
+
+            virtual void del(
+                    _In_ const std::string& key,
+                    _In_ const std::string& command) override;
+
+            virtual bool isPipelined() const override;
+
+            virtual sai_status_t wait(
+                    _In_ const std::string& command,
+                    _Out_ swss::KeyOpFieldsValuesTuple& kco) override;
+
+        protected:
+
+            virtual void notificationThreadFunction() override;
+
+        private:
+
+            /**
+             * @brief Check whether operation can be batched.
+             *
+             * Only create and remove of entries which syncd can also
+             * execute one by one are batched.
+             */
+            static bool isBatchable(
+                    _In_ const std::string& key,
+                    _In_ const std::string& command,
+                    _Out_ sai_object_type_t& objectType);
+
+            /**
+             * @brief Add operation to batch, flushing batch if needed.
+             *
+             * Mutex must be held.
+             */
+            void addToBatch(
+                    _In_ sai_object_type_t objectType,
+                    _In_ const std::string& key,
+                    _In_ const std::vector<swss::FieldValueTuple>& values,
+                    _In_ const std::string& command);
+
+            /**
+             * @brief Send accumulated batch to underlying channel.
+             *
+             * Mutex must be held.
+             */
+            void flushBatch();
+
+            void timerThreadFunction();
+
+        private:
+
+            std::shared_ptr<Channel> m_channel;
+
+            bool m_syncMode;
+
+            size_t m_batchSize;
+
+            uint64_t m_batchTimeoutUs;
+
+            std::mutex m_mutex;
+
+            std::condition_variable m_cv;
+
+            std::string m_batchCommand;
+
+            sai_object_type_t m_batchObjectType;
+
+            std::vector<std::string> m_batchKeys;
+
+            std::vector<std::vector<swss::FieldValueTuple>> m_batchValues;
+
+            std::chrono::steady_clock::time_point m_batchStart;
+
+            bool m_buffered;
+
+            /**
+             * @brief Number of operations for each message sent to underlying
+             * channel, in send order, 0 for not batched message.
+             *
+             * Used only in sync mode, where each message gets response.
+             */
+            std::deque<size_t> m_expectedResponses;
+
+            /**
+             * @brief Responses split from bulk response, not yet returned by wait.
+             */
+            std::deque<swss::KeyOpFieldsValuesTuple> m_responses;
+
+            bool m_runTimerThread;
+
+            std::shared_ptr<std::thread> m_timerThread;
+    };
+}
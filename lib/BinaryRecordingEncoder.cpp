@@ -0,0 +1,392 @@
+#include "BinaryRecordingEncoder.h"
+
+#include "meta/AttrSerializerTable.h"
+#include "meta/EnumNameIndex.h"
+
+#include "swss/logger.h"
+
+#include <algorithm>
+
+#include <time.h>
+#include <string.h>
+
+using namespace sairedis;
+
+constexpr size_t BinaryRecordingEncoder::SYNC_INTERVAL;
+
+static void put_varint(
+        _Inout_ std::string& out,
+        _In_ uint64_t value)
+{
+    SWSS_LOG_ENTER();
+
+    while (value >= 0x80)
+    {
+        out += (char)(uint8_t)(value | 0x80);
+
+        value >>= 7;
+    }
+
+    out += (char)(uint8_t)value;
+}
+
+static void put_svarint(
+        _Inout_ std::string& out,
+        _In_ int64_t value)
+{
+    SWSS_LOG_ENTER();
+
+    // zigzag, so small negative deltas are also short
+
+    uint64_t zigzag = (value >= 0)
+        ? ((uint64_t)value << 1)
+        : ((((uint64_t)(-(value + 1))) << 1) | 1);
+
+    put_varint(out, zigzag);
+}
+
+static void put_string(
+        _Inout_ std::string& out,
+        _In_ const char* data,
+        _In_ size_t size)
+{
+    SWSS_LOG_ENTER();
+
+    put_varint(out, size);
+
+    out.append(data, size);
+}
+
+static bool parse_digits(
+        _In_ const char* data,
+        _In_ int count,
+        _Out_ int& value)
+{
+    SWSS_LOG_ENTER();
+
+    value = 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        if (data[i] < '0' || data[i] > '9')
+        {
+            return false;
+        }
+
+        value = value * 10 + (data[i] - '0');
+    }
+
+    return true;
+}
+
+/**
+ * @brief Parse object id serialized as "oid:0x..." by sai_serialize_object_id.
+ *
+ * Only canonical form is accepted, so serialized value is restored exactly.
+ */
+static bool parse_oid(
+        _In_ const char* data,
+        _In_ size_t size,
+        _Out_ uint64_t& oid)
+{
+    SWSS_LOG_ENTER();
+
+    oid = 0;
+
+    if (size < 7 || size > 22 || memcmp(data, "oid:0x", 6) != 0)
+    {
+        return false;
+    }
+
+    if (data[6] == '0' && size != 7)
+    {
+        return false; // leading zero
+    }
+
+    for (size_t i = 6; i < size; i++)
+    {
+        char c = data[i];
+
+        if (c >= '0' && c <= '9')
+        {
+            oid = (oid << 4) | (uint64_t)(c - '0');
+        }
+        else if (c >= 'a' && c <= 'f')
+        {
+            oid = (oid << 4) | (uint64_t)(c - 'a' + 10);
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+BinaryRecordingEncoder::BinaryRecordingEncoder():
+    m_lastTimestamp(0),
+    m_bytesSinceSync(0),
+    m_syncNeeded(true)
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+void BinaryRecordingEncoder::begin(
+        _In_ bool emptyFile,
+        _Inout_ std::string& out)
+{
+    SWSS_LOG_ENTER();
+
+    if (emptyFile)
+    {
+        out.append(BINARY_RECORDING_MAGIC, BINARY_RECORDING_MAGIC_SIZE);
+    }
+
+    m_syncNeeded = true;
+}
+
+void BinaryRecordingEncoder::encode(
+        _In_ const char* line,
+        _In_ size_t size,
+        _Inout_ std::string& out)
+{
+    SWSS_LOG_ENTER();
+
+    // timestamp|op|token|token...
+
+    const char* end = line + size;
+
+    const char* sep = std::find(line, end, '|');
+
+    if (sep == end)
+    {
+        SWSS_LOG_THROW("missing timestamp separator: %.*s", (int)size, line);
+    }
+
+    uint64_t timestamp = parseTimestamp(line, (size_t)(sep - line));
+
+    const char* op = sep + 1;
+
+    if (op >= end || (op + 1 < end && op[1] != '|'))
+    {
+        SWSS_LOG_THROW("invalid op: %.*s", (int)size, line);
+    }
+
+    if (m_syncNeeded || m_bytesSinceSync >= SYNC_INTERVAL)
+    {
+        out.append(BINARY_RECORDING_SYNC_MARKER, BINARY_RECORDING_SYNC_MARKER_SIZE);
+
+        for (int i = 0; i < 8; i++)
+        {
+            out += (char)(uint8_t)(timestamp >> (8 * i));
+        }
+
+        m_lastTimestamp = timestamp;
+
+        m_bytesSinceSync = 0;
+
+        m_syncNeeded = false;
+    }
+
+    m_body.clear();
+
+    put_svarint(m_body, (int64_t)(timestamp - m_lastTimestamp));
+
+    m_lastTimestamp = timestamp;
+
+    m_body += *op;
+
+    if (op + 1 == end)
+    {
+        put_varint(m_body, 0);
+    }
+    else
+    {
+        const char* token = op + 2;
+
+        put_varint(m_body, (uint64_t)std::count(token, end, '|') + 1);
+
+        while (true)
+        {
+            const char* tokenEnd = std::find(token, end, '|');
+
+            encodeToken(token, (size_t)(tokenEnd - token));
+
+            if (tokenEnd == end)
+            {
+                break;
+            }
+
+            token = tokenEnd + 1;
+        }
+    }
+
+    size_t start = out.size();
+
+    out += (char)BINARY_RECORDING_ENTRY_RECORD;
+
+    put_varint(out, m_body.size());
+
+    out += m_body;
+
+    m_bytesSinceSync += out.size() - start;
+}
+
+void BinaryRecordingEncoder::encodeToken(
+        _In_ const char* token,
+        _In_ size_t size)
+{
+    SWSS_LOG_ENTER();
+
+    static const char objectTypePrefix[] = "SAI_OBJECT_TYPE_";
+
+    static const size_t objectTypePrefixSize = sizeof(objectTypePrefix) - 1;
+
+    const char* end = token + size;
+
+    if (size > objectTypePrefixSize && memcmp(token, objectTypePrefix, objectTypePrefixSize) == 0)
+    {
+        // object type with optional object id
+
+        const char* colon = std::find(token, end, ':');
+
+        std::string name(token, colon);
+
+        auto* index = saimeta::EnumNameIndex::getIndex(&sai_metadata_enum_sai_object_type_t);
+
+        int32_t objectType;
+        bool ignored;
+
+        if (index && index->find(name.c_str(), objectType, ignored) && !ignored)
+        {
+            uint64_t oid;
+
+            if (colon == end)
+            {
+                m_body += (char)BINARY_RECORDING_TOKEN_OBJECT_TYPE;
+
+                put_varint(m_body, (uint64_t)objectType);
+            }
+            else if (parse_oid(colon + 1, (size_t)(end - colon - 1), oid))
+            {
+                m_body += (char)BINARY_RECORDING_TOKEN_OBJECT_OID;
+
+                put_varint(m_body, (uint64_t)objectType);
+                put_varint(m_body, oid);
+            }
+            else
+            {
+                m_body += (char)BINARY_RECORDING_TOKEN_OBJECT;
+
+                put_varint(m_body, (uint64_t)objectType);
+                put_string(m_body, colon + 1, (size_t)(end - colon - 1));
+            }
+
+            return;
+        }
+    }
+    else if (size > 4 && memcmp(token, "SAI_", 4) == 0)
+    {
+        // attribute, names are most of the text record size
+
+        const char* eq = std::find(token, end, '=');
+
+        if (eq != end)
+        {
+            auto* entry = saimeta::AttrSerializerTable::getInstance().findByName(std::string(token, eq));
+
+            if (entry)
+            {
+                m_body += (char)BINARY_RECORDING_TOKEN_ATTR;
+
+                put_varint(m_body, (uint64_t)entry->meta->objecttype);
+                put_varint(m_body, (uint64_t)entry->meta->attrid);
+                put_string(m_body, eq + 1, (size_t)(end - eq - 1));
+
+                return;
+            }
+        }
+    }
+
+    m_body += (char)BINARY_RECORDING_TOKEN_STRING;
+
+    put_string(m_body, token, size);
+}
+
+uint64_t BinaryRecordingEncoder::parseTimestamp(
+        _In_ const char* timestamp,
+        _In_ size_t size)
+{
+    SWSS_LOG_ENTER();
+
+    // 2024-01-31.12:34:56.123456
+
+    int year, month, day, hour, min, sec, usec;
+
+    if (size != 26 ||
+            timestamp[4] != '-' || timestamp[7] != '-' || timestamp[10] != '.' ||
+            timestamp[13] != ':' || timestamp[16] != ':' || timestamp[19] != '.' ||
+            !parse_digits(timestamp, 4, year) ||
+            !parse_digits(timestamp + 5, 2, month) ||
+            !parse_digits(timestamp + 8, 2, day) ||
+            !parse_digits(timestamp + 11, 2, hour) ||
+            !parse_digits(timestamp + 14, 2, min) ||
+            !parse_digits(timestamp + 17, 2, sec) ||
+            !parse_digits(timestamp + 20, 6, usec) ||
+            year < 1970 || month < 1 || month > 12 || day < 1 || day > 31 ||
+            hour > 23 || min > 59 || sec > 59)
+    {
+        SWSS_LOG_THROW("invalid timestamp: %.*s", (int)size, timestamp);
+    }
+
+    struct tm tm;
+
+    memset(&tm, 0, sizeof(tm));
+
+    tm.tm_year = year - 1900;
+    tm.tm_mon = month - 1;
+    tm.tm_mday = day;
+    tm.tm_hour = hour;
+    tm.tm_min = min;
+    tm.tm_sec = sec;
+
+    time_t seconds = timegm(&tm);
+
+    return (uint64_t)seconds * 1000000 + (uint64_t)usec;
+}
+
+uint64_t BinaryRecordingEncoder::parseTimestamp(
+        _In_ const std::string& timestamp)
+{
+    SWSS_LOG_ENTER();
+
+    return parseTimestamp(timestamp.data(), timestamp.size());
+}
+
+std::string BinaryRecordingEncoder::formatTimestamp(
+        _In_ uint64_t timestamp)
+{
+    SWSS_LOG_ENTER();
+
+    time_t seconds = (time_t)(timestamp / 1000000);
+
+    struct tm tm;
+
+    gmtime_r(&seconds, &tm);
+
+    char buffer[64];
+
+    snprintf(buffer, sizeof(buffer), "%04d-%02d-%02d.%02d:%02d:%02d.%06u",
+            tm.tm_year + 1900,
+            tm.tm_mon + 1,
+            tm.tm_mday,
+            tm.tm_hour,
+            tm.tm_min,
+            tm.tm_sec,
+            (unsigned int)(timestamp % 1000000));
+
+    return buffer;
+}
@@ -0,0 +1,133 @@
+#pragma once
+
+#include "swss/sal.h"
+
+#include <string>
+
+#include <stdint.h>
+
+/**
+ * @brief Binary recording file magic, last byte is format version.
+ */
+#define BINARY_RECORDING_MAGIC "\x89SAIREC\x01"
+#define BINARY_RECORDING_MAGIC_SIZE (8)
+
+/**
+ * @brief Sync point marker, first byte never starts record entry.
+ */
+#define BINARY_RECORDING_SYNC_MARKER "\xff\xfeSAIRECSYNC\xfd\xfc\xfb\xfa"
+#define BINARY_RECORDING_SYNC_MARKER_SIZE (16)
+
+#define BINARY_RECORDING_ENTRY_RECORD (0x01)
+
+#define BINARY_RECORDING_TOKEN_STRING       (0)
+#define BINARY_RECORDING_TOKEN_ATTR         (1)
+#define BINARY_RECORDING_TOKEN_OBJECT       (2)
+#define BINARY_RECORDING_TOKEN_OBJECT_OID   (3)
+#define BINARY_RECORDING_TOKEN_OBJECT_TYPE  (4)
+
+namespace sairedis
+{
+    /**
+     * @brief Encodes text recording lines into binary recording format.
+     *
+     * Binary recording file starts with BINARY_RECORDING_MAGIC, followed by
+     * entries. Entry is either sync point:
+     *
+     *   16 bytes  BINARY_RECORDING_SYNC_MARKER
+     *   u64       timestamp in microseconds
+     *
+     * or record:
+     *
+     *   u8        BINARY_RECORDING_ENTRY_RECORD
+     *   varint    body length
+     *   svarint   timestamp delta from previous record or sync point
+     *   u8        op
+     *   varint    token count
+     *   tokens
+     *
+     * Tokens are '|' separated fields of text record after op. Object type
+     * and attribute names are encoded as their numeric values and object
+     * ids as varints, other values as strings (varint length and bytes), so
+     * each text record can be restored exactly.
+     *
+     * Sync point is written at file start and after each SYNC_INTERVAL
+     * bytes, and serves as seek index: reader can binary search sync points
+     * by file offset to find time window without reading whole file. Since
+     * index is part of the data, it survives log rotate and crash.
+     *
+     * Varints are LEB128, svarint is zigzag encoded, integers are little
+     * endian. Timestamps keep wall clock fields of text format (converted
+     * as UTC), so conversion does not depend on local time zone.
+     */
+    class BinaryRecordingEncoder
+    {
+        public:
+
+            BinaryRecordingEncoder();
+
+            virtual ~BinaryRecordingEncoder() = default;
+
+        public:
+
+            /**
+             * @brief Begin writing to file.
+             *
+             * Appends file magic when file is empty, and forces sync point
+             * before next record.
+             */
+            void begin(
+                    _In_ bool emptyFile,
+                    _Inout_ std::string& out);
+
+            /**
+             * @brief Encode single text record, without line terminator.
+             *
+             * Throws when record is not in "timestamp|op|..." format.
+             */
+            void encode(
+                    _In_ const char* line,
+                    _In_ size_t size,
+                    _Inout_ std::string& out);
+
+        public:
+
+            /**
+             * @brief Parse text recording timestamp to microseconds.
+             *
+             * Throws on invalid timestamp.
+             */
+            static uint64_t parseTimestamp(
+                    _In_ const char* timestamp,
+                    _In_ size_t size);
+
+            static uint64_t parseTimestamp(
+                    _In_ const std::string& timestamp);
+
+            static std::string formatTimestamp(
+                    _In_ uint64_t timestamp);
+
+        public:
+
+            /**
+             * @brief Number of encoded bytes between sync points.
+             */
+            static constexpr size_t SYNC_INTERVAL = 64 * 1024;
+
+        private:
+
+            void encodeToken(
+                    _In_ const char* token,
+                    _In_ size_t size);
+
+        private:
+
+            uint64_t m_lastTimestamp;
+
+            size_t m_bytesSinceSync;
+
+            bool m_syncNeeded;
+
+            std::string m_body;
+    };
+}
@@ -0,0 +1,490 @@
+#include "BinaryRecordingReader.h"
+
+#include "meta/sai_serialize.h"
+
+#include "swss/logger.h"
+
+#include <algorithm>
+#include <vector>
+
+#include <inttypes.h>
+#include <string.h>
+
+using namespace sairedis;
+
+static uint64_t get_varint(
+        _Inout_ const char*& data,
+        _In_ const char* end)
+{
+    SWSS_LOG_ENTER();
+
+    uint64_t value = 0;
+
+    for (int shift = 0; shift < 64; shift += 7)
+    {
+        if (data >= end)
+        {
+            SWSS_LOG_THROW("truncated varint");
+        }
+
+        uint8_t byte = (uint8_t)*data++;
+
+        value |= (uint64_t)(byte & 0x7f) << shift;
+
+        if ((byte & 0x80) == 0)
+        {
+            return value;
+        }
+    }
+
+    SWSS_LOG_THROW("varint too long");
+}
+
+static void get_string(
+        _Inout_ const char*& data,
+        _In_ const char* end,
+        _Inout_ std::string& out)
+{
+    SWSS_LOG_ENTER();
+
+    uint64_t size = get_varint(data, end);
+
+    if (size > (uint64_t)(end - data))
+    {
+        SWSS_LOG_THROW("truncated string");
+    }
+
+    out.append(data, (size_t)size);
+
+    data += size;
+}
+
+static sai_object_type_t get_object_type(
+        _Inout_ const char*& data,
+        _In_ const char* end)
+{
+    SWSS_LOG_ENTER();
+
+    uint64_t objectType = get_varint(data, end);
+
+    if (objectType > INT32_MAX || !sai_metadata_is_object_type_valid((sai_object_type_t)objectType))
+    {
+        SWSS_LOG_THROW("invalid object type %" PRIu64, objectType);
+    }
+
+    return (sai_object_type_t)objectType;
+}
+
+BinaryRecordingReader::BinaryRecordingReader(
+        _In_ const std::string& fileName):
+    m_fileName(fileName),
+    m_fileSize(0),
+    m_lastTimestamp(0),
+    m_timestamp(0),
+    m_hasSeekRecord(false),
+    m_seekTimestamp(0)
+{
+    SWSS_LOG_ENTER();
+
+    m_file.open(fileName, std::ios::in | std::ios::binary);
+
+    if (!m_file.is_open())
+    {
+        SWSS_LOG_THROW("failed to open %s", fileName.c_str());
+    }
+
+    m_file.seekg(0, std::ios::end);
+
+    m_fileSize = (uint64_t)m_file.tellg();
+
+    m_file.seekg(0, std::ios::beg);
+
+    char magic[BINARY_RECORDING_MAGIC_SIZE];
+
+    m_file.read(magic, sizeof(magic));
+
+    if (m_file.gcount() != sizeof(magic) || memcmp(magic, BINARY_RECORDING_MAGIC, sizeof(magic)) != 0)
+    {
+        SWSS_LOG_THROW("%s is not binary recording", fileName.c_str());
+    }
+}
+
+bool BinaryRecordingReader::isBinaryRecording(
+        _In_ const std::string& fileName)
+{
+    SWSS_LOG_ENTER();
+
+    std::ifstream file(fileName, std::ios::in | std::ios::binary);
+
+    char magic[BINARY_RECORDING_MAGIC_SIZE];
+
+    file.read(magic, sizeof(magic));
+
+    return file.gcount() == sizeof(magic) && memcmp(magic, BINARY_RECORDING_MAGIC, sizeof(magic)) == 0;
+}
+
+bool BinaryRecordingReader::next(
+        _Out_ std::string& line)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_hasSeekRecord)
+    {
+        m_hasSeekRecord = false;
+
+        line.swap(m_seekRecord);
+
+        m_timestamp = m_seekTimestamp;
+
+        return true;
+    }
+
+    while (true)
+    {
+        int entry = m_file.get();
+
+        if (entry == std::char_traits<char>::eof())
+        {
+            return false;
+        }
+
+        if ((char)entry == BINARY_RECORDING_SYNC_MARKER[0])
+        {
+            char sync[BINARY_RECORDING_SYNC_MARKER_SIZE + 8];
+
+            sync[0] = (char)entry;
+
+            m_file.read(sync + 1, sizeof(sync) - 1);
+
+            if (m_file.gcount() != sizeof(sync) - 1)
+            {
+                SWSS_LOG_WARN("truncated sync point at the end of %s", m_fileName.c_str());
+
+                return false;
+            }
+
+            if (memcmp(sync, BINARY_RECORDING_SYNC_MARKER, BINARY_RECORDING_SYNC_MARKER_SIZE) != 0)
+            {
+                SWSS_LOG_THROW("invalid sync point before offset %" PRId64 " in %s", (int64_t)m_file.tellg(), m_fileName.c_str());
+            }
+
+            m_lastTimestamp = 0;
+
+            for (int i = 0; i < 8; i++)
+            {
+                m_lastTimestamp |= (uint64_t)(uint8_t)sync[BINARY_RECORDING_SYNC_MARKER_SIZE + i] << (8 * i);
+            }
+
+            continue;
+        }
+
+        if (entry != BINARY_RECORDING_ENTRY_RECORD)
+        {
+            SWSS_LOG_THROW("invalid entry 0x%x before offset %" PRId64 " in %s", entry, (int64_t)m_file.tellg(), m_fileName.c_str());
+        }
+
+        uint64_t size;
+
+        if (!readVarint(size) || size > m_fileSize)
+        {
+            SWSS_LOG_WARN("truncated record at the end of %s", m_fileName.c_str());
+
+            return false;
+        }
+
+        m_body.resize((size_t)size);
+
+        m_file.read(&m_body[0], (std::streamsize)size);
+
+        if ((uint64_t)m_file.gcount() != size)
+        {
+            SWSS_LOG_WARN("truncated record at the end of %s", m_fileName.c_str());
+
+            return false;
+        }
+
+        decodeBody(line);
+
+        return true;
+    }
+}
+
+bool BinaryRecordingReader::readVarint(
+        _Out_ uint64_t& value)
+{
+    SWSS_LOG_ENTER();
+
+    value = 0;
+
+    for (int shift = 0; shift < 64; shift += 7)
+    {
+        int byte = m_file.get();
+
+        if (byte == std::char_traits<char>::eof())
+        {
+            return false;
+        }
+
+        value |= (uint64_t)(byte & 0x7f) << shift;
+
+        if ((byte & 0x80) == 0)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void BinaryRecordingReader::decodeBody(
+        _Out_ std::string& line)
+{
+    SWSS_LOG_ENTER();
+
+    const char* data = m_body.data();
+    const char* end = data + m_body.size();
+
+    uint64_t zigzag = get_varint(data, end);
+
+    int64_t delta = (zigzag & 1) ? -(int64_t)(zigzag >> 1) - 1 : (int64_t)(zigzag >> 1);
+
+    m_timestamp = m_lastTimestamp + (uint64_t)delta;
+
+    m_lastTimestamp = m_timestamp;
+
+    if (data >= end)
+    {
+        SWSS_LOG_THROW("record without op");
+    }
+
+    char op = *data++;
+
+    uint64_t count = get_varint(data, end);
+
+    line = BinaryRecordingEncoder::formatTimestamp(m_timestamp);
+
+    line += '|';
+    line += op;
+
+    for (uint64_t i = 0; i < count; i++)
+    {
+        line += '|';
+
+        if (data >= end)
+        {
+            SWSS_LOG_THROW("truncated token");
+        }
+
+        char tag = *data++;
+
+        switch (tag)
+        {
+            case BINARY_RECORDING_TOKEN_STRING:
+
+                get_string(data, end, line);
+                break;
+
+            case BINARY_RECORDING_TOKEN_ATTR:
+                {
+                    auto objectType = get_object_type(data, end);
+
+                    uint64_t attrId = get_varint(data, end);
+
+                    auto* meta = sai_metadata_get_attr_metadata(objectType, (sai_attr_id_t)attrId);
+
+                    if (meta == NULL || attrId > UINT32_MAX)
+                    {
+                        SWSS_LOG_THROW("invalid attribute id %" PRIu64 " on %s", attrId, sai_serialize_object_type(objectType).c_str());
+                    }
+
+                    line += meta->attridname;
+                    line += '=';
+
+                    get_string(data, end, line);
+                }
+                break;
+
+            case BINARY_RECORDING_TOKEN_OBJECT:
+
+                line += sai_serialize_object_type(get_object_type(data, end));
+                line += ':';
+
+                get_string(data, end, line);
+                break;
+
+            case BINARY_RECORDING_TOKEN_OBJECT_OID:
+
+                line += sai_serialize_object_type(get_object_type(data, end));
+                line += ':';
+                line += sai_serialize_object_id(get_varint(data, end));
+                break;
+
+            case BINARY_RECORDING_TOKEN_OBJECT_TYPE:
+
+                line += sai_serialize_object_type(get_object_type(data, end));
+                break;
+
+            default:
+                SWSS_LOG_THROW("invalid token tag %d", tag);
+        }
+    }
+
+    if (data != end)
+    {
+        SWSS_LOG_THROW("record has %zu trailing bytes", (size_t)(end - data));
+    }
+}
+
+uint64_t BinaryRecordingReader::getTimestamp() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_timestamp;
+}
+
+bool BinaryRecordingReader::findSync(
+        _In_ uint64_t offset,
+        _In_ uint64_t end,
+        _Out_ uint64_t& syncOffset)
+{
+    SWSS_LOG_ENTER();
+
+    const char* marker = BINARY_RECORDING_SYNC_MARKER;
+
+    const size_t markerSize = BINARY_RECORDING_SYNC_MARKER_SIZE;
+
+    const size_t chunkSize = BinaryRecordingEncoder::SYNC_INTERVAL;
+
+    m_file.clear();
+    m_file.seekg((std::streamoff)offset);
+
+    std::vector<char> buffer;
+
+    uint64_t base = offset; // file offset of buffer begin
+
+    syncOffset = 0;
+
+    while (base < end)
+    {
+        size_t kept = buffer.size();
+
+        buffer.resize(kept + chunkSize);
+
+        m_file.read(buffer.data() + kept, (std::streamsize)chunkSize);
+
+        size_t read = (size_t)m_file.gcount();
+
+        buffer.resize(kept + read);
+
+        auto it = std::search(buffer.begin(), buffer.end(), marker, marker + markerSize);
+
+        if (it != buffer.end())
+        {
+            syncOffset = base + (uint64_t)(it - buffer.begin());
+
+            return syncOffset < end;
+        }
+
+        if (read == 0)
+        {
+            return false;
+        }
+
+        // marker may span chunks
+
+        size_t tail = std::min(buffer.size(), markerSize - 1);
+
+        base += buffer.size() - tail;
+
+        buffer.erase(buffer.begin(), buffer.end() - (std::ptrdiff_t)tail);
+    }
+
+    return false;
+}
+
+bool BinaryRecordingReader::readSyncTimestamp(
+        _In_ uint64_t syncOffset,
+        _Out_ uint64_t& timestamp)
+{
+    SWSS_LOG_ENTER();
+
+    m_file.clear();
+    m_file.seekg((std::streamoff)(syncOffset + BINARY_RECORDING_SYNC_MARKER_SIZE));
+
+    unsigned char buffer[8];
+
+    m_file.read((char*)buffer, sizeof(buffer));
+
+    timestamp = 0;
+
+    if (m_file.gcount() != sizeof(buffer))
+    {
+        return false;
+    }
+
+    for (int i = 0; i < 8; i++)
+    {
+        timestamp |= (uint64_t)buffer[i] << (8 * i);
+    }
+
+    return true;
+}
+
+void BinaryRecordingReader::seek(
+        _In_ uint64_t timestamp)
+{
+    SWSS_LOG_ENTER();
+
+    m_hasSeekRecord = false;
+
+    // find last sync point not newer than timestamp, first sync point
+    // follows file magic
+
+    uint64_t best = BINARY_RECORDING_MAGIC_SIZE;
+
+    uint64_t lo = BINARY_RECORDING_MAGIC_SIZE;
+    uint64_t hi = m_fileSize;
+
+    while (lo < hi)
+    {
+        uint64_t mid = lo + (hi - lo) / 2;
+
+        uint64_t syncOffset;
+        uint64_t syncTimestamp;
+
+        if (!findSync(mid, hi, syncOffset) || !readSyncTimestamp(syncOffset, syncTimestamp))
+        {
+            hi = mid;
+            continue;
+        }
+
+        if (syncTimestamp <= timestamp)
+        {
+            best = syncOffset;
+            lo = syncOffset + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+
+    m_file.clear();
+    m_file.seekg((std::streamoff)best);
+
+    std::string line;
+
+    while (next(line))
+    {
+        if (m_timestamp >= timestamp)
+        {
+            m_seekRecord.swap(line);
+
+            m_seekTimestamp = m_timestamp;
+
+            m_hasSeekRecord = true;
+
+            return;
+        }
+    }
+}
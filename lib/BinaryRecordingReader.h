@@ -0,0 +1,106 @@
+#pragma once
+
+#include "BinaryRecordingEncoder.h"
+
+#include <string>
+#include <fstream>
+
+namespace sairedis
+{
+    /**
+     * @brief Reads binary recording file as text recording lines.
+     *
+     * See BinaryRecordingEncoder for file format.
+     */
+    class BinaryRecordingReader
+    {
+        public:
+
+            /**
+             * @brief Open binary recording file.
+             *
+             * Throws when file can't be opened or is not binary recording.
+             */
+            BinaryRecordingReader(
+                    _In_ const std::string& fileName);
+
+            virtual ~BinaryRecordingReader() = default;
+
+        public:
+
+            /**
+             * @brief Read next record as text recording line, without line
+             * terminator.
+             *
+             * Record truncated at the end of file (for example when writer
+             * crashed) is treated as end of file.
+             *
+             * @return False on end of file.
+             */
+            bool next(
+                    _Out_ std::string& line);
+
+            /**
+             * @brief Get timestamp in microseconds of record returned by
+             * last next call.
+             */
+            uint64_t getTimestamp() const;
+
+            /**
+             * @brief Position reader at first record with timestamp equal or
+             * greater than given timestamp.
+             *
+             * Sync points are binary searched by file offset, so only few
+             * blocks are read regardless of file size.
+             */
+            void seek(
+                    _In_ uint64_t timestamp);
+
+        public:
+
+            static bool isBinaryRecording(
+                    _In_ const std::string& fileName);
+
+        private:
+
+            /**
+             * @brief Find first sync point at or after given offset.
+             *
+             * @return True if sync point was found before end offset.
+             */
+            bool findSync(
+                    _In_ uint64_t offset,
+                    _In_ uint64_t end,
+                    _Out_ uint64_t& syncOffset);
+
+            bool readSyncTimestamp(
+                    _In_ uint64_t syncOffset,
+                    _Out_ uint64_t& timestamp);
+
+            bool readVarint(
+                    _Out_ uint64_t& value);
+
+            void decodeBody(
+                    _Out_ std::string& line);
+
+        private:
+
+            std::string m_fileName;
+
+            std::ifstream m_file;
+
+            uint64_t m_fileSize;
+
+            uint64_t m_lastTimestamp;
+
+            uint64_t m_timestamp;
+
+            std::string m_body;
+
+            bool m_hasSeekRecord;
+
+            std::string m_seekRecord;
+
+            uint64_t m_seekTimestamp;
+    };
+}
@@ -0,0 +1,607 @@
+#include "CapabilityCache.h"
+#include "sairedis.h"
+
+#include "meta/sai_serialize.h"
+#include "meta/SaiAttributeList.h"
+#include "meta/Globals.h"
+
+#include "swss/logger.h"
+
+#include <vector>
+
+using namespace sairedis;
+using namespace saimeta;
+
+#define CAPABILITY_CACHE_FILE_HEADER "# sairedis capability cache "
+
+#define QUERY_ATTRIBUTE_CAPABILITY              "attribute_capability"
+#define QUERY_ATTRIBUTE_ENUM_VALUES_CAPABILITY  "attribute_enum_values_capability"
+#define QUERY_STATS_CAPABILITY                  "stats_capability"
+
+CapabilityCache::CapabilityCache():
+    m_enabled(true),
+    m_availabilityTtlMs(SAI_REDIS_DEFAULT_AVAILABILITY_CACHE_TTL)
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+void CapabilityCache::setEnabled(
+        _In_ bool enabled)
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_enabled = enabled;
+
+    if (!enabled)
+    {
+        m_capabilities.clear();
+    }
+}
+
+bool CapabilityCache::setFile(
+        _In_ const std::string& fileName,
+        _In_ const std::string& version)
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (m_file.is_open())
+    {
+        m_file.close();
+    }
+
+    m_fileName = fileName;
+
+    if (fileName.empty())
+    {
+        return true;
+    }
+
+    const std::string header = CAPABILITY_CACHE_FILE_HEADER + version;
+
+    bool sameVersion = false;
+
+    std::ifstream in(fileName);
+
+    std::string line;
+
+    if (in.is_open() && std::getline(in, line) && line == header)
+    {
+        sameVersion = true;
+
+        size_t loaded = 0;
+
+        while (std::getline(in, line))
+        {
+            auto pos = line.find('=');
+
+            if (pos == std::string::npos)
+            {
+                SWSS_LOG_WARN("skipping invalid line in %s: %s", fileName.c_str(), line.c_str());
+                continue;
+            }
+
+            m_capabilities[line.substr(0, pos)] = line.substr(pos + 1);
+
+            loaded++;
+        }
+
+        SWSS_LOG_NOTICE("loaded %zu capabilities from %s", loaded, fileName.c_str());
+    }
+
+    in.close();
+
+    if (sameVersion)
+    {
+        m_file.open(fileName, std::ios::out | std::ios::app);
+    }
+    else
+    {
+        SWSS_LOG_NOTICE("capability cache file %s is missing or was written by different version, truncating", fileName.c_str());
+
+        m_file.open(fileName, std::ios::out | std::ios::trunc);
+
+        m_file << header << std::endl;
+    }
+
+    if (!m_file.is_open() || m_file.fail())
+    {
+        SWSS_LOG_ERROR("failed to open capability cache file %s", fileName.c_str());
+
+        m_file.close();
+
+        m_fileName.clear();
+
+        return false;
+    }
+
+    return true;
+}
+
+void CapabilityCache::setAvailabilityTtl(
+        _In_ uint64_t ttlMs)
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_availabilityTtlMs = ttlMs;
+
+    m_availabilities.clear();
+}
+
+void CapabilityCache::removeSwitch(
+        _In_ sai_object_id_t switchId)
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    const std::string prefix = sai_serialize_object_id(switchId) + "|";
+
+    auto it = m_capabilities.lower_bound(prefix);
+
+    while (it != m_capabilities.end() && it->first.compare(0, prefix.size(), prefix) == 0)
+    {
+        it = m_capabilities.erase(it);
+    }
+
+    auto ait = m_availabilities.lower_bound(prefix);
+
+    while (ait != m_availabilities.end() && ait->first.compare(0, prefix.size(), prefix) == 0)
+    {
+        ait = m_availabilities.erase(ait);
+    }
+}
+
+bool CapabilityCache::getAttributeCapability(
+        _In_ sai_object_id_t switchId,
+        _In_ sai_object_type_t objectType,
+        _In_ sai_attr_id_t attrId,
+        _Out_ sai_status_t& status,
+        _Out_ sai_attr_capability_t& capability)
+{
+    SWSS_LOG_ENTER();
+
+    std::string payload;
+
+    if (!getCapability(getAttrKey(QUERY_ATTRIBUTE_CAPABILITY, switchId, objectType, attrId), status, payload))
+    {
+        return false;
+    }
+
+    if (status == SAI_STATUS_SUCCESS)
+    {
+        if (payload.size() != 3)
+        {
+            SWSS_LOG_ERROR("invalid cached attribute capability: %s", payload.c_str());
+
+            return false;
+        }
+
+        capability.create_implemented = (payload[0] == '1');
+        capability.set_implemented = (payload[1] == '1');
+        capability.get_implemented = (payload[2] == '1');
+    }
+
+    return true;
+}
+
+void CapabilityCache::setAttributeCapability(
+        _In_ sai_object_id_t switchId,
+        _In_ sai_object_type_t objectType,
+        _In_ sai_attr_id_t attrId,
+        _In_ sai_status_t status,
+        _In_ const sai_attr_capability_t& capability)
+{
+    SWSS_LOG_ENTER();
+
+    std::string payload;
+
+    if (status == SAI_STATUS_SUCCESS)
+    {
+        payload += capability.create_implemented ? '1' : '0';
+        payload += capability.set_implemented ? '1' : '0';
+        payload += capability.get_implemented ? '1' : '0';
+    }
+
+    setCapability(getAttrKey(QUERY_ATTRIBUTE_CAPABILITY, switchId, objectType, attrId), status, payload);
+}
+
+bool CapabilityCache::getAttributeEnumValuesCapability(
+        _In_ sai_object_id_t switchId,
+        _In_ sai_object_type_t objectType,
+        _In_ sai_attr_id_t attrId,
+        _Out_ sai_status_t& status,
+        _Inout_ sai_s32_list_t& enumValuesCapability)
+{
+    SWSS_LOG_ENTER();
+
+    std::string payload;
+
+    if (!getCapability(getAttrKey(QUERY_ATTRIBUTE_ENUM_VALUES_CAPABILITY, switchId, objectType, attrId), status, payload))
+    {
+        return false;
+    }
+
+    if (status != SAI_STATUS_SUCCESS)
+    {
+        return true;
+    }
+
+    std::vector<int32_t> values;
+
+    try
+    {
+        size_t pos = 0;
+
+        while (pos < payload.size())
+        {
+            size_t end = payload.find(',', pos);
+
+            if (end == std::string::npos)
+            {
+                end = payload.size();
+            }
+
+            values.push_back(std::stoi(payload.substr(pos, end - pos)));
+
+            pos = end + 1;
+        }
+    }
+    catch (const std::exception& e)
+    {
+        SWSS_LOG_ERROR("invalid cached enum values capability %s: %s", payload.c_str(), e.what());
+
+        return false;
+    }
+
+    if (enumValuesCapability.list == nullptr || enumValuesCapability.count < values.size())
+    {
+        enumValuesCapability.count = (uint32_t)values.size();
+
+        status = SAI_STATUS_BUFFER_OVERFLOW;
+
+        return true;
+    }
+
+    enumValuesCapability.count = (uint32_t)values.size();
+
+    for (size_t idx = 0; idx < values.size(); idx++)
+    {
+        enumValuesCapability.list[idx] = values[idx];
+    }
+
+    return true;
+}
+
+void CapabilityCache::setAttributeEnumValuesCapability(
+        _In_ sai_object_id_t switchId,
+        _In_ sai_object_type_t objectType,
+        _In_ sai_attr_id_t attrId,
+        _In_ sai_status_t status,
+        _In_ const sai_s32_list_t& enumValuesCapability)
+{
+    SWSS_LOG_ENTER();
+
+    std::string payload;
+
+    if (status == SAI_STATUS_SUCCESS)
+    {
+        for (uint32_t idx = 0; idx < enumValuesCapability.count; idx++)
+        {
+            if (idx)
+            {
+                payload += ',';
+            }
+
+            payload += std::to_string(enumValuesCapability.list[idx]);
+        }
+    }
+
+    setCapability(getAttrKey(QUERY_ATTRIBUTE_ENUM_VALUES_CAPABILITY, switchId, objectType, attrId), status, payload);
+}
+
+bool CapabilityCache::getStatsCapability(
+        _In_ sai_object_id_t switchId,
+        _In_ sai_object_type_t objectType,
+        _Out_ sai_status_t& status,
+        _Inout_ sai_stat_capability_list_t& statsCapability)
+{
+    SWSS_LOG_ENTER();
+
+    std::string payload;
+
+    auto key = sai_serialize_object_id(switchId) + "|" QUERY_STATS_CAPABILITY "|" + sai_serialize_object_type(objectType);
+
+    if (!getCapability(key, status, payload))
+    {
+        return false;
+    }
+
+    if (status != SAI_STATUS_SUCCESS)
+    {
+        return true;
+    }
+
+    // payload is comma separated list of stat:modes
+
+    std::vector<sai_stat_capability_t> values;
+
+    try
+    {
+        size_t pos = 0;
+
+        while (pos < payload.size())
+        {
+            size_t end = payload.find(',', pos);
+
+            if (end == std::string::npos)
+            {
+                end = payload.size();
+            }
+
+            auto item = payload.substr(pos, end - pos);
+
+            auto colon = item.find(':');
+
+            if (colon == std::string::npos)
+            {
+                SWSS_LOG_THROW("missing stat modes in %s", item.c_str());
+            }
+
+            sai_stat_capability_t cap;
+
+            cap.stat_enum = (sai_stat_id_t)std::stoul(item.substr(0, colon));
+            cap.stat_modes = (uint32_t)std::stoul(item.substr(colon + 1));
+
+            values.push_back(cap);
+
+            pos = end + 1;
+        }
+    }
+    catch (const std::exception& e)
+    {
+        SWSS_LOG_ERROR("invalid cached stats capability %s: %s", payload.c_str(), e.what());
+
+        return false;
+    }
+
+    if (statsCapability.list == nullptr || statsCapability.count < values.size())
+    {
+        statsCapability.count = (uint32_t)values.size();
+
+        status = SAI_STATUS_BUFFER_OVERFLOW;
+
+        return true;
+    }
+
+    statsCapability.count = (uint32_t)values.size();
+
+    for (size_t idx = 0; idx < values.size(); idx++)
+    {
+        statsCapability.list[idx] = values[idx];
+    }
+
+    return true;
+}
+
+void CapabilityCache::setStatsCapability(
+        _In_ sai_object_id_t switchId,
+        _In_ sai_object_type_t objectType,
+        _In_ sai_status_t status,
+        _In_ const sai_stat_capability_list_t& statsCapability)
+{
+    SWSS_LOG_ENTER();
+
+    std::string payload;
+
+    if (status == SAI_STATUS_SUCCESS)
+    {
+        for (uint32_t idx = 0; idx < statsCapability.count; idx++)
+        {
+            if (idx)
+            {
+                payload += ',';
+            }
+
+            payload += std::to_string(statsCapability.list[idx].stat_enum);
+            payload += ':';
+            payload += std::to_string(statsCapability.list[idx].stat_modes);
+        }
+    }
+
+    auto key = sai_serialize_object_id(switchId) + "|" QUERY_STATS_CAPABILITY "|" + sai_serialize_object_type(objectType);
+
+    setCapability(key, status, payload);
+}
+
+bool CapabilityCache::getObjectTypeAvailability(
+        _In_ sai_object_id_t switchId,
+        _In_ sai_object_type_t objectType,
+        _In_ uint32_t attrCount,
+        _In_ const sai_attribute_t *attrList,
+        _Out_ uint64_t& count)
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (m_availabilityTtlMs == 0 || m_availabilities.empty())
+    {
+        return false;
+    }
+
+    auto key = sai_serialize_object_id(switchId) + "|" + sai_serialize_object_type(objectType) + "|" +
+        Globals::joinFieldValues(SaiAttributeList::serialize_attr_list(objectType, attrCount, attrList, false));
+
+    auto it = m_availabilities.find(key);
+
+    if (it == m_availabilities.end())
+    {
+        return false;
+    }
+
+    auto age = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - it->second.time).count();
+
+    if ((uint64_t)age >= m_availabilityTtlMs)
+    {
+        m_availabilities.erase(it);
+
+        return false;
+    }
+
+    count = it->second.count;
+
+    return true;
+}
+
+void CapabilityCache::setObjectTypeAvailability(
+        _In_ sai_object_id_t switchId,
+        _In_ sai_object_type_t objectType,
+        _In_ uint32_t attrCount,
+        _In_ const sai_attribute_t *attrList,
+        _In_ uint64_t count)
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (m_availabilityTtlMs == 0)
+    {
+        return;
+    }
+
+    auto key = sai_serialize_object_id(switchId) + "|" + sai_serialize_object_type(objectType) + "|" +
+        Globals::joinFieldValues(SaiAttributeList::serialize_attr_list(objectType, attrCount, attrList, false));
+
+    auto& availability = m_availabilities[key];
+
+    availability.count = count;
+    availability.time = std::chrono::steady_clock::now();
+}
+
+void CapabilityCache::invalidateObjectTypeAvailability()
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_availabilities.clear();
+}
+
+bool CapabilityCache::isCacheableStatus(
+        _In_ sai_status_t status)
+{
+    SWSS_LOG_ENTER();
+
+    // vendor answer which will not change for switch lifetime
+
+    return status == SAI_STATUS_SUCCESS ||
+        status == SAI_STATUS_NOT_SUPPORTED ||
+        status == SAI_STATUS_NOT_IMPLEMENTED;
+}
+
+std::string CapabilityCache::getAttrKey(
+        _In_ const char* query,
+        _In_ sai_object_id_t switchId,
+        _In_ sai_object_type_t objectType,
+        _In_ sai_attr_id_t attrId)
+{
+    SWSS_LOG_ENTER();
+
+    auto* meta = sai_metadata_get_attr_metadata(objectType, attrId);
+
+    if (meta == NULL)
+    {
+        return "";
+    }
+
+    return sai_serialize_object_id(switchId) + "|" + query + "|" + meta->attridname;
+}
+
+bool CapabilityCache::getCapability(
+        _In_ const std::string& key,
+        _Out_ sai_status_t& status,
+        _Out_ std::string& payload)
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    status = SAI_STATUS_FAILURE;
+
+    if (!m_enabled || key.empty())
+    {
+        return false;
+    }
+
+    auto it = m_capabilities.find(key);
+
+    if (it == m_capabilities.end())
+    {
+        return false;
+    }
+
+    auto pos = it->second.find('|');
+
+    try
+    {
+        sai_deserialize_status(it->second.substr(0, pos), status);
+    }
+    catch (const std::exception& e)
+    {
+        SWSS_LOG_ERROR("invalid cached capability %s: %s", it->second.c_str(), e.what());
+
+        m_capabilities.erase(it);
+
+        return false;
+    }
+
+    payload = (pos == std::string::npos) ? "" : it->second.substr(pos + 1);
+
+    return true;
+}
+
+void CapabilityCache::setCapability(
+        _In_ const std::string& key,
+        _In_ sai_status_t status,
+        _In_ const std::string& payload)
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (!m_enabled || key.empty() || !isCacheableStatus(status))
+    {
+        return;
+    }
+
+    auto value = sai_serialize_status(status) + "|" + payload;
+
+    auto& entry = m_capabilities[key];
+
+    if (entry == value)
+    {
+        return;
+    }
+
+    entry = value;
+
+    if (m_file.is_open())
+    {
+        m_file << key << "=" << value << std::endl;
+
+        if (m_file.fail())
+        {
+            SWSS_LOG_ERROR("failed to write capability cache file %s, disabling persistence", m_fileName.c_str());
+
+            m_file.close();
+        }
+    }
+}
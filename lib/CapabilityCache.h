@@ -0,0 +1,203 @@
+#pragma once
+
+extern "C" {
+#include "sai.h"
+}
+
+#include <string>
+#include <map>
+#include <mutex>
+#include <chrono>
+#include <fstream>
+
+namespace sairedis
+{
+    /**
+     * @brief Client side cache of capability and availability queries.
+     *
+     * Attribute capability, attribute enum values capability and stats
+     * capability are static for switch lifetime, so successful (and not supported/not implemented)
+     * answers are kept until switch is removed. They can be also persisted
+     * to file, so they survive client restart.
+     *
+     * Object type availability changes when objects are created, so it is
+     * kept only for short time to live, and whole availability cache is
+     * invalidated when this client creates or removes any object.
+     *
+     * This class is thread safe.
+     */
+    class CapabilityCache
+    {
+        public:
+
+            CapabilityCache();
+
+            virtual ~CapabilityCache() = default;
+
+        public:
+
+            /**
+             * @brief Enable or disable capability cache.
+             *
+             * Disabling will clear cached capabilities. Enabled by default.
+             */
+            void setEnabled(
+                    _In_ bool enabled);
+
+            /**
+             * @brief Set file where capabilities are persisted.
+             *
+             * Entries from file are loaded if file was written with the same
+             * version, otherwise file is truncated. New entries are appended.
+             * Empty file name disables persistence.
+             *
+             * @return True on success.
+             */
+            bool setFile(
+                    _In_ const std::string& fileName,
+                    _In_ const std::string& version);
+
+            /**
+             * @brief Set object type availability time to live in
+             * milliseconds, 0 disables availability cache.
+             */
+            void setAvailabilityTtl(
+                    _In_ uint64_t ttlMs);
+
+            /**
+             * @brief Remove all entries of given switch.
+             */
+            void removeSwitch(
+                    _In_ sai_object_id_t switchId);
+
+        public: // attribute capability
+
+            bool getAttributeCapability(
+                    _In_ sai_object_id_t switchId,
+                    _In_ sai_object_type_t objectType,
+                    _In_ sai_attr_id_t attrId,
+                    _Out_ sai_status_t& status,
+                    _Out_ sai_attr_capability_t& capability);
+
+            void setAttributeCapability(
+                    _In_ sai_object_id_t switchId,
+                    _In_ sai_object_type_t objectType,
+                    _In_ sai_attr_id_t attrId,
+                    _In_ sai_status_t status,
+                    _In_ const sai_attr_capability_t& capability);
+
+        public: // attribute enum values capability
+
+            /**
+             * @brief Get enum values capability.
+             *
+             * When list is too small, count is updated and status is
+             * SAI_STATUS_BUFFER_OVERFLOW, same as returned by syncd.
+             */
+            bool getAttributeEnumValuesCapability(
+                    _In_ sai_object_id_t switchId,
+                    _In_ sai_object_type_t objectType,
+                    _In_ sai_attr_id_t attrId,
+                    _Out_ sai_status_t& status,
+                    _Inout_ sai_s32_list_t& enumValuesCapability);
+
+            void setAttributeEnumValuesCapability(
+                    _In_ sai_object_id_t switchId,
+                    _In_ sai_object_type_t objectType,
+                    _In_ sai_attr_id_t attrId,
+                    _In_ sai_status_t status,
+                    _In_ const sai_s32_list_t& enumValuesCapability);
+
+        public: // stats capability
+
+            /**
+             * @brief Get stats capability.
+             *
+             * When list is too small, count is updated and status is
+             * SAI_STATUS_BUFFER_OVERFLOW, same as returned by syncd.
+             */
+            bool getStatsCapability(
+                    _In_ sai_object_id_t switchId,
+                    _In_ sai_object_type_t objectType,
+                    _Out_ sai_status_t& status,
+                    _Inout_ sai_stat_capability_list_t& statsCapability);
+
+            void setStatsCapability(
+                    _In_ sai_object_id_t switchId,
+                    _In_ sai_object_type_t objectType,
+                    _In_ sai_status_t status,
+                    _In_ const sai_stat_capability_list_t& statsCapability);
+
+        public: // object type availability
+
+            bool getObjectTypeAvailability(
+                    _In_ sai_object_id_t switchId,
+                    _In_ sai_object_type_t objectType,
+                    _In_ uint32_t attrCount,
+                    _In_ const sai_attribute_t *attrList,
+                    _Out_ uint64_t& count);
+
+            void setObjectTypeAvailability(
+                    _In_ sai_object_id_t switchId,
+                    _In_ sai_object_type_t objectType,
+                    _In_ uint32_t attrCount,
+                    _In_ const sai_attribute_t *attrList,
+                    _In_ uint64_t count);
+
+            /**
+             * @brief Invalidate all cached availabilities.
+             *
+             * Must be called when object is created or removed.
+             */
+            void invalidateObjectTypeAvailability();
+
+        private:
+
+            static bool isCacheableStatus(
+                    _In_ sai_status_t status);
+
+            static std::string getAttrKey(
+                    _In_ const char* query,
+                    _In_ sai_object_id_t switchId,
+                    _In_ sai_object_type_t objectType,
+                    _In_ sai_attr_id_t attrId);
+
+            bool getCapability(
+                    _In_ const std::string& key,
+                    _Out_ sai_status_t& status,
+                    _Out_ std::string& payload);
+
+            void setCapability(
+                    _In_ const std::string& key,
+                    _In_ sai_status_t status,
+                    _In_ const std::string& payload);
+
+        private:
+
+            std::mutex m_mutex;
+
+            bool m_enabled;
+
+            uint64_t m_availabilityTtlMs;
+
+            /**
+             * @brief Capabilities, key is "switch|query|attribute", value is
+             * "status|payload".
+             */
+            std::map<std::string, std::string> m_capabilities;
+
+            typedef struct _Availability
+            {
+                uint64_t count;
+
+                std::chrono::steady_clock::time_point time;
+
+            } Availability;
+
+            std::map<std::string, Availability> m_availabilities;
+
+            std::string m_fileName;
+
+            std::ofstream m_file;
+    };
+}
@@ -1,15 +1,20 @@
 #include "Channel.h"
 
 #include "sairedis.h"
+#include "sairediscommon.h"
 
 #include "swss/logger.h"
 
 using namespace sairedis;
 
+constexpr uint64_t Channel::NO_CORRELATION_ID;
+
 Channel::Channel(
         _In_ Callback callback):
     m_callback(callback),
-    m_responseTimeoutMs(SAI_REDIS_DEFAULT_SYNC_OPERATION_RESPONSE_TIMEOUT)
+    m_responseTimeoutMs(SAI_REDIS_DEFAULT_SYNC_OPERATION_RESPONSE_TIMEOUT),
+    m_requestCorrelationId(NO_CORRELATION_ID),
+    m_responseCorrelationId(NO_CORRELATION_ID)
 {
     SWSS_LOG_ENTER();
 
@@ -37,3 +42,64 @@ uint64_t Channel::getResponseTimeout() const
 
     return m_responseTimeoutMs;
 }
+
+uint64_t Channel::getRequestCorrelationId() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_requestCorrelationId;
+}
+
+uint64_t Channel::getResponseCorrelationId() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_responseCorrelationId;
+}
+
+bool Channel::isPipelined() const
+{
+    SWSS_LOG_ENTER();
+
+    return false;
+}
+
+bool Channel::isFullDuplex() const
+{
+    SWSS_LOG_ENTER();
+
+    return false;
+}
+
+uint64_t Channel::nextCorrelationId()
+{
+    SWSS_LOG_ENTER();
+
+    return ++m_requestCorrelationId;
+}
+
+void Channel::pushCorrelationId(
+        _Inout_ std::vector<swss::FieldValueTuple>& values,
+        _In_ uint64_t correlationId)
+{
+    SWSS_LOG_ENTER();
+
+    values.emplace_back(REDIS_CORRELATION_ID_FIELD, std::to_string(correlationId));
+}
+
+uint64_t Channel::popCorrelationId(
+        _Inout_ std::vector<swss::FieldValueTuple>& values)
+{
+    SWSS_LOG_ENTER();
+
+    if (values.empty() || fvField(values.back()) != REDIS_CORRELATION_ID_FIELD)
+    {
+        return NO_CORRELATION_ID;
+    }
+
+    uint64_t correlationId = std::stoull(fvValue(values.back()));
+
+    values.pop_back();
+
+    return correlationId;
+}
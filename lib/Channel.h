@@ -12,6 +12,7 @@ extern "C" {
 
 #include <memory>
 #include <functional>
+#include <atomic>
 
 namespace sairedis
 {
@@ -30,11 +31,44 @@ namespace sairedis
 
         public:
 
-            void setResponseTimeout(
+            virtual void setResponseTimeout(
                     _In_ uint64_t responseTimeout);
 
             uint64_t getResponseTimeout() const;
 
+            /**
+             * @brief Get correlation id of last request sent by set or del.
+             *
+             * Ids are assigned locally in send order starting from 1, so
+             * they can be used to match responses in send order even if
+             * channel is not carrying them.
+             */
+            uint64_t getRequestCorrelationId() const;
+
+            /**
+             * @brief Get correlation id carried by last response received by
+             * wait, or NO_CORRELATION_ID if channel is not carrying ids.
+             */
+            uint64_t getResponseCorrelationId() const;
+
+            /**
+             * @brief Whether multiple requests can be in flight.
+             *
+             * If not, response to request must be received before next
+             * request is sent on this channel.
+             */
+            virtual bool isPipelined() const;
+
+            /**
+             * @brief Whether requests can be sent while other thread waits
+             * for response.
+             *
+             * Responses must carry correlation ids, since they are received
+             * by whichever thread is waiting. Wait is not checking response
+             * command then, caller must check it against matched request.
+             */
+            virtual bool isFullDuplex() const;
+
         public:
 
             virtual void setBuffered(
@@ -59,12 +93,38 @@ namespace sairedis
 
             virtual void notificationThreadFunction() = 0;
 
+            uint64_t nextCorrelationId();
+
+            /**
+             * @brief Append correlation id to message values.
+             */
+            static void pushCorrelationId(
+                    _Inout_ std::vector<swss::FieldValueTuple>& values,
+                    _In_ uint64_t correlationId);
+
+            /**
+             * @brief Remove correlation id from message values.
+             *
+             * @return Correlation id or NO_CORRELATION_ID if values are not
+             * carrying it.
+             */
+            static uint64_t popCorrelationId(
+                    _Inout_ std::vector<swss::FieldValueTuple>& values);
+
+        public:
+
+            static constexpr uint64_t NO_CORRELATION_ID = 0;
+
         protected:
 
             Callback m_callback;
 
             uint64_t m_responseTimeoutMs;
 
+            std::atomic<uint64_t> m_requestCorrelationId;
+
+            uint64_t m_responseCorrelationId;
+
         protected: // notification
 
             /**
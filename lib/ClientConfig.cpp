@@ -12,7 +12,8 @@ using namespace sairedis;
 
 ClientConfig::ClientConfig():
     m_zmqEndpoint("ipc:///tmp/saiServer"),
-    m_zmqNtfEndpoint("ipc:///tmp/saiServerNtf")
+    m_zmqNtfEndpoint("ipc:///tmp/saiServerNtf"),
+    m_zmqRouter(false)
 {
     SWSS_LOG_ENTER();
 
@@ -57,9 +58,14 @@ std::shared_ptr<ClientConfig> ClientConfig::loadFromFile(
         cc->m_zmqEndpoint = j["zmq_endpoint"];
         cc->m_zmqNtfEndpoint = j["zmq_ntf_endpoint"];
 
-        SWSS_LOG_NOTICE("client config: %s, %s",
+        cc->m_zmqRouter = j.value("zmq_router", false);
+        cc->m_zmqIdentity = j.value("zmq_identity", "");
+
+        SWSS_LOG_NOTICE("client config: %s, %s, router: %s, identity: '%s'",
                 cc->m_zmqEndpoint.c_str(),
-                cc->m_zmqNtfEndpoint.c_str());
+                cc->m_zmqNtfEndpoint.c_str(),
+                (cc->m_zmqRouter ? "true" : "false"),
+                cc->m_zmqIdentity.c_str());
 
         SWSS_LOG_NOTICE("loaded %s client config", path);
 
@@ -25,5 +25,16 @@ namespace sairedis
             std::string m_zmqEndpoint;
 
             std::string m_zmqNtfEndpoint;
+
+            /**
+             * @brief Connect to multi client server over ROUTER socket.
+             */
+            bool m_zmqRouter;
+
+            /**
+             * @brief Client identity used by multi client server, if empty
+             * it will be generated.
+             */
+            std::string m_zmqIdentity;
     };
 }
@@ -2,6 +2,7 @@
 #include "SaiInternal.h"
 #include "RedisRemoteSaiInterface.h"
 #include "ZeroMQChannel.h"
+#include "ZeroMQBinaryChannel.h"
 #include "Utils.h"
 #include "sairediscommon.h"
 #include "ClientConfig.h"
@@ -81,10 +82,21 @@ sai_status_t ClientSai::apiInitialize(
 
     auto cc = ClientConfig::loadFromFile(clientConfig);
 
-    m_communicationChannel = std::make_shared<ZeroMQChannel>(
-            cc->m_zmqEndpoint,
-            cc->m_zmqNtfEndpoint,
-            std::bind(&ClientSai::handleNotification, this, _1, _2, _3));
+    if (cc->m_zmqRouter)
+    {
+        m_communicationChannel = std::make_shared<ZeroMQBinaryChannel>(
+                cc->m_zmqEndpoint,
+                cc->m_zmqNtfEndpoint,
+                std::bind(&ClientSai::handleNotification, this, _1, _2, _3),
+                cc->m_zmqIdentity);
+    }
+    else
+    {
+        m_communicationChannel = std::make_shared<ZeroMQChannel>(
+                cc->m_zmqEndpoint,
+                cc->m_zmqNtfEndpoint,
+                std::bind(&ClientSai::handleNotification, this, _1, _2, _3));
+    }
 
     m_apiInitialized = true;
 
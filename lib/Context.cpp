@@ -13,7 +13,9 @@ Context::Context(
         _In_ std::function<sai_switch_notifications_t(std::shared_ptr<Notification>, Context*)> notificationCallback):
     m_contextConfig(contextConfig),
     m_recorder(recorder),
-    m_notificationCallback(notificationCallback)
+    m_notificationCallback(notificationCallback),
+    m_apiMutex(std::make_shared<std::mutex>()),
+    m_metaMutex(std::make_shared<std::mutex>())
 {
     SWSS_LOG_ENTER();
 
@@ -26,6 +28,10 @@ Context::Context(
     m_meta = std::make_shared<saimeta::Meta>(m_redisSai);
 
     m_redisSai->setMeta(m_meta);
+
+    m_redisSai->setApiMutex(m_apiMutex);
+
+    m_redisSai->setMetaMutex(m_metaMutex);
 }
 
 Context::~Context()
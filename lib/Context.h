@@ -6,6 +6,8 @@
 #include "meta/Notification.h"
 #include "meta/Meta.h"
 
+#include <mutex>
+
 namespace sairedis
 {
     class Context
@@ -42,5 +44,28 @@ namespace sairedis
             std::shared_ptr<RedisRemoteSaiInterface> m_redisSai;
 
             std::function<sai_switch_notifications_t(std::shared_ptr<Notification>, Context*)> m_notificationCallback;
+
+            /**
+             * @brief Serializes API calls on this context.
+             *
+             * Held for whole call, except while waiting for syncd response of
+             * read only request (get, stats, capability and availability
+             * queries) on full duplex channel (ZMQ v2, shared memory), where
+             * responses are matched by correlation id. Then other calls on
+             * this context, writes included, can send requests in the
+             * meantime. On other channels, responses are matched in send
+             * order, so calls on one context are executed one after another.
+             * Calls on different contexts are independent.
+             */
+            std::shared_ptr<std::mutex> m_apiMutex;
+
+            /**
+             * @brief Protects meta database of this context.
+             *
+             * Acquired after API mutex by API calls, and alone by notification
+             * thread. Released by RedisRemoteSaiInterface while waiting for
+             * response of read only request.
+             */
+            std::shared_ptr<std::mutex> m_metaMutex;
     };
 }
@@ -46,6 +46,12 @@ namespace sairedis
 
             std::string m_zmqNtfEndpoint;
 
+            /**
+             * @brief Unix socket path used by shared memory channel to pass
+             * shared memory and eventfd descriptors.
+             */
+            std::string m_shmEndpoint;
+
             std::shared_ptr<SwitchConfigContainer> m_scc;
     };
 }
@@ -127,10 +127,18 @@ std::shared_ptr<ContextConfigContainer> ContextConfigContainer::loadFromFile(
             cc->m_zmqEndpoint = item["zmq_endpoint"];
             cc->m_zmqNtfEndpoint = item["zmq_ntf_endpoint"];
 
-            SWSS_LOG_NOTICE("contextConfig zmq enable %s, endpoint: %s, ntf endpoint: %s",
+            // optional, only used in shm communication mode
+
+            if (item.find("shm_endpoint") != item.end())
+            {
+                cc->m_shmEndpoint = item["shm_endpoint"];
+            }
+
+            SWSS_LOG_NOTICE("contextConfig zmq enable %s, endpoint: %s, ntf endpoint: %s, shm endpoint: %s",
                     (cc->m_zmqEnable) ? "true" : "false",
                     cc->m_zmqEndpoint.c_str(),
-                    cc->m_zmqNtfEndpoint.c_str());
+                    cc->m_zmqNtfEndpoint.c_str(),
+                    cc->m_shmEndpoint.c_str());
 
             for (size_t k = 0; k < item["switches"].size(); k++)
             {
@@ -0,0 +1,312 @@
+#include "FlightRecorder.h"
+
+#include "swss/logger.h"
+
+#include <algorithm>
+#include <vector>
+
+#include <zlib.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <string.h>
+#include <errno.h>
+
+using namespace sairedis;
+
+constexpr size_t FlightRecorder::CHUNK_SIZE;
+
+static bool write_all(
+        _In_ int fd,
+        _In_ const char* data,
+        _In_ size_t size)
+{
+    SWSS_LOG_ENTER();
+
+    while (size)
+    {
+        ssize_t written = write(fd, data, size);
+
+        if (written < 0 && errno == EINTR)
+        {
+            continue;
+        }
+
+        if (written < 0)
+        {
+            return false;
+        }
+
+        data += written;
+        size -= (size_t)written;
+    }
+
+    return true;
+}
+
+FlightRecorder::FlightRecorder(
+        _In_ size_t capacity):
+    m_capacity(capacity),
+    m_compressedSize(0),
+    m_pendingSize(0),
+    m_compressingSize(0),
+    m_droppedChunks(0),
+    m_runThread(true)
+{
+    SWSS_LOG_ENTER();
+
+    if (capacity == 0)
+    {
+        SWSS_LOG_THROW("flight recorder capacity can't be zero");
+    }
+
+    // small capacity would be used only by current chunk
+
+    m_chunkSize = std::max<size_t>(1, std::min(CHUNK_SIZE, capacity / 4));
+
+    m_current.reserve(m_chunkSize);
+
+    m_thread = std::make_shared<std::thread>(&FlightRecorder::compressionThread, this);
+}
+
+FlightRecorder::~FlightRecorder()
+{
+    SWSS_LOG_ENTER();
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        m_runThread = false;
+    }
+
+    m_cv.notify_all();
+
+    m_thread->join();
+}
+
+void FlightRecorder::record(
+        _In_ const std::string& record)
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_current += record;
+
+    if (m_current.size() >= m_chunkSize)
+    {
+        queueCurrent();
+    }
+}
+
+void FlightRecorder::queueCurrent()
+{
+    SWSS_LOG_ENTER();
+
+    m_pendingSize += m_current.size();
+
+    m_pending.push_back(std::move(m_current));
+
+    m_current.clear();
+    m_current.reserve(m_chunkSize);
+
+    dropOverCapacity();
+
+    m_cv.notify_all();
+}
+
+void FlightRecorder::dropOverCapacity()
+{
+    SWSS_LOG_ENTER();
+
+    // leave space for current chunk, chunk being compressed can't be dropped
+
+    while (m_compressedSize + m_pendingSize + m_compressingSize + m_chunkSize > m_capacity)
+    {
+        if (m_chunks.size())
+        {
+            m_compressedSize -= m_chunks.front().data.size();
+
+            m_chunks.pop_front();
+        }
+        else if (m_pending.size())
+        {
+            // compression can't keep up, drop uncompressed chunk
+
+            m_pendingSize -= m_pending.front().size();
+
+            m_pending.pop_front();
+        }
+        else
+        {
+            break;
+        }
+
+        m_droppedChunks++;
+    }
+}
+
+void FlightRecorder::compressionThread()
+{
+    SWSS_LOG_ENTER();
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    while (true)
+    {
+        m_cv.wait(lock, [this] { return !m_runThread || m_pending.size(); });
+
+        if (!m_runThread)
+        {
+            break;
+        }
+
+        std::string raw = std::move(m_pending.front());
+
+        m_pending.pop_front();
+
+        m_pendingSize -= raw.size();
+
+        m_compressingSize = raw.size();
+
+        lock.unlock();
+
+        Chunk chunk;
+
+        chunk.size = raw.size();
+
+        uLongf size = compressBound((uLong)raw.size());
+
+        chunk.data.resize(size);
+
+        // fastest level, records are very repetitive so ratio is still good
+
+        int rc = compress2((Bytef*)&chunk.data[0], &size, (const Bytef*)raw.data(), (uLong)raw.size(), Z_BEST_SPEED);
+
+        lock.lock();
+
+        m_compressingSize = 0;
+
+        if (rc != Z_OK)
+        {
+            SWSS_LOG_ERROR("failed to compress %zu bytes chunk: %d, chunk DROPPED", chunk.size, rc);
+
+            m_droppedChunks++;
+        }
+        else
+        {
+            chunk.data.resize(size);
+            chunk.data.shrink_to_fit();
+
+            m_compressedSize += chunk.data.size();
+
+            m_chunks.push_back(std::move(chunk));
+
+            dropOverCapacity();
+        }
+
+        // wake up dump waiting for compression
+
+        m_cv.notify_all();
+    }
+}
+
+bool FlightRecorder::dump(
+        _In_ const std::string& fileName)
+{
+    SWSS_LOG_ENTER();
+
+    std::deque<Chunk> chunks;
+
+    std::string current;
+
+    {
+        // copy compressed data, so records are not blocked while we
+        // decompress and write
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        m_cv.wait(lock, [this] { return m_pending.empty() && m_compressingSize == 0; });
+
+        chunks = m_chunks;
+
+        current = m_current;
+    }
+
+    int fd = open(fileName.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0666);
+
+    if (fd < 0)
+    {
+        SWSS_LOG_ERROR("failed to open %s: %s", fileName.c_str(), strerror(errno));
+
+        return false;
+    }
+
+    std::vector<char> buffer;
+
+    bool success = true;
+
+    for (const auto& chunk: chunks)
+    {
+        buffer.resize(chunk.size);
+
+        uLongf size = (uLongf)chunk.size;
+
+        int rc = uncompress((Bytef*)buffer.data(), &size, (const Bytef*)chunk.data.data(), (uLong)chunk.data.size());
+
+        if (rc != Z_OK || size != chunk.size)
+        {
+            SWSS_LOG_ERROR("failed to uncompress chunk: %d, chunk SKIPPED", rc);
+            continue;
+        }
+
+        if (!write_all(fd, buffer.data(), buffer.size()))
+        {
+            success = false;
+            break;
+        }
+    }
+
+    if (success)
+    {
+        success = write_all(fd, current.data(), current.size());
+    }
+
+    if (!success)
+    {
+        SWSS_LOG_ERROR("failed to write %s: %s", fileName.c_str(), strerror(errno));
+    }
+
+    if (fsync(fd) != 0)
+    {
+        SWSS_LOG_ERROR("failed to sync %s: %s", fileName.c_str(), strerror(errno));
+    }
+
+    close(fd);
+
+    return success;
+}
+
+size_t FlightRecorder::getCapacity() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_capacity;
+}
+
+size_t FlightRecorder::getMemoryUsage()
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_compressedSize + m_pendingSize + m_compressingSize + m_current.size();
+}
+
+uint64_t FlightRecorder::getDroppedChunkCount()
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_droppedChunks;
+}
@@ -0,0 +1,139 @@
+#pragma once
+
+#include "swss/sal.h"
+
+#include <string>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <memory>
+#include <condition_variable>
+
+namespace sairedis
+{
+    /**
+     * @brief Keeps most recent records in compressed memory ring.
+     *
+     * Records are appended to uncompressed chunk, and when chunk is full it
+     * is handed to compression thread, which compresses it and adds it to
+     * ring, so caller is not blocked by compression. When compressed chunks
+     * together with chunks waiting for compression and current chunk exceed
+     * capacity, oldest chunks are dropped, so memory usage is bounded by
+     * capacity.
+     *
+     * Records are written to disk only when dump is requested.
+     *
+     * This class is thread safe.
+     */
+    class FlightRecorder
+    {
+        public:
+
+            FlightRecorder(
+                    _In_ size_t capacity);
+
+            virtual ~FlightRecorder();
+
+        public:
+
+            /**
+             * @brief Append record, record must include line terminator.
+             */
+            void record(
+                    _In_ const std::string& record);
+
+            /**
+             * @brief Write all kept records to file, oldest first.
+             *
+             * Existing file is overwritten. Records are kept, so they can be
+             * dumped again.
+             *
+             * Waits until all full chunks are compressed.
+             *
+             * @return True on success.
+             */
+            bool dump(
+                    _In_ const std::string& fileName);
+
+            size_t getCapacity() const;
+
+            /**
+             * @brief Get memory used by compressed chunks, chunks waiting
+             * for compression and current chunk.
+             */
+            size_t getMemoryUsage();
+
+            /**
+             * @brief Get number of chunks dropped since capacity was reached.
+             */
+            uint64_t getDroppedChunkCount();
+
+        public:
+
+            /**
+             * @brief Maximum size of uncompressed chunk.
+             */
+            static constexpr size_t CHUNK_SIZE = 64 * 1024;
+
+        private:
+
+            typedef struct _Chunk
+            {
+                std::string data;
+
+                size_t size;
+
+            } Chunk;
+
+            /**
+             * @brief Hand current chunk to compression thread.
+             *
+             * Mutex must be held.
+             */
+            void queueCurrent();
+
+            /**
+             * @brief Drop oldest chunks over capacity, compressed first.
+             *
+             * Mutex must be held.
+             */
+            void dropOverCapacity();
+
+            void compressionThread();
+
+        private:
+
+            std::mutex m_mutex;
+
+            std::condition_variable m_cv;
+
+            size_t m_capacity;
+
+            size_t m_chunkSize;
+
+            std::string m_current;
+
+            std::deque<Chunk> m_chunks;
+
+            size_t m_compressedSize;
+
+            /**
+             * @brief Full chunks waiting for compression, oldest first.
+             */
+            std::deque<std::string> m_pending;
+
+            size_t m_pendingSize;
+
+            /**
+             * @brief Size of chunk which is being compressed, 0 when
+             * compression thread is idle.
+             */
+            size_t m_compressingSize;
+
+            uint64_t m_droppedChunks;
+
+            bool m_runThread;
+
+            std::shared_ptr<std::thread> m_thread;
+    };
+}
@@ -6,11 +6,12 @@
 #include "meta/SaiInterface.h"
 
 #include <unistd.h>
+#include <fcntl.h>
+#include <sys/stat.h>
 #include <inttypes.h>
 
 #include <cstring>
 #include <vector>
-#include <fstream>
 
 using namespace sairedis;
 using namespace saimeta;
@@ -22,6 +23,7 @@ std::vector<swss::FieldValueTuple> serialize_counter_id_list(
 
 #define MUTEX() std::lock_guard<std::mutex> _lock(m_mutex)
 #define DEFAULT_RECORDING_FILE_NAME "sairedis.rec"
+#define BINARY_RECORDING_FILE_SUFFIX ".bin"
 Recorder::Recorder()
 {
     SWSS_LOG_ENTER();
@@ -35,12 +37,28 @@ Recorder::Recorder()
     m_enabled = false;
 
     m_recordStats = true;
+
+    m_fd = -1;
+
+    m_asyncBufferSize = 0;
+
+    m_droppedRecords = 0;
+
+    m_reportedDroppedRecords = 0;
+
+    m_runAsyncThread = false;
+
+    m_dirty = false;
+
+    m_flightRecorderEnabled = false;
 }
 
 Recorder::~Recorder()
 {
     SWSS_LOG_ENTER();
 
+    stopAsyncWriter();
+
     stopRecording();
 }
 
@@ -163,22 +181,441 @@ void Recorder::enableRecording(
     }
 }
 
+bool Recorder::isRecording() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_enabled || m_flightRecorderEnabled;
+}
+
 void Recorder::recordLine(
         _In_ const std::string& line)
 {
+    SWSS_LOG_ENTER();
+
+    std::shared_ptr<FlightRecorder> flightRecorder;
+
+    {
+        std::lock_guard<std::mutex> lock(m_asyncMutex);
+
+        flightRecorder = m_flightRecorder;
+    }
+
+    if (!m_enabled && !flightRecorder)
+    {
+        return;
+    }
+
+    std::string record = getTimestamp() + "|" + line + "\n";
+
+    if (flightRecorder)
+    {
+        // flight recorder keeps records even when recording to file is off
+
+        flightRecorder->record(record);
+    }
+
+    if (!m_enabled)
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_asyncMutex);
+
+        if (m_asyncBufferSize)
+        {
+            if (m_pending.size() + record.size() > m_asyncBufferSize)
+            {
+                // never block caller on slow disk
+
+                m_droppedRecords++;
+                return;
+            }
+
+            bool notify = m_pending.empty();
+
+            m_pending += record;
+
+            if (notify)
+            {
+                m_asyncCv.notify_one();
+            }
+
+            return;
+        }
+    }
+
     MUTEX();
 
+    writeRecord(record);
+}
+
+void Recorder::writeRecord(
+        _In_ const std::string& record)
+{
     SWSS_LOG_ENTER();
 
-    if (!m_enabled)
+    if (m_fd < 0)
+    {
+        return;
+    }
+
+    if (!m_binaryEncoder)
+    {
+        writeData(record.data(), record.size());
+        return;
+    }
+
+    m_binaryBuffer.clear();
+
+    size_t start = 0;
+
+    while (start < record.size())
+    {
+        size_t end = record.find('\n', start);
+
+        if (end == std::string::npos)
+        {
+            end = record.size();
+        }
+
+        try
+        {
+            m_binaryEncoder->encode(record.data() + start, end - start, m_binaryBuffer);
+        }
+        catch (const std::exception& e)
+        {
+            SWSS_LOG_ERROR("failed to encode record, record DROPPED: %s", e.what());
+        }
+
+        start = end + 1;
+    }
+
+    writeData(m_binaryBuffer.data(), m_binaryBuffer.size());
+}
+
+void Recorder::writeData(
+        _In_ const char* data,
+        _In_ size_t size)
+{
+    SWSS_LOG_ENTER();
+
+    while (size)
+    {
+        ssize_t written = write(m_fd, data, size);
+
+        if (written < 0 && errno == EINTR)
+        {
+            continue;
+        }
+
+        if (written < 0)
+        {
+            SWSS_LOG_ERROR("failed to write recording file %s: %s", m_recordingFile.c_str(), strerror(errno));
+            return;
+        }
+
+        data += written;
+        size -= (size_t)written;
+    }
+}
+
+void Recorder::writePending()
+{
+    SWSS_LOG_ENTER();
+
+    // buffers are swapped, so both keep their capacity
+
+    m_writeBuffer.clear();
+
+    uint64_t dropped;
+
+    {
+        std::lock_guard<std::mutex> lock(m_asyncMutex);
+
+        m_writeBuffer.swap(m_pending);
+
+        dropped = m_droppedRecords - m_reportedDroppedRecords;
+
+        m_reportedDroppedRecords = m_droppedRecords;
+    }
+
+    if (dropped)
+    {
+        m_writeBuffer += getTimestamp() + "|#|dropped " + std::to_string(dropped) + " records, recording buffer full\n";
+    }
+
+    if (m_writeBuffer.empty())
+    {
+        return;
+    }
+
+    writeRecord(m_writeBuffer);
+
+    m_dirty = true;
+}
+
+void Recorder::syncFile(
+        _In_ bool force)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_fd < 0 || !m_dirty)
+    {
+        return;
+    }
+
+    auto now = std::chrono::steady_clock::now();
+
+    if (!force && now - m_lastSync < std::chrono::milliseconds(ASYNC_SYNC_INTERVAL_MS))
+    {
+        return;
+    }
+
+    if (fdatasync(m_fd) != 0)
+    {
+        SWSS_LOG_ERROR("failed to sync recording file %s: %s", m_recordingFile.c_str(), strerror(errno));
+    }
+
+    m_dirty = false;
+
+    m_lastSync = now;
+}
+
+void Recorder::closeFile()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_fd >= 0)
+    {
+        close(m_fd);
+
+        m_fd = -1;
+    }
+
+    m_dirty = false;
+}
+
+void Recorder::setAsyncBufferSize(
+        _In_ size_t bufferSize)
+{
+    SWSS_LOG_ENTER();
+
+    stopAsyncWriter();
+
+    {
+        MUTEX();
+
+        {
+            std::lock_guard<std::mutex> lock(m_asyncMutex);
+
+            m_asyncBufferSize = bufferSize;
+        }
+
+        // records buffered so far must be written before any synchronous
+        // record
+
+        writePending();
+
+        syncFile(true);
+    }
+
+    SWSS_LOG_NOTICE("recording buffer size set to %zu bytes", bufferSize);
+
+    if (bufferSize)
+    {
+        startAsyncWriter();
+    }
+}
+
+uint64_t Recorder::getDroppedRecordCount()
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_asyncMutex);
+
+    return m_droppedRecords;
+}
+
+bool Recorder::setRecordingFormat(
+        _In_ sai_redis_recording_format_t format)
+{
+    SWSS_LOG_ENTER();
+
+    switch (format)
+    {
+        case SAI_REDIS_RECORDING_FORMAT_TEXT:
+        case SAI_REDIS_RECORDING_FORMAT_BINARY:
+            break;
+
+        default:
+
+            SWSS_LOG_ERROR("unknown recording format: %d", format);
+
+            return false;
+    }
+
+    stopRecording();
+
+    {
+        MUTEX();
+
+        m_binaryEncoder = (format == SAI_REDIS_RECORDING_FORMAT_BINARY) ? std::make_shared<BinaryRecordingEncoder>() : nullptr;
+    }
+
+    SWSS_LOG_NOTICE("recording format set to %s", format == SAI_REDIS_RECORDING_FORMAT_BINARY ? "binary" : "text");
+
+    if (m_enabled)
+    {
+        startRecording();
+    }
+
+    return true;
+}
+
+void Recorder::setFlightRecorderSize(
+        _In_ size_t size)
+{
+    SWSS_LOG_ENTER();
+
+    auto flightRecorder = size ? std::make_shared<FlightRecorder>(size) : nullptr;
+
+    {
+        std::lock_guard<std::mutex> lock(m_asyncMutex);
+
+        if (m_flightRecorder && size == m_flightRecorder->getCapacity())
+        {
+            return;
+        }
+
+        // previous records are released
+
+        m_flightRecorder = flightRecorder;
+
+        m_flightRecorderEnabled = (flightRecorder != nullptr);
+    }
+
+    SWSS_LOG_NOTICE("flight recorder size set to %zu bytes", size);
+}
+
+bool Recorder::dumpFlightRecorder(
+        _In_ const std::string& reason)
+{
+    SWSS_LOG_ENTER();
+
+    std::shared_ptr<FlightRecorder> flightRecorder;
+
+    {
+        std::lock_guard<std::mutex> lock(m_asyncMutex);
+
+        flightRecorder = m_flightRecorder;
+    }
+
+    if (!flightRecorder)
+    {
+        SWSS_LOG_INFO("flight recorder is disabled, nothing to dump (%s)", reason.c_str());
+
+        return false;
+    }
+
+    flightRecorder->record(getTimestamp() + "|#|flight recorder dump: " + reason + "\n");
+
+    time_t now = time(nullptr);
+
+    struct tm tm;
+
+    localtime_r(&now, &tm);
+
+    char buffer[32];
+
+    strftime(buffer, sizeof(buffer), "%Y%m%d.%H%M%S", &tm);
+
+    std::string fileName;
+
+    {
+        MUTEX();
+
+        fileName = m_recordingOutputDirectory + "/" + m_recordingFileName + ".flight." + buffer;
+    }
+
+    SWSS_LOG_NOTICE("dumping flight recorder to %s: %s", fileName.c_str(), reason.c_str());
+
+    return flightRecorder->dump(fileName);
+}
+
+void Recorder::startAsyncWriter()
+{
+    SWSS_LOG_ENTER();
+
+    m_runAsyncThread = true;
+
+    m_asyncThread = std::make_shared<std::thread>(&Recorder::asyncWriterThread, this);
+}
+
+void Recorder::stopAsyncWriter()
+{
+    SWSS_LOG_ENTER();
+
+    if (!m_asyncThread)
     {
         return;
     }
 
-    if (m_ofstream.is_open())
     {
-        m_ofstream << getTimestamp() << "|" << line << std::endl;
+        std::lock_guard<std::mutex> lock(m_asyncMutex);
+
+        m_runAsyncThread = false;
+    }
+
+    m_asyncCv.notify_all();
+
+    m_asyncThread->join();
+
+    m_asyncThread = nullptr;
+
+    MUTEX();
+
+    writePending();
+
+    syncFile(true);
+}
+
+void Recorder::asyncWriterThread()
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_NOTICE("begin");
+
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_asyncMutex);
+
+            if (m_runAsyncThread && m_pending.empty() && m_droppedRecords == m_reportedDroppedRecords)
+            {
+                // wake up at least once per sync interval, so written
+                // records are synced even if no new records arrive
+
+                m_asyncCv.wait_for(lock, std::chrono::milliseconds(ASYNC_SYNC_INTERVAL_MS));
+            }
+
+            if (!m_runAsyncThread)
+            {
+                break;
+            }
+        }
+
+        // records arriving while we write are collected into next batch
+
+        MUTEX();
+
+        writePending();
+
+        syncFile(false);
     }
+
+    SWSS_LOG_NOTICE("end");
 }
 
 void Recorder::requestLogRotate()
@@ -198,7 +635,13 @@ void Recorder::recordingFileReopen()
 
     SWSS_LOG_ENTER();
 
-    m_ofstream.close();
+    // records buffered before rotate belong to old file
+
+    writePending();
+
+    syncFile(true);
+
+    closeFile();
 
     /*
      * On log rotate we will use the same file name, we are assuming that
@@ -206,30 +649,55 @@ void Recorder::recordingFileReopen()
      * empty file here.
      */
 
+    openFile();
+}
+
+void Recorder::openFile()
+{
+    SWSS_LOG_ENTER();
+
     m_recordingFile = m_recordingOutputDirectory + "/" + m_recordingFileName;
 
-    m_ofstream.open(m_recordingFile, std::ofstream::out | std::ofstream::app);
+    if (m_binaryEncoder)
+    {
+        // formats are not mixed in one file
 
-    if (!m_ofstream.is_open())
+        m_recordingFile += BINARY_RECORDING_FILE_SUFFIX;
+    }
+
+    m_fd = open(m_recordingFile.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0666);
+
+    if (m_fd < 0)
     {
         SWSS_LOG_ERROR("failed to open recording file %s: %s", m_recordingFile.c_str(), strerror(errno));
         return;
     }
+
+    if (m_binaryEncoder)
+    {
+        struct stat st;
+
+        bool empty = fstat(m_fd, &st) == 0 && st.st_size == 0;
+
+        m_binaryBuffer.clear();
+
+        m_binaryEncoder->begin(empty, m_binaryBuffer);
+
+        writeData(m_binaryBuffer.data(), m_binaryBuffer.size());
+    }
 }
 
 void Recorder::startRecording()
 {
     SWSS_LOG_ENTER();
 
-    m_recordingFile = m_recordingOutputDirectory + "/" + m_recordingFileName;
-
     {
         MUTEX();
-        m_ofstream.open(m_recordingFile, std::ofstream::out | std::ofstream::app);
 
-        if (!m_ofstream.is_open())
+        openFile();
+
+        if (m_fd < 0)
         {
-            SWSS_LOG_ERROR("failed to open recording file %s: %s", m_recordingFile.c_str(), strerror(errno));
             return;
         }
     }
@@ -247,9 +715,13 @@ void Recorder::stopRecording()
 
     SWSS_LOG_NOTICE("stopped recording");
 
-    if (m_ofstream.is_open())
+    writePending();
+
+    syncFile(true);
+
+    if (m_fd >= 0)
     {
-        m_ofstream.close();
+        closeFile();
 
         SWSS_LOG_NOTICE("closed recording file: %s", m_recordingFileName.c_str());
     }
@@ -259,17 +731,32 @@ std::string Recorder::getTimestamp()
 {
     SWSS_LOG_ENTER();
 
-    char buffer[64];
+    // date and time part changes once per second, so it is formatted only
+    // when second changes, which avoids localtime_r on every record
+
+    static thread_local time_t lastSecond = (time_t)-1;
+    static thread_local char prefix[32];
+    static thread_local size_t prefixSize = 0;
+
     struct timeval tv;
 
     gettimeofday(&tv, NULL);
 
-    struct tm now;
-    localtime_r(&tv.tv_sec, &now);
+    if (tv.tv_sec != lastSecond)
+    {
+        struct tm now;
+        localtime_r(&tv.tv_sec, &now);
+
+        prefixSize = strftime(prefix, sizeof(prefix), "%Y-%m-%d.%T.", &now);
+
+        lastSecond = tv.tv_sec;
+    }
+
+    char buffer[64];
 
-    size_t size = strftime(buffer, 32, "%Y-%m-%d.%T.", &now);
+    memcpy(buffer, prefix, prefixSize);
 
-    snprintf(&buffer[size], 32, "%06ld", tv.tv_usec);
+    snprintf(&buffer[prefixSize], 32, "%06ld", tv.tv_usec);
 
     return std::string(buffer);
 }
@@ -283,6 +770,9 @@ void Recorder::recordFlushFdbEntries(
 {
     SWSS_LOG_ENTER();
 
+    if (!isRecording())
+        return;
+
     std::vector<swss::FieldValueTuple> entry = SaiAttributeList::serialize_attr_list(
             SAI_OBJECT_TYPE_FDB_FLUSH,
             attrCount,
@@ -305,6 +795,9 @@ void Recorder::recordFlushFdbEntries(
 {
     SWSS_LOG_ENTER();
 
+    if (!isRecording())
+        return;
+
     recordLine("f|" + key + "|" + Globals::joinFieldValues(arguments));
 }
 
@@ -313,6 +806,9 @@ void Recorder::recordFlushFdbEntriesResponse(
 {
     SWSS_LOG_ENTER();
 
+    if (!isRecording())
+        return;
+
     recordLine("F|" + sai_serialize_status(status));
 }
 
@@ -322,16 +818,23 @@ void Recorder::recordQueryAttributeCapability(
 {
     SWSS_LOG_ENTER();
 
+    if (!isRecording())
+        return;
+
     recordLine("q|attribute_capability|" + key + "|" + Globals::joinFieldValues(arguments));
 }
 
 void Recorder::recordQueryAttributeCapabilityResponse(
         _In_ sai_status_t status,
-        _In_ const std::vector<swss::FieldValueTuple>& arguments)
+        _In_ const std::vector<swss::FieldValueTuple>& arguments,
+        _In_ bool cached)
 {
     SWSS_LOG_ENTER();
 
-    recordLine("Q|attribute_capability|" + sai_serialize_status(status) + "|" + Globals::joinFieldValues(arguments));
+    if (!isRecording())
+        return;
+
+    recordLine(std::string("Q|attribute_capability") + (cached ? "_cached|" : "|") + sai_serialize_status(status) + "|" + Globals::joinFieldValues(arguments));
 }
 
 void Recorder::recordQueryAttributeEnumValuesCapability(
@@ -340,16 +843,23 @@ void Recorder::recordQueryAttributeEnumValuesCapability(
 {
     SWSS_LOG_ENTER();
 
+    if (!isRecording())
+        return;
+
     recordLine("q|attribute_enum_values_capability|" + key + "|" + Globals::joinFieldValues(arguments));
 }
 
 void Recorder::recordQueryAttributeEnumValuesCapabilityResponse(
         _In_ sai_status_t status,
-        _In_ const std::vector<swss::FieldValueTuple>& arguments)
+        _In_ const std::vector<swss::FieldValueTuple>& arguments,
+        _In_ bool cached)
 {
     SWSS_LOG_ENTER();
 
-    recordLine("Q|attribute_enum_values_capability|" + sai_serialize_status(status) + "|" + Globals::joinFieldValues(arguments));
+    if (!isRecording())
+        return;
+
+    recordLine(std::string("Q|attribute_enum_values_capability") + (cached ? "_cached|" : "|") + sai_serialize_status(status) + "|" + Globals::joinFieldValues(arguments));
 }
 
 void Recorder::recordObjectTypeGetAvailability(
@@ -358,16 +868,48 @@ void Recorder::recordObjectTypeGetAvailability(
 {
     SWSS_LOG_ENTER();
 
+    if (!isRecording())
+        return;
+
     recordLine("q|object_type_get_availability|" + key + "|" + Globals::joinFieldValues(arguments));
 }
 
 void Recorder::recordObjectTypeGetAvailabilityResponse(
         _In_ sai_status_t status,
+        _In_ const std::vector<swss::FieldValueTuple>& arguments,
+        _In_ bool cached)
+{
+    SWSS_LOG_ENTER();
+
+    if (!isRecording())
+        return;
+
+    recordLine(std::string("Q|object_type_get_availability") + (cached ? "_cached|" : "|") + sai_serialize_status(status) + "|" + Globals::joinFieldValues(arguments));
+}
+
+void Recorder::recordQueryStatsCapability(
+        _In_ const std::string& key,
         _In_ const std::vector<swss::FieldValueTuple>& arguments)
 {
     SWSS_LOG_ENTER();
 
-    recordLine("Q|object_type_get_availability|" + sai_serialize_status(status) + "|" + Globals::joinFieldValues(arguments));
+    if (!isRecording())
+        return;
+
+    recordLine("q|stats_capability|" + key + "|" + Globals::joinFieldValues(arguments));
+}
+
+void Recorder::recordQueryStatsCapabilityResponse(
+        _In_ sai_status_t status,
+        _In_ const std::vector<swss::FieldValueTuple>& arguments,
+        _In_ bool cached)
+{
+    SWSS_LOG_ENTER();
+
+    if (!isRecording())
+        return;
+
+    recordLine(std::string("Q|stats_capability") + (cached ? "_cached|" : "|") + sai_serialize_status(status) + "|" + Globals::joinFieldValues(arguments));
 }
 
 void Recorder::recordNotifySyncd(
@@ -375,6 +917,9 @@ void Recorder::recordNotifySyncd(
 {
     SWSS_LOG_ENTER();
 
+    if (!isRecording())
+        return;
+
     // lower case 'a' stands for notify syncd request
 
     recordLine("a|" + key);
@@ -385,6 +930,9 @@ void Recorder::recordNotifySyncdResponse(
 {
     SWSS_LOG_ENTER();
 
+    if (!isRecording())
+        return;
+
     // capital 'A' stands for notify syncd response
 
     recordLine("A|" + sai_serialize_status(status));
@@ -396,6 +944,9 @@ void Recorder::recordGenericCreate(
 {
     SWSS_LOG_ENTER();
 
+    if (!isRecording())
+        return;
+
     // lower case 'c' stands for create api
 
     recordLine("c|" + key + "|" + Globals::joinFieldValues(arguments));
@@ -426,18 +977,24 @@ void Recorder::recordBulkGenericCreate(
 {
     SWSS_LOG_ENTER();
 
-    std::string joined;
+    if (!isRecording())
+        return;
+
+    std::string joined = "C|" + objectType;
 
     for (const auto &e: entriesWithStatus)
     {
         // ||obj_id|attr=val|attr=val|status||obj_id|attr=val|attr=val|status
 
-        joined += "||" + fvField(e) + "|" + fvValue(e);
+        joined += "||";
+        joined += fvField(e);
+        joined += '|';
+        joined += fvValue(e);
     }
 
     // capital 'C' stands for bulk CREATE operation.
 
-    recordLine("C|" + objectType + joined);
+    recordLine(joined);
 }
 
 void Recorder::recordBulkGenericCreateResponse(
@@ -457,6 +1014,9 @@ void Recorder::recordGenericRemove(
 {
     SWSS_LOG_ENTER();
 
+    if (!isRecording())
+        return;
+
     auto key = sai_serialize_object_type(objectType) + ":" + sai_serialize_object_id(objectId);
 
     // lower case 'r' stands for REMOVE api
@@ -468,6 +1028,9 @@ void Recorder::recordGenericRemove(
 {
     SWSS_LOG_ENTER();
 
+    if (!isRecording())
+        return;
+
     // lower case 'r' stands for REMOVE api
     recordLine("r|" + key);
 }
@@ -487,7 +1050,10 @@ void Recorder::recordBulkGenericRemove(
 {
     SWSS_LOG_ENTER();
 
-    std::string joined;
+    if (!isRecording())
+        return;
+
+    std::string joined = "R|" + objectType;
 
     // TODO revisit
 
@@ -495,12 +1061,13 @@ void Recorder::recordBulkGenericRemove(
     {
         // ||obj_id||obj_id||...
 
-        joined += "||" + fvField(e);
+        joined += "||";
+        joined += fvField(e);
     }
 
     // capital 'R' stands for bulk REMOVE operation.
 
-    recordLine("R|" + objectType + joined);
+    recordLine(joined);
 }
 
 void Recorder::recordBulkGenericRemoveResponse(
@@ -521,6 +1088,9 @@ void Recorder::recordGenericSet(
 {
     SWSS_LOG_ENTER();
 
+    if (!isRecording())
+        return;
+
     recordSet(objectType, sai_serialize_object_id(objectId), attr);
 }
 
@@ -530,6 +1100,9 @@ void Recorder::recordGenericSet(
 {
     SWSS_LOG_ENTER();
 
+    if (!isRecording())
+        return;
+
     // lower case 's' stands for SET api
 
     recordLine("s|" + key + "|" + Globals::joinFieldValues(arguments));
@@ -550,18 +1123,24 @@ void Recorder::recordBulkGenericSet(
 {
     SWSS_LOG_ENTER();
 
-    std::string joined;
+    if (!isRecording())
+        return;
+
+    std::string joined = "S|" + key;
 
     for (const auto &e: arguments)
     {
         // ||obj_id|attr=val|status||obj_id|attr=val|status
 
-        joined += "||" + fvField(e) + "|" + fvValue(e);
+        joined += "||";
+        joined += fvField(e);
+        joined += '|';
+        joined += fvValue(e);
     }
 
     // capital 'S' stands for bulk SET operation.
 
-    recordLine("S|" + key + joined);
+    recordLine(joined);
 }
 
 void Recorder::recordBulkGenericSetResponse(
@@ -583,6 +1162,9 @@ void Recorder::recordGenericGet(
 {
     SWSS_LOG_ENTER();
 
+    if (!isRecording())
+        return;
+
     recordGet(
             objectType,
             sai_serialize_object_id(objectId),
@@ -596,6 +1178,9 @@ void Recorder::recordGenericGet(
 {
     SWSS_LOG_ENTER();
 
+    if (!isRecording())
+        return;
+
     // lower case 'g' stands for GET api
 
     recordLine("g|" + key + "|" + Globals::joinFieldValues(arguments));
@@ -607,6 +1192,9 @@ void Recorder::recordGenericGetResponse(
 {
     SWSS_LOG_ENTER();
 
+    if (!isRecording())
+        return;
+
     // capital 'G' stands for GET api response
 
     recordLine("G|" + sai_serialize_status(status) + "|" + Globals::joinFieldValues(arguments));
@@ -620,7 +1208,7 @@ void Recorder::recordGenericGetStats(
 {
     SWSS_LOG_ENTER();
 
-    if (!m_recordStats)
+    if (!m_recordStats || !isRecording())
         return;
 
     auto stats_enum = sai_metadata_get_object_type_info(object_type)->statenum;
@@ -642,7 +1230,7 @@ void Recorder::recordGenericGetStats(
 {
     SWSS_LOG_ENTER();
 
-    if (!m_recordStats)
+    if (!m_recordStats || !isRecording())
         return;
 
     recordLine("q|get_stats|" + key + "|" + Globals::joinFieldValues(arguments));
@@ -655,14 +1243,16 @@ void Recorder::recordGenericGetStatsResponse(
 {
     SWSS_LOG_ENTER();
 
-    if (!m_recordStats)
+    if (!m_recordStats || !isRecording())
         return;
 
     std::string joined;
 
     for (uint32_t idx = 0; idx < count; idx ++)
     {
-        joined += "|" + std::to_string(counters[idx]);
+        joined += '|';
+
+        sai_serialize_number(joined, counters[idx]);
     }
 
     recordLine("Q|get_stats|" + sai_serialize_status(status) + joined);
@@ -676,7 +1266,7 @@ void Recorder::recordGenericClearStats(
 {
     SWSS_LOG_ENTER();
 
-    if (!m_recordStats)
+    if (!m_recordStats || !isRecording())
         return;
 
     auto stats_enum = sai_metadata_get_object_type_info(object_type)->statenum;
@@ -697,7 +1287,7 @@ void Recorder::recordGenericClearStats(
 {
     SWSS_LOG_ENTER();
 
-    if (!m_recordStats)
+    if (!m_recordStats || !isRecording())
         return;
 
     recordLine("q|clear_stats|" + key + "|" + Globals::joinFieldValues(arguments));
@@ -708,12 +1298,127 @@ void Recorder::recordGenericClearStatsResponse(
 {
     SWSS_LOG_ENTER();
 
-    if (!m_recordStats)
+    if (!m_recordStats || !isRecording())
         return;
 
     recordLine("Q|clear_stats|" + sai_serialize_status(status));
 }
 
+void Recorder::recordGenericGetStatsExt(
+        _In_ const std::string& key,
+        _In_ const std::vector<swss::FieldValueTuple>& arguments)
+{
+    SWSS_LOG_ENTER();
+
+    if (!m_recordStats || !isRecording())
+        return;
+
+    recordLine("q|get_stats_ext|" + key + "|" + Globals::joinFieldValues(arguments));
+}
+
+void Recorder::recordGenericGetStatsExtResponse(
+        _In_ sai_status_t status,
+        _In_ uint32_t count,
+        _In_ const uint64_t *counters)
+{
+    SWSS_LOG_ENTER();
+
+    if (!m_recordStats || !isRecording())
+        return;
+
+    std::string joined;
+
+    for (uint32_t idx = 0; status == SAI_STATUS_SUCCESS && idx < count; idx ++)
+    {
+        joined += '|';
+
+        sai_serialize_number(joined, counters[idx]);
+    }
+
+    recordLine("Q|get_stats_ext|" + sai_serialize_status(status) + joined);
+}
+
+void Recorder::recordBulkGetStats(
+        _In_ const std::string& key,
+        _In_ const std::vector<swss::FieldValueTuple>& arguments)
+{
+    SWSS_LOG_ENTER();
+
+    if (!m_recordStats || !isRecording())
+        return;
+
+    recordLine("q|bulk_get_stats|" + key + "|" + Globals::joinFieldValues(arguments));
+}
+
+void Recorder::recordBulkGetStatsResponse(
+        _In_ sai_status_t status,
+        _In_ uint32_t objectCount,
+        _In_ const sai_status_t *objectStatuses,
+        _In_ uint32_t numberOfCounters,
+        _In_ const uint64_t *counters)
+{
+    SWSS_LOG_ENTER();
+
+    if (!m_recordStats || !isRecording())
+        return;
+
+    // each object is recorded as status=counter,counter,...
+
+    std::string joined;
+
+    for (uint32_t idx = 0; idx < objectCount; idx++)
+    {
+        joined += '|';
+        joined += sai_serialize_status(objectStatuses[idx]);
+        joined += '=';
+
+        for (uint32_t cnt = 0; objectStatuses[idx] == SAI_STATUS_SUCCESS && cnt < numberOfCounters; cnt++)
+        {
+            if (cnt)
+            {
+                joined += ',';
+            }
+
+            sai_serialize_number(joined, counters[(size_t)idx * numberOfCounters + cnt]);
+        }
+    }
+
+    recordLine("Q|bulk_get_stats|" + sai_serialize_status(status) + joined);
+}
+
+void Recorder::recordBulkClearStats(
+        _In_ const std::string& key,
+        _In_ const std::vector<swss::FieldValueTuple>& arguments)
+{
+    SWSS_LOG_ENTER();
+
+    if (!m_recordStats || !isRecording())
+        return;
+
+    recordLine("q|bulk_clear_stats|" + key + "|" + Globals::joinFieldValues(arguments));
+}
+
+void Recorder::recordBulkClearStatsResponse(
+        _In_ sai_status_t status,
+        _In_ uint32_t objectCount,
+        _In_ const sai_status_t *objectStatuses)
+{
+    SWSS_LOG_ENTER();
+
+    if (!m_recordStats || !isRecording())
+        return;
+
+    std::string joined;
+
+    for (uint32_t idx = 0; idx < objectCount; idx++)
+    {
+        joined += '|';
+        joined += sai_serialize_status(objectStatuses[idx]);
+    }
+
+    recordLine("Q|bulk_clear_stats|" + sai_serialize_status(status) + joined);
+}
+
 void Recorder::recordNotification(
         _In_ const std::string &name,
         _In_ const std::string &serializedNotification,
@@ -721,6 +1426,9 @@ void Recorder::recordNotification(
 {
     SWSS_LOG_ENTER();
 
+    if (!isRecording())
+        return;
+
     recordLine("n|" + name + "|" + serializedNotification + "|" + Globals::joinFieldValues(values));
 }
 
@@ -730,6 +1438,9 @@ void Recorder::recordRemove(
 {
     SWSS_LOG_ENTER();
 
+    if (!isRecording())
+        return;
+
     auto key = sai_serialize_object_type(objectType) + ":" + serializedObjectId;
 
     recordGenericRemove(key);
@@ -743,6 +1454,9 @@ void Recorder::recordGenericCreate(
 {
     SWSS_LOG_ENTER();
 
+    if (!isRecording())
+        return;
+
     recordCreate(
             objectType,
             sai_serialize_object_id(objectId),
@@ -758,6 +1472,9 @@ void Recorder::recordCreate(
 {
     SWSS_LOG_ENTER();
 
+    if (!isRecording())
+        return;
+
     std::vector<swss::FieldValueTuple> entry = SaiAttributeList::serialize_attr_list(
             objectType,
             attr_count,
@@ -789,6 +1506,9 @@ void Recorder::recordSet(
 {
     SWSS_LOG_ENTER();
 
+    if (!isRecording())
+        return;
+
     std::vector<swss::FieldValueTuple> entry = SaiAttributeList::serialize_attr_list(
             objectType,
             1,
@@ -812,6 +1532,9 @@ void Recorder::recordGet(
 {
     SWSS_LOG_ENTER();
 
+    if (!isRecording())
+        return;
+
     std::vector<swss::FieldValueTuple> entry = SaiAttributeList::serialize_attr_list(
             objectType,
             attr_count,
@@ -835,6 +1558,9 @@ void Recorder::recordGenericGetResponse(
 {
     SWSS_LOG_ENTER();
 
+    if (!isRecording())
+        return;
+
     if (status == SAI_STATUS_SUCCESS)
     {
         auto entry = SaiAttributeList::serialize_attr_list(
@@ -869,6 +1595,8 @@ void Recorder::recordRemove(                                            \
         _In_ const sai_ ## ot ## _t* ot)                                \
 {                                                                       \
     SWSS_LOG_ENTER();                                                   \
+    if (!isRecording())                                                 \
+        return;                                                         \
     recordRemove((sai_object_type_t)SAI_OBJECT_TYPE_ ## OT,             \
         sai_serialize_ ## ot(*ot));                                     \
 }
@@ -882,6 +1610,8 @@ void Recorder::recordCreate(
         _In_ const sai_attribute_t *attr_list)                                                  \
 {                                                                                               \
     SWSS_LOG_ENTER();                                                                           \
+    if (!isRecording())                                                                         \
+        return;                                                                                 \
     recordCreate((sai_object_type_t)SAI_OBJECT_TYPE_ ## OT,                                     \
         sai_serialize_ ## ot(*ot), attr_count, attr_list);                                      \
 }
@@ -894,6 +1624,8 @@ void Recorder::recordSet(
         _In_ const sai_attribute_t *attr)                                                       \
 {                                                                                               \
     SWSS_LOG_ENTER();                                                                           \
+    if (!isRecording())                                                                         \
+        return;                                                                                 \
     recordSet((sai_object_type_t)SAI_OBJECT_TYPE_ ## OT,                                        \
         sai_serialize_ ## ot(*ot), attr);                                                       \
 }
@@ -907,6 +1639,8 @@ void Recorder::recordGet(
         _In_ const sai_attribute_t *attr_list)                                                  \
 {                                                                                               \
     SWSS_LOG_ENTER();                                                                           \
+    if (!isRecording())                                                                         \
+        return;                                                                                 \
     recordGet((sai_object_type_t)SAI_OBJECT_TYPE_ ## OT,                                        \
         sai_serialize_ ## ot(*ot), attr_count, attr_list);                                      \
 }
@@ -921,6 +1655,9 @@ void Recorder::recordObjectTypeGetAvailability(
 {
     SWSS_LOG_ENTER();
 
+    if (!isRecording())
+        return;
+
     auto key = sai_serialize_object_type(SAI_OBJECT_TYPE_SWITCH) + ":" + sai_serialize_object_id(switchId);
 
     auto values = SaiAttributeList::serialize_attr_list(
@@ -936,15 +1673,19 @@ void Recorder::recordObjectTypeGetAvailability(
 
 void Recorder::recordObjectTypeGetAvailabilityResponse(
         _In_ sai_status_t status,
-        _In_ const uint64_t *count)
+        _In_ const uint64_t *count,
+        _In_ bool cached)
 {
     SWSS_LOG_ENTER();
 
+    if (!isRecording())
+        return;
+
     std::vector<swss::FieldValueTuple> values;
 
     values.push_back(swss::FieldValueTuple("COUNT", std::to_string(*count)));
 
-    recordObjectTypeGetAvailabilityResponse(status, values);
+    recordObjectTypeGetAvailabilityResponse(status, values, cached);
 }
 
 void Recorder::recordQueryAttributeCapability(
@@ -955,6 +1696,9 @@ void Recorder::recordQueryAttributeCapability(
 {
     SWSS_LOG_ENTER();
 
+    if (!isRecording())
+        return;
+
     auto meta = sai_metadata_get_attr_metadata(objectType, attrId);
 
     if (meta == NULL)
@@ -986,10 +1730,14 @@ void Recorder::recordQueryAttributeCapabilityResponse(
         _In_ sai_status_t status,
         _In_ sai_object_type_t objectType,
         _In_ sai_attr_id_t attrId,
-        _In_ const sai_attr_capability_t* capability)
+        _In_ const sai_attr_capability_t* capability,
+        _In_ bool cached)
 {
     SWSS_LOG_ENTER();
 
+    if (!isRecording())
+        return;
+
     auto meta = sai_metadata_get_attr_metadata(objectType, attrId);
 
     if (meta == NULL)
@@ -1013,7 +1761,7 @@ void Recorder::recordQueryAttributeCapabilityResponse(
         swss::FieldValueTuple("GET_IMP", get_str)
     };
 
-    recordQueryAttributeCapabilityResponse(status, values);
+    recordQueryAttributeCapabilityResponse(status, values, cached);
 }
 
 void Recorder::recordQueryAttributeEnumValuesCapability(
@@ -1024,6 +1772,9 @@ void Recorder::recordQueryAttributeEnumValuesCapability(
 {
     SWSS_LOG_ENTER();
 
+    if (!isRecording())
+        return;
+
     std::vector<swss::FieldValueTuple> values;
 
     auto meta = sai_metadata_get_attr_metadata(objectType, attrId);
@@ -1057,10 +1808,14 @@ void Recorder::recordQueryAttributeEnumValuesCapabilityResponse(
         _In_ sai_status_t status,
         _In_ sai_object_type_t objectType,
         _In_ sai_attr_id_t attrId,
-        _In_ const sai_s32_list_t* enumValuesCapability)
+        _In_ const sai_s32_list_t* enumValuesCapability,
+        _In_ bool cached)
 {
     SWSS_LOG_ENTER();
 
+    if (!isRecording())
+        return;
+
     std::vector<swss::FieldValueTuple> values;
 
     auto meta = sai_metadata_get_attr_metadata(objectType, attrId);
@@ -1090,7 +1845,7 @@ void Recorder::recordQueryAttributeEnumValuesCapabilityResponse(
         values.emplace_back(str_attr_id, str_enum_list);
     }
 
-    recordQueryAttributeEnumValuesCapabilityResponse(status, values);
+    recordQueryAttributeEnumValuesCapabilityResponse(status, values, cached);
 }
 
 void Recorder::recordNotifySyncd(
@@ -1099,6 +1854,9 @@ void Recorder::recordNotifySyncd(
 {
     SWSS_LOG_ENTER();
 
+    if (!isRecording())
+        return;
+
     recordNotifySyncd(sai_serialize(redisNotifySyncd));
 }
 
@@ -1116,6 +1874,9 @@ void Recorder::recordGenericResponse(
 {
     SWSS_LOG_ENTER();
 
+    if (!isRecording())
+        return;
+
     if (status != SAI_STATUS_SUCCESS)
     {
         // record only when response is not success
@@ -1131,6 +1892,9 @@ void Recorder::recordBulkGenericResponse(
 {
     SWSS_LOG_ENTER();
 
+    if (!isRecording())
+        return;
+
     if (status != SAI_STATUS_SUCCESS)
     {
         // record only when response is not success
@@ -1151,5 +1915,8 @@ void Recorder::recordComment(
 {
     SWSS_LOG_ENTER();
 
+    if (!isRecording())
+        return;
+
     recordLine("#|" + comment);
 }
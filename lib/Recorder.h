@@ -7,10 +7,17 @@ extern "C" {
 #include "swss/table.h"
 
 #include "sairedis.h"
+#include "FlightRecorder.h"
+#include "BinaryRecordingEncoder.h"
 
 #include <string>
-#include <fstream>
 #include <vector>
+#include <mutex>
+#include <thread>
+#include <memory>
+#include <chrono>
+#include <atomic>
+#include <condition_variable>
 
 #define SAI_REDIS_RECORDER_DECLARE_RECORD_REMOVE(ot)    \
     void recordRemove(                                  \
@@ -69,6 +76,9 @@ namespace sairedis
             // sai_get_object_count
             // sai_query_attribute_capability
             // sai_query_attribute_enum_values_capability
+            // sai_query_stats_capability
+            // sai_bulk_object_get_stats
+            // sai_bulk_object_clear_stats
             // sai_bulk_get_attribute
             // sai_tam_telemetry_get_data
 
@@ -268,6 +278,35 @@ namespace sairedis
             void recordGenericClearStatsResponse(
                     _In_ sai_status_t status);
 
+            void recordGenericGetStatsExt(
+                    _In_ const std::string& key,
+                    _In_ const std::vector<swss::FieldValueTuple>& arguments);
+
+            void recordGenericGetStatsExtResponse(
+                    _In_ sai_status_t status,
+                    _In_ uint32_t count,
+                    _In_ const uint64_t *counters);
+
+            void recordBulkGetStats(
+                    _In_ const std::string& key,
+                    _In_ const std::vector<swss::FieldValueTuple>& arguments);
+
+            void recordBulkGetStatsResponse(
+                    _In_ sai_status_t status,
+                    _In_ uint32_t objectCount,
+                    _In_ const sai_status_t *objectStatuses,
+                    _In_ uint32_t numberOfCounters,
+                    _In_ const uint64_t *counters);
+
+            void recordBulkClearStats(
+                    _In_ const std::string& key,
+                    _In_ const std::vector<swss::FieldValueTuple>& arguments);
+
+            void recordBulkClearStatsResponse(
+                    _In_ sai_status_t status,
+                    _In_ uint32_t objectCount,
+                    _In_ const sai_status_t *objectStatuses);
+
         public: // SAI bulk API
 
             void recordBulkGenericCreate(
@@ -327,7 +366,8 @@ namespace sairedis
 
             void recordObjectTypeGetAvailabilityResponse(
                     _In_ sai_status_t status,
-                    _In_ const uint64_t *count);
+                    _In_ const uint64_t *count,
+                    _In_ bool cached);
 
             void recordQueryAttributeCapability(
                     _In_ sai_object_id_t switch_id,
@@ -339,7 +379,8 @@ namespace sairedis
                     _In_ sai_status_t status,
                     _In_ sai_object_type_t objectType,
                     _In_ sai_attr_id_t attrId,
-                    _In_ const sai_attr_capability_t* capability);
+                    _In_ const sai_attr_capability_t* capability,
+                    _In_ bool cached);
 
             void recordQueryAttributeEnumValuesCapability(
                     _In_ sai_object_id_t switch_id,
@@ -351,7 +392,8 @@ namespace sairedis
                     _In_ sai_status_t status,
                     _In_ sai_object_type_t objectType,
                     _In_ sai_attr_id_t attrId,
-                    _In_ const sai_s32_list_t* enumValuesCapability);
+                    _In_ const sai_s32_list_t* enumValuesCapability,
+                    _In_ bool cached);
 
             // TODO move to private
             void recordQueryAttributeCapability(
@@ -360,7 +402,8 @@ namespace sairedis
 
             void recordQueryAttributeCapabilityResponse(
                     _In_ sai_status_t status,
-                    _In_ const std::vector<swss::FieldValueTuple>& arguments);
+                    _In_ const std::vector<swss::FieldValueTuple>& arguments,
+                    _In_ bool cached);
 
             void recordQueryAttributeEnumValuesCapability(
                     _In_ const std::string& key,
@@ -368,7 +411,8 @@ namespace sairedis
 
             void recordQueryAttributeEnumValuesCapabilityResponse(
                     _In_ sai_status_t status,
-                    _In_ const std::vector<swss::FieldValueTuple>& arguments);
+                    _In_ const std::vector<swss::FieldValueTuple>& arguments,
+                    _In_ bool cached);
 
             void recordObjectTypeGetAvailability(
                     _In_ const std::string& key,
@@ -376,8 +420,18 @@ namespace sairedis
 
             void recordObjectTypeGetAvailabilityResponse(
                     _In_ sai_status_t status,
+                    _In_ const std::vector<swss::FieldValueTuple>& arguments,
+                    _In_ bool cached);
+
+            void recordQueryStatsCapability(
+                    _In_ const std::string& key,
                     _In_ const std::vector<swss::FieldValueTuple>& arguments);
 
+            void recordQueryStatsCapabilityResponse(
+                    _In_ sai_status_t status,
+                    _In_ const std::vector<swss::FieldValueTuple>& arguments,
+                    _In_ bool cached);
+
         public: // SAI notifications
 
             void recordNotification(
@@ -402,6 +456,14 @@ namespace sairedis
             void enableRecording(
                     _In_ bool enabled);
 
+            /**
+             * @brief Check whether records are kept, either by recording to
+             * file or by flight recorder.
+             *
+             * When false, record functions return before formatting record.
+             */
+            bool isRecording() const;
+
             bool setRecordingOutputDirectory(
                     _In_ const sai_attribute_t &attr);
 
@@ -410,6 +472,56 @@ namespace sairedis
 
             void requestLogRotate();
 
+            /**
+             * @brief Set size of asynchronous recording buffer in bytes.
+             *
+             * When greater than zero, records are formatted on caller thread
+             * and appended to buffer, and background thread writes them to
+             * recording file in batches and syncs file periodically. When
+             * buffer is full, records are dropped and number of dropped
+             * records is written to file once there is space again.
+             *
+             * Zero (default) writes each record synchronously.
+             */
+            void setAsyncBufferSize(
+                    _In_ size_t bufferSize);
+
+            /**
+             * @brief Get number of records dropped since buffer was full.
+             */
+            uint64_t getDroppedRecordCount();
+
+            /**
+             * @brief Set recording file format.
+             *
+             * Binary recording is written to recording file name with
+             * ".bin" suffix, so text and binary records are never mixed in
+             * one file. Recording is restarted when enabled.
+             */
+            bool setRecordingFormat(
+                    _In_ sai_redis_recording_format_t format);
+
+            /**
+             * @brief Set flight recorder size in bytes.
+             *
+             * When greater than zero, last records are also kept in
+             * compressed memory ring of that size, even when recording is
+             * disabled, and written to disk only by dumpFlightRecorder.
+             *
+             * Zero (default) disables flight recorder and releases memory.
+             */
+            void setFlightRecorderSize(
+                    _In_ size_t size);
+
+            /**
+             * @brief Write flight recorder records to
+             * "<output dir>/<recording file>.flight.<timestamp>".
+             *
+             * @return True if records were written.
+             */
+            bool dumpFlightRecorder(
+                    _In_ const std::string& reason);
+
             void recordComment(
                     _In_ const std::string& comment);
 
@@ -454,11 +566,68 @@ namespace sairedis
             void recordLine(
                     _In_ const std::string& line);
 
+            /**
+             * @brief Write record to recording file.
+             *
+             * Mutex must be held.
+             */
+            void writeRecord(
+                    _In_ const std::string& record);
+
+            /**
+             * @brief Write data to recording file.
+             *
+             * Mutex must be held.
+             */
+            void writeData(
+                    _In_ const char* data,
+                    _In_ size_t size);
+
+            /**
+             * @brief Open recording file, in binary format file magic is
+             * written when file is empty.
+             *
+             * Mutex must be held.
+             */
+            void openFile();
+
+            /**
+             * @brief Write all buffered records to recording file.
+             *
+             * Mutex must be held.
+             */
+            void writePending();
+
+            /**
+             * @brief Sync recording file if it was written and sync interval
+             * elapsed, or when forced.
+             *
+             * Mutex must be held.
+             */
+            void syncFile(
+                    _In_ bool force);
+
+            void closeFile();
+
+            void startAsyncWriter();
+
+            void stopAsyncWriter();
+
+            void asyncWriterThread();
+
+        public:
+
+            /**
+             * @brief Interval in which asynchronously written recording file
+             * is synced to disk.
+             */
+            static constexpr uint64_t ASYNC_SYNC_INTERVAL_MS = 1000;
+
         private:
 
             bool m_performLogRotate;
 
-            bool m_enabled;
+            std::atomic<bool> m_enabled;
 
             bool m_recordStats;
 
@@ -468,8 +637,72 @@ namespace sairedis
 
             std::string m_recordingFile;
 
-            std::ofstream m_ofstream;
+            /**
+             * @brief Recording file descriptor, -1 when not open.
+             */
+            int m_fd;
 
+            /**
+             * @brief Protects recording file.
+             */
             std::mutex m_mutex;
+
+        private: // asynchronous recording
+
+            /**
+             * @brief Protects buffered records, never held during file I/O,
+             * so callers don't wait for disk.
+             *
+             * If both are needed, m_mutex must be locked first.
+             */
+            std::mutex m_asyncMutex;
+
+            std::condition_variable m_asyncCv;
+
+            size_t m_asyncBufferSize;
+
+            std::string m_pending;
+
+            /**
+             * @brief Records being written, protected by m_mutex.
+             */
+            std::string m_writeBuffer;
+
+            uint64_t m_droppedRecords;
+
+            uint64_t m_reportedDroppedRecords;
+
+            bool m_runAsyncThread;
+
+            std::shared_ptr<std::thread> m_asyncThread;
+
+            /**
+             * @brief Whether file was written since last sync.
+             */
+            bool m_dirty;
+
+            std::chrono::steady_clock::time_point m_lastSync;
+
+        private: // binary recording
+
+            /**
+             * @brief Encoder when recording in binary format, protected by
+             * m_mutex.
+             */
+            std::shared_ptr<BinaryRecordingEncoder> m_binaryEncoder;
+
+            std::string m_binaryBuffer;
+
+        private: // flight recorder
+
+            /**
+             * @brief Flight recorder, protected by m_asyncMutex.
+             */
+            std::shared_ptr<FlightRecorder> m_flightRecorder;
+
+            /**
+             * @brief Whether flight recorder is set, checked without lock.
+             */
+            std::atomic<bool> m_flightRecorderEnabled;
     };
 }
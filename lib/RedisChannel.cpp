@@ -121,6 +121,11 @@ void RedisChannel::set(
 {
     SWSS_LOG_ENTER();
 
+    // redis will not carry correlation id, since request values are written
+    // to ASIC DB, responses are matched in send order
+
+    nextCorrelationId();
+
     m_asicState->set(key, values, command);
 }
 
@@ -130,9 +135,18 @@ void RedisChannel::del(
 {
     SWSS_LOG_ENTER();
 
+    nextCorrelationId();
+
     m_asicState->del(key, command);
 }
 
+bool RedisChannel::isPipelined() const
+{
+    SWSS_LOG_ENTER();
+
+    return true;
+}
+
 sai_status_t RedisChannel::wait(
         _In_ const std::string& command,
         _Out_ swss::KeyOpFieldsValuesTuple& kco)
@@ -48,6 +48,8 @@ namespace sairedis
                     _In_ const std::string& key,
                     _In_ const std::string& command) override;
 
+            virtual bool isPipelined() const override;
+
             virtual sai_status_t wait(
                     _In_ const std::string& command,
                     _Out_ swss::KeyOpFieldsValuesTuple& kco) override;
@@ -5,6 +5,10 @@
 #include "SkipRecordAttrContainer.h"
 #include "SwitchContainer.h"
 #include "ZeroMQChannel.h"
+#include "ZeroMQBinaryChannel.h"
+#include "SharedMemoryChannel.h"
+#include "BatchingChannel.h"
+#include "WriteCombiningChannel.h"
 
 #include "sairediscommon.h"
 
@@ -14,15 +18,60 @@
 #include "meta/PerformanceIntervalTimer.h"
 #include "meta/Globals.h"
 
+#include "swss/tokenize.h"
+
 #include "config.h"
 
 #include <inttypes.h>
+#include <algorithm>
+#include <fstream>
 
 using namespace sairedis;
 using namespace saimeta;
 using namespace sairediscommon;
 using namespace std::placeholders;
 
+#define CAPABILITY_CACHE_BOOT_ID_FILE "/proc/sys/kernel/random/boot_id"
+
+/**
+ * @brief Releases mutex held by caller for object lifetime.
+ *
+ * Mutex is acquired back on destruction, also when exception is thrown, so
+ * caller lock guard will not unlock mutex which is not owned. When releasing
+ * more mutexes, they must be released in reverse order of acquiring, so they
+ * are acquired back in the same order as by caller.
+ */
+class MutexRelease
+{
+    public:
+
+        MutexRelease(
+                _In_ std::shared_ptr<std::mutex> mutex):
+            m_mutex(mutex)
+        {
+            SWSS_LOG_ENTER();
+
+            if (m_mutex)
+            {
+                m_mutex->unlock();
+            }
+        }
+
+        ~MutexRelease()
+        {
+            SWSS_LOG_ENTER();
+
+            if (m_mutex)
+            {
+                m_mutex->lock();
+            }
+        }
+
+    private:
+
+        std::shared_ptr<std::mutex> m_mutex;
+};
+
 std::vector<swss::FieldValueTuple> serialize_counter_id_list(
         _In_ const sai_enum_metadata_t *stats_enum,
         _In_ uint32_t count,
@@ -71,10 +120,16 @@ sai_status_t RedisRemoteSaiInterface::apiInitialize(
 
     m_skipRecordAttrContainer = std::make_shared<SkipRecordAttrContainer>();
 
+    m_capabilityCache = std::make_shared<CapabilityCache>();
+
     m_asicInitViewMode = false; // default mode is apply mode
     m_useTempView = false;
     m_syncMode = false;
     m_redisCommunicationMode = SAI_REDIS_COMMUNICATION_MODE_REDIS_ASYNC;
+    m_autoBatchSize = 0;
+    m_autoBatchTimeoutUs = SAI_REDIS_DEFAULT_AUTO_BATCH_TIMEOUT;
+
+    m_writeCombiningWindowUs = 0;
 
     if (m_contextConfig->m_zmqEnable)
     {
@@ -269,6 +324,8 @@ sai_status_t RedisRemoteSaiInterface::remove(
 
         // remove switch from container
         m_switchContainer->removeSwitch(objectId);
+
+        m_capabilityCache->removeSwitch(objectId);
     }
 
     return status;
@@ -343,6 +400,8 @@ sai_status_t RedisRemoteSaiInterface::setRedisExtensionAttribute(
 
             SWSS_LOG_WARN("sync mode is depreacated, use communication mode");
 
+            drainCommunicationChannel();
+
             m_syncMode = attr->value.booldata;
 
             if (m_contextConfig->m_zmqEnable)
@@ -359,19 +418,25 @@ sai_status_t RedisRemoteSaiInterface::setRedisExtensionAttribute(
                 m_communicationChannel->setBuffered(false);
             }
 
+            updateChannelDecorators();
+
             return SAI_STATUS_SUCCESS;
 
         case SAI_REDIS_SWITCH_ATTR_REDIS_COMMUNICATION_MODE:
 
             m_redisCommunicationMode = (sai_redis_communication_mode_t)attr->value.s32;
 
-            if (m_contextConfig->m_zmqEnable)
+            if (m_contextConfig->m_zmqEnable &&
+                    m_redisCommunicationMode != SAI_REDIS_COMMUNICATION_MODE_ZMQ_V2_SYNC &&
+                    m_redisCommunicationMode != SAI_REDIS_COMMUNICATION_MODE_SHM_SYNC)
             {
                 SWSS_LOG_NOTICE("zmq enabled via context config");
 
                 m_redisCommunicationMode = SAI_REDIS_COMMUNICATION_MODE_ZMQ_SYNC;
             }
 
+            drainCommunicationChannel();
+
             m_communicationChannel = nullptr;
 
             switch (m_redisCommunicationMode)
@@ -390,6 +455,8 @@ sai_status_t RedisRemoteSaiInterface::setRedisExtensionAttribute(
 
                     m_communicationChannel->setBuffered(true);
 
+                    updateChannelDecorators();
+
                     return SAI_STATUS_SUCCESS;
 
                 case SAI_REDIS_COMMUNICATION_MODE_REDIS_SYNC:
@@ -406,6 +473,8 @@ sai_status_t RedisRemoteSaiInterface::setRedisExtensionAttribute(
 
                     m_communicationChannel->setBuffered(false);
 
+                    updateChannelDecorators();
+
                     return SAI_STATUS_SUCCESS;
 
                 case SAI_REDIS_COMMUNICATION_MODE_ZMQ_SYNC:
@@ -430,6 +499,53 @@ sai_status_t RedisRemoteSaiInterface::setRedisExtensionAttribute(
 
                     m_communicationChannel->setBuffered(false);
 
+                    updateChannelDecorators();
+
+                    return SAI_STATUS_SUCCESS;
+
+                case SAI_REDIS_COMMUNICATION_MODE_ZMQ_V2_SYNC:
+
+                    m_contextConfig->m_zmqEnable = true;
+
+                    m_communicationChannel = std::make_shared<ZeroMQBinaryChannel>(
+                            m_contextConfig->m_zmqEndpoint,
+                            m_contextConfig->m_zmqNtfEndpoint,
+                            std::bind(&RedisRemoteSaiInterface::handleNotification, this, _1, _2, _3));
+
+                    m_communicationChannel->setResponseTimeout(m_responseTimeoutMs);
+
+                    SWSS_LOG_NOTICE("zmq v2 enabled, forcing sync mode");
+
+                    m_syncMode = true;
+
+                    // responses are matched by correlation id and pending
+                    // requests are sent before waiting for response, so
+                    // pipeline can stay enabled in sync mode
+
+                    m_communicationChannel->setBuffered(true);
+
+                    updateChannelDecorators();
+
+                    return SAI_STATUS_SUCCESS;
+
+                case SAI_REDIS_COMMUNICATION_MODE_SHM_SYNC:
+
+                    m_communicationChannel = std::make_shared<SharedMemoryChannel>(
+                            m_contextConfig->m_shmEndpoint,
+                            std::bind(&RedisRemoteSaiInterface::handleNotification, this, _1, _2, _3));
+
+                    m_communicationChannel->setResponseTimeout(m_responseTimeoutMs);
+
+                    SWSS_LOG_NOTICE("shared memory enabled, forcing sync mode");
+
+                    m_syncMode = true;
+
+                    // same as zmq v2, responses are matched by correlation id
+
+                    m_communicationChannel->setBuffered(true);
+
+                    updateChannelDecorators();
+
                     return SAI_STATUS_SUCCESS;
 
                 default:
@@ -441,7 +557,9 @@ sai_status_t RedisRemoteSaiInterface::setRedisExtensionAttribute(
 
         case SAI_REDIS_SWITCH_ATTR_USE_PIPELINE:
 
-            if (m_syncMode)
+            if (m_syncMode &&
+                    m_redisCommunicationMode != SAI_REDIS_COMMUNICATION_MODE_ZMQ_V2_SYNC &&
+                    m_redisCommunicationMode != SAI_REDIS_COMMUNICATION_MODE_SHM_SYNC)
             {
                 SWSS_LOG_WARN("use pipeline is not supported in sync mode");
 
@@ -484,6 +602,106 @@ sai_status_t RedisRemoteSaiInterface::setRedisExtensionAttribute(
             return notifyCounterOperations(objectId,
                                            reinterpret_cast<sai_redis_flex_counter_parameter_t*>(attr->value.ptr));
 
+        case SAI_REDIS_SWITCH_ATTR_BULK_VALIDATION_THREADS:
+
+            return setBulkValidationThreads(attr->value.u32);
+
+        case SAI_REDIS_SWITCH_ATTR_AUTO_BATCH_SIZE:
+
+            m_autoBatchSize = attr->value.u32;
+
+            updateChannelDecorators();
+
+            return SAI_STATUS_SUCCESS;
+
+        case SAI_REDIS_SWITCH_ATTR_AUTO_BATCH_TIMEOUT:
+
+            m_autoBatchTimeoutUs = attr->value.u64;
+
+            updateChannelDecorators();
+
+            return SAI_STATUS_SUCCESS;
+
+        case SAI_REDIS_SWITCH_ATTR_WRITE_COMBINING_WINDOW:
+
+            m_writeCombiningWindowUs = attr->value.u64;
+
+            updateChannelDecorators();
+
+            return SAI_STATUS_SUCCESS;
+
+        case SAI_REDIS_SWITCH_ATTR_VID_LEASE_SIZE:
+
+            m_redisVidIndexGenerator->setLeaseSize(attr->value.u64);
+
+            return SAI_STATUS_SUCCESS;
+
+        case SAI_REDIS_SWITCH_ATTR_RECORDING_BUFFER_SIZE:
+
+            if (m_recorder)
+            {
+                m_recorder->setAsyncBufferSize((size_t)attr->value.u64);
+            }
+
+            return SAI_STATUS_SUCCESS;
+
+        case SAI_REDIS_SWITCH_ATTR_FLIGHT_RECORDER_SIZE:
+
+            if (m_recorder)
+            {
+                m_recorder->setFlightRecorderSize((size_t)attr->value.u64);
+            }
+
+            return SAI_STATUS_SUCCESS;
+
+        case SAI_REDIS_SWITCH_ATTR_FLIGHT_RECORDER_DUMP:
+
+            if (m_recorder && attr->value.booldata)
+            {
+                return m_recorder->dumpFlightRecorder("requested") ? SAI_STATUS_SUCCESS : SAI_STATUS_FAILURE;
+            }
+
+            return SAI_STATUS_SUCCESS;
+
+        case SAI_REDIS_SWITCH_ATTR_RECORDING_FORMAT:
+
+            if (m_recorder)
+            {
+                return m_recorder->setRecordingFormat((sai_redis_recording_format_t)attr->value.s32) ? SAI_STATUS_SUCCESS : SAI_STATUS_FAILURE;
+            }
+
+            return SAI_STATUS_SUCCESS;
+
+        case SAI_REDIS_SWITCH_ATTR_CAPABILITY_CACHE:
+
+            m_capabilityCache->setEnabled(attr->value.booldata);
+
+            return SAI_STATUS_SUCCESS;
+
+        case SAI_REDIS_SWITCH_ATTR_CAPABILITY_CACHE_FILE:
+
+            if (attr->value.s8list.count == 0)
+            {
+                m_capabilityCache->setFile("", "");
+
+                return SAI_STATUS_SUCCESS;
+            }
+
+            if (!isSaiS8ListValidString(attr->value.s8list))
+            {
+                return SAI_STATUS_FAILURE;
+            }
+
+            return m_capabilityCache->setFile(
+                    std::string((const char*)attr->value.s8list.list, attr->value.s8list.count),
+                    getCapabilityCacheVersion()) ? SAI_STATUS_SUCCESS : SAI_STATUS_FAILURE;
+
+        case SAI_REDIS_SWITCH_ATTR_AVAILABILITY_CACHE_TTL:
+
+            m_capabilityCache->setAvailabilityTtl(attr->value.u64);
+
+            return SAI_STATUS_SUCCESS;
+
         default:
             break;
     }
@@ -515,6 +733,22 @@ bool RedisRemoteSaiInterface::isSaiS8ListValidString(
     return false;
 }
 
+std::string RedisRemoteSaiInterface::getCapabilityCacheVersion() const
+{
+    SWSS_LOG_ENTER();
+
+    std::string bootId;
+
+    std::ifstream in(CAPABILITY_CACHE_BOOT_ID_FILE);
+
+    if (!std::getline(in, bootId))
+    {
+        SWSS_LOG_WARN("failed to read boot id from %s", CAPABILITY_CACHE_BOOT_ID_FILE);
+    }
+
+    return SAIREDIS_GIT_REVISION "/" SAI_GIT_REVISION "/" + bootId;
+}
+
 bool RedisRemoteSaiInterface::emplaceStrings(
         _In_ const sai_s8_list_t &field,
         _In_ const sai_s8_list_t &value,
@@ -574,11 +808,10 @@ sai_status_t RedisRemoteSaiInterface::notifyCounterGroupOperations(
 
     m_recorder->recordGenericSet(key, entries);
 
-    m_communicationChannel->set(key,
-                                entries,
-                                (entries.size() != 0) ? REDIS_FLEX_COUNTER_COMMAND_SET_GROUP : REDIS_FLEX_COUNTER_COMMAND_DEL_GROUP);
-
-    return waitForResponse(SAI_COMMON_API_SET);
+    return sendAndWaitForResponse(
+            key,
+            entries,
+            (entries.size() != 0) ? REDIS_FLEX_COUNTER_COMMAND_SET_GROUP : REDIS_FLEX_COUNTER_COMMAND_DEL_GROUP);
 }
 
 sai_status_t RedisRemoteSaiInterface::notifyCounterOperations(
@@ -608,9 +841,8 @@ sai_status_t RedisRemoteSaiInterface::notifyCounterOperations(
     }
 
     m_recorder->recordGenericSet(key, entries);
-    m_communicationChannel->set(key, entries, command);
 
-    return waitForResponse(SAI_COMMON_API_SET);
+    return sendAndWaitForResponse(key, entries, command);
 }
 
 sai_status_t RedisRemoteSaiInterface::set(
@@ -805,6 +1037,17 @@ sai_status_t RedisRemoteSaiInterface::create(
 {
     SWSS_LOG_ENTER();
 
+    return createAsync(object_type, serializedObjectId, attr_count, attr_list).get();
+}
+
+std::future<sai_status_t> RedisRemoteSaiInterface::createAsync(
+        _In_ sai_object_type_t object_type,
+        _In_ const std::string& serializedObjectId,
+        _In_ uint32_t attr_count,
+        _In_ const sai_attribute_t *attr_list)
+{
+    SWSS_LOG_ENTER();
+
     auto entry = SaiAttributeList::serialize_attr_list(
             object_type,
             attr_count,
@@ -820,21 +1063,24 @@ sai_status_t RedisRemoteSaiInterface::create(
         entry.push_back(null);
     }
 
-    auto serializedObjectType = sai_serialize_object_type(object_type);
+    std::string key = sai_serialize_object_type(object_type);
 
-    const std::string key = serializedObjectType + ":" + serializedObjectId;
+    key += ':';
+    key += serializedObjectId;
 
     SWSS_LOG_DEBUG("generic create key: %s, fields: %" PRIu64, key.c_str(), entry.size());
 
     m_recorder->recordGenericCreate(key, entry);
 
-    m_communicationChannel->set(key, entry, REDIS_ASIC_STATE_COMMAND_CREATE);
+    m_capabilityCache->invalidateObjectTypeAvailability();
 
-    auto status = waitForResponse(SAI_COMMON_API_CREATE);
+    // request must be registered in flight before any response is received
 
-    m_recorder->recordGenericCreateResponse(status);
+    std::unique_lock<std::mutex> lock(m_responseMutex);
 
-    return status;
+    m_communicationChannel->set(key, entry, REDIS_ASIC_STATE_COMMAND_CREATE);
+
+    return makeResponseFuture(lock, SAI_COMMON_API_CREATE);
 }
 
 sai_status_t RedisRemoteSaiInterface::remove(
@@ -843,6 +1089,15 @@ sai_status_t RedisRemoteSaiInterface::remove(
 {
     SWSS_LOG_ENTER();
 
+    return removeAsync(objectType, serializedObjectId).get();
+}
+
+std::future<sai_status_t> RedisRemoteSaiInterface::removeAsync(
+        _In_ sai_object_type_t objectType,
+        _In_ const std::string& serializedObjectId)
+{
+    SWSS_LOG_ENTER();
+
     auto serializedObjectType = sai_serialize_object_type(objectType);
 
     const std::string key = serializedObjectType + ":" + serializedObjectId;
@@ -851,13 +1106,15 @@ sai_status_t RedisRemoteSaiInterface::remove(
 
     m_recorder->recordGenericRemove(key);
 
-    m_communicationChannel->del(key, REDIS_ASIC_STATE_COMMAND_REMOVE);
+    m_capabilityCache->invalidateObjectTypeAvailability();
 
-    auto status = waitForResponse(SAI_COMMON_API_REMOVE);
+    // request must be registered in flight before any response is received
 
-    m_recorder->recordGenericRemoveResponse(status);
+    std::unique_lock<std::mutex> lock(m_responseMutex);
 
-    return status;
+    m_communicationChannel->del(key, REDIS_ASIC_STATE_COMMAND_REMOVE);
+
+    return makeResponseFuture(lock, SAI_COMMON_API_REMOVE);
 }
 
 sai_status_t RedisRemoteSaiInterface::set(
@@ -867,137 +1124,529 @@ sai_status_t RedisRemoteSaiInterface::set(
 {
     SWSS_LOG_ENTER();
 
+    return setAsync(objectType, serializedObjectId, attr).get();
+}
+
+std::future<sai_status_t> RedisRemoteSaiInterface::setAsync(
+        _In_ sai_object_type_t objectType,
+        _In_ const std::string &serializedObjectId,
+        _In_ const sai_attribute_t *attr)
+{
+    SWSS_LOG_ENTER();
+
     auto entry = SaiAttributeList::serialize_attr_list(
             objectType,
             1,
             attr,
             false);
 
-    auto serializedObjectType = sai_serialize_object_type(objectType);
+    std::string key = sai_serialize_object_type(objectType);
 
-    std::string key = serializedObjectType + ":" + serializedObjectId;
+    key += ':';
+    key += serializedObjectId;
 
     SWSS_LOG_DEBUG("generic set key: %s, fields: %lu", key.c_str(), entry.size());
 
     m_recorder->recordGenericSet(key, entry);
 
-    m_communicationChannel->set(key, entry, REDIS_ASIC_STATE_COMMAND_SET);
+    // request must be registered in flight before any response is received
 
-    auto status = waitForResponse(SAI_COMMON_API_SET);
+    std::unique_lock<std::mutex> lock(m_responseMutex);
 
-    m_recorder->recordGenericSetResponse(status);
+    m_communicationChannel->set(key, entry, REDIS_ASIC_STATE_COMMAND_SET);
 
-    return status;
+    return makeResponseFuture(lock, SAI_COMMON_API_SET);
 }
 
-sai_status_t RedisRemoteSaiInterface::waitForResponse(
-        _In_ sai_common_api_t api)
+sai_status_t RedisRemoteSaiInterface::sendAndWaitForResponse(
+        _In_ const std::string& key,
+        _In_ const std::vector<swss::FieldValueTuple>& values,
+        _In_ const std::string& command)
 {
     SWSS_LOG_ENTER();
 
-    if (m_syncMode)
-    {
-        swss::KeyOpFieldsValuesTuple kco;
+    // request must be registered in flight before any response is received
 
-        auto status = m_communicationChannel->wait(REDIS_ASIC_STATE_COMMAND_GETRESPONSE, kco);
+    std::unique_lock<std::mutex> lock(m_responseMutex);
 
-        m_recorder->recordGenericResponse(status);
+    m_communicationChannel->set(key, values, command);
 
-        return status;
-    }
+    auto future = makeResponseFuture(lock, SAI_COMMON_API_SET);
 
-    /*
-     * By default sync mode is disabled and all create/set/remove are
-     * considered success operations.
-     */
+    lock.unlock();
 
-    return SAI_STATUS_SUCCESS;
+    return future.get();
 }
 
-sai_status_t RedisRemoteSaiInterface::waitForGetResponse(
-        _In_ sai_object_type_t objectType,
-        _In_ uint32_t attr_count,
-        _Inout_ sai_attribute_t *attr_list)
+RedisRemoteSaiInterface::WaiterToken RedisRemoteSaiInterface::sendRequest(
+        _In_ const std::string& key,
+        _In_ const std::vector<swss::FieldValueTuple>& values,
+        _In_ const std::string& command,
+        _In_ const std::string& responseCommand)
 {
     SWSS_LOG_ENTER();
 
-    swss::KeyOpFieldsValuesTuple kco;
+    // request must be registered in flight before any response is received
 
-    auto status = m_communicationChannel->wait(REDIS_ASIC_STATE_COMMAND_GETRESPONSE, kco);
+    std::lock_guard<std::mutex> lock(m_responseMutex);
 
-    auto &values = kfvFieldsValues(kco);
+    m_communicationChannel->set(key, values, command);
 
-    if (status == SAI_STATUS_SUCCESS)
-    {
-        if (values.size() == 0)
-        {
-            SWSS_LOG_THROW("logic error, get response returned 0 values!, send api response or sync/async issue?");
-        }
+    return addPendingResponse(SAI_COMMON_API_MAX, responseCommand);
+}
 
-        SaiAttributeList list(objectType, values, false);
+RedisRemoteSaiInterface::WaiterToken RedisRemoteSaiInterface::sendBulkRequest(
+        _In_ const std::string& key,
+        _In_ const std::vector<swss::FieldValueTuple>& values,
+        _In_ const std::string& command)
+{
+    SWSS_LOG_ENTER();
 
-        transfer_attributes(objectType, attr_count, list.get_attr_list(), attr_list, false);
-    }
-    else if (status == SAI_STATUS_BUFFER_OVERFLOW)
+    if (m_syncMode)
     {
-        if (values.size() == 0)
-        {
-            SWSS_LOG_THROW("logic error, get response returned 0 values!, send api response or sync/async issue?");
-        }
+        return sendRequest(key, values, command, REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
+    }
 
-        SaiAttributeList list(objectType, values, true);
+    // bulk create/remove/set is answered only in sync mode
 
-        // no need for id fix since this is overflow
-        transfer_attributes(objectType, attr_count, list.get_attr_list(), attr_list, true);
-    }
+    m_communicationChannel->set(key, values, command);
 
-    return status;
+    return nullptr;
 }
 
-sai_status_t RedisRemoteSaiInterface::get(
-        _In_ sai_object_type_t objectType,
-        _In_ const std::string& serializedObjectId,
-        _In_ uint32_t attr_count,
-        _Inout_ sai_attribute_t *attr_list)
+sai_status_t RedisRemoteSaiInterface::waitForRequestResponse(
+        _In_ const WaiterToken& request,
+        _Out_ swss::KeyOpFieldsValuesTuple& kco)
 {
     SWSS_LOG_ENTER();
 
-    /*
-     * Since user may reuse buffers, then oid list buffers maybe not cleared
-     * and contain some garbage, let's clean them so we send all oids as null to
-     * syncd.
-     */
+    std::unique_lock<std::mutex> lock(m_responseMutex);
 
-    Utils::clearOidValues(objectType, attr_count, attr_list);
+    return waitForResponse(lock, *request, kco);
+}
 
-    auto entry = SaiAttributeList::serialize_attr_list(objectType, attr_count, attr_list, false);
+RedisRemoteSaiInterface::WaiterToken RedisRemoteSaiInterface::addPendingResponse(
+        _In_ sai_common_api_t api,
+        _In_ const std::string& responseCommand)
+{
+    SWSS_LOG_ENTER();
 
-    std::string serializedObjectType = sai_serialize_object_type(objectType);
+    dropAbandonedResponses();
 
-    std::string key = serializedObjectType + ":" + serializedObjectId;
+    uint64_t correlationId = m_communicationChannel->getRequestCorrelationId();
 
-    SWSS_LOG_DEBUG("generic get key: %s, fields: %lu", key.c_str(), entry.size());
+    WaiterToken waiter = std::make_shared<uint64_t>(correlationId);
 
-    bool record = !m_skipRecordAttrContainer->canSkipRecording(objectType, attr_count, attr_list);
+    m_pendingResponses.push_back(PendingResponse{correlationId, api, responseCommand, waiter});
 
-    if (record)
-    {
-        m_recorder->recordGenericGet(key, entry);
-    }
+    return waiter;
+}
 
-    // get is special, it will not put data
-    // into asic view, only to message queue
-    m_communicationChannel->set(key, entry, REDIS_ASIC_STATE_COMMAND_GET);
+std::future<sai_status_t> RedisRemoteSaiInterface::makeResponseFuture(
+        _Inout_ std::unique_lock<std::mutex>& lock,
+        _In_ sai_common_api_t api)
+{
+    SWSS_LOG_ENTER();
 
-    auto status = waitForGetResponse(objectType, attr_count, attr_list);
+    std::promise<sai_status_t> promise;
 
-    if (record)
+    if (!m_syncMode)
     {
-        m_recorder->recordGenericGetResponse(status, objectType, attr_count, attr_list);
-    }
+        /*
+         * By default sync mode is disabled and all create/set/remove are
+         * considered success operations.
+         */
 
-    return status;
-}
+        recordResponse(api, SAI_STATUS_SUCCESS);
+
+        promise.set_value(SAI_STATUS_SUCCESS);
+
+        return promise.get_future();
+    }
+
+    WaiterToken waiter = addPendingResponse(api, REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
+
+    if (!m_communicationChannel->isPipelined())
+    {
+        // next request can't be sent before this response is received
+
+        swss::KeyOpFieldsValuesTuple kco;
+
+        promise.set_value(waitForResponse(lock, *waiter, kco));
+
+        return promise.get_future();
+    }
+
+    // waiter is owned by future, response of destroyed future is dropped
+
+    return std::async(std::launch::deferred, [this, waiter]() {
+
+            std::unique_lock<std::mutex> responseLock(m_responseMutex);
+
+            swss::KeyOpFieldsValuesTuple kco;
+
+            return waitForResponse(responseLock, *waiter, kco);
+    });
+}
+
+sai_status_t RedisRemoteSaiInterface::waitForResponse(
+        _Inout_ std::unique_lock<std::mutex>& lock,
+        _In_ uint64_t correlationId,
+        _Out_ swss::KeyOpFieldsValuesTuple& kco)
+{
+    SWSS_LOG_ENTER();
+
+    while (true)
+    {
+        auto it = m_receivedResponses.find(correlationId);
+
+        if (it != m_receivedResponses.end())
+        {
+            auto status = it->second.status;
+
+            kco = std::move(it->second.kco);
+
+            m_receivedResponses.erase(it);
+
+            return status;
+        }
+
+        if (m_pendingResponses.empty())
+        {
+            SWSS_LOG_THROW("logic error, no response for request %" PRIu64 " and no requests in flight",
+                    correlationId);
+        }
+
+        receiveResponse(lock, correlationId);
+    }
+}
+
+void RedisRemoteSaiInterface::receiveResponse(
+        _Inout_ std::unique_lock<std::mutex>& lock,
+        _In_ uint64_t correlationId)
+{
+    SWSS_LOG_ENTER();
+
+    auto channel = m_communicationChannel;
+
+    std::unique_lock<std::mutex> receiveLock(m_receiveMutex, std::defer_lock);
+
+    std::string command = m_pendingResponses.front().command;
+
+    if (channel->isFullDuplex())
+    {
+        // only one thread receives at a time, but response mutex is not held
+        // while waiting, so other threads can send requests in the meantime
+
+        lock.unlock();
+
+        receiveLock.lock();
+
+        lock.lock();
+
+        // other thread could receive awaited response in the meantime
+
+        if (m_pendingResponses.empty() || m_receivedResponses.find(correlationId) != m_receivedResponses.end())
+        {
+            return;
+        }
+
+        lock.unlock();
+    }
+
+    swss::KeyOpFieldsValuesTuple kco;
+
+    auto status = channel->wait(command, kco);
+
+    if (!lock.owns_lock())
+    {
+        lock.lock();
+    }
+
+    if (kfvOp(kco).empty())
+    {
+        // no response at all, since responses arrive in send order, none of
+        // the requests in flight will get one, fail them all
+
+        SWSS_LOG_ERROR("failed to receive response, failing %zu requests in flight", m_pendingResponses.size());
+
+        recordNoResponse(status);
+
+        while (m_pendingResponses.size())
+        {
+            setReceivedResponse(m_pendingResponses.begin(), status, kco);
+        }
+
+        // syncd is most likely gone, keep last operations for post mortem
+
+        m_recorder->dumpFlightRecorder("no response from syncd");
+
+        return;
+    }
+
+    uint64_t responseCorrelationId = channel->getResponseCorrelationId();
+
+    if (responseCorrelationId == Channel::NO_CORRELATION_ID)
+    {
+        // channel is not carrying ids, responses are in send order
+
+        responseCorrelationId = m_pendingResponses.front().correlationId;
+    }
+
+    auto it = std::find_if(m_pendingResponses.begin(), m_pendingResponses.end(),
+            [responseCorrelationId](const PendingResponse& pr) { return pr.correlationId == responseCorrelationId; });
+
+    if (it == m_pendingResponses.end())
+    {
+        SWSS_LOG_WARN("got response for request %" PRIu64 " which is not in flight, ignoring", responseCorrelationId);
+
+        return;
+    }
+
+    if (kfvOp(kco) != it->command)
+    {
+        SWSS_LOG_THROW("got not expected response: %s:%s, expected: %s",
+                kfvKey(kco).c_str(),
+                kfvOp(kco).c_str(),
+                it->command.c_str());
+    }
+
+    if (it->api != SAI_COMMON_API_MAX)
+    {
+        m_recorder->recordGenericResponse(status);
+    }
+
+    setReceivedResponse(it, status, kco);
+}
+
+void RedisRemoteSaiInterface::recordNoResponse(
+        _In_ sai_status_t status)
+{
+    SWSS_LOG_ENTER();
+
+    // responses of requests other than create/remove/set are recorded by
+    // their callers, record once for all of them
+
+    for (const auto& pr: m_pendingResponses)
+    {
+        if (pr.api != SAI_COMMON_API_MAX)
+        {
+            m_recorder->recordGenericResponse(status);
+            break;
+        }
+    }
+}
+
+void RedisRemoteSaiInterface::setReceivedResponse(
+        _In_ const std::deque<PendingResponse>::iterator& it,
+        _In_ sai_status_t status,
+        _In_ const swss::KeyOpFieldsValuesTuple& kco)
+{
+    SWSS_LOG_ENTER();
+
+    recordResponse(it->api, status);
+
+    if (it->waiter.expired())
+    {
+        SWSS_LOG_DEBUG("future of %s request %" PRIu64 " was destroyed, dropping response %s",
+                (it->api == SAI_COMMON_API_MAX) ? it->command.c_str() : sai_serialize_common_api(it->api).c_str(),
+                it->correlationId,
+                sai_serialize_status(status).c_str());
+    }
+    else
+    {
+        m_receivedResponses[it->correlationId] = ReceivedResponse{status, kco, it->waiter};
+    }
+
+    m_pendingResponses.erase(it);
+}
+
+void RedisRemoteSaiInterface::dropAbandonedResponses()
+{
+    SWSS_LOG_ENTER();
+
+    for (auto it = m_receivedResponses.begin(); it != m_receivedResponses.end(); )
+    {
+        if (it->second.waiter.expired())
+        {
+            it = m_receivedResponses.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+void RedisRemoteSaiInterface::recordResponse(
+        _In_ sai_common_api_t api,
+        _In_ sai_status_t status)
+{
+    SWSS_LOG_ENTER();
+
+    switch (api)
+    {
+        case SAI_COMMON_API_CREATE:
+            m_recorder->recordGenericCreateResponse(status);
+            break;
+
+        case SAI_COMMON_API_REMOVE:
+            m_recorder->recordGenericRemoveResponse(status);
+            break;
+
+        case SAI_COMMON_API_SET:
+            m_recorder->recordGenericSetResponse(status);
+            break;
+
+        default:
+            break;
+    }
+}
+
+void RedisRemoteSaiInterface::waitForPendingResponses()
+{
+    SWSS_LOG_ENTER();
+
+    std::unique_lock<std::mutex> lock(m_responseMutex);
+
+    while (m_pendingResponses.size())
+    {
+        receiveResponse(lock, Channel::NO_CORRELATION_ID);
+    }
+}
+
+void RedisRemoteSaiInterface::drainCommunicationChannel()
+{
+    SWSS_LOG_ENTER();
+
+    if (!m_communicationChannel)
+    {
+        return;
+    }
+
+    m_communicationChannel->flush();
+
+    // responses are kept until their futures are resolved
+
+    waitForPendingResponses();
+}
+
+void RedisRemoteSaiInterface::setCommunicationChannel(
+        _In_ std::shared_ptr<Channel> channel)
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_responseMutex);
+
+    m_communicationChannel = channel;
+
+    m_pendingResponses.clear();
+    m_receivedResponses.clear();
+
+    m_syncMode = true;
+}
+
+size_t RedisRemoteSaiInterface::getAsyncResponseCount()
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_responseMutex);
+
+    return m_pendingResponses.size() + m_receivedResponses.size();
+}
+
+sai_status_t RedisRemoteSaiInterface::waitForGetResponse(
+        _In_ const WaiterToken& request,
+        _In_ sai_object_type_t objectType,
+        _In_ uint32_t attr_count,
+        _Inout_ sai_attribute_t *attr_list)
+{
+    SWSS_LOG_ENTER();
+
+    // read only request, let notifications update meta while waiting, and on
+    // full duplex channel also other API calls, response is matched by id
+
+    MutexRelease metaRelease(m_metaMutex);
+
+    MutexRelease apiRelease(m_communicationChannel->isFullDuplex() ? m_apiMutex : nullptr);
+
+    swss::KeyOpFieldsValuesTuple kco;
+
+    auto status = waitForRequestResponse(request, kco);
+
+    auto &values = kfvFieldsValues(kco);
+
+    if (status == SAI_STATUS_SUCCESS)
+    {
+        if (values.size() == 0)
+        {
+            SWSS_LOG_THROW("logic error, get response returned 0 values!, send api response or sync/async issue?");
+        }
+
+        SaiAttributeList list(objectType, values, false);
+
+        transfer_attributes(objectType, attr_count, list.get_attr_list(), attr_list, false);
+    }
+    else if (status == SAI_STATUS_BUFFER_OVERFLOW)
+    {
+        if (values.size() == 0)
+        {
+            SWSS_LOG_THROW("logic error, get response returned 0 values!, send api response or sync/async issue?");
+        }
+
+        SaiAttributeList list(objectType, values, true);
+
+        // no need for id fix since this is overflow
+        transfer_attributes(objectType, attr_count, list.get_attr_list(), attr_list, true);
+    }
+
+    return status;
+}
+
+sai_status_t RedisRemoteSaiInterface::get(
+        _In_ sai_object_type_t objectType,
+        _In_ const std::string& serializedObjectId,
+        _In_ uint32_t attr_count,
+        _Inout_ sai_attribute_t *attr_list)
+{
+    SWSS_LOG_ENTER();
+
+    /*
+     * Since user may reuse buffers, then oid list buffers maybe not cleared
+     * and contain some garbage, let's clean them so we send all oids as null to
+     * syncd.
+     */
+
+    Utils::clearOidValues(objectType, attr_count, attr_list);
+
+    auto entry = SaiAttributeList::serialize_attr_list(objectType, attr_count, attr_list, false);
+
+    std::string serializedObjectType = sai_serialize_object_type(objectType);
+
+    std::string key = serializedObjectType + ":" + serializedObjectId;
+
+    SWSS_LOG_DEBUG("generic get key: %s, fields: %lu", key.c_str(), entry.size());
+
+    bool record = !m_skipRecordAttrContainer->canSkipRecording(objectType, attr_count, attr_list);
+
+    if (record)
+    {
+        m_recorder->recordGenericGet(key, entry);
+    }
+
+    // get is special, it will not put data
+    // into asic view, only to message queue
+    auto request = sendRequest(key, entry, REDIS_ASIC_STATE_COMMAND_GET, REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
+
+    auto status = waitForGetResponse(request, objectType, attr_count, attr_list);
+
+    if (record)
+    {
+        m_recorder->recordGenericGetResponse(status, objectType, attr_count, attr_list);
+    }
+
+    return status;
+}
 
 #define DECLARE_GET_ENTRY(OT,ot)                                \
 sai_status_t RedisRemoteSaiInterface::get(                      \
@@ -1015,13 +1664,14 @@ sai_status_t RedisRemoteSaiInterface::get(                      \
 
 SAIREDIS_DECLARE_EVERY_ENTRY(DECLARE_GET_ENTRY);
 
-sai_status_t RedisRemoteSaiInterface::waitForFlushFdbEntriesResponse()
+sai_status_t RedisRemoteSaiInterface::waitForFlushFdbEntriesResponse(
+        _In_ const WaiterToken& request)
 {
     SWSS_LOG_ENTER();
 
     swss::KeyOpFieldsValuesTuple kco;
 
-    auto status = m_communicationChannel->wait(REDIS_ASIC_STATE_COMMAND_FLUSHRESPONSE, kco);
+    auto status = waitForRequestResponse(request, kco);
 
     return status;
 }
@@ -1049,9 +1699,9 @@ sai_status_t RedisRemoteSaiInterface::flushFdbEntries(
     m_recorder->recordFlushFdbEntries(switchId, attrCount, attrList);
    // TODO m_recorder->recordFlushFdbEntries(key, entry)
 
-    m_communicationChannel->set(key, entry, REDIS_ASIC_STATE_COMMAND_FLUSH);
+    auto request = sendRequest(key, entry, REDIS_ASIC_STATE_COMMAND_FLUSH, REDIS_ASIC_STATE_COMMAND_FLUSHRESPONSE);
 
-    auto status = waitForFlushFdbEntriesResponse();
+    auto status = waitForFlushFdbEntriesResponse(request);
 
     m_recorder->recordFlushFdbEntriesResponse(status);
 
@@ -1083,25 +1733,45 @@ sai_status_t RedisRemoteSaiInterface::objectTypeGetAvailability(
     m_recorder->recordObjectTypeGetAvailability(switchId, objectType, attrCount, attrList);
     // recordObjectTypeGetAvailability(strSwitchId, entry);
 
+    if (m_capabilityCache->getObjectTypeAvailability(switchId, objectType, attrCount, attrList, *count))
+    {
+        m_recorder->recordObjectTypeGetAvailabilityResponse(SAI_STATUS_SUCCESS, count, true);
+
+        return SAI_STATUS_SUCCESS;
+    }
+
     // This query will not put any data into the ASIC view, just into the
     // message queue
-    m_communicationChannel->set(strSwitchId, entry, REDIS_ASIC_STATE_COMMAND_OBJECT_TYPE_GET_AVAILABILITY_QUERY);
+    auto request = sendRequest(strSwitchId, entry, REDIS_ASIC_STATE_COMMAND_OBJECT_TYPE_GET_AVAILABILITY_QUERY, REDIS_ASIC_STATE_COMMAND_OBJECT_TYPE_GET_AVAILABILITY_RESPONSE);
+
+    auto status = waitForObjectTypeGetAvailabilityResponse(request, count);
 
-    auto status = waitForObjectTypeGetAvailabilityResponse(count);
+    if (status == SAI_STATUS_SUCCESS)
+    {
+        m_capabilityCache->setObjectTypeAvailability(switchId, objectType, attrCount, attrList, *count);
+    }
 
-    m_recorder->recordObjectTypeGetAvailabilityResponse(status, count);
+    m_recorder->recordObjectTypeGetAvailabilityResponse(status, count, false);
 
     return status;
 }
 
 sai_status_t RedisRemoteSaiInterface::waitForObjectTypeGetAvailabilityResponse(
+        _In_ const WaiterToken& request,
         _Inout_ uint64_t *count)
 {
     SWSS_LOG_ENTER();
 
+    // read only request, let notifications update meta while waiting, and on
+    // full duplex channel also other API calls, response is matched by id
+
+    MutexRelease metaRelease(m_metaMutex);
+
+    MutexRelease apiRelease(m_communicationChannel->isFullDuplex() ? m_apiMutex : nullptr);
+
     swss::KeyOpFieldsValuesTuple kco;
 
-    auto status = m_communicationChannel->wait(REDIS_ASIC_STATE_COMMAND_OBJECT_TYPE_GET_AVAILABILITY_RESPONSE, kco);
+    auto status = waitForRequestResponse(request, kco);
 
     if (status == SAI_STATUS_SUCCESS)
     {
@@ -1161,23 +1831,42 @@ sai_status_t RedisRemoteSaiInterface::queryAttributeCapability(
 
     m_recorder->recordQueryAttributeCapability(switchId, objectType, attrId, capability);
 
-    m_communicationChannel->set(switchIdStr, entry, REDIS_ASIC_STATE_COMMAND_ATTR_CAPABILITY_QUERY);
+    sai_status_t status;
+
+    if (m_capabilityCache->getAttributeCapability(switchId, objectType, attrId, status, *capability))
+    {
+        m_recorder->recordQueryAttributeCapabilityResponse(status, objectType, attrId, capability, true);
+
+        return status;
+    }
+
+    auto request = sendRequest(switchIdStr, entry, REDIS_ASIC_STATE_COMMAND_ATTR_CAPABILITY_QUERY, REDIS_ASIC_STATE_COMMAND_ATTR_CAPABILITY_RESPONSE);
+
+    status = waitForQueryAttributeCapabilityResponse(request, capability);
 
-    auto status = waitForQueryAttributeCapabilityResponse(capability);
+    m_capabilityCache->setAttributeCapability(switchId, objectType, attrId, status, *capability);
 
-    m_recorder->recordQueryAttributeCapabilityResponse(status, objectType, attrId, capability);
+    m_recorder->recordQueryAttributeCapabilityResponse(status, objectType, attrId, capability, false);
 
     return status;
 }
 
 sai_status_t RedisRemoteSaiInterface::waitForQueryAttributeCapabilityResponse(
+        _In_ const WaiterToken& request,
         _Out_ sai_attr_capability_t* capability)
 {
     SWSS_LOG_ENTER();
 
+    // read only request, let notifications update meta while waiting, and on
+    // full duplex channel also other API calls, response is matched by id
+
+    MutexRelease metaRelease(m_metaMutex);
+
+    MutexRelease apiRelease(m_communicationChannel->isFullDuplex() ? m_apiMutex : nullptr);
+
     swss::KeyOpFieldsValuesTuple kco;
 
-    auto status = m_communicationChannel->wait(REDIS_ASIC_STATE_COMMAND_ATTR_CAPABILITY_RESPONSE, kco);
+    auto status = waitForRequestResponse(request, kco);
 
     if (status == SAI_STATUS_SUCCESS)
     {
@@ -1250,23 +1939,42 @@ sai_status_t RedisRemoteSaiInterface::queryAttributeEnumValuesCapability(
 
     m_recorder->recordQueryAttributeEnumValuesCapability(switchId, objectType, attrId, enumValuesCapability);
 
-    m_communicationChannel->set(switch_id_str, entry, REDIS_ASIC_STATE_COMMAND_ATTR_ENUM_VALUES_CAPABILITY_QUERY);
+    sai_status_t status;
 
-    auto status = waitForQueryAttributeEnumValuesCapabilityResponse(enumValuesCapability);
+    if (m_capabilityCache->getAttributeEnumValuesCapability(switchId, objectType, attrId, status, *enumValuesCapability))
+    {
+        m_recorder->recordQueryAttributeEnumValuesCapabilityResponse(status, objectType, attrId, enumValuesCapability, true);
 
-    m_recorder->recordQueryAttributeEnumValuesCapabilityResponse(status, objectType, attrId, enumValuesCapability);
+        return status;
+    }
+
+    auto request = sendRequest(switch_id_str, entry, REDIS_ASIC_STATE_COMMAND_ATTR_ENUM_VALUES_CAPABILITY_QUERY, REDIS_ASIC_STATE_COMMAND_ATTR_ENUM_VALUES_CAPABILITY_RESPONSE);
+
+    status = waitForQueryAttributeEnumValuesCapabilityResponse(request, enumValuesCapability);
+
+    m_capabilityCache->setAttributeEnumValuesCapability(switchId, objectType, attrId, status, *enumValuesCapability);
+
+    m_recorder->recordQueryAttributeEnumValuesCapabilityResponse(status, objectType, attrId, enumValuesCapability, false);
 
     return status;
 }
 
 sai_status_t RedisRemoteSaiInterface::waitForQueryAttributeEnumValuesCapabilityResponse(
+        _In_ const WaiterToken& request,
         _Inout_ sai_s32_list_t* enumValuesCapability)
 {
     SWSS_LOG_ENTER();
 
+    // read only request, let notifications update meta while waiting, and on
+    // full duplex channel also other API calls, response is matched by id
+
+    MutexRelease metaRelease(m_metaMutex);
+
+    MutexRelease apiRelease(m_communicationChannel->isFullDuplex() ? m_apiMutex : nullptr);
+
     swss::KeyOpFieldsValuesTuple kco;
 
-    auto status = m_communicationChannel->wait(REDIS_ASIC_STATE_COMMAND_ATTR_ENUM_VALUES_CAPABILITY_RESPONSE, kco);
+    auto status = waitForRequestResponse(request, kco);
 
     if (status == SAI_STATUS_SUCCESS)
     {
@@ -1302,17 +2010,203 @@ sai_status_t RedisRemoteSaiInterface::waitForQueryAttributeEnumValuesCapabilityR
                     SWSS_LOG_WARN("Query returned less attributes than expected: expected %d, received %d", num_capabilities, i+1);
                 }
 
-                break;
-            }
+                break;
+            }
+
+            // Skip the commas
+            position++;
+        }
+    }
+    else if (status == SAI_STATUS_BUFFER_OVERFLOW)
+    {
+        const std::vector<swss::FieldValueTuple> &values = kfvFieldsValues(kco);
+
+        if (values.size() != 1)
+        {
+            SWSS_LOG_ERROR("Invalid response from syncd: expected 1 value, received %zu", values.size());
+
+            return SAI_STATUS_FAILURE;
+        }
+
+        const uint32_t num_capabilities = std::stoi(fvValue(values[0]));
+
+        SWSS_LOG_DEBUG("Received payload: count = %u", num_capabilities);
+
+        enumValuesCapability->count = num_capabilities;
+    }
+
+    return status;
+}
+
+sai_status_t RedisRemoteSaiInterface::getStats(
+        _In_ sai_object_type_t object_type,
+        _In_ sai_object_id_t object_id,
+        _In_ uint32_t number_of_counters,
+        _In_ const sai_stat_id_t *counter_ids,
+        _Out_ uint64_t *counters)
+{
+    SWSS_LOG_ENTER();
+
+    auto stats_enum = sai_metadata_get_object_type_info(object_type)->statenum;
+
+    auto entry = serialize_counter_id_list(stats_enum, number_of_counters, counter_ids);
+
+    std::string str_object_type = sai_serialize_object_type(object_type);
+
+    std::string key = str_object_type + ":" + sai_serialize_object_id(object_id);
+
+    SWSS_LOG_DEBUG("generic get stats key: %s, fields: %lu", key.c_str(), entry.size());
+
+    // get_stats will not put data to asic view, only to message queue
+
+    auto request = sendRequest(key, entry, REDIS_ASIC_STATE_COMMAND_GET_STATS, REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
+
+    return waitForGetStatsResponse(request, number_of_counters, counters);
+}
+
+sai_status_t RedisRemoteSaiInterface::queryStatsCapability(
+        _In_ sai_object_id_t switchId,
+        _In_ sai_object_type_t objectType,
+        _Inout_ sai_stat_capability_list_t *stats_capability)
+{
+    SWSS_LOG_ENTER();
+
+    auto switchIdStr = sai_serialize_object_id(switchId);
+    auto objectTypeStr = sai_serialize_object_type(objectType);
+
+    const std::string listSize = std::to_string(stats_capability->count);
+
+    const std::vector<swss::FieldValueTuple> entry =
+    {
+        swss::FieldValueTuple("OBJECT_TYPE", objectTypeStr),
+        swss::FieldValueTuple("LIST_SIZE", listSize)
+    };
+
+    SWSS_LOG_DEBUG(
+            "Query arguments: switch %s, object type: %s, count: %s",
+            switchIdStr.c_str(),
+            objectTypeStr.c_str(),
+            listSize.c_str()
+    );
+
+    // This query will not put any data into the ASIC view, just into the
+    // message queue
+
+    m_recorder->recordQueryStatsCapability(switchIdStr, entry);
+
+    sai_status_t status;
+
+    if (m_capabilityCache->getStatsCapability(switchId, objectType, status, *stats_capability))
+    {
+        m_recorder->recordQueryStatsCapabilityResponse(status, serializeStatsCapability(objectType, status, *stats_capability), true);
+
+        return status;
+    }
+
+    auto request = sendRequest(switchIdStr, entry, REDIS_ASIC_STATE_COMMAND_STATS_CAPABILITY_QUERY, REDIS_ASIC_STATE_COMMAND_STATS_CAPABILITY_RESPONSE);
+
+    status = waitForQueryStatsCapabilityResponse(request, stats_capability);
+
+    m_capabilityCache->setStatsCapability(switchId, objectType, status, *stats_capability);
+
+    m_recorder->recordQueryStatsCapabilityResponse(status, serializeStatsCapability(objectType, status, *stats_capability), false);
+
+    return status;
+}
+
+std::vector<swss::FieldValueTuple> RedisRemoteSaiInterface::serializeStatsCapability(
+        _In_ sai_object_type_t objectType,
+        _In_ sai_status_t status,
+        _In_ const sai_stat_capability_list_t& statsCapability)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<swss::FieldValueTuple> values;
+
+    if (status == SAI_STATUS_SUCCESS)
+    {
+        auto statsEnum = sai_metadata_get_object_type_info(objectType)->statenum;
+
+        std::string stats;
+
+        for (uint32_t idx = 0; idx < statsCapability.count; idx++)
+        {
+            if (idx)
+            {
+                stats += ',';
+            }
+
+            const char* name = statsEnum ? sai_metadata_get_enum_value_name(statsEnum, statsCapability.list[idx].stat_enum) : nullptr;
+
+            stats += name ? name : std::to_string(statsCapability.list[idx].stat_enum);
+            stats += ':';
+            stats += std::to_string(statsCapability.list[idx].stat_modes);
+        }
+
+        values.emplace_back("STATS", stats);
+    }
+
+    if (status == SAI_STATUS_SUCCESS || status == SAI_STATUS_BUFFER_OVERFLOW)
+    {
+        values.emplace_back("STAT_COUNT", std::to_string(statsCapability.count));
+    }
+
+    return values;
+}
+
+sai_status_t RedisRemoteSaiInterface::waitForQueryStatsCapabilityResponse(
+        _In_ const WaiterToken& request,
+        _Inout_ sai_stat_capability_list_t* statsCapability)
+{
+    SWSS_LOG_ENTER();
+
+    // read only request, let notifications update meta while waiting, and on
+    // full duplex channel also other API calls, response is matched by id
+
+    MutexRelease metaRelease(m_metaMutex);
+
+    MutexRelease apiRelease(m_communicationChannel->isFullDuplex() ? m_apiMutex : nullptr);
+
+    swss::KeyOpFieldsValuesTuple kco;
+
+    auto status = waitForRequestResponse(request, kco);
+
+    const std::vector<swss::FieldValueTuple> &values = kfvFieldsValues(kco);
+
+    if (status == SAI_STATUS_SUCCESS)
+    {
+        if (values.size() != 3)
+        {
+            SWSS_LOG_ERROR("Invalid response from syncd: expected 3 values, received %zu", values.size());
+
+            return SAI_STATUS_FAILURE;
+        }
+
+        auto statEnums = swss::tokenize(fvValue(values[0]), ',');
+        auto statModes = swss::tokenize(fvValue(values[1]), ',');
+
+        const uint32_t count = (uint32_t)std::stoul(fvValue(values[2]));
+
+        if (count > statsCapability->count || statEnums.size() < count || statModes.size() < count)
+        {
+            SWSS_LOG_ERROR("Invalid response from syncd: count %u, list size %u, received %zu enums and %zu modes",
+                    count, statsCapability->count, statEnums.size(), statModes.size());
+
+            return SAI_STATUS_FAILURE;
+        }
+
+        statsCapability->count = count;
 
-            // Skip the commas
-            position++;
+        for (uint32_t idx = 0; idx < count; idx++)
+        {
+            statsCapability->list[idx].stat_enum = (sai_stat_id_t)std::stoul(statEnums[idx]);
+            statsCapability->list[idx].stat_modes = (uint32_t)std::stoul(statModes[idx]);
         }
+
+        SWSS_LOG_DEBUG("Received payload: count = %u", count);
     }
     else if (status == SAI_STATUS_BUFFER_OVERFLOW)
     {
-        const std::vector<swss::FieldValueTuple> &values = kfvFieldsValues(kco);
-
         if (values.size() != 1)
         {
             SWSS_LOG_ERROR("Invalid response from syncd: expected 1 value, received %zu", values.size());
@@ -1320,61 +2214,31 @@ sai_status_t RedisRemoteSaiInterface::waitForQueryAttributeEnumValuesCapabilityR
             return SAI_STATUS_FAILURE;
         }
 
-        const uint32_t num_capabilities = std::stoi(fvValue(values[0]));
-
-        SWSS_LOG_DEBUG("Received payload: count = %u", num_capabilities);
+        statsCapability->count = (uint32_t)std::stoul(fvValue(values[0]));
 
-        enumValuesCapability->count = num_capabilities;
+        SWSS_LOG_DEBUG("Received payload: count = %u", statsCapability->count);
     }
 
     return status;
 }
 
-sai_status_t RedisRemoteSaiInterface::getStats(
-        _In_ sai_object_type_t object_type,
-        _In_ sai_object_id_t object_id,
+sai_status_t RedisRemoteSaiInterface::waitForGetStatsResponse(
+        _In_ const WaiterToken& request,
         _In_ uint32_t number_of_counters,
-        _In_ const sai_stat_id_t *counter_ids,
         _Out_ uint64_t *counters)
 {
     SWSS_LOG_ENTER();
 
-    auto stats_enum = sai_metadata_get_object_type_info(object_type)->statenum;
-
-    auto entry = serialize_counter_id_list(stats_enum, number_of_counters, counter_ids);
-
-    std::string str_object_type = sai_serialize_object_type(object_type);
-
-    std::string key = str_object_type + ":" + sai_serialize_object_id(object_id);
-
-    SWSS_LOG_DEBUG("generic get stats key: %s, fields: %lu", key.c_str(), entry.size());
-
-    // get_stats will not put data to asic view, only to message queue
-
-    m_communicationChannel->set(key, entry, REDIS_ASIC_STATE_COMMAND_GET_STATS);
-
-    return waitForGetStatsResponse(number_of_counters, counters);
-}
-
-sai_status_t RedisRemoteSaiInterface::queryStatsCapability(
-        _In_ sai_object_id_t switchId,
-        _In_ sai_object_type_t objectType,
-        _Inout_ sai_stat_capability_list_t *stats_capability)
-{
-    SWSS_LOG_ENTER();
+    // read only request, let notifications update meta while waiting, and on
+    // full duplex channel also other API calls, response is matched by id
 
-    return SAI_STATUS_NOT_IMPLEMENTED;
-}
+    MutexRelease metaRelease(m_metaMutex);
 
-sai_status_t RedisRemoteSaiInterface::waitForGetStatsResponse(
-        _In_ uint32_t number_of_counters,
-        _Out_ uint64_t *counters)
-{
-    SWSS_LOG_ENTER();
+    MutexRelease apiRelease(m_communicationChannel->isFullDuplex() ? m_apiMutex : nullptr);
 
     swss::KeyOpFieldsValuesTuple kco;
 
-    auto status = m_communicationChannel->wait(REDIS_ASIC_STATE_COMMAND_GETRESPONSE, kco);
+    auto status = waitForRequestResponse(request, kco);
 
     if (status == SAI_STATUS_SUCCESS)
     {
@@ -1404,11 +2268,31 @@ sai_status_t RedisRemoteSaiInterface::getStatsExt(
 {
     SWSS_LOG_ENTER();
 
-    SWSS_LOG_ERROR("not implemented");
+    auto stats_enum = sai_metadata_get_object_type_info(object_type)->statenum;
+
+    auto entry = serialize_counter_id_list(stats_enum, number_of_counters, counter_ids);
+
+    // same as get stats, but mode is put as first argument
 
-    // TODO could be the same as getStats but put mode at first argument
+    entry.insert(entry.begin(), swss::FieldValueTuple(REDIS_STATS_MODE_FIELD, sai_serialize_enum(mode, &sai_metadata_enum_sai_stats_mode_t)));
 
-    return SAI_STATUS_NOT_IMPLEMENTED;
+    std::string str_object_type = sai_serialize_object_type(object_type);
+
+    std::string key = str_object_type + ":" + sai_serialize_object_id(object_id);
+
+    SWSS_LOG_DEBUG("generic get stats ext key: %s, fields: %lu", key.c_str(), entry.size());
+
+    m_recorder->recordGenericGetStatsExt(key, entry);
+
+    // get_stats_ext will not put data to asic view, only to message queue
+
+    auto request = sendRequest(key, entry, REDIS_ASIC_STATE_COMMAND_GET_STATS_EXT, REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
+
+    auto status = waitForGetStatsResponse(request, number_of_counters, counters);
+
+    m_recorder->recordGenericGetStatsExtResponse(status, number_of_counters, counters);
+
+    return status;
 }
 
 sai_status_t RedisRemoteSaiInterface::clearStats(
@@ -1433,9 +2317,9 @@ sai_status_t RedisRemoteSaiInterface::clearStats(
 
     m_recorder->recordGenericClearStats(object_type, object_id, number_of_counters, counter_ids);
 
-    m_communicationChannel->set(key, values, REDIS_ASIC_STATE_COMMAND_CLEAR_STATS);
+    auto request = sendRequest(key, values, REDIS_ASIC_STATE_COMMAND_CLEAR_STATS, REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
 
-    auto status = waitForClearStatsResponse();
+    auto status = waitForClearStatsResponse(request);
 
     m_recorder->recordGenericClearStatsResponse(status);
 
@@ -1455,9 +2339,34 @@ sai_status_t RedisRemoteSaiInterface::bulkGetStats(
 {
     SWSS_LOG_ENTER();
 
-    SWSS_LOG_ERROR("not implemented");
+    if (counters == nullptr)
+    {
+        SWSS_LOG_ERROR("counters pointer is null");
+
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
 
-    return SAI_STATUS_NOT_IMPLEMENTED;
+    std::string key;
+    std::vector<swss::FieldValueTuple> entries;
+
+    auto status = serializeBulkStats(switchId, object_type, object_count, object_key, number_of_counters, counter_ids, mode, object_statuses, key, entries);
+
+    if (status != SAI_STATUS_SUCCESS)
+    {
+        return status;
+    }
+
+    m_recorder->recordBulkGetStats(key, entries);
+
+    // all objects are read in single request, stats are not put to asic view
+
+    auto request = sendRequest(key, entries, REDIS_ASIC_STATE_COMMAND_BULK_GET_STATS, REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
+
+    status = waitForBulkStatsResponse(request, object_count, object_statuses, number_of_counters, counters);
+
+    m_recorder->recordBulkGetStatsResponse(status, object_count, object_statuses, number_of_counters, counters);
+
+    return status;
 }
 
 sai_status_t RedisRemoteSaiInterface::bulkClearStats(
@@ -1472,18 +2381,173 @@ sai_status_t RedisRemoteSaiInterface::bulkClearStats(
 {
     SWSS_LOG_ENTER();
 
-    SWSS_LOG_ERROR("not implemented");
+    std::string key;
+    std::vector<swss::FieldValueTuple> entries;
+
+    auto status = serializeBulkStats(switchId, object_type, object_count, object_key, number_of_counters, counter_ids, mode, object_statuses, key, entries);
 
-    return SAI_STATUS_NOT_IMPLEMENTED;
+    if (status != SAI_STATUS_SUCCESS)
+    {
+        return status;
+    }
+
+    m_recorder->recordBulkClearStats(key, entries);
+
+    auto request = sendRequest(key, entries, REDIS_ASIC_STATE_COMMAND_BULK_CLEAR_STATS, REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
+
+    status = waitForBulkStatsResponse(request, object_count, object_statuses, 0, nullptr);
+
+    m_recorder->recordBulkClearStatsResponse(status, object_count, object_statuses);
+
+    return status;
+}
+
+sai_status_t RedisRemoteSaiInterface::serializeBulkStats(
+        _In_ sai_object_id_t switchId,
+        _In_ sai_object_type_t object_type,
+        _In_ uint32_t object_count,
+        _In_ const sai_object_key_t *object_key,
+        _In_ uint32_t number_of_counters,
+        _In_ const sai_stat_id_t *counter_ids,
+        _In_ sai_stats_mode_t mode,
+        _In_ const sai_status_t *object_statuses,
+        _Out_ std::string& key,
+        _Out_ std::vector<swss::FieldValueTuple>& entries)
+{
+    SWSS_LOG_ENTER();
+
+    if (object_count == 0 || object_key == nullptr || object_statuses == nullptr ||
+            number_of_counters == 0 || counter_ids == nullptr)
+    {
+        SWSS_LOG_ERROR("invalid bulk stats arguments, object count %u, number of counters %u", object_count, number_of_counters);
+
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    auto info = sai_metadata_get_object_type_info(object_type);
+
+    if (info == nullptr || info->isnonobjectid || info->statenum == nullptr)
+    {
+        SWSS_LOG_ERROR("bulk stats are not supported on %s", sai_serialize_object_type(object_type).c_str());
+
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    // key: object type and switch, then mode, counter ids and one field per object
+
+    key = sai_serialize_object_type(object_type) + ":" + sai_serialize_object_id(switchId);
+
+    entries.clear();
+
+    entries.reserve(object_count + 2);
+
+    entries.emplace_back(REDIS_STATS_MODE_FIELD, sai_serialize_enum(mode, &sai_metadata_enum_sai_stats_mode_t));
+
+    std::string counters;
+
+    for (uint32_t idx = 0; idx < number_of_counters; idx++)
+    {
+        if (idx)
+        {
+            counters += ',';
+        }
+
+        const char* name = sai_metadata_get_enum_value_name(info->statenum, counter_ids[idx]);
+
+        if (name == NULL)
+        {
+            SWSS_LOG_THROW("failed to find enum %d in %s", counter_ids[idx], info->statenum->name);
+        }
+
+        counters += name;
+    }
+
+    entries.emplace_back(REDIS_STATS_COUNTERS_FIELD, counters);
+
+    for (uint32_t idx = 0; idx < object_count; idx++)
+    {
+        entries.emplace_back(sai_serialize_object_id(object_key[idx].key.object_id), "");
+    }
+
+    SWSS_LOG_DEBUG("bulk stats key: %s, objects: %u, counters: %u", key.c_str(), object_count, number_of_counters);
+
+    return SAI_STATUS_SUCCESS;
+}
+
+sai_status_t RedisRemoteSaiInterface::waitForBulkStatsResponse(
+        _In_ const WaiterToken& request,
+        _In_ uint32_t object_count,
+        _Out_ sai_status_t *object_statuses,
+        _In_ uint32_t number_of_counters,
+        _Out_ uint64_t *counters)
+{
+    SWSS_LOG_ENTER();
+
+    // read only request, let notifications update meta while waiting, and on
+    // full duplex channel also other API calls, response is matched by id
+
+    MutexRelease metaRelease(m_metaMutex);
+
+    MutexRelease apiRelease(m_communicationChannel->isFullDuplex() ? m_apiMutex : nullptr);
+
+    swss::KeyOpFieldsValuesTuple kco;
+
+    auto status = waitForRequestResponse(request, kco);
+
+    auto &values = kfvFieldsValues(kco);
+
+    if (values.size() != object_count)
+    {
+        if (status == SAI_STATUS_SUCCESS)
+        {
+            SWSS_LOG_THROW("wrong number of statuses, got %zu, expected %u", values.size(), object_count);
+        }
+
+        // request failed as whole before any object was processed
+
+        for (uint32_t idx = 0; idx < object_count; idx++)
+        {
+            object_statuses[idx] = status;
+        }
+
+        return status;
+    }
+
+    // each object: status=counter,counter,...
+
+    for (uint32_t idx = 0; idx < object_count; idx++)
+    {
+        sai_deserialize_status(fvField(values[idx]), object_statuses[idx]);
+
+        if (counters == nullptr || object_statuses[idx] != SAI_STATUS_SUCCESS)
+        {
+            continue;
+        }
+
+        auto tokens = swss::tokenize(fvValue(values[idx]), ',');
+
+        if (tokens.size() != number_of_counters)
+        {
+            SWSS_LOG_THROW("wrong number of counters for object %u, got %zu, expected %u", idx, tokens.size(), number_of_counters);
+        }
+
+        for (uint32_t cnt = 0; cnt < number_of_counters; cnt++)
+        {
+            counters[(size_t)idx * number_of_counters + cnt] = std::stoull(tokens[cnt]);
+        }
+    }
+
+    return status;
 }
 
-sai_status_t RedisRemoteSaiInterface::waitForClearStatsResponse()
+sai_status_t RedisRemoteSaiInterface::waitForClearStatsResponse(
+        _In_ const WaiterToken& request)
 {
     SWSS_LOG_ENTER();
 
     swss::KeyOpFieldsValuesTuple kco;
 
-    auto status = m_communicationChannel->wait(REDIS_ASIC_STATE_COMMAND_GETRESPONSE, kco);
+    auto status = waitForRequestResponse(request, kco);
 
     return status;
 }
@@ -1504,13 +2568,11 @@ sai_status_t RedisRemoteSaiInterface::bulkRemove(
 
     std::vector<swss::FieldValueTuple> entries;
 
+    entries.reserve(serialized_object_ids.size());
+
     for (size_t idx = 0; idx < serialized_object_ids.size(); ++idx)
     {
-        std::string str_attr = "";
-
-        swss::FieldValueTuple fvtNoStatus(serialized_object_ids[idx], str_attr);
-
-        entries.push_back(fvtNoStatus);
+        entries.emplace_back(serialized_object_ids[idx], std::string());
     }
 
     /*
@@ -1525,23 +2587,26 @@ sai_status_t RedisRemoteSaiInterface::bulkRemove(
 
     m_recorder->recordBulkGenericRemove(serializedObjectType, entries);
 
-    m_communicationChannel->set(key, entries, REDIS_ASIC_STATE_COMMAND_BULK_REMOVE);
+    m_capabilityCache->invalidateObjectTypeAvailability();
+
+    auto request = sendBulkRequest(key, entries, REDIS_ASIC_STATE_COMMAND_BULK_REMOVE);
 
-    return waitForBulkResponse(SAI_COMMON_API_BULK_REMOVE, (uint32_t)serialized_object_ids.size(), object_statuses);
+    return waitForBulkResponse(request, SAI_COMMON_API_BULK_REMOVE, (uint32_t)serialized_object_ids.size(), object_statuses);
 }
 
 sai_status_t RedisRemoteSaiInterface::waitForBulkResponse(
+        _In_ const WaiterToken& request,
         _In_ sai_common_api_t api,
         _In_ uint32_t object_count,
         _Out_ sai_status_t *object_statuses)
 {
     SWSS_LOG_ENTER();
 
-    if (m_syncMode)
+    if (request)
     {
         swss::KeyOpFieldsValuesTuple kco;
 
-        auto status = m_communicationChannel->wait(REDIS_ASIC_STATE_COMMAND_GETRESPONSE, kco);
+        auto status = waitForRequestResponse(request, kco);
 
         auto &values = kfvFieldsValues(kco);
 
@@ -1627,15 +2692,15 @@ sai_status_t RedisRemoteSaiInterface::bulkSet(
 
     std::vector<swss::FieldValueTuple> entries;
 
+    entries.reserve(serialized_object_ids.size());
+
     for (size_t idx = 0; idx < serialized_object_ids.size(); ++idx)
     {
-        auto entry = SaiAttributeList::serialize_attr_list(object_type, 1, &attr_list[idx], false);
+        std::string str_attr;
 
-        std::string str_attr = Globals::joinFieldValues(entry);
+        SaiAttributeList::serialize_attr_list(str_attr, object_type, 1, &attr_list[idx], false);
 
-        swss::FieldValueTuple value(serialized_object_ids[idx], str_attr);
-
-        entries.push_back(value);
+        entries.emplace_back(serialized_object_ids[idx], std::move(str_attr));
     }
 
     /*
@@ -1649,9 +2714,9 @@ sai_status_t RedisRemoteSaiInterface::bulkSet(
 
     m_recorder->recordBulkGenericSet(serializedObjectType, entries);
 
-    m_communicationChannel->set(key, entries, REDIS_ASIC_STATE_COMMAND_BULK_SET);
+    auto request = sendBulkRequest(key, entries, REDIS_ASIC_STATE_COMMAND_BULK_SET);
 
-    return waitForBulkResponse(SAI_COMMON_API_BULK_SET, (uint32_t)serialized_object_ids.size(), object_statuses);
+    return waitForBulkResponse(request, SAI_COMMON_API_BULK_SET, (uint32_t)serialized_object_ids.size(), object_statuses);
 }
 
 sai_status_t RedisRemoteSaiInterface::bulkGet(
@@ -1698,13 +2763,12 @@ sai_status_t RedisRemoteSaiInterface::bulkCreate(
         }
     }
 
-    std::vector<std::string> serialized_object_ids;
+    std::vector<std::string> serialized_object_ids(object_count);
 
     // on create vid is put in db by syncd
     for (uint32_t idx = 0; idx < object_count; idx++)
     {
-        std::string str_object_id = sai_serialize_object_id(object_id[idx]);
-        serialized_object_ids.push_back(str_object_id);
+        sai_serialize_object_id(serialized_object_ids[idx], object_id[idx]);
     }
 
     return bulkCreate(
@@ -1732,24 +2796,24 @@ sai_status_t RedisRemoteSaiInterface::bulkCreate(
 
     std::vector<swss::FieldValueTuple> entries;
 
+    entries.reserve(serialized_object_ids.size());
+
     for (size_t idx = 0; idx < serialized_object_ids.size(); ++idx)
     {
-        auto entry = SaiAttributeList::serialize_attr_list(object_type, attr_count[idx], attr_list[idx], false);
+        std::string str_attr;
 
-        if (entry.empty())
+        if (attr_count[idx] == 0)
         {
             // make sure that we put object into db
             // even if there are no attributes set
-            swss::FieldValueTuple null("NULL", "NULL");
-
-            entry.push_back(null);
+            str_attr = "NULL=NULL";
+        }
+        else
+        {
+            SaiAttributeList::serialize_attr_list(str_attr, object_type, attr_count[idx], attr_list[idx], false);
         }
 
-        std::string str_attr = Globals::joinFieldValues(entry);
-
-        swss::FieldValueTuple fvtNoStatus(serialized_object_ids[idx] , str_attr);
-
-        entries.push_back(fvtNoStatus);
+        entries.emplace_back(serialized_object_ids[idx], std::move(str_attr));
     }
 
     /*
@@ -1764,9 +2828,11 @@ sai_status_t RedisRemoteSaiInterface::bulkCreate(
 
     m_recorder->recordBulkGenericCreate(str_object_type, entries);
 
-    m_communicationChannel->set(key, entries, REDIS_ASIC_STATE_COMMAND_BULK_CREATE);
+    m_capabilityCache->invalidateObjectTypeAvailability();
 
-    return waitForBulkResponse(SAI_COMMON_API_BULK_CREATE, (uint32_t)serialized_object_ids.size(), object_statuses);
+    auto request = sendBulkRequest(key, entries, REDIS_ASIC_STATE_COMMAND_BULK_CREATE);
+
+    return waitForBulkResponse(request, SAI_COMMON_API_BULK_CREATE, (uint32_t)serialized_object_ids.size(), object_statuses);
 }
 
 sai_status_t RedisRemoteSaiInterface::notifySyncd(
@@ -1793,22 +2859,23 @@ sai_status_t RedisRemoteSaiInterface::notifySyncd(
 
     m_recorder->recordNotifySyncd(switchId, redisNotifySyncd);
 
-    m_communicationChannel->set(key, entry, REDIS_ASIC_STATE_COMMAND_NOTIFY);
+    auto request = sendRequest(key, entry, REDIS_ASIC_STATE_COMMAND_NOTIFY, REDIS_ASIC_STATE_COMMAND_NOTIFY);
 
-    auto status = waitForNotifySyncdResponse();
+    auto status = waitForNotifySyncdResponse(request);
 
     m_recorder->recordNotifySyncdResponse(status);
 
     return status;
 }
 
-sai_status_t RedisRemoteSaiInterface::waitForNotifySyncdResponse()
+sai_status_t RedisRemoteSaiInterface::waitForNotifySyncdResponse(
+        _In_ const WaiterToken& request)
 {
     SWSS_LOG_ENTER();
 
     swss::KeyOpFieldsValuesTuple kco;
 
-    auto status = m_communicationChannel->wait(REDIS_ASIC_STATE_COMMAND_NOTIFY, kco);
+    auto status = waitForRequestResponse(request, kco);
 
     return status;
 }
@@ -1852,6 +2919,11 @@ void RedisRemoteSaiInterface::handleNotification(
 
     m_recorder->recordNotification(name, serializedNotification, values);
 
+    if (name == SAI_SWITCH_NOTIFICATION_NAME_SWITCH_SHUTDOWN_REQUEST)
+    {
+        m_recorder->dumpFlightRecorder("switch shutdown request");
+    }
+
     auto notification = NotificationFactory::deserialize(name, serializedNotification);
 
     if (notification)
@@ -2004,6 +3076,79 @@ void RedisRemoteSaiInterface::clear_local_state()
     }
 }
 
+sai_status_t RedisRemoteSaiInterface::setBulkValidationThreads(
+        _In_ uint32_t threads)
+{
+    SWSS_LOG_ENTER();
+
+    auto meta = m_meta.lock();
+
+    if (!meta)
+    {
+        SWSS_LOG_WARN("meta pointer expired");
+
+        return SAI_STATUS_FAILURE;
+    }
+
+    meta->setBulkValidationThreads(threads);
+
+    return SAI_STATUS_SUCCESS;
+}
+
+void RedisRemoteSaiInterface::updateChannelDecorators()
+{
+    SWSS_LOG_ENTER();
+
+    // batching channel matches responses to requests it combined, so it
+    // can't be removed while any of them is in flight
+
+    drainCommunicationChannel();
+
+    // destroying decorator will send its pending operations to underlying
+    // channel, so outer decorator must be removed first
+
+    auto writeCombiningChannel = std::dynamic_pointer_cast<WriteCombiningChannel>(m_communicationChannel);
+
+    if (writeCombiningChannel)
+    {
+        m_communicationChannel = writeCombiningChannel->getChannel();
+
+        writeCombiningChannel = nullptr;
+    }
+
+    auto batchingChannel = std::dynamic_pointer_cast<BatchingChannel>(m_communicationChannel);
+
+    if (batchingChannel)
+    {
+        m_communicationChannel = batchingChannel->getChannel();
+
+        batchingChannel = nullptr;
+    }
+
+    if (m_autoBatchSize > 1)
+    {
+        m_communicationChannel = std::make_shared<BatchingChannel>(
+                m_communicationChannel,
+                m_syncMode,
+                m_autoBatchSize,
+                m_autoBatchTimeoutUs);
+    }
+
+    if (m_writeCombiningWindowUs)
+    {
+        if (m_syncMode)
+        {
+            SWSS_LOG_NOTICE("write combining is not supported in sync mode, ignoring");
+        }
+        else
+        {
+            m_communicationChannel = std::make_shared<WriteCombiningChannel>(
+                    m_communicationChannel,
+                    m_writeCombiningWindowUs);
+        }
+    }
+}
+
 void RedisRemoteSaiInterface::setMeta(
         _In_ std::weak_ptr<saimeta::Meta> meta)
 {
@@ -2012,14 +3157,30 @@ void RedisRemoteSaiInterface::setMeta(
     m_meta = meta;
 }
 
+void RedisRemoteSaiInterface::setMetaMutex(
+        _In_ std::shared_ptr<std::mutex> mutex)
+{
+    SWSS_LOG_ENTER();
+
+    m_metaMutex = mutex;
+}
+
+void RedisRemoteSaiInterface::setApiMutex(
+        _In_ std::shared_ptr<std::mutex> mutex)
+{
+    SWSS_LOG_ENTER();
+
+    m_apiMutex = mutex;
+}
+
 sai_switch_notifications_t RedisRemoteSaiInterface::syncProcessNotification(
         _In_ std::shared_ptr<Notification> notification)
 {
     SWSS_LOG_ENTER();
 
-    // NOTE: process metadata must be executed under sairedis API mutex since
-    // it will access meta database and notification comes from different
-    // thread, and this method is executed from notifications thread
+    // NOTE: process metadata must be executed under meta mutex since it will
+    // access meta database and notification comes from different thread, and
+    // this method is executed from notifications thread
 
     auto meta = m_meta.lock();
 
@@ -9,6 +9,7 @@
 #include "RedisChannel.h"
 #include "SwitchConfigContainer.h"
 #include "ContextConfig.h"
+#include "CapabilityCache.h"
 
 #include "meta/Notification.h"
 
@@ -20,6 +21,9 @@
 #include <memory>
 #include <functional>
 #include <map>
+#include <deque>
+#include <mutex>
+#include <future>
 
 namespace sairedis
 {
@@ -222,11 +226,78 @@ namespace sairedis
             void setMeta(
                     _In_ std::weak_ptr<saimeta::Meta> meta);
 
+            /**
+             * @brief Set mutex protecting meta database.
+             *
+             * Caller must hold this mutex when calling any API. It is
+             * released while waiting for syncd response of read only
+             * requests (get, stats, capability and availability queries), so
+             * notifications can be processed in the meantime.
+             */
+            void setMetaMutex(
+                    _In_ std::shared_ptr<std::mutex> mutex);
+
+            /**
+             * @brief Set mutex serializing API calls.
+             *
+             * Caller must hold this mutex when calling any API, before meta
+             * mutex. On full duplex channel it is released together with
+             * meta mutex while waiting for response of read only request,
+             * so other calls can send requests in the meantime.
+             */
+            void setApiMutex(
+                    _In_ std::shared_ptr<std::mutex> mutex);
+
             sai_switch_notifications_t syncProcessNotification(
                     _In_ std::shared_ptr<Notification> notification);
 
             const std::map<sai_object_id_t, swss::TableDump>& getTableDump() const;
 
+        public: // asynchronous QUAD API helpers
+
+            /*
+             * Asynchronous create/remove/set send request immediately and
+             * return future which will hold syncd response status, so caller
+             * can keep multiple requests in flight. Responses are matched to
+             * requests by correlation id, or in send order if channel is not
+             * carrying ids. Calling get() on future will receive responses
+             * until its own arrives, responses to other requests received in
+             * the meantime are kept for their futures.
+             *
+             * When sync mode is disabled, returned future is already
+             * resolved with success, and when channel is not pipelined it's
+             * resolved before return.
+             */
+
+            std::future<sai_status_t> createAsync(
+                    _In_ sai_object_type_t objectType,
+                    _In_ const std::string& serializedObjectId,
+                    _In_ uint32_t attr_count,
+                    _In_ const sai_attribute_t *attr_list);
+
+            std::future<sai_status_t> removeAsync(
+                    _In_ sai_object_type_t objectType,
+                    _In_ const std::string& serializedObjectId);
+
+            std::future<sai_status_t> setAsync(
+                    _In_ sai_object_type_t objectType,
+                    _In_ const std::string& serializedObjectId,
+                    _In_ const sai_attribute_t *attr);
+
+        public: // unittests method helpers
+
+            /**
+             * @brief Replace communication channel and enable sync mode.
+             */
+            void setCommunicationChannel(
+                    _In_ std::shared_ptr<Channel> channel);
+
+            /**
+             * @brief Get number of requests in flight and received responses
+             * not yet collected by futures.
+             */
+            size_t getAsyncResponseCount();
+
         private: // QUAD API helpers
 
             sai_status_t create(
@@ -276,15 +347,159 @@ namespace sairedis
         private: // QUAD API response
 
             /**
-             * @brief Wait for response.
+             * @brief Waiter token is owned by future, so it expires when
+             * future is destroyed without calling get().
              *
-             * Will wait for response from syncd. Method used only for single
-             * object create/remove/set since they have common output which is
-             * sai_status_t.
+             * Token holds correlation id of request.
              */
-            sai_status_t waitForResponse(
+            typedef std::shared_ptr<uint64_t> WaiterToken;
+
+            typedef struct _PendingResponse
+            {
+                uint64_t correlationId;
+
+                /**
+                 * @brief Create/remove/set API, or SAI_COMMON_API_MAX for
+                 * other requests, whose responses are recorded by caller.
+                 */
+                sai_common_api_t api;
+
+                /**
+                 * @brief Expected response command.
+                 */
+                std::string command;
+
+                std::weak_ptr<uint64_t> waiter;
+
+            } PendingResponse;
+
+            typedef struct _ReceivedResponse
+            {
+                sai_status_t status;
+
+                swss::KeyOpFieldsValuesTuple kco;
+
+                std::weak_ptr<uint64_t> waiter;
+
+            } ReceivedResponse;
+
+            /**
+             * @brief Send create/remove/set like request and wait for its
+             * response.
+             */
+            sai_status_t sendAndWaitForResponse(
+                    _In_ const std::string& key,
+                    _In_ const std::vector<swss::FieldValueTuple>& values,
+                    _In_ const std::string& command);
+
+            /**
+             * @brief Send request and register it in flight.
+             *
+             * Used for requests which are always answered (get, stats,
+             * queries, ...), response is collected by waitForRequestResponse.
+             * Request is registered together with send, so its response is
+             * matched also when it's received by other thread.
+             */
+            WaiterToken sendRequest(
+                    _In_ const std::string& key,
+                    _In_ const std::vector<swss::FieldValueTuple>& values,
+                    _In_ const std::string& command,
+                    _In_ const std::string& responseCommand);
+
+            /**
+             * @brief Send bulk create/remove/set request.
+             *
+             * @return Token of registered request in sync mode, nullptr
+             * otherwise, since bulk is answered only in sync mode.
+             */
+            WaiterToken sendBulkRequest(
+                    _In_ const std::string& key,
+                    _In_ const std::vector<swss::FieldValueTuple>& values,
+                    _In_ const std::string& command);
+
+            /**
+             * @brief Wait for response of request sent by sendRequest.
+             */
+            sai_status_t waitForRequestResponse(
+                    _In_ const WaiterToken& request,
+                    _Out_ swss::KeyOpFieldsValuesTuple& kco);
+
+            /**
+             * @brief Register request which was just sent in flight.
+             *
+             * Response mutex must be held since request was sent.
+             */
+            WaiterToken addPendingResponse(
+                    _In_ sai_common_api_t api,
+                    _In_ const std::string& responseCommand);
+
+            /**
+             * @brief Make future for response of request which was just sent.
+             *
+             * Response mutex must be held since request was sent.
+             */
+            std::future<sai_status_t> makeResponseFuture(
+                    _Inout_ std::unique_lock<std::mutex>& lock,
                     _In_ sai_common_api_t api);
 
+            /**
+             * @brief Wait for response with given correlation id.
+             *
+             * Response mutex must be held by lock.
+             */
+            sai_status_t waitForResponse(
+                    _Inout_ std::unique_lock<std::mutex>& lock,
+                    _In_ uint64_t correlationId,
+                    _Out_ swss::KeyOpFieldsValuesTuple& kco);
+
+            /**
+             * @brief Receive single response and match it to request in flight.
+             *
+             * Response is recorded here, so it's recorded also when future
+             * is never resolved. Response mutex must be held by lock.
+             *
+             * On full duplex channel response mutex is released while
+             * waiting, and nothing is received if response with given
+             * correlation id was received by other thread in the meantime.
+             */
+            void receiveResponse(
+                    _Inout_ std::unique_lock<std::mutex>& lock,
+                    _In_ uint64_t correlationId);
+
+            /**
+             * @brief Record that no response was received for requests in
+             * flight.
+             */
+            void recordNoResponse(
+                    _In_ sai_status_t status);
+
+            /**
+             * @brief Set response of request which was in flight.
+             *
+             * Response is kept only when waiter of request still exists.
+             */
+            void setReceivedResponse(
+                    _In_ const std::deque<PendingResponse>::iterator& it,
+                    _In_ sai_status_t status,
+                    _In_ const swss::KeyOpFieldsValuesTuple& kco);
+
+            /**
+             * @brief Drop received responses whose futures were destroyed
+             * without calling get().
+             *
+             * Response mutex must be held.
+             */
+            void dropAbandonedResponses();
+
+            void recordResponse(
+                    _In_ sai_common_api_t api,
+                    _In_ sai_status_t status);
+
+            /**
+             * @brief Receive responses for all requests in flight.
+             */
+            void waitForPendingResponses();
+
             /**
              * @brief Wait for GET response.
              *
@@ -296,6 +511,7 @@ namespace sairedis
              * list at all.
              */
             sai_status_t waitForGetResponse(
+                    _In_ const WaiterToken& request,
                     _In_ sai_object_type_t objectType,
                     _In_ uint32_t attr_count,
                     _Inout_ sai_attribute_t *attr_list);
@@ -310,6 +526,7 @@ namespace sairedis
              * sai_status_t and object_statuses.
              */
             sai_status_t waitForBulkResponse(
+                    _In_ const WaiterToken& request,
                     _In_ sai_common_api_t api,
                     _In_ uint32_t object_count,
                     _Out_ sai_status_t *object_statuses);
@@ -317,29 +534,71 @@ namespace sairedis
         private: // stats API response
 
             sai_status_t waitForGetStatsResponse(
+                    _In_ const WaiterToken& request,
                     _In_ uint32_t number_of_counters,
                     _Out_ uint64_t *counters);
 
-            sai_status_t waitForClearStatsResponse();
+            sai_status_t waitForClearStatsResponse(
+                    _In_ const WaiterToken& request);
+
+            /**
+             * @brief Wait for bulk get/clear stats response.
+             *
+             * Response contains one field per object, field is object status
+             * and value is comma separated list of counters. Counters can be
+             * null for bulk clear.
+             */
+            sai_status_t waitForBulkStatsResponse(
+                    _In_ const WaiterToken& request,
+                    _In_ uint32_t object_count,
+                    _Out_ sai_status_t *object_statuses,
+                    _In_ uint32_t number_of_counters,
+                    _Out_ uint64_t *counters);
+
+            sai_status_t serializeBulkStats(
+                    _In_ sai_object_id_t switchId,
+                    _In_ sai_object_type_t object_type,
+                    _In_ uint32_t object_count,
+                    _In_ const sai_object_key_t *object_key,
+                    _In_ uint32_t number_of_counters,
+                    _In_ const sai_stat_id_t *counter_ids,
+                    _In_ sai_stats_mode_t mode,
+                    _In_ const sai_status_t *object_statuses,
+                    _Out_ std::string& key,
+                    _Out_ std::vector<swss::FieldValueTuple>& entries);
 
         private: // non QUAD API response
 
-            sai_status_t waitForFlushFdbEntriesResponse();
+            sai_status_t waitForFlushFdbEntriesResponse(
+                    _In_ const WaiterToken& request);
 
         private: // SAI API response
 
             sai_status_t waitForQueryAttributeCapabilityResponse(
+                    _In_ const WaiterToken& request,
                     _Out_ sai_attr_capability_t* capability);
 
             sai_status_t waitForQueryAttributeEnumValuesCapabilityResponse(
+                    _In_ const WaiterToken& request,
                     _Inout_ sai_s32_list_t* enumValuesCapability);
 
             sai_status_t waitForObjectTypeGetAvailabilityResponse(
+                    _In_ const WaiterToken& request,
                     _In_ uint64_t *count);
 
+            sai_status_t waitForQueryStatsCapabilityResponse(
+                    _In_ const WaiterToken& request,
+                    _Inout_ sai_stat_capability_list_t* statsCapability);
+
+            static std::vector<swss::FieldValueTuple> serializeStatsCapability(
+                    _In_ sai_object_type_t objectType,
+                    _In_ sai_status_t status,
+                    _In_ const sai_stat_capability_list_t& statsCapability);
+
         private: // notify syncd response
 
-            sai_status_t waitForNotifySyncdResponse();
+            sai_status_t waitForNotifySyncdResponse(
+                    _In_ const WaiterToken& request);
 
         private: // notification
 
@@ -358,6 +617,15 @@ namespace sairedis
             bool isSaiS8ListValidString(
                     _In_ const sai_s8_list_t &s8list);
 
+            /**
+             * @brief Get version of capability cache file.
+             *
+             * Besides sairedis and SAI revisions it contains boot id, since
+             * vendor SAI and hardware can't change without reboot and client
+             * can't query them directly.
+             */
+            std::string getCapabilityCacheVersion() const;
+
             bool emplaceStrings(
                     _In_ const sai_s8_list_t &field,
                     _In_ const sai_s8_list_t &value,
@@ -376,6 +644,24 @@ namespace sairedis
                     _In_ sai_object_id_t objectId,
                     _In_ const sai_redis_flex_counter_parameter_t *flexCounterParam);
 
+            sai_status_t setBulkValidationThreads(
+                    _In_ uint32_t threads);
+
+            /**
+             * @brief Wrap or unwrap communication channel in batching and
+             * write combining channels according to current settings.
+             *
+             * Channel is drained first, since decorators keep track of
+             * responses expected for requests in flight.
+             */
+            void updateChannelDecorators();
+
+            /**
+             * @brief Send buffered requests and receive responses for all
+             * requests in flight, so communication channel can be replaced.
+             */
+            void drainCommunicationChannel();
+
         private:
 
             sai_status_t sai_redis_notify_syncd(
@@ -415,14 +701,44 @@ namespace sairedis
 
             std::weak_ptr<saimeta::Meta> m_meta;
 
+            std::shared_ptr<std::mutex> m_metaMutex;
+
+            std::shared_ptr<std::mutex> m_apiMutex;
+
             std::shared_ptr<SkipRecordAttrContainer> m_skipRecordAttrContainer;
 
+            std::shared_ptr<CapabilityCache> m_capabilityCache;
+
             std::shared_ptr<Channel> m_communicationChannel;
 
             uint64_t m_responseTimeoutMs;
 
+            uint32_t m_autoBatchSize;
+
+            uint64_t m_autoBatchTimeoutUs;
+
+            uint64_t m_writeCombiningWindowUs;
+
             std::function<sai_switch_notifications_t(std::shared_ptr<Notification>)> m_notificationCallback;
 
             std::map<sai_object_id_t, swss::TableDump> m_tableDump;
+
+            std::mutex m_responseMutex;
+
+            /**
+             * @brief Held by thread which waits for response on full duplex
+             * channel, response mutex is not held then.
+             */
+            std::mutex m_receiveMutex;
+
+            /**
+             * @brief Requests in flight, in send order.
+             */
+            std::deque<PendingResponse> m_pendingResponses;
+
+            /**
+             * @brief Received responses not yet collected by futures.
+             */
+            std::map<uint64_t, ReceivedResponse> m_receivedResponses;
     };
 }
@@ -1,6 +1,9 @@
 #include "RedisVidIndexGenerator.h"
 
 #include "swss/logger.h"
+#include "swss/redisreply.h"
+
+#include <inttypes.h>
 
 using namespace sairedis;
 
@@ -8,7 +11,10 @@ RedisVidIndexGenerator::RedisVidIndexGenerator(
         _In_ std::shared_ptr<swss::DBConnector> dbConnector,
         _In_ const std::string& vidCounterName):
     m_dbConnector(dbConnector),
-    m_vidCounterName(vidCounterName)
+    m_vidCounterName(vidCounterName),
+    m_leaseSize(0),
+    m_leaseNext(1),
+    m_leaseLast(0)
 {
     SWSS_LOG_ENTER();
 
@@ -19,15 +25,90 @@ uint64_t RedisVidIndexGenerator::increment()
 {
     SWSS_LOG_ENTER();
 
-    // this counter must be atomic since it can be independently accessed by
-    // sairedis and syncd
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (m_leaseSize <= 1)
+    {
+        // this counter must be atomic since it can be independently accessed by
+        // sairedis and syncd
+
+        return m_dbConnector->incr(m_vidCounterName); // "VIDCOUNTER"
+    }
+
+    if (m_leaseNext > m_leaseLast)
+    {
+        lease();
+    }
 
-    return m_dbConnector->incr(m_vidCounterName); // "VIDCOUNTER"
+    return m_leaseNext++;
 }
 
 void RedisVidIndexGenerator::reset()
 {
     SWSS_LOG_ENTER();
 
-    SWSS_LOG_ERROR("not implemented");
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (m_leaseNext <= m_leaseLast)
+    {
+        SWSS_LOG_NOTICE("abandoning %" PRIu64 " leased indexes 0x%" PRIx64 "..0x%" PRIx64,
+                m_leaseLast - m_leaseNext + 1,
+                m_leaseNext,
+                m_leaseLast);
+    }
+
+    m_leaseNext = 1;
+    m_leaseLast = 0;
+}
+
+void RedisVidIndexGenerator::setLeaseSize(
+        _In_ uint64_t leaseSize)
+{
+    SWSS_LOG_ENTER();
+
+    reset();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_leaseSize = leaseSize;
+
+    SWSS_LOG_NOTICE("setting %s lease size to %" PRIu64, m_vidCounterName.c_str(), leaseSize);
+}
+
+uint64_t RedisVidIndexGenerator::getLeaseSize() const
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_leaseSize;
+}
+
+void RedisVidIndexGenerator::lease()
+{
+    SWSS_LOG_ENTER();
+
+    // INCRBY is atomic, so reserved range will not overlap with indexes
+    // allocated by syncd or other leases
+
+    swss::RedisCommand command;
+
+    command.format("INCRBY %s %" PRIu64, m_vidCounterName.c_str(), m_leaseSize);
+
+    swss::RedisReply r(m_dbConnector.get(), command, REDIS_REPLY_INTEGER);
+
+    auto last = r.getContext()->integer;
+
+    if (last < (long long)m_leaseSize)
+    {
+        SWSS_LOG_THROW("INCRBY %s returned %lld, lower than lease size %" PRIu64,
+                m_vidCounterName.c_str(),
+                last,
+                m_leaseSize);
+    }
+
+    m_leaseLast = (uint64_t)last;
+    m_leaseNext = m_leaseLast - m_leaseSize + 1;
+
+    SWSS_LOG_INFO("leased indexes 0x%" PRIx64 "..0x%" PRIx64, m_leaseNext, m_leaseLast);
 }
@@ -6,9 +6,22 @@
 #include "swss/sal.h"
 
 #include <memory>
+#include <mutex>
 
 namespace sairedis
 {
+    /**
+     * @brief Generates object indexes from counter in redis database.
+     *
+     * Counter is shared between sairedis and syncd, and it is incremented
+     * atomically, so both can allocate indexes independently.
+     *
+     * When lease size is greater than 1, range of indexes is reserved by
+     * single INCRBY and indexes are handed out locally until range is
+     * exhausted. Indexes left in range on reset or on process exit are
+     * never reused, since counter only grows, so it is safe to abandon
+     * them. Object index space is large enough that the gaps don't matter.
+     */
     class RedisVidIndexGenerator:
         public OidIndexGenerator
     {
@@ -24,12 +37,53 @@ namespace sairedis
 
             virtual uint64_t increment() override;
 
+            /**
+             * @brief Drop currently leased range.
+             *
+             * Next index will be allocated from redis counter.
+             */
             virtual void reset() override;
 
+        public:
+
+            /**
+             * @brief Set number of indexes reserved with single redis call.
+             *
+             * Value 0 or 1 disables leasing. Current lease is dropped.
+             */
+            void setLeaseSize(
+                    _In_ uint64_t leaseSize);
+
+            uint64_t getLeaseSize() const;
+
+        private:
+
+            /**
+             * @brief Reserve new range of indexes from redis counter.
+             *
+             * Mutex must be held.
+             */
+            void lease();
+
         private:
 
             std::shared_ptr<swss::DBConnector> m_dbConnector;
 
             std::string m_vidCounterName;
+
+            mutable std::mutex m_mutex;
+
+            uint64_t m_leaseSize;
+
+            /**
+             * @brief Next index to hand out from leased range.
+             */
+            uint64_t m_leaseNext;
+
+            /**
+             * @brief Last index of leased range, range is empty when
+             * m_leaseNext is greater than m_leaseLast.
+             */
+            uint64_t m_leaseLast;
     };
 }
@@ -25,6 +25,10 @@ using namespace std::placeholders;
                 sai_serialize_object_id(oid).c_str());                      \
         return SAI_STATUS_FAILURE; }
 
+#define REDIS_CONTEXT_MUTEX()                                               \
+    std::lock_guard<std::mutex> _apiLock(*context->m_apiMutex);             \
+    std::lock_guard<std::mutex> _metaLock(*context->m_metaMutex)
+
 #define REDIS_CHECK_POINTER(pointer)                                        \
     if ((pointer) == nullptr) {                                             \
         SWSS_LOG_ERROR("entry pointer " # pointer " is null");              \
@@ -53,7 +57,7 @@ sai_status_t Sai::apiInitialize(
         _In_ uint64_t flags,
         _In_ const sai_service_method_table_t *service_method_table)
 {
-    MUTEX();
+    EXCLUSIVE_MUTEX();
     SWSS_LOG_ENTER();
 
     if (m_apiInitialized)
@@ -102,15 +106,27 @@ sai_status_t Sai::apiInitialize(
 sai_status_t Sai::apiUninitialize(void)
 {
     SWSS_LOG_ENTER();
-    REDIS_CHECK_API_INITIALIZED();
 
-    SWSS_LOG_NOTICE("begin");
+    std::map<uint32_t, std::shared_ptr<Context>> contextMap;
 
-    m_contextMap.clear();
+    {
+        EXCLUSIVE_MUTEX();
+        REDIS_CHECK_API_INITIALIZED();
 
-    m_recorder = nullptr;
+        SWSS_LOG_NOTICE("begin");
 
-    m_apiInitialized = false;
+        contextMap.swap(m_contextMap);
+
+        m_recorder = nullptr;
+
+        m_apiInitialized = false;
+    }
+
+    // context destructor joins notification thread, which may be waiting for
+    // api mutex in handle_notification, so contexts are destroyed after api
+    // mutex is released
+
+    contextMap.clear();
 
     SWSS_LOG_NOTICE("end");
 
@@ -126,7 +142,7 @@ sai_status_t Sai::create(
         _In_ uint32_t attr_count,
         _In_ const sai_attribute_t *attr_list)
 {
-    MUTEX();
+    SHARED_MUTEX();
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
 
@@ -153,6 +169,8 @@ sai_status_t Sai::create(
         }
     }
 
+    REDIS_CONTEXT_MUTEX();
+
     auto status = context->m_meta->create(
             objectType,
             objectId,
@@ -184,10 +202,11 @@ sai_status_t Sai::remove(
         _In_ sai_object_type_t objectType,
         _In_ sai_object_id_t objectId)
 {
-    MUTEX();
+    SHARED_MUTEX();
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
     REDIS_CHECK_CONTEXT(objectId);
+    REDIS_CONTEXT_MUTEX();
 
     return context->m_meta->remove(objectType, objectId);
 }
@@ -197,30 +216,23 @@ sai_status_t Sai::set(
         _In_ sai_object_id_t objectId,
         _In_ const sai_attribute_t *attr)
 {
-    MUTEX();
+    SHARED_MUTEX();
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
 
     if (RedisRemoteSaiInterface::isRedisAttribute(objectType, attr))
     {
-        if (attr->id == SAI_REDIS_SWITCH_ATTR_REDIS_COMMUNICATION_MODE)
-        {
-            // Since communication mode destroys current channel and creates
-            // new one, it may happen, that during this SET api execution when
-            // api mutex is acquired, channel destructor will be blocking on
-            // thread->join() and channel thread will start processing
-            // incoming notification. That notification will be synchronized
-            // with api mutex and will cause deadlock, so to mitigate this
-            // scenario we will unlock api mutex here.
-            //
-            // This is not the perfect, but assuming that communication mode is
-            // changed in single thread and before switch create then we should
-            // not hit race condition.
-
-            SWSS_LOG_NOTICE("unlocking api mutex for communication mode");
-
-            MUTEX_UNLOCK();
-        }
+        // Since communication mode destroys current channel and creates new
+        // one, channel destructor will be blocking on thread->join() and
+        // channel thread may be processing incoming notification, which is
+        // synchronized with meta mutex. To not cause deadlock, meta mutex is
+        // not acquired for communication mode, only api mutex of context,
+        // which notification thread is not using.
+        //
+        // This is not the perfect, but assuming that communication mode is
+        // changed before switch create then we should not hit race condition.
+
+        bool lockMeta = (attr->id != SAI_REDIS_SWITCH_ATTR_REDIS_COMMUNICATION_MODE);
 
         // skip metadata if attribute is redis extension attribute
 
@@ -231,7 +243,18 @@ sai_status_t Sai::set(
 
         for (auto& kvp: m_contextMap)
         {
-            sai_status_t status = kvp.second->m_redisSai->set(objectType, objectId, attr);
+            auto& context = kvp.second;
+
+            std::lock_guard<std::mutex> apiLock(*context->m_apiMutex);
+
+            std::unique_lock<std::mutex> metaLock(*context->m_metaMutex, std::defer_lock);
+
+            if (lockMeta)
+            {
+                metaLock.lock();
+            }
+
+            sai_status_t status = context->m_redisSai->set(objectType, objectId, attr);
 
             success &= (status == SAI_STATUS_SUCCESS);
 
@@ -244,6 +267,7 @@ sai_status_t Sai::set(
     }
 
     REDIS_CHECK_CONTEXT(objectId);
+    REDIS_CONTEXT_MUTEX();
 
     return context->m_meta->set(objectType, objectId, attr);
 }
@@ -254,10 +278,11 @@ sai_status_t Sai::get(
         _In_ uint32_t attr_count,
         _Inout_ sai_attribute_t *attr_list)
 {
-    MUTEX();
+    SHARED_MUTEX();
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
     REDIS_CHECK_CONTEXT(objectId);
+    REDIS_CONTEXT_MUTEX();
 
     return context->m_meta->get(
             objectType,
@@ -274,11 +299,12 @@ sai_status_t Sai::create(                                           \
         _In_ uint32_t attr_count,                                   \
         _In_ const sai_attribute_t *attr_list)                      \
 {                                                                   \
-    MUTEX();                                                        \
+    SHARED_MUTEX();                                                 \
     SWSS_LOG_ENTER();                                               \
     REDIS_CHECK_API_INITIALIZED();                                  \
     REDIS_CHECK_POINTER(entry)                                      \
     REDIS_CHECK_CONTEXT(entry->switch_id);                          \
+    REDIS_CONTEXT_MUTEX();                                          \
     return context->m_meta->create(entry, attr_count, attr_list);   \
 }
 
@@ -288,11 +314,12 @@ SAIREDIS_DECLARE_EVERY_ENTRY(DECLARE_CREATE_ENTRY);
 sai_status_t Sai::remove(                                   \
         _In_ const sai_ ## ot ## _t* entry)                 \
 {                                                           \
-    MUTEX();                                                \
+    SHARED_MUTEX();                                         \
     SWSS_LOG_ENTER();                                       \
     REDIS_CHECK_API_INITIALIZED();                          \
     REDIS_CHECK_POINTER(entry)                              \
     REDIS_CHECK_CONTEXT(entry->switch_id);                  \
+    REDIS_CONTEXT_MUTEX();                                  \
     return context->m_meta->remove(entry);                  \
 }
 
@@ -303,11 +330,12 @@ sai_status_t Sai::set(                                      \
         _In_ const sai_ ## ot ## _t* entry,                 \
         _In_ const sai_attribute_t *attr)                   \
 {                                                           \
-    MUTEX();                                                \
+    SHARED_MUTEX();                                         \
     SWSS_LOG_ENTER();                                       \
     REDIS_CHECK_API_INITIALIZED();                          \
     REDIS_CHECK_POINTER(entry)                              \
     REDIS_CHECK_CONTEXT(entry->switch_id);                  \
+    REDIS_CONTEXT_MUTEX();                                  \
     return context->m_meta->set(entry, attr);               \
 }
 
@@ -319,11 +347,12 @@ sai_status_t Sai::get(                                          \
         _In_ uint32_t attr_count,                               \
         _Inout_ sai_attribute_t *attr_list)                     \
 {                                                               \
-    MUTEX();                                                    \
+    SHARED_MUTEX();                                             \
     SWSS_LOG_ENTER();                                           \
     REDIS_CHECK_API_INITIALIZED();                              \
     REDIS_CHECK_POINTER(entry)                                  \
     REDIS_CHECK_CONTEXT(entry->switch_id);                      \
+    REDIS_CONTEXT_MUTEX();                                      \
     return context->m_meta->get(entry, attr_count, attr_list);  \
 }
 
@@ -338,10 +367,11 @@ sai_status_t Sai::getStats(
         _In_ const sai_stat_id_t *counter_ids,
         _Out_ uint64_t *counters)
 {
-    MUTEX();
+    SHARED_MUTEX();
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
     REDIS_CHECK_CONTEXT(object_id);
+    REDIS_CONTEXT_MUTEX();
 
     return context->m_meta->getStats(
             object_type,
@@ -356,9 +386,16 @@ sai_status_t Sai::queryStatsCapability(
         _In_ sai_object_type_t objectType,
         _Inout_ sai_stat_capability_list_t *stats_capability)
 {
+    SHARED_MUTEX();
     SWSS_LOG_ENTER();
+    REDIS_CHECK_API_INITIALIZED();
+    REDIS_CHECK_CONTEXT(switchId);
+    REDIS_CONTEXT_MUTEX();
 
-    return SAI_STATUS_NOT_IMPLEMENTED;
+    return context->m_meta->queryStatsCapability(
+            switchId,
+            objectType,
+            stats_capability);
 }
 
 sai_status_t Sai::getStatsExt(
@@ -369,10 +406,11 @@ sai_status_t Sai::getStatsExt(
         _In_ sai_stats_mode_t mode,
         _Out_ uint64_t *counters)
 {
-    MUTEX();
+    SHARED_MUTEX();
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
     REDIS_CHECK_CONTEXT(object_id);
+    REDIS_CONTEXT_MUTEX();
 
     return context->m_meta->getStatsExt(
             object_type,
@@ -389,10 +427,11 @@ sai_status_t Sai::clearStats(
         _In_ uint32_t number_of_counters,
         _In_ const sai_stat_id_t *counter_ids)
 {
-    MUTEX();
+    SHARED_MUTEX();
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
     REDIS_CHECK_CONTEXT(object_id);
+    REDIS_CONTEXT_MUTEX();
 
     return context->m_meta->clearStats(
             object_type,
@@ -412,9 +451,22 @@ sai_status_t Sai::bulkGetStats(
         _Inout_ sai_status_t *object_statuses,
         _Out_ uint64_t *counters)
 {
+    SHARED_MUTEX();
     SWSS_LOG_ENTER();
+    REDIS_CHECK_API_INITIALIZED();
+    REDIS_CHECK_CONTEXT(switchId);
+    REDIS_CONTEXT_MUTEX();
 
-    return SAI_STATUS_NOT_IMPLEMENTED;
+    return context->m_meta->bulkGetStats(
+            switchId,
+            object_type,
+            object_count,
+            object_key,
+            number_of_counters,
+            counter_ids,
+            mode,
+            object_statuses,
+            counters);
 }
 
 sai_status_t Sai::bulkClearStats(
@@ -427,9 +479,21 @@ sai_status_t Sai::bulkClearStats(
         _In_ sai_stats_mode_t mode,
         _Inout_ sai_status_t *object_statuses)
 {
+    SHARED_MUTEX();
     SWSS_LOG_ENTER();
+    REDIS_CHECK_API_INITIALIZED();
+    REDIS_CHECK_CONTEXT(switchId);
+    REDIS_CONTEXT_MUTEX();
 
-    return SAI_STATUS_NOT_IMPLEMENTED;
+    return context->m_meta->bulkClearStats(
+            switchId,
+            object_type,
+            object_count,
+            object_key,
+            number_of_counters,
+            counter_ids,
+            mode,
+            object_statuses);
 }
 
 // BULK QUAD OID
@@ -444,10 +508,11 @@ sai_status_t Sai::bulkCreate(
         _Out_ sai_object_id_t *object_id,
         _Out_ sai_status_t *object_statuses)
 {
-    MUTEX();
+    SHARED_MUTEX();
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
     REDIS_CHECK_CONTEXT(switch_id);
+    REDIS_CONTEXT_MUTEX();
 
     return context->m_meta->bulkCreate(
             object_type,
@@ -467,11 +532,12 @@ sai_status_t Sai::bulkRemove(
         _In_ sai_bulk_op_error_mode_t mode,
         _Out_ sai_status_t *object_statuses)
 {
-    MUTEX();
+    SHARED_MUTEX();
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
     REDIS_CHECK_POINTER(object_id);
     REDIS_CHECK_CONTEXT(*object_id);
+    REDIS_CONTEXT_MUTEX();
 
     return context->m_meta->bulkRemove(
             object_type,
@@ -489,10 +555,11 @@ sai_status_t Sai::bulkSet(
         _In_ sai_bulk_op_error_mode_t mode,
         _Out_ sai_status_t *object_statuses)
 {
-    MUTEX();
+    SHARED_MUTEX();
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
     REDIS_CHECK_CONTEXT(*object_id);
+    REDIS_CONTEXT_MUTEX();
 
     return context->m_meta->bulkSet(
             object_type,
@@ -530,11 +597,12 @@ sai_status_t Sai::bulkCreate(                               \
         _In_ sai_bulk_op_error_mode_t mode,                 \
         _Out_ sai_status_t *object_statuses)                \
 {                                                           \
-    MUTEX();                                                \
+    SHARED_MUTEX();                                         \
     SWSS_LOG_ENTER();                                       \
     REDIS_CHECK_API_INITIALIZED();                          \
     REDIS_CHECK_POINTER(entries)                            \
     REDIS_CHECK_CONTEXT(entries->switch_id);                \
+    REDIS_CONTEXT_MUTEX();                                  \
     return context->m_meta->bulkCreate(                     \
             object_count,                                   \
             entries,                                        \
@@ -555,11 +623,12 @@ sai_status_t Sai::bulkRemove(                               \
         _In_ sai_bulk_op_error_mode_t mode,                 \
         _Out_ sai_status_t *object_statuses)                \
 {                                                           \
-    MUTEX();                                                \
+    SHARED_MUTEX();                                         \
     SWSS_LOG_ENTER();                                       \
     REDIS_CHECK_API_INITIALIZED();                          \
     REDIS_CHECK_POINTER(entries)                            \
     REDIS_CHECK_CONTEXT(entries->switch_id);                \
+    REDIS_CONTEXT_MUTEX();                                  \
     return context->m_meta->bulkRemove(                     \
             object_count,                                   \
             entries,                                        \
@@ -579,11 +648,12 @@ sai_status_t Sai::bulkSet(                                  \
         _In_ sai_bulk_op_error_mode_t mode,                 \
         _Out_ sai_status_t *object_statuses)                \
 {                                                           \
-    MUTEX();                                                \
+    SHARED_MUTEX();                                         \
     SWSS_LOG_ENTER();                                       \
     REDIS_CHECK_API_INITIALIZED();                          \
     REDIS_CHECK_POINTER(entries)                            \
     REDIS_CHECK_CONTEXT(entries->switch_id);                \
+    REDIS_CONTEXT_MUTEX();                                  \
     return context->m_meta->bulkSet(                        \
             object_count,                                   \
             entries,                                        \
@@ -605,7 +675,7 @@ sai_status_t Sai::bulkGet(                                  \
         _In_ sai_bulk_op_error_mode_t mode,                 \
         _Out_ sai_status_t *object_statuses)                \
 {                                                           \
-    MUTEX();                                                \
+    SHARED_MUTEX();                                         \
     SWSS_LOG_ENTER();                                       \
     REDIS_CHECK_API_INITIALIZED();                          \
     REDIS_CHECK_POINTER(ot);                                \
@@ -625,10 +695,11 @@ sai_status_t Sai::flushFdbEntries(
         _In_ uint32_t attr_count,
         _In_ const sai_attribute_t *attr_list)
 {
-    MUTEX();
+    SHARED_MUTEX();
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
     REDIS_CHECK_CONTEXT(switch_id);
+    REDIS_CONTEXT_MUTEX();
 
     return context->m_meta->flushFdbEntries(
             switch_id,
@@ -645,10 +716,11 @@ sai_status_t Sai::objectTypeGetAvailability(
         _In_ const sai_attribute_t *attrList,
         _Out_ uint64_t *count)
 {
-    MUTEX();
+    SHARED_MUTEX();
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
     REDIS_CHECK_CONTEXT(switchId);
+    REDIS_CONTEXT_MUTEX();
 
     return context->m_meta->objectTypeGetAvailability(
             switchId,
@@ -664,10 +736,11 @@ sai_status_t Sai::queryAttributeCapability(
         _In_ sai_attr_id_t attr_id,
         _Out_ sai_attr_capability_t *capability)
 {
-    MUTEX();
+    SHARED_MUTEX();
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
     REDIS_CHECK_CONTEXT(switch_id);
+    REDIS_CONTEXT_MUTEX();
 
     return context->m_meta->queryAttributeCapability(
             switch_id,
@@ -682,10 +755,11 @@ sai_status_t Sai::queryAttributeEnumValuesCapability(
         _In_ sai_attr_id_t attr_id,
         _Inout_ sai_s32_list_t *enum_values_capability)
 {
-    MUTEX();
+    SHARED_MUTEX();
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
     REDIS_CHECK_CONTEXT(switch_id);
+    REDIS_CONTEXT_MUTEX();
 
     return context->m_meta->queryAttributeEnumValuesCapability(
             switch_id,
@@ -728,13 +802,17 @@ sai_status_t Sai::logSet(
         _In_ sai_api_t api,
         _In_ sai_log_level_t log_level)
 {
-    MUTEX();
+    SHARED_MUTEX();
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
 
     for (auto&kvp: m_contextMap)
     {
-        kvp.second->m_meta->logSet(api, log_level);
+        auto& context = kvp.second;
+
+        REDIS_CONTEXT_MUTEX();
+
+        context->m_meta->logSet(api, log_level);
     }
 
     return SAI_STATUS_SUCCESS;
@@ -743,7 +821,7 @@ sai_status_t Sai::logSet(
 sai_status_t Sai::queryApiVersion(
         _Out_ sai_api_version_t *version)
 {
-    MUTEX();
+    SHARED_MUTEX();
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
 
@@ -757,7 +835,11 @@ sai_status_t Sai::queryApiVersion(
     {
         SWSS_LOG_WARN("using first context");
 
-        return kvp.second->m_meta->queryApiVersion(version);
+        auto& context = kvp.second;
+
+        REDIS_CONTEXT_MUTEX();
+
+        return context->m_meta->queryApiVersion(version);
     }
 
     SWSS_LOG_ERROR("context map is empty");
@@ -771,8 +853,9 @@ sai_status_t Sai::queryApiVersion(
  * It is possible that when we create switch we will immediately start getting
  * notifications from it, and it may happen that this switch will not be yet
  * put to switch container and notification won't find it. But before
- * notification will be processed it will first try to acquire mutex, so create
- * switch function will end and switch will be put inside container.
+ * notification will be processed it will first try to acquire meta mutex of
+ * context, so create switch function will end and switch will be put inside
+ * container.
  *
  * Similar it can happen that we receive notification when we are removing
  * switch, then switch will be removed from switch container and notification
@@ -784,7 +867,7 @@ sai_switch_notifications_t Sai::handle_notification(
         _In_ std::shared_ptr<Notification> notification,
         _In_ Context* context)
 {
-    MUTEX();
+    SHARED_MUTEX();
     SWSS_LOG_ENTER();
 
     if (!m_apiInitialized)
@@ -794,9 +877,28 @@ sai_switch_notifications_t Sai::handle_notification(
         return { };
     }
 
+    // only meta mutex, so notification is not waiting for api calls on this
+    // context which are waiting for syncd response to read only request
+
+    std::lock_guard<std::mutex> metaLock(*context->m_metaMutex);
+
+    if (m_notificationObserver)
+    {
+        m_notificationObserver(notification);
+    }
+
     return context->m_redisSai->syncProcessNotification(notification);
 }
 
+void Sai::setNotificationObserver(
+        _In_ NotificationObserver observer)
+{
+    EXCLUSIVE_MUTEX();
+    SWSS_LOG_ENTER();
+
+    m_notificationObserver = observer;
+}
+
 std::shared_ptr<Context> Sai::getContext(
         _In_ uint32_t globalContext)
 {
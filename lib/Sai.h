@@ -12,7 +12,9 @@
 #include <vector>
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
 #include <map>
+#include <functional>
 
 namespace sairedis
 {
@@ -188,6 +190,21 @@ namespace sairedis
             virtual sai_status_t queryApiVersion(
                     _Out_ sai_api_version_t *version) override;
 
+        public:
+
+            typedef std::function<void(std::shared_ptr<Notification>)> NotificationObserver;
+
+            /**
+             * @brief Set observer which will receive every notification,
+             * before it's delivered to switch notification pointers.
+             *
+             * Observer is executed from notification thread, under meta mutex
+             * of context which received notification, so it can be executed
+             * concurrently for different contexts.
+             */
+            void setNotificationObserver(
+                    _In_ NotificationObserver observer);
+
         private:
 
             sai_switch_notifications_t handle_notification(
@@ -201,12 +218,21 @@ namespace sairedis
 
             bool m_apiInitialized;
 
-            std::recursive_mutex m_apimutex;
+            /**
+             * @brief Protects API initialization state and context map.
+             *
+             * Acquired shared by API calls and notifications, which then
+             * synchronize on context mutexes, and exclusive by initialize and
+             * uninitialize.
+             */
+            std::shared_timed_mutex m_apimutex;
 
             std::map<uint32_t, std::shared_ptr<Context>> m_contextMap;
 
             sai_service_method_table_t m_service_method_table;
 
             std::shared_ptr<Recorder> m_recorder;
+
+            NotificationObserver m_notificationObserver;
     };
 }
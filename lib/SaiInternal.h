@@ -2,3 +2,6 @@
 
 #define MUTEX() std::lock_guard<std::recursive_mutex> _lock(m_apimutex)
 #define MUTEX_UNLOCK() m_apimutex.unlock()
+
+#define SHARED_MUTEX() std::shared_lock<std::shared_timed_mutex> _lock(m_apimutex)
+#define EXCLUSIVE_MUTEX() std::unique_lock<std::shared_timed_mutex> _lock(m_apimutex)
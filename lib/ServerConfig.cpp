@@ -12,7 +12,8 @@ using namespace sairedis;
 
 ServerConfig::ServerConfig():
     m_zmqEndpoint("ipc:///tmp/saiServer"),
-    m_zmqNtfEndpoint("ipc:///tmp/saiServerNtf")
+    m_zmqNtfEndpoint("ipc:///tmp/saiServerNtf"),
+    m_zmqRouter(false)
 {
     SWSS_LOG_ENTER();
 
@@ -57,9 +58,30 @@ std::shared_ptr<ServerConfig> ServerConfig::loadFromFile(
         cc->m_zmqEndpoint = j["zmq_endpoint"];
         cc->m_zmqNtfEndpoint = j["zmq_ntf_endpoint"];
 
-        SWSS_LOG_NOTICE("server config: %s, %s",
+        cc->m_zmqRouter = j.value("zmq_router", false);
+
+        if (j.find("zmq_client_weights") != j.end())
+        {
+            json& weights = j["zmq_client_weights"];
+
+            for (auto it = weights.begin(); it != weights.end(); ++it)
+            {
+                uint32_t weight = it.value();
+
+                if (weight == 0)
+                {
+                    SWSS_LOG_THROW("client '%s' weight can't be zero", it.key().c_str());
+                }
+
+                cc->m_zmqClientWeights[it.key()] = weight;
+            }
+        }
+
+        SWSS_LOG_NOTICE("server config: %s, %s, router: %s, client weights: %zu",
                 cc->m_zmqEndpoint.c_str(),
-                cc->m_zmqNtfEndpoint.c_str());
+                cc->m_zmqNtfEndpoint.c_str(),
+                (cc->m_zmqRouter ? "true" : "false"),
+                cc->m_zmqClientWeights.size());
 
         SWSS_LOG_NOTICE("loaded %s server config", path);
 
@@ -3,6 +3,7 @@
 #include "swss/sal.h"
 
 #include <memory>
+#include <map>
 #include <string>
 
 namespace sairedis
@@ -25,5 +26,20 @@ namespace sairedis
             std::string m_zmqEndpoint;
 
             std::string m_zmqNtfEndpoint;
+
+            /**
+             * @brief Serve many clients over ROUTER socket, notifications
+             * are published to all clients.
+             */
+            bool m_zmqRouter;
+
+            /**
+             * @brief Scheduling weight of client identity, used in router
+             * mode, clients not listed have weight 1.
+             *
+             * Weight changes only order in which queued requests are served,
+             * requests of all clients are still executed one at a time.
+             */
+            std::map<std::string, uint32_t> m_zmqClientWeights;
     };
 }
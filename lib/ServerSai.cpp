@@ -7,10 +7,15 @@
 #include "meta/sai_serialize.h"
 #include "meta/SaiAttributeList.h"
 #include "meta/ZeroMQSelectableChannel.h"
+#include "meta/ZeroMQBinarySelectableChannel.h"
+#include "meta/NotificationFactory.h"
 
 #include "swss/logger.h"
 #include "swss/select.h"
 #include "swss/tokenize.h"
+#include "swss/json.h"
+
+#include <zmq.h>
 
 #include <iterator>
 #include <algorithm>
@@ -31,6 +36,10 @@ ServerSai::ServerSai()
     m_apiInitialized = false;
 
     m_runServerThread = false;
+
+    m_ntfContext = nullptr;
+
+    m_ntfSocket = nullptr;
 }
 
 ServerSai::~ServerSai()
@@ -77,7 +86,9 @@ sai_status_t ServerSai::apiInitialize(
 
     memcpy(&m_service_method_table, service_method_table, sizeof(m_service_method_table));
 
-    m_sai = std::make_shared<Sai>(); // actual SAI to talk to syncd
+    auto sai = std::make_shared<Sai>(); // actual SAI to talk to syncd
+
+    m_sai = sai;
 
     auto status = m_sai->apiInitialize(flags, service_method_table);
 
@@ -89,7 +100,27 @@ sai_status_t ServerSai::apiInitialize(
 
         auto cc = ServerConfig::loadFromFile(serverConfig);
 
-        m_selectableChannel = std::make_shared<ZeroMQSelectableChannel>(cc->m_zmqEndpoint);
+        if (cc->m_zmqRouter)
+        {
+            SWSS_LOG_NOTICE("serving multiple clients on %s", cc->m_zmqEndpoint.c_str());
+
+            auto channel = std::make_shared<ZeroMQBinarySelectableChannel>(cc->m_zmqEndpoint);
+
+            for (auto& kvp: cc->m_zmqClientWeights)
+            {
+                channel->setClientWeight(kvp.first, kvp.second);
+            }
+
+            m_selectableChannel = channel;
+
+            openNotificationPublisher(cc->m_zmqNtfEndpoint);
+
+            sai->setNotificationObserver(std::bind(&ServerSai::publishNotification, this, _1));
+        }
+        else
+        {
+            m_selectableChannel = std::make_shared<ZeroMQSelectableChannel>(cc->m_zmqEndpoint);
+        }
 
         SWSS_LOG_NOTICE("starting server thread");
 
@@ -127,6 +158,10 @@ sai_status_t ServerSai::apiUninitialize(void)
 
     m_sai = nullptr;
 
+    // notification threads ended together with sai
+
+    closeNotificationPublisher();
+
     SWSS_LOG_NOTICE("end");
 
     return SAI_STATUS_SUCCESS;
@@ -697,6 +732,87 @@ void ServerSai::serverThreadFunction()
     SWSS_LOG_NOTICE("end");
 }
 
+void ServerSai::openNotificationPublisher(
+        _In_ const std::string& ntfEndpoint)
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_ntfMutex);
+
+    m_ntfContext = zmq_ctx_new();
+
+    m_ntfSocket = zmq_socket(m_ntfContext, ZMQ_PUB);
+
+    int linger = 0;
+
+    zmq_setsockopt(m_ntfSocket, ZMQ_LINGER, &linger, sizeof(linger));
+
+    SWSS_LOG_NOTICE("opening zmq ntf publisher endpoint: %s", ntfEndpoint.c_str());
+
+    int rc = zmq_bind(m_ntfSocket, ntfEndpoint.c_str());
+
+    if (rc != 0)
+    {
+        SWSS_LOG_THROW("failed to open zmq ntf endpoint %s, zmqerrno: %d",
+                ntfEndpoint.c_str(),
+                zmq_errno());
+    }
+}
+
+void ServerSai::closeNotificationPublisher()
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_ntfMutex);
+
+    if (m_ntfSocket)
+    {
+        zmq_close(m_ntfSocket);
+        zmq_ctx_destroy(m_ntfContext);
+
+        m_ntfSocket = nullptr;
+        m_ntfContext = nullptr;
+    }
+}
+
+void ServerSai::publishNotification(
+        _In_ std::shared_ptr<Notification> notification)
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_ntfMutex);
+
+    if (m_ntfSocket == nullptr)
+    {
+        return;
+    }
+
+    try
+    {
+        // same format as notifications sent by syncd, so clients can use
+        // the same notification receiver
+
+        std::vector<swss::FieldValueTuple> values;
+
+        values.emplace_back(NotificationFactory::getName(*notification), notification->getSerializedNotification());
+
+        std::string msg = swss::JSon::buildJson(values);
+
+        // publisher drops message for slow subscribers and never blocks
+
+        int rc = zmq_send(m_ntfSocket, msg.c_str(), msg.length(), 0);
+
+        if (rc < 0)
+        {
+            SWSS_LOG_ERROR("zmq_send failed, zmqerrno: %d", zmq_errno());
+        }
+    }
+    catch (const std::exception& e)
+    {
+        SWSS_LOG_ERROR("failed to publish notification: %s", e.what());
+    }
+}
+
 void ServerSai::processEvent(
         _In_ SelectableChannel& consumer)
 {
@@ -3,6 +3,7 @@
 #include "meta/SaiInterface.h"
 #include "meta/SaiAttributeList.h"
 #include "meta/SelectableChannel.h"
+#include "meta/Notification.h"
 
 #include "swss/selectableevent.h"
 
@@ -188,6 +189,23 @@ namespace sairedis
 
             void serverThreadFunction();
 
+            /**
+             * @brief Bind notification publisher, used in router mode to
+             * send notifications to all subscribed clients.
+             */
+            void openNotificationPublisher(
+                    _In_ const std::string& ntfEndpoint);
+
+            void closeNotificationPublisher();
+
+            /**
+             * @brief Publish notification to all subscribed clients.
+             *
+             * Executed from notification thread.
+             */
+            void publishNotification(
+                    _In_ std::shared_ptr<Notification> notification);
+
             void processEvent(
                     _In_ SelectableChannel& consumer);
 
@@ -311,5 +329,11 @@ namespace sairedis
             std::shared_ptr<SelectableChannel> m_selectableChannel;
 
             swss::SelectableEvent m_serverThreadThreadShouldEndEvent;
+
+            std::mutex m_ntfMutex;
+
+            void* m_ntfContext;
+
+            void* m_ntfSocket;
     };
 }
@@ -0,0 +1,536 @@
+#include "SharedMemoryChannel.h"
+
+#include "sairediscommon.h"
+
+#include "meta/sai_serialize.h"
+#include "meta/ZeroMQFrameCodec.h"
+#include "meta/SharedMemoryProtocol.h"
+
+#include "swss/logger.h"
+
+#include <chrono>
+
+#include <inttypes.h>
+
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <poll.h>
+#include <unistd.h>
+#include <string.h>
+#include <errno.h>
+
+#define SHM_CONNECT_RETRY_COUNT (100)
+#define SHM_CONNECT_RETRY_SLEEP_US (100 * 1000)
+#define SHM_PUSH_RETRY_SLEEP_US (100)
+
+using namespace sairedis;
+
+static void signal_eventfd(
+        _In_ int fd)
+{
+    SWSS_LOG_ENTER();
+
+    uint64_t value = 1;
+
+    if (write(fd, &value, sizeof(value)) < 0 && errno != EAGAIN)
+    {
+        SWSS_LOG_ERROR("failed to signal eventfd %d: %s", fd, strerror(errno));
+    }
+}
+
+static void clear_eventfd(
+        _In_ int fd)
+{
+    SWSS_LOG_ENTER();
+
+    uint64_t value;
+
+    if (read(fd, &value, sizeof(value)) < 0 && errno != EAGAIN)
+    {
+        SWSS_LOG_ERROR("failed to read eventfd %d: %s", fd, strerror(errno));
+    }
+}
+
+SharedMemoryChannel::SharedMemoryChannel(
+        _In_ const std::string& endpoint,
+        _In_ Channel::Callback callback):
+    Channel(callback),
+    m_endpoint(endpoint),
+    m_socket(-1),
+    m_memoryFd(-1),
+    m_memory(MAP_FAILED),
+    m_memorySize(0),
+    m_requestEvent(-1),
+    m_responseEvent(-1),
+    m_notificationEvent(-1),
+    m_buffered(false),
+    m_pendingSignals(0),
+    m_generation(0),
+    m_staleCorrelationId(NO_CORRELATION_ID)
+{
+    SWSS_LOG_ENTER();
+
+    connect();
+
+    m_runNotificationThread = true;
+
+    SWSS_LOG_NOTICE("creating notification thread");
+
+    m_notificationThread = std::make_shared<std::thread>(&SharedMemoryChannel::notificationThreadFunction, this);
+}
+
+SharedMemoryChannel::~SharedMemoryChannel()
+{
+    SWSS_LOG_ENTER();
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        signalPending();
+    }
+
+    m_runNotificationThread = false;
+
+    m_notificationThreadShouldEndEvent.notify();
+
+    SWSS_LOG_NOTICE("join ntf thread begin");
+
+    m_notificationThread->join();
+
+    SWSS_LOG_NOTICE("join ntf thread end");
+
+    if (m_memory != MAP_FAILED)
+    {
+        munmap(m_memory, m_memorySize);
+    }
+
+    // closing socket will tell syncd that client is gone
+
+    for (int fd: { m_notificationEvent, m_responseEvent, m_requestEvent, m_memoryFd, m_socket })
+    {
+        if (fd >= 0)
+        {
+            close(fd);
+        }
+    }
+}
+
+void SharedMemoryChannel::connect()
+{
+    SWSS_LOG_ENTER();
+
+    sockaddr_un addr;
+
+    memset(&addr, 0, sizeof(addr));
+
+    if (m_endpoint.size() >= sizeof(addr.sun_path))
+    {
+        SWSS_LOG_THROW("endpoint path too long: %s", m_endpoint.c_str());
+    }
+
+    addr.sun_family = AF_UNIX;
+
+    strncpy(addr.sun_path, m_endpoint.c_str(), sizeof(addr.sun_path) - 1);
+
+    m_socket = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+
+    if (m_socket < 0)
+    {
+        SWSS_LOG_THROW("socket failed: %s", strerror(errno));
+    }
+
+    // syncd may be still starting
+
+    for (int i = 0; true; ++i)
+    {
+        if (::connect(m_socket, (const sockaddr*)&addr, sizeof(addr)) == 0)
+        {
+            break;
+        }
+
+        if (i >= SHM_CONNECT_RETRY_COUNT)
+        {
+            SWSS_LOG_THROW("failed to connect to %s: %s", m_endpoint.c_str(), strerror(errno));
+        }
+
+        usleep(SHM_CONNECT_RETRY_SLEEP_US);
+    }
+
+    SharedMemoryHandshake handshake;
+
+    int fds[SHM_FD_COUNT];
+
+    iovec iov;
+
+    iov.iov_base = &handshake;
+    iov.iov_len = sizeof(handshake);
+
+    union
+    {
+        char buffer[CMSG_SPACE(sizeof(fds))];
+
+        cmsghdr align;
+
+    } control;
+
+    msghdr msg;
+
+    memset(&msg, 0, sizeof(msg));
+
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control.buffer;
+    msg.msg_controllen = sizeof(control.buffer);
+
+    ssize_t size = recvmsg(m_socket, &msg, MSG_CMSG_CLOEXEC | MSG_WAITALL);
+
+    if (size == 0)
+    {
+        SWSS_LOG_THROW("connection to %s rejected, other client is connected", m_endpoint.c_str());
+    }
+
+    cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+
+    if (size != (ssize_t)sizeof(handshake) ||
+            cmsg == nullptr ||
+            cmsg->cmsg_level != SOL_SOCKET ||
+            cmsg->cmsg_type != SCM_RIGHTS ||
+            cmsg->cmsg_len != CMSG_LEN(sizeof(fds)))
+    {
+        SWSS_LOG_THROW("invalid handshake from %s, size %zd", m_endpoint.c_str(), size);
+    }
+
+    memcpy(fds, CMSG_DATA(cmsg), sizeof(fds));
+
+    m_memoryFd = fds[SHM_FD_MEMORY];
+    m_requestEvent = fds[SHM_FD_REQUEST_EVENT];
+    m_responseEvent = fds[SHM_FD_RESPONSE_EVENT];
+    m_notificationEvent = fds[SHM_FD_NOTIFICATION_EVENT];
+
+    if (handshake.magic != SHM_HANDSHAKE_MAGIC)
+    {
+        SWSS_LOG_THROW("invalid handshake magic 0x%" PRIx64, handshake.magic);
+    }
+
+    m_generation = handshake.generation;
+
+    size_t ringMemorySize = (size_t)handshake.ringMemorySize;
+
+    m_memorySize = SHM_RING_COUNT * ringMemorySize;
+
+    m_memory = mmap(nullptr, m_memorySize, PROT_READ | PROT_WRITE, MAP_SHARED, m_memoryFd, 0);
+
+    if (m_memory == MAP_FAILED)
+    {
+        SWSS_LOG_THROW("mmap of %zu bytes failed: %s", m_memorySize, strerror(errno));
+    }
+
+    uint8_t* base = static_cast<uint8_t*>(m_memory);
+
+    m_requestRing = std::make_shared<SharedMemoryRing>(base + SHM_RING_REQUEST * ringMemorySize, ringMemorySize, false);
+    m_responseRing = std::make_shared<SharedMemoryRing>(base + SHM_RING_RESPONSE * ringMemorySize, ringMemorySize, false);
+    m_notificationRing = std::make_shared<SharedMemoryRing>(base + SHM_RING_NOTIFICATION * ringMemorySize, ringMemorySize, false);
+
+    // drop anything left for previous client, responses which syncd will
+    // still send to it are skipped by generation in wait
+
+    std::string record;
+
+    size_t stale = 0;
+
+    while (m_responseRing->pop(record) || m_notificationRing->pop(record))
+    {
+        stale++;
+    }
+
+    if (stale)
+    {
+        SWSS_LOG_WARN("dropped %zu records left by previous client", stale);
+    }
+
+    SWSS_LOG_NOTICE("connected to %s, ring capacity %zu, generation %" PRIu64,
+            m_endpoint.c_str(),
+            m_requestRing->getCapacity(),
+            m_generation);
+}
+
+void SharedMemoryChannel::setBuffered(
+        _In_ bool buffered)
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_buffered = buffered;
+
+    if (!buffered)
+    {
+        signalPending();
+    }
+}
+
+void SharedMemoryChannel::flush()
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    signalPending();
+}
+
+void SharedMemoryChannel::signalPending()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_pendingSignals)
+    {
+        signal_eventfd(m_requestEvent);
+
+        m_pendingSignals = 0;
+    }
+}
+
+void SharedMemoryChannel::set(
+        _In_ const std::string& key,
+        _In_ const std::vector<swss::FieldValueTuple>& values,
+        _In_ const std::string& command)
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    std::string frame;
+
+    uint64_t correlationId = (m_generation << SHM_GENERATION_SHIFT) | nextCorrelationId();
+
+    ZeroMQFrameCodec::encode(key, command, values, correlationId, frame);
+
+    uint64_t waited = 0;
+
+    while (!m_requestRing->push(frame))
+    {
+        // ring is full, make sure syncd is draining it
+
+        signalPending();
+
+        if (waited >= m_responseTimeoutMs * 1000)
+        {
+            SWSS_LOG_THROW("request ring full for %" PRIu64 " ms, syncd is not reading requests on %s",
+                    m_responseTimeoutMs,
+                    m_endpoint.c_str());
+        }
+
+        usleep(SHM_PUSH_RETRY_SLEEP_US);
+
+        waited += SHM_PUSH_RETRY_SLEEP_US;
+    }
+
+    m_pendingSignals++;
+
+    if (!m_buffered || m_pendingSignals >= MAX_PENDING_SIGNALS)
+    {
+        signalPending();
+    }
+}
+
+void SharedMemoryChannel::del(
+        _In_ const std::string& key,
+        _In_ const std::string& command)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<swss::FieldValueTuple> values;
+
+    set(key, values, command);
+}
+
+bool SharedMemoryChannel::isPipelined() const
+{
+    SWSS_LOG_ENTER();
+
+    return true;
+}
+
+bool SharedMemoryChannel::isFullDuplex() const
+{
+    SWSS_LOG_ENTER();
+
+    return true;
+}
+
+sai_status_t SharedMemoryChannel::wait(
+        _In_ const std::string& command,
+        _Out_ swss::KeyOpFieldsValuesTuple& kco)
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_INFO("wait for %s response", command.c_str());
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        // response may be for request which syncd was not signaled about yet
+
+        signalPending();
+    }
+
+    // don't hold lock while waiting, so other threads can send requests
+
+    m_responseCorrelationId = NO_CORRELATION_ID;
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(m_responseTimeoutMs);
+
+    std::string frame;
+
+    uint64_t correlationId;
+
+    while (true)
+    {
+        if (!popResponse(deadline, frame))
+        {
+            SWSS_LOG_ERROR("wait timed out for: %s", command.c_str());
+
+            // caller will fail all requests in flight, so responses to them
+            // which arrive later must be skipped
+
+            m_staleCorrelationId = getRequestCorrelationId();
+
+            kco = swss::KeyOpFieldsValuesTuple();
+
+            return SAI_STATUS_FAILURE;
+        }
+
+        ZeroMQFrameCodec::decode(frame.data(), frame.size(), kco, correlationId);
+
+        if ((correlationId >> SHM_GENERATION_SHIFT) != m_generation)
+        {
+            SWSS_LOG_WARN("discarding response %s for request of previous client", kfvKey(kco).c_str());
+
+            continue;
+        }
+
+        correlationId &= SHM_CORRELATION_ID_MASK;
+
+        if (correlationId <= m_staleCorrelationId)
+        {
+            SWSS_LOG_WARN("discarding late response %s for request %" PRIu64 " which timed out",
+                    kfvKey(kco).c_str(),
+                    correlationId);
+
+            continue;
+        }
+
+        break;
+    }
+
+    m_responseCorrelationId = correlationId;
+
+    const std::string& opkey = kfvKey(kco);
+    const std::string& op = kfvOp(kco);
+
+    SWSS_LOG_INFO("response: op = %s, key = %s", opkey.c_str(), op.c_str());
+
+    // response may be for request of other thread, caller checks command
+
+    sai_status_t status;
+    sai_deserialize_status(opkey, status);
+
+    SWSS_LOG_DEBUG("%s status: %s", command.c_str(), opkey.c_str());
+
+    return status;
+}
+
+bool SharedMemoryChannel::popResponse(
+        _In_ const std::chrono::steady_clock::time_point& deadline,
+        _Out_ std::string& frame)
+{
+    SWSS_LOG_ENTER();
+
+    while (!m_responseRing->pop(frame))
+    {
+        auto now = std::chrono::steady_clock::now();
+
+        if (now >= deadline)
+        {
+            return false;
+        }
+
+        pollfd pfd = { m_responseEvent, POLLIN, 0 };
+
+        int timeout = (int)std::chrono::duration_cast<std::chrono::milliseconds>(deadline - now).count();
+
+        int rc = poll(&pfd, 1, timeout + 1);
+
+        if (rc < 0 && errno != EINTR)
+        {
+            SWSS_LOG_THROW("poll failed: %s", strerror(errno));
+        }
+
+        if (rc > 0)
+        {
+            clear_eventfd(m_responseEvent);
+        }
+    }
+
+    return true;
+}
+
+void SharedMemoryChannel::notificationThreadFunction()
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_NOTICE("start listening for notifications");
+
+    std::string frame;
+
+    swss::KeyOpFieldsValuesTuple kco;
+
+    uint64_t correlationId;
+
+    while (m_runNotificationThread)
+    {
+        pollfd fds[2];
+
+        fds[0] = { m_notificationEvent, POLLIN, 0 };
+        fds[1] = { m_notificationThreadShouldEndEvent.getFd(), POLLIN, 0 };
+
+        int rc = poll(fds, 2, -1);
+
+        if (!m_runNotificationThread)
+            break;
+
+        if (rc < 0 && errno == EINTR)
+        {
+            continue;
+        }
+
+        if (rc < 0)
+        {
+            SWSS_LOG_ERROR("poll failed: %s, ending thread", strerror(errno));
+            break;
+        }
+
+        clear_eventfd(m_notificationEvent);
+
+        while (m_notificationRing->pop(frame))
+        {
+            try
+            {
+                ZeroMQFrameCodec::decode(frame.data(), frame.size(), kco, correlationId);
+            }
+            catch (const std::exception& e)
+            {
+                SWSS_LOG_ERROR("failed to decode notification of %zu bytes: %s, message DROPPED", frame.size(), e.what());
+
+                continue;
+            }
+
+            SWSS_LOG_DEBUG("notification: op = %s, data = %s", kfvOp(kco).c_str(), kfvKey(kco).c_str());
+
+            m_callback(kfvOp(kco), kfvKey(kco), kfvFieldsValues(kco));
+        }
+    }
+
+    SWSS_LOG_NOTICE("exiting notification thread");
+}
@@ -0,0 +1,145 @@
+#pragma once
+
+#include "Channel.h"
+
+#include "meta/SharedMemoryRing.h"
+
+#include <mutex>
+#include <thread>
+#include <memory>
+#include <chrono>
+
+namespace sairedis
+{
+    /**
+     * @brief Client side of shared memory channel.
+     *
+     * Connects to syncd unix socket, receives shared memory with request,
+     * response and notification rings and their eventfds (see
+     * SharedMemorySelectableChannel), and keeps socket open while channel
+     * exists, so syncd knows when client is gone.
+     *
+     * Operations are encoded as ZMQ v2 binary frames and responses are
+     * matched by correlation id, so many requests can be in flight.
+     * Responses to requests which timed out, or which were sent by previous
+     * client, are discarded when they arrive. In
+     * buffered mode syncd is woken up only after MAX_PENDING_SIGNALS
+     * requests, on flush, or before waiting for response.
+     *
+     * Channel is full duplex, request and response rings are separate, so
+     * mutex is not held while waiting for response. Only one thread may wait
+     * at a time.
+     */
+    class SharedMemoryChannel:
+        public Channel
+    {
+        public:
+
+            SharedMemoryChannel(
+                    _In_ const std::string& endpoint,
+                    _In_ Channel::Callback callback);
+
+            virtual ~SharedMemoryChannel();
+
+        public:
+
+            virtual void setBuffered(
+                    _In_ bool buffered) override;
+
+            virtual void flush() override;
+
+            virtual void set(
+                    _In_ const std::string& key,
+                    _In_ const std::vector<swss::FieldValueTuple>& values,
+                    _In_ const std::string& command) override;
+
+            virtual void del(
+                    _In_ const std::string& key,
+                    _In_ const std::string& command) override;
+
+            virtual bool isPipelined() const override;
+
+            virtual bool isFullDuplex() const override;
+
+            virtual sai_status_t wait(
+                    _In_ const std::string& command,
+                    _Out_ swss::KeyOpFieldsValuesTuple& kco) override;
+
+        protected:
+
+            virtual void notificationThreadFunction() override;
+
+        private:
+
+            void connect();
+
+            /**
+             * @brief Signal syncd if any request was pushed since last signal.
+             *
+             * Mutex must be held.
+             */
+            void signalPending();
+
+            /**
+             * @brief Pop response frame, wait for it until deadline.
+             *
+             * Mutex is not needed, response ring has single consumer.
+             *
+             * @return False on timeout.
+             */
+            bool popResponse(
+                    _In_ const std::chrono::steady_clock::time_point& deadline,
+                    _Out_ std::string& frame);
+
+        public:
+
+            /**
+             * @brief Maximum number of requests pushed in buffered mode
+             * before syncd is signaled.
+             */
+            static constexpr size_t MAX_PENDING_SIGNALS = 1024;
+
+        private:
+
+            std::string m_endpoint;
+
+            int m_socket;
+
+            int m_memoryFd;
+
+            void* m_memory;
+
+            size_t m_memorySize;
+
+            std::shared_ptr<SharedMemoryRing> m_requestRing;
+
+            std::shared_ptr<SharedMemoryRing> m_responseRing;
+
+            std::shared_ptr<SharedMemoryRing> m_notificationRing;
+
+            int m_requestEvent;
+
+            int m_responseEvent;
+
+            int m_notificationEvent;
+
+            std::mutex m_mutex;
+
+            bool m_buffered;
+
+            /**
+             * @brief Number of requests pushed since syncd was signaled.
+             */
+            size_t m_pendingSignals;
+
+            /**
+             * @brief Connection generation received in handshake.
+             */
+            uint64_t m_generation;
+
+            /**
+             * @brief Last request id sent before wait timed out.
+             */
+            uint64_t m_staleCorrelationId;
+    };
+}
@@ -0,0 +1,385 @@
+#include "WriteCombiningChannel.h"
+
+#include "sairediscommon.h"
+
+#include "meta/sai_serialize.h"
+
+#include "swss/logger.h"
+
+#include <inttypes.h>
+
+using namespace sairedis;
+
+WriteCombiningChannel::WriteCombiningChannel(
+        _In_ std::shared_ptr<Channel> channel,
+        _In_ uint64_t windowUs):
+    Channel(nullptr),
+    m_channel(channel),
+    m_windowUs(windowUs),
+    m_combinedCount(0),
+    m_buffered(false),
+    m_runTimerThread(true)
+{
+    SWSS_LOG_ENTER();
+
+    if (!channel)
+    {
+        SWSS_LOG_THROW("channel can't be nullptr");
+    }
+
+    if (windowUs == 0)
+    {
+        SWSS_LOG_THROW("write combining window can't be zero");
+    }
+
+    m_responseTimeoutMs = channel->getResponseTimeout();
+
+    SWSS_LOG_NOTICE("combining writes, window: %" PRIu64 " us", windowUs);
+
+    m_timerThread = std::make_shared<std::thread>(&WriteCombiningChannel::timerThreadFunction, this);
+}
+
+WriteCombiningChannel::~WriteCombiningChannel()
+{
+    SWSS_LOG_ENTER();
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        m_runTimerThread = false;
+    }
+
+    m_cv.notify_all();
+
+    m_timerThread->join();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    flushPending();
+
+    SWSS_LOG_NOTICE("combined %" PRIu64 " operations", m_combinedCount);
+}
+
+std::shared_ptr<Channel> WriteCombiningChannel::getChannel() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_channel;
+}
+
+void WriteCombiningChannel::setResponseTimeout(
+        _In_ uint64_t responseTimeout)
+{
+    SWSS_LOG_ENTER();
+
+    Channel::setResponseTimeout(responseTimeout);
+
+    m_channel->setResponseTimeout(responseTimeout);
+}
+
+void WriteCombiningChannel::setBuffered(
+        _In_ bool buffered)
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_buffered = buffered;
+
+    m_channel->setBuffered(buffered);
+}
+
+void WriteCombiningChannel::flush()
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    flushPending();
+
+    m_channel->flush();
+}
+
+void WriteCombiningChannel::set(
+        _In_ const std::string& key,
+        _In_ const std::vector<swss::FieldValueTuple>& values,
+        _In_ const std::string& command)
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    nextCorrelationId();
+
+    if (command == REDIS_ASIC_STATE_COMMAND_CREATE ||
+            (command == REDIS_ASIC_STATE_COMMAND_SET && values.size() == 1))
+    {
+        addOperation(key, values, command);
+        return;
+    }
+
+    flushPending();
+
+    m_channel->set(key, values, command);
+}
+
+void WriteCombiningChannel::del(
+        _In_ const std::string& key,
+        _In_ const std::string& command)
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    nextCorrelationId();
+
+    if (command == REDIS_ASIC_STATE_COMMAND_REMOVE)
+    {
+        addOperation(key, {}, command);
+        return;
+    }
+
+    flushPending();
+
+    m_channel->del(key, command);
+}
+
+bool WriteCombiningChannel::isPipelined() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_channel->isPipelined();
+}
+
+sai_status_t WriteCombiningChannel::wait(
+        _In_ const std::string& command,
+        _Out_ swss::KeyOpFieldsValuesTuple& kco)
+{
+    SWSS_LOG_ENTER();
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        flushPending();
+    }
+
+    // don't hold lock while waiting, so timer and other senders can proceed
+
+    return m_channel->wait(command, kco);
+}
+
+uint64_t WriteCombiningChannel::getCombinedCount() const
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_combinedCount;
+}
+
+void WriteCombiningChannel::notificationThreadFunction()
+{
+    SWSS_LOG_ENTER();
+
+    // notifications are handled by underlying channel
+}
+
+bool WriteCombiningChannel::isEntry(
+        _In_ const std::string& key)
+{
+    SWSS_LOG_ENTER();
+
+    auto pos = key.find(':');
+
+    if (pos == std::string::npos)
+    {
+        return false;
+    }
+
+    sai_object_type_t objectType;
+
+    sai_deserialize_object_type(key.substr(0, pos), objectType);
+
+    auto info = sai_metadata_get_object_type_info(objectType);
+
+    return info != nullptr && info->isnonobjectid;
+}
+
+void WriteCombiningChannel::addOperation(
+        _In_ const std::string& key,
+        _In_ const std::vector<swss::FieldValueTuple>& values,
+        _In_ const std::string& command)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_operations.empty())
+    {
+        m_windowStart = std::chrono::steady_clock::now();
+
+        m_cv.notify_all();
+    }
+
+    if (command == REDIS_ASIC_STATE_COMMAND_SET)
+    {
+        const auto& attr = fvField(values.at(0));
+
+        auto& sets = m_pendingSets[key];
+
+        auto it = sets.find(attr);
+
+        if (it != sets.end())
+        {
+            // only last value of attribute matters
+
+            cancelOperation(it->second);
+        }
+
+        sets[attr] = m_operations.size();
+
+        m_operations.push_back({key, command, values, true});
+    }
+    else if (!isEntry(key))
+    {
+        // object id create or remove may change references, don't combine
+        // operations across it
+
+        m_pendingSets.clear();
+        m_pendingCreates.clear();
+
+        m_operations.push_back({key, command, values, true});
+    }
+    else if (command == REDIS_ASIC_STATE_COMMAND_CREATE)
+    {
+        m_pendingSets.erase(key);
+
+        m_pendingCreates[key] = m_operations.size();
+
+        m_operations.push_back({key, command, values, true});
+    }
+    else
+    {
+        auto it = m_pendingCreates.find(key);
+
+        if (it != m_pendingCreates.end())
+        {
+            // entry was created in this window, entries can't be referenced
+            // so create, sets and remove can be dropped together
+
+            cancelOperation(it->second);
+
+            for (auto& set: m_pendingSets[key])
+            {
+                cancelOperation(set.second);
+            }
+
+            m_combinedCount++; // remove itself
+
+            m_pendingCreates.erase(it);
+            m_pendingSets.erase(key);
+        }
+        else
+        {
+            m_pendingSets.erase(key);
+
+            m_operations.push_back({key, command, values, true});
+        }
+    }
+
+    if (m_operations.size() >= MAX_PENDING_OPERATIONS)
+    {
+        flushPending();
+    }
+}
+
+void WriteCombiningChannel::cancelOperation(
+        _In_ size_t index)
+{
+    SWSS_LOG_ENTER();
+
+    auto& op = m_operations.at(index);
+
+    if (op.valid)
+    {
+        op.valid = false;
+
+        op.values.clear();
+
+        m_combinedCount++;
+    }
+}
+
+void WriteCombiningChannel::flushPending()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_operations.empty())
+    {
+        return;
+    }
+
+    // clear state before sending, so exception will not leave stale indexes
+
+    auto operations = std::move(m_operations);
+
+    m_operations.clear();
+    m_pendingSets.clear();
+    m_pendingCreates.clear();
+
+    for (const auto& op: operations)
+    {
+        if (!op.valid)
+        {
+            continue;
+        }
+
+        if (op.command == REDIS_ASIC_STATE_COMMAND_REMOVE)
+        {
+            m_channel->del(op.key, op.command);
+        }
+        else
+        {
+            m_channel->set(op.key, op.values, op.command);
+        }
+    }
+}
+
+void WriteCombiningChannel::timerThreadFunction()
+{
+    SWSS_LOG_ENTER();
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    while (m_runTimerThread)
+    {
+        if (m_operations.empty())
+        {
+            m_cv.wait(lock);
+            continue;
+        }
+
+        auto deadline = m_windowStart + std::chrono::microseconds(m_windowUs);
+
+        if (std::chrono::steady_clock::now() < deadline)
+        {
+            m_cv.wait_until(lock, deadline);
+            continue;
+        }
+
+        try
+        {
+            flushPending();
+
+            if (m_buffered)
+            {
+                // otherwise operations would stay in underlying channel
+                // buffer until next flush
+
+                m_channel->flush();
+            }
+        }
+        catch (const std::exception& e)
+        {
+            SWSS_LOG_ERROR("failed to flush pending operations: %s", e.what());
+        }
+    }
+}
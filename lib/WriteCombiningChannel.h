@@ -0,0 +1,170 @@
+#pragma once
+
+#include "Channel.h"
+
+#include <memory>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <chrono>
+#include <condition_variable>
+
+namespace sairedis
+{
+    /**
+     * @brief Channel which combines redundant writes within time window.
+     *
+     * Create, remove and set operations are held for up to window time.
+     * While held, set of the same attribute on the same object replaces
+     * previous pending set, and create of non object id entry followed by
+     * its remove cancels both, together with sets in between.
+     *
+     * Create and remove of object id objects are kept in place and act as
+     * barrier: sets are not combined across them, since they may change
+     * references which later operations depend on.
+     *
+     * Pending operations are sent in original order when window expires,
+     * before any other message is sent (get, notify syncd, bulk, ...), on
+     * flush and before waiting for response.
+     *
+     * Since operations are not answered until they are sent, this channel
+     * can be used only in asynchronous mode.
+     *
+     * This class is thread safe.
+     */
+    class WriteCombiningChannel:
+        public Channel
+    {
+        public:
+
+            WriteCombiningChannel(
+                    _In_ std::shared_ptr<Channel> channel,
+                    _In_ uint64_t windowUs);
+
+            virtual ~WriteCombiningChannel();
+
+        public:
+
+            /**
+             * @brief Get underlying channel.
+             */
+            std::shared_ptr<Channel> getChannel() const;
+
+            virtual void setResponseTimeout(
+                    _In_ uint64_t responseTimeout) override;
+
+            virtual void setBuffered(
+                    _In_ bool buffered) override;
+
+            virtual void flush() override;
+
+            virtual void set(
+                    _In_ const std::string& key,
+                    _In_ const std::vector<swss::FieldValueTuple>& values,
+                    _In_ const std::string& command) override;
+
+            virtual void del(
+                    _In_ const std::string& key,
+                    _In_ const std::string& command) override;
+
+            virtual bool isPipelined() const override;
+
+            virtual sai_status_t wait(
+                    _In_ const std::string& command,
+                    _Out_ swss::KeyOpFieldsValuesTuple& kco) override;
+
+            /**
+             * @brief Get number of operations which were not sent, because
+             * they were combined with other operations.
+             */
+            uint64_t getCombinedCount() const;
+
+        protected:
+
+            virtual void notificationThreadFunction() override;
+
+        private:
+
+            typedef struct _Operation
+            {
+                std::string key;
+
+                std::string command;
+
+                std::vector<swss::FieldValueTuple> values;
+
+                bool valid;
+
+            } Operation;
+
+            /**
+             * @brief Add operation to pending operations.
+             *
+             * Mutex must be held.
+             */
+            void addOperation(
+                    _In_ const std::string& key,
+                    _In_ const std::vector<swss::FieldValueTuple>& values,
+                    _In_ const std::string& command);
+
+            /**
+             * @brief Drop pending operation.
+             *
+             * Mutex must be held.
+             */
+            void cancelOperation(
+                    _In_ size_t index);
+
+            /**
+             * @brief Send all pending operations to underlying channel.
+             *
+             * Mutex must be held.
+             */
+            void flushPending();
+
+            void timerThreadFunction();
+
+            static bool isEntry(
+                    _In_ const std::string& key);
+
+        public:
+
+            /**
+             * @brief Maximum number of pending operations, when reached
+             * pending operations are sent.
+             */
+            static constexpr size_t MAX_PENDING_OPERATIONS = 16 * 1024;
+
+        private:
+
+            std::shared_ptr<Channel> m_channel;
+
+            uint64_t m_windowUs;
+
+            mutable std::mutex m_mutex;
+
+            std::condition_variable m_cv;
+
+            std::vector<Operation> m_operations;
+
+            /**
+             * @brief Index of pending set for each object key and attribute.
+             */
+            std::map<std::string, std::map<std::string, size_t>> m_pendingSets;
+
+            /**
+             * @brief Index of pending create for each entry key.
+             */
+            std::map<std::string, size_t> m_pendingCreates;
+
+            std::chrono::steady_clock::time_point m_windowStart;
+
+            uint64_t m_combinedCount;
+
+            bool m_buffered;
+
+            bool m_runTimerThread;
+
+            std::shared_ptr<std::thread> m_timerThread;
+    };
+}
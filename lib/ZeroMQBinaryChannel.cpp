@@ -0,0 +1,339 @@
+#include "ZeroMQBinaryChannel.h"
+
+#include "sairediscommon.h"
+
+#include "meta/sai_serialize.h"
+#include "meta/ZeroMQFrameCodec.h"
+
+#include "swss/logger.h"
+
+#include <zmq.h>
+
+#include <inttypes.h>
+
+#include <chrono>
+
+using namespace sairedis;
+
+#define ZMQ_MAX_RETRY 10
+#define ZMQ_LINGER_MS 1000
+
+ZeroMQBinaryChannel::ZeroMQBinaryChannel(
+        _In_ const std::string& endpoint,
+        _In_ const std::string& ntfEndpoint,
+        _In_ Channel::Callback callback):
+    ZeroMQChannel(endpoint, ntfEndpoint, callback, ZMQ_DEALER, "", false),
+    m_buffered(false),
+    m_staleCorrelationId(NO_CORRELATION_ID)
+{
+    SWSS_LOG_ENTER();
+
+    // don't block on exit forever if syncd is gone
+
+    int linger = ZMQ_LINGER_MS;
+
+    zmq_setsockopt(m_socket, ZMQ_LINGER, &linger, sizeof(linger));
+}
+
+ZeroMQBinaryChannel::ZeroMQBinaryChannel(
+        _In_ const std::string& endpoint,
+        _In_ const std::string& ntfEndpoint,
+        _In_ Channel::Callback callback,
+        _In_ const std::string& identity):
+    ZeroMQChannel(endpoint, ntfEndpoint, callback, ZMQ_DEALER, identity, true),
+    m_buffered(false),
+    m_staleCorrelationId(NO_CORRELATION_ID)
+{
+    SWSS_LOG_ENTER();
+
+    int linger = ZMQ_LINGER_MS;
+
+    zmq_setsockopt(m_socket, ZMQ_LINGER, &linger, sizeof(linger));
+}
+
+ZeroMQBinaryChannel::~ZeroMQBinaryChannel()
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    try
+    {
+        sendPending();
+    }
+    catch (const std::exception& e)
+    {
+        SWSS_LOG_ERROR("failed to send pending frames: %s", e.what());
+    }
+}
+
+void ZeroMQBinaryChannel::setBuffered(
+        _In_ bool buffered)
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_buffered = buffered;
+
+    if (!buffered)
+    {
+        sendPending();
+    }
+}
+
+void ZeroMQBinaryChannel::flush()
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    sendPending();
+}
+
+void ZeroMQBinaryChannel::set(
+        _In_ const std::string& key,
+        _In_ const std::vector<swss::FieldValueTuple>& values,
+        _In_ const std::string& command)
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_pendingFrames.emplace_back();
+
+    ZeroMQFrameCodec::encode(key, command, values, nextCorrelationId(), m_pendingFrames.back());
+
+    if (!m_buffered || m_pendingFrames.size() >= MAX_PENDING_FRAMES)
+    {
+        sendPending();
+    }
+}
+
+void ZeroMQBinaryChannel::del(
+        _In_ const std::string& key,
+        _In_ const std::string& command)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<swss::FieldValueTuple> values;
+
+    set(key, values, command);
+}
+
+bool ZeroMQBinaryChannel::isPipelined() const
+{
+    SWSS_LOG_ENTER();
+
+    return true;
+}
+
+bool ZeroMQBinaryChannel::isFullDuplex() const
+{
+    SWSS_LOG_ENTER();
+
+    return true;
+}
+
+void ZeroMQBinaryChannel::sendPending()
+{
+    SWSS_LOG_ENTER();
+
+    size_t count = m_pendingFrames.size();
+
+    for (size_t idx = 0; idx < count; idx++)
+    {
+        const auto& frame = m_pendingFrames[idx];
+
+        int flags = (idx + 1 < count) ? ZMQ_SNDMORE : 0;
+
+        for (int i = 0; true ; ++i)
+        {
+            int rc = zmq_send(m_socket, frame.data(), frame.size(), flags);
+
+            if (rc < 0 && zmq_errno() == EINTR && i < ZMQ_MAX_RETRY)
+            {
+                continue;
+            }
+
+            if (rc < 0)
+            {
+                m_pendingFrames.clear();
+
+                SWSS_LOG_THROW("zmq_send failed, on endpoint %s, zmqerrno: %d: %s",
+                        m_endpoint.c_str(),
+                        zmq_errno(),
+                        zmq_strerror(zmq_errno()));
+            }
+
+            break;
+        }
+    }
+
+    if (count > 1)
+    {
+        SWSS_LOG_DEBUG("sent %zu frames in single message", count);
+    }
+
+    m_pendingFrames.clear();
+}
+
+bool ZeroMQBinaryChannel::receive(
+        _In_ const std::string& command,
+        _Out_ swss::KeyOpFieldsValuesTuple& kco,
+        _Out_ uint64_t& correlationId)
+{
+    SWSS_LOG_ENTER();
+
+    zmq_pollitem_t items [1] = { };
+
+    items[0].socket = m_socket;
+    items[0].events = ZMQ_POLLIN;
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(m_responseTimeoutMs);
+
+    // socket is not thread safe, but poll only short slices with mutex held,
+    // so other threads can send requests while this one is waiting
+
+    std::unique_lock<std::mutex> lock(m_mutex, std::defer_lock);
+
+    for (int i = 0; true ; )
+    {
+        lock.lock();
+
+        int rc = zmq_poll(items, 1, RECEIVE_SLICE_MS);
+
+        if (rc > 0)
+        {
+            break;
+        }
+
+        if (rc < 0 && zmq_errno() == EINTR && i < ZMQ_MAX_RETRY)
+        {
+            lock.unlock();
+            ++i;
+            continue;
+        }
+
+        if (rc < 0)
+        {
+            SWSS_LOG_THROW("zmq_poll failed, zmqerrno: %d", zmq_errno());
+        }
+
+        lock.unlock();
+
+        if (std::chrono::steady_clock::now() >= deadline)
+        {
+            SWSS_LOG_ERROR("zmq_poll timed out for: %s", command.c_str());
+
+            return false;
+        }
+    }
+
+    zmq_msg_t msg;
+
+    zmq_msg_init(&msg);
+
+    int rc;
+
+    for (int i = 0; true ; ++i)
+    {
+        rc = zmq_msg_recv(&msg, m_socket, 0);
+
+        if (rc < 0 && zmq_errno() == EINTR && i < ZMQ_MAX_RETRY)
+        {
+            continue;
+        }
+
+        break;
+    }
+
+    lock.unlock();
+
+    if (rc < 0)
+    {
+        zmq_msg_close(&msg);
+
+        SWSS_LOG_THROW("zmq_msg_recv failed, zmqerrno: %d", zmq_errno());
+    }
+
+    try
+    {
+        ZeroMQFrameCodec::decode(zmq_msg_data(&msg), zmq_msg_size(&msg), kco, correlationId);
+    }
+    catch (const std::exception&)
+    {
+        zmq_msg_close(&msg);
+        throw;
+    }
+
+    zmq_msg_close(&msg);
+
+    return true;
+}
+
+sai_status_t ZeroMQBinaryChannel::wait(
+        _In_ const std::string& command,
+        _Out_ swss::KeyOpFieldsValuesTuple& kco)
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_INFO("wait for %s response", command.c_str());
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        // response may be for request which was not sent yet
+
+        sendPending();
+    }
+
+    m_responseCorrelationId = NO_CORRELATION_ID;
+
+    uint64_t correlationId;
+
+    while (true)
+    {
+        if (!receive(command, kco, correlationId))
+        {
+            // unlike REQ socket, DEALER socket is still usable after timeout,
+            // caller will fail all requests in flight, so responses to them
+            // which arrive later must be skipped
+
+            m_staleCorrelationId = getRequestCorrelationId();
+
+            // discarded frame may be already decoded
+
+            kco = swss::KeyOpFieldsValuesTuple();
+
+            return SAI_STATUS_FAILURE;
+        }
+
+        if (correlationId != NO_CORRELATION_ID && correlationId <= m_staleCorrelationId)
+        {
+            SWSS_LOG_WARN("discarding late response %s for request %" PRIu64 " which timed out",
+                    kfvKey(kco).c_str(),
+                    correlationId);
+
+            continue;
+        }
+
+        break;
+    }
+
+    m_responseCorrelationId = correlationId;
+
+    const std::string& opkey = kfvKey(kco);
+    const std::string& op = kfvOp(kco);
+
+    SWSS_LOG_INFO("response: op = %s, key = %s", opkey.c_str(), op.c_str());
+
+    // response may be for request of other thread, caller checks command
+
+    sai_status_t status;
+    sai_deserialize_status(opkey, status);
+
+    SWSS_LOG_DEBUG("%s status: %s", command.c_str(), opkey.c_str());
+
+    return status;
+}
@@ -0,0 +1,126 @@
+#pragma once
+
+#include "ZeroMQChannel.h"
+
+#include <mutex>
+
+namespace sairedis
+{
+    /**
+     * @brief Client side of ZMQ v2 protocol.
+     *
+     * Operations are encoded as binary frames (see ZeroMQFrameCodec) and
+     * sent over DEALER socket to ROUTER socket on syncd side. Since DEALER
+     * doesn't enforce send/receive order, many requests can be in flight
+     * and responses are matched by correlation id.
+     *
+     * When wait times out, responses to all requests sent so far are
+     * considered stale and are discarded when they arrive later.
+     *
+     * Channel is full duplex, socket is polled in short slices while
+     * waiting for response, so other threads can send requests in between.
+     *
+     * In buffered mode frames are accumulated and sent as single multipart
+     * message on flush, or before waiting for response.
+     *
+     * Notifications are received the same way as by ZeroMQChannel, or
+     * when connecting to multi client server, by subscribing to server
+     * notification publisher.
+     */
+    class ZeroMQBinaryChannel:
+        public ZeroMQChannel
+    {
+        public:
+
+            ZeroMQBinaryChannel(
+                    _In_ const std::string& endpoint,
+                    _In_ const std::string& ntfEndpoint,
+                    _In_ Channel::Callback callback);
+
+            /**
+             * @brief Create channel to multi client server.
+             *
+             * Server schedules requests per client identity, if identity is
+             * empty, it will be generated by ZMQ. Notifications are received
+             * from server publisher.
+             */
+            ZeroMQBinaryChannel(
+                    _In_ const std::string& endpoint,
+                    _In_ const std::string& ntfEndpoint,
+                    _In_ Channel::Callback callback,
+                    _In_ const std::string& identity);
+
+            virtual ~ZeroMQBinaryChannel();
+
+        public:
+
+            virtual void setBuffered(
+                    _In_ bool buffered) override;
+
+            virtual void flush() override;
+
+            virtual void set(
+                    _In_ const std::string& key,
+                    _In_ const std::vector<swss::FieldValueTuple>& values,
+                    _In_ const std::string& command) override;
+
+            virtual void del(
+                    _In_ const std::string& key,
+                    _In_ const std::string& command) override;
+
+            virtual bool isPipelined() const override;
+
+            virtual bool isFullDuplex() const override;
+
+            virtual sai_status_t wait(
+                    _In_ const std::string& command,
+                    _Out_ swss::KeyOpFieldsValuesTuple& kco) override;
+
+        private:
+
+            /**
+             * @brief Send pending frames as single multipart message.
+             *
+             * Mutex must be held.
+             */
+            void sendPending();
+
+            /**
+             * @brief Receive and decode single frame.
+             *
+             * Mutex is acquired for each poll slice, so senders are not
+             * blocked for whole wait.
+             *
+             * @return False on timeout.
+             */
+            bool receive(
+                    _In_ const std::string& command,
+                    _Out_ swss::KeyOpFieldsValuesTuple& kco,
+                    _Out_ uint64_t& correlationId);
+
+        public:
+
+            /**
+             * @brief Maximum number of frames in single multipart message.
+             */
+            static constexpr size_t MAX_PENDING_FRAMES = 1024;
+
+            /**
+             * @brief Maximum time socket is polled with mutex held.
+             */
+            static constexpr int RECEIVE_SLICE_MS = 1;
+
+        private:
+
+            std::mutex m_mutex;
+
+            bool m_buffered;
+
+            std::vector<std::string> m_pendingFrames;
+
+            /**
+             * @brief Last request id sent before wait timed out.
+             */
+            uint64_t m_staleCorrelationId;
+    };
+}
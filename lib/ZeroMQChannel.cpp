@@ -3,6 +3,7 @@
 #include "sairediscommon.h"
 
 #include "meta/sai_serialize.h"
+#include "meta/JsonFieldValueParser.h"
 
 #include "swss/logger.h"
 #include "swss/select.h"
@@ -19,13 +20,28 @@ ZeroMQChannel::ZeroMQChannel(
         _In_ const std::string& endpoint,
         _In_ const std::string& ntfEndpoint,
         _In_ Channel::Callback callback):
+    ZeroMQChannel(endpoint, ntfEndpoint, callback, ZMQ_REQ, "", false)
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+ZeroMQChannel::ZeroMQChannel(
+        _In_ const std::string& endpoint,
+        _In_ const std::string& ntfEndpoint,
+        _In_ Channel::Callback callback,
+        _In_ int socketType,
+        _In_ const std::string& identity,
+        _In_ bool subscribe):
     Channel(callback),
     m_endpoint(endpoint),
     m_ntfEndpoint(ntfEndpoint),
     m_context(nullptr),
     m_socket(nullptr),
     m_ntfContext(nullptr),
-    m_ntfSocket(nullptr)
+    m_ntfSocket(nullptr),
+    m_subscribe(subscribe)
 {
     SWSS_LOG_ENTER();
 
@@ -35,11 +51,28 @@ ZeroMQChannel::ZeroMQChannel(
 
     m_context = zmq_ctx_new();
 
-    m_socket = zmq_socket(m_context, ZMQ_REQ);
+    m_socket = zmq_socket(m_context, socketType);
+
+    int rc;
+
+    if (identity.size())
+    {
+        // identity must be set before connect, server uses it to tell
+        // clients apart
+
+        rc = zmq_setsockopt(m_socket, ZMQ_IDENTITY, identity.data(), identity.size());
+
+        if (rc != 0)
+        {
+            SWSS_LOG_THROW("failed to set zmq identity '%s', zmqerrno: %d",
+                    identity.c_str(),
+                    zmq_errno());
+        }
+    }
 
     SWSS_LOG_NOTICE("opening zmq main endpoint: %s", endpoint.c_str());
 
-    int rc = zmq_connect(m_socket, endpoint.c_str());
+    rc = zmq_connect(m_socket, endpoint.c_str());
 
     if (rc != 0)
     {
@@ -52,11 +85,25 @@ ZeroMQChannel::ZeroMQChannel(
 
     m_ntfContext = zmq_ctx_new();
 
-    m_ntfSocket = zmq_socket(m_ntfContext, ZMQ_PULL);
-
     SWSS_LOG_NOTICE("opening zmq ntf endpoint: %s", ntfEndpoint.c_str());
 
-    rc = zmq_bind(m_ntfSocket, ntfEndpoint.c_str());
+    if (subscribe)
+    {
+        // many clients can subscribe to the same publisher, so it's the
+        // publisher which binds
+
+        m_ntfSocket = zmq_socket(m_ntfContext, ZMQ_SUB);
+
+        zmq_setsockopt(m_ntfSocket, ZMQ_SUBSCRIBE, "", 0);
+
+        rc = zmq_connect(m_ntfSocket, ntfEndpoint.c_str());
+    }
+    else
+    {
+        m_ntfSocket = zmq_socket(m_ntfContext, ZMQ_PULL);
+
+        rc = zmq_bind(m_ntfSocket, ntfEndpoint.c_str());
+    }
 
     if (rc != 0)
     {
@@ -83,29 +130,39 @@ ZeroMQChannel::~ZeroMQChannel()
     zmq_close(m_socket);
     zmq_ctx_destroy(m_context);
 
-    // create new context, and perform send to break notification recv
+    if (m_subscribe)
+    {
+        // we can't send to subscriber socket, shutdown will interrupt
+        // zmq_msg_recv with ETERM
 
-    void* ctx = zmq_ctx_new();
-    void* socket = zmq_socket(ctx, ZMQ_PUSH);
+        zmq_ctx_shutdown(m_ntfContext);
+    }
+    else
+    {
+        // create new context, and perform send to break notification recv
 
-    int rc = zmq_connect(socket, m_ntfEndpoint.c_str());
+        void* ctx = zmq_ctx_new();
+        void* socket = zmq_socket(ctx, ZMQ_PUSH);
 
-    if (rc != 0)
-    {
-        SWSS_LOG_THROW("failed to open zmq ntf endpoint %s, zmqerrno: %d",
-                m_ntfEndpoint.c_str(),
-                zmq_errno());
-    }
+        int rc = zmq_connect(socket, m_ntfEndpoint.c_str());
 
-    rc = zmq_send(socket, "1", 1, 0);
+        if (rc != 0)
+        {
+            SWSS_LOG_THROW("failed to open zmq ntf endpoint %s, zmqerrno: %d",
+                    m_ntfEndpoint.c_str(),
+                    zmq_errno());
+        }
 
-    if (rc < 0)
-    {
-        SWSS_LOG_THROW("send error: %d, errno: %d, %s", rc, zmq_errno(), strerror(zmq_errno()));
-    }
+        rc = zmq_send(socket, "1", 1, 0);
 
-    zmq_close(socket);
-    zmq_ctx_destroy(ctx);
+        if (rc < 0)
+        {
+            SWSS_LOG_THROW("send error: %d, errno: %d, %s", rc, zmq_errno(), strerror(zmq_errno()));
+        }
+
+        zmq_close(socket);
+        zmq_ctx_destroy(ctx);
+    }
 
     // when zmq context is destroyed, zmq_recv will be interrupted and errno
     // will be set to ETERM, so we don't need actual FD to be used in
@@ -127,56 +184,62 @@ void ZeroMQChannel::notificationThreadFunction()
 
     SWSS_LOG_NOTICE("start listening for notifications");
 
-    std::vector<uint8_t> buffer;
+    // zmq message is used instead of fixed buffer, so notification of any
+    // size can be received, and it's parsed directly from message data
+
+    zmq_msg_t msg;
+
+    zmq_msg_init(&msg);
 
-    buffer.resize(ZMQ_RESPONSE_BUFFER_SIZE);
+    std::vector<swss::FieldValueTuple> values;
 
     while (m_runNotificationThread)
     {
         // NOTE: this entire loop internal could be encapsulated into separate class
         // which will inherit from Selectable class, and name this as ntf receiver
 
-        int rc = zmq_recv(m_ntfSocket, buffer.data(), ZMQ_RESPONSE_BUFFER_SIZE, 0);
+        int rc = zmq_msg_recv(&msg, m_ntfSocket, 0);
 
         if (!m_runNotificationThread)
             break;
 
-        if (rc <= 0 && zmq_errno() == ETERM)
+        if (rc < 0 && zmq_errno() == ETERM)
         {
-            SWSS_LOG_NOTICE("zmq_recv interrupted with ETERM, ending thread");
+            SWSS_LOG_NOTICE("zmq_msg_recv interrupted with ETERM, ending thread");
             break;
         }
 
         if (rc < 0)
         {
-            SWSS_LOG_ERROR("zmq_recv failed, zmqerrno: %d", zmq_errno());
+            SWSS_LOG_ERROR("zmq_msg_recv failed, zmqerrno: %d", zmq_errno());
 
-            // at this point we don't know if next zmq_recv will succeed
+            // at this point we don't know if next zmq_msg_recv will succeed
 
             continue;
         }
 
-        if (rc >= ZMQ_RESPONSE_BUFFER_SIZE)
+        try
         {
-            SWSS_LOG_WARN("zmq_recv message was truncated (over %d bytes, received %d), increase buffer size, message DROPPED",
-                    ZMQ_RESPONSE_BUFFER_SIZE,
-                    rc);
+            JsonFieldValueParser::parse((const char*)zmq_msg_data(&msg), zmq_msg_size(&msg), values);
+        }
+        catch (const std::exception& e)
+        {
+            SWSS_LOG_ERROR("failed to parse notification of %zu bytes: %s, message DROPPED", zmq_msg_size(&msg), e.what());
 
             continue;
         }
 
-        buffer.at(rc) = 0; // make sure that we end string with zero before parse
-
-        SWSS_LOG_DEBUG("ntf: %s", buffer.data());
-
-        std::vector<swss::FieldValueTuple> values;
+        if (values.empty())
+        {
+            SWSS_LOG_ERROR("empty notification, message DROPPED");
 
-        swss::JSon::readJson((char*)buffer.data(), values);
+            continue;
+        }
 
-        swss::FieldValueTuple fvt = values.at(0);
+        // op and data are moved out, values are used without copy
 
-        const std::string& op = fvField(fvt);
-        const std::string& data = fvValue(fvt);
+        std::string op = std::move(fvField(values[0]));
+        std::string data = std::move(fvValue(values[0]));
 
         values.erase(values.begin());
 
@@ -185,6 +248,8 @@ void ZeroMQChannel::notificationThreadFunction()
         m_callback(op, data, values);
     }
 
+    zmq_msg_close(&msg);
+
     SWSS_LOG_NOTICE("exiting notification thread");
 }
 
@@ -216,6 +281,8 @@ void ZeroMQChannel::set(
 
     copy.insert(copy.begin(), opdata);
 
+    pushCorrelationId(copy, nextCorrelationId());
+
     std::string msg = swss::JSon::buildJson(copy);
 
     SWSS_LOG_DEBUG("sending: %s", msg.c_str());
@@ -258,6 +325,8 @@ sai_status_t ZeroMQChannel::wait(
 
     SWSS_LOG_INFO("wait for %s response", command.c_str());
 
+    m_responseCorrelationId = NO_CORRELATION_ID;
+
     zmq_pollitem_t items [1] = { };
 
     items[0].socket = m_socket;
@@ -325,6 +394,8 @@ sai_status_t ZeroMQChannel::wait(
 
     values.erase(values.begin());
 
+    m_responseCorrelationId = popCorrelationId(values);
+
     kfvFieldsValues(kco) = values;
     kfvOp(kco) = op;
     kfvKey(kco) = opkey;
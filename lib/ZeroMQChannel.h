@@ -24,6 +24,24 @@ namespace sairedis
 
             virtual ~ZeroMQChannel();
 
+        protected:
+
+            /**
+             * @brief Create channel with given main socket type.
+             *
+             * Main socket is connected to endpoint, with given identity if
+             * not empty. Notification socket is bound to notification
+             * endpoint, or when subscribe is true, it's connected to
+             * publisher on notification endpoint.
+             */
+            ZeroMQChannel(
+                    _In_ const std::string& endpoint,
+                    _In_ const std::string& ntfEndpoint,
+                    _In_ Channel::Callback callback,
+                    _In_ int socketType,
+                    _In_ const std::string& identity,
+                    _In_ bool subscribe);
+
         public:
 
             virtual void setBuffered(
@@ -48,7 +66,7 @@ namespace sairedis
 
             virtual void notificationThreadFunction() override;
 
-        private:
+        protected:
 
             std::string m_endpoint;
 
@@ -63,5 +81,7 @@ namespace sairedis
             void* m_ntfContext;
 
             void* m_ntfSocket;
+
+            bool m_subscribe;
     };
 }
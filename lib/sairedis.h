@@ -45,6 +45,16 @@ extern "C" {
  */
 #define SAI_REDIS_DEFAULT_SYNC_OPERATION_RESPONSE_TIMEOUT (60*1000)
 
+/**
+ * @brief Default time in microseconds entry operation can wait in batch.
+ */
+#define SAI_REDIS_DEFAULT_AUTO_BATCH_TIMEOUT (1000)
+
+/**
+ * @brief Default object type availability cache time to live in milliseconds.
+ */
+#define SAI_REDIS_DEFAULT_AVAILABILITY_CACHE_TTL (100)
+
 typedef enum _sai_redis_notify_syncd_t
 {
     SAI_REDIS_NOTIFY_SYNCD_INIT_VIEW,
@@ -84,8 +94,59 @@ typedef enum _sai_redis_communication_mode_t
      */
     SAI_REDIS_COMMUNICATION_MODE_ZMQ_SYNC,
 
+    /**
+     * @brief Synchronous mode using ZMQ library with binary protocol.
+     *
+     * When enabled syncd also needs to be running in zmq v2 synchronous mode.
+     * Same endpoints are used as in SAI_REDIS_COMMUNICATION_MODE_ZMQ_SYNC.
+     *
+     * Operations are sent as length prefixed binary frames over DEALER and
+     * ROUTER sockets, so many requests can be in flight and responses are
+     * matched by correlation id. Command pipeline is enabled, buffered
+     * operations are sent as single multipart message on flush or when
+     * waiting for response.
+     */
+    SAI_REDIS_COMMUNICATION_MODE_ZMQ_V2_SYNC,
+
+    /**
+     * @brief Synchronous mode using shared memory rings.
+     *
+     * When enabled syncd also needs to be running in shm synchronous mode on
+     * the same host. Client connects to syncd over unix socket given by
+     * "shm_endpoint" in context config (default "/tmp/sai_shm_ep") and
+     * receives shared memory and eventfd descriptors.
+     *
+     * Operations are encoded the same way as in zmq v2 mode and passed over
+     * single producer single consumer request ring, responses and
+     * notifications over separate rings. Command pipeline is enabled.
+     */
+    SAI_REDIS_COMMUNICATION_MODE_SHM_SYNC,
+
 } sai_redis_communication_mode_t;
 
+typedef enum _sai_redis_recording_format_t
+{
+    /**
+     * @brief Text recording format.
+     *
+     * Each record is single line with timestamp, op and serialized key and
+     * attributes.
+     */
+    SAI_REDIS_RECORDING_FORMAT_TEXT,
+
+    /**
+     * @brief Binary recording format.
+     *
+     * Records are varint encoded with object types and attribute names
+     * encoded as numbers, and file contains periodic sync points with
+     * timestamps which serve as seek index. Recording file name gets ".bin"
+     * suffix. saiplayer replays it directly and sairecconv converts it to
+     * and from text format.
+     */
+    SAI_REDIS_RECORDING_FORMAT_BINARY,
+
+} sai_redis_recording_format_t;
+
 /**
  * @brief Use Redis communication channel to handle counters.
  *
@@ -350,6 +411,180 @@ typedef enum _sai_redis_switch_attr_t
      */
     SAI_REDIS_SWITCH_ATTR_FLEX_COUNTER,
 
+    /**
+     * @brief Number of threads used to validate bulk API items.
+     *
+     * When greater than 1, metadata validation of big bulk requests is
+     * executed in parallel chunks. Value 0 is treated as 1.
+     *
+     * @type sai_uint32_t
+     * @flags CREATE_AND_SET
+     * @default 1
+     */
+    SAI_REDIS_SWITCH_ATTR_BULK_VALIDATION_THREADS,
+
+    /**
+     * @brief Maximum number of entry operations batched into single bulk message.
+     *
+     * When greater than 1, consecutive create or remove operations on non
+     * object id entries (route, neighbor, fdb, ...) of the same object type
+     * are accumulated and sent to syncd as single bulk create or bulk remove
+     * message. Batch is flushed when it reaches this size, when object type
+     * or operation changes, before any other operation, on flush and after
+     * SAI_REDIS_SWITCH_ATTR_AUTO_BATCH_TIMEOUT.
+     *
+     * In sync mode each operation still gets its own status, but since
+     * synchronous API waits for status, batching is effective only for
+     * asynchronous API or asynchronous mode. Value 0 or 1 disables batching.
+     *
+     * Changing this attribute waits for responses of requests in flight.
+     *
+     * @type sai_uint32_t
+     * @flags CREATE_AND_SET
+     * @default 0
+     */
+    SAI_REDIS_SWITCH_ATTR_AUTO_BATCH_SIZE,
+
+    /**
+     * @brief Maximum time in microseconds entry operation can wait in batch.
+     *
+     * Value 0 disables timer, batch will be flushed only by other conditions.
+     *
+     * @type sai_uint64_t
+     * @flags CREATE_AND_SET
+     * @default 1000
+     */
+    SAI_REDIS_SWITCH_ATTR_AUTO_BATCH_TIMEOUT,
+
+    /**
+     * @brief Write combining window in microseconds.
+     *
+     * When set in asynchronous mode, create, remove and set operations are
+     * held for up to this time. Within window, set of the same attribute
+     * on the same object replaces previous pending set, and create of
+     * entry (route, neighbor, fdb, ...) followed by its remove cancels both.
+     * Pending operations are sent in order when window expires, before get,
+     * notify syncd or any other operation, and on flush.
+     *
+     * Ignored in sync mode. Value 0 disables write combining.
+     *
+     * @type sai_uint64_t
+     * @flags CREATE_AND_SET
+     * @default 0
+     */
+    SAI_REDIS_SWITCH_ATTR_WRITE_COMBINING_WINDOW,
+
+    /**
+     * @brief Number of object indexes reserved from VIDCOUNTER at once.
+     *
+     * When greater than 1, range of indexes is reserved with single redis
+     * call and new object ids are allocated locally from that range, which
+     * avoids redis round trip for each created object. Indexes left unused
+     * are never reused. Counter stays shared with syncd.
+     *
+     * Value 0 or 1 allocates each index from redis.
+     *
+     * @type sai_uint64_t
+     * @flags CREATE_AND_SET
+     * @default 0
+     */
+    SAI_REDIS_SWITCH_ATTR_VID_LEASE_SIZE,
+
+    /**
+     * @brief Asynchronous recording buffer size in bytes.
+     *
+     * When greater than 0, records are appended to memory buffer and
+     * written to recording file in batches by background thread, which
+     * also syncs file to disk every second. API calls never wait for disk.
+     * When buffer is full, records are dropped and number of dropped
+     * records is recorded as comment.
+     *
+     * Value 0 writes every record synchronously.
+     *
+     * @type sai_uint64_t
+     * @flags CREATE_AND_SET
+     * @default 0
+     */
+    SAI_REDIS_SWITCH_ATTR_RECORDING_BUFFER_SIZE,
+
+    /**
+     * @brief Flight recorder size in bytes.
+     *
+     * When greater than 0, last records are kept in compressed memory ring
+     * of that size, also when recording is disabled, and written to disk
+     * only when dump is requested, on switch shutdown request notification
+     * or when syncd doesn't respond.
+     *
+     * Value 0 disables flight recorder.
+     *
+     * @type sai_uint64_t
+     * @flags CREATE_AND_SET
+     * @default 0
+     */
+    SAI_REDIS_SWITCH_ATTR_FLIGHT_RECORDER_SIZE,
+
+    /**
+     * @brief Dump flight recorder.
+     *
+     * When set to true, flight recorder records are written to
+     * "<output dir>/<recording file>.flight.<timestamp>". Caller failure
+     * handler can use it before exiting.
+     *
+     * @type bool
+     * @flags SET_ONLY
+     * @default false
+     */
+    SAI_REDIS_SWITCH_ATTR_FLIGHT_RECORDER_DUMP,
+
+    /**
+     * @brief Recording file format.
+     *
+     * @type sai_redis_recording_format_t
+     * @flags CREATE_AND_SET
+     * @default SAI_REDIS_RECORDING_FORMAT_TEXT
+     */
+    SAI_REDIS_SWITCH_ATTR_RECORDING_FORMAT,
+
+    /**
+     * @brief Enable client capability cache.
+     *
+     * When enabled, attribute capability and attribute enum values
+     * capability query answers are cached per switch and repeated queries
+     * are answered without sending them to syncd. Disabling clears cache.
+     *
+     * @type bool
+     * @flags CREATE_AND_SET
+     * @default true
+     */
+    SAI_REDIS_SWITCH_ATTR_CAPABILITY_CACHE,
+
+    /**
+     * @brief Capability cache file.
+     *
+     * When set, cached capabilities are loaded from file and new ones are
+     * appended to it, so they survive client restart. File written by
+     * different sairedis/SAI revision or before last reboot is truncated,
+     * since vendor SAI or hardware could change. Setting empty disables
+     * persistence.
+     *
+     * @type sai_s8_list_t
+     * @flags CREATE_AND_SET
+     * @default empty
+     */
+    SAI_REDIS_SWITCH_ATTR_CAPABILITY_CACHE_FILE,
+
+    /**
+     * @brief Object type availability cache time to live in milliseconds.
+     *
+     * Cache is also invalidated when any object is created or removed by
+     * this client. Value 0 disables availability cache.
+     *
+     * @type sai_uint64_t
+     * @flags CREATE_AND_SET
+     * @default 100
+     */
+    SAI_REDIS_SWITCH_ATTR_AVAILABILITY_CACHE_TTL,
+
 } sai_redis_switch_attr_t;
 
 /**
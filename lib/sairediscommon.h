@@ -16,6 +16,8 @@
 #define REDIS_COMMUNICATION_MODE_REDIS_ASYNC_STRING "redis_async"
 #define REDIS_COMMUNICATION_MODE_REDIS_SYNC_STRING  "redis_sync"
 #define REDIS_COMMUNICATION_MODE_ZMQ_SYNC_STRING    "zmq_sync"
+#define REDIS_COMMUNICATION_MODE_ZMQ_V2_SYNC_STRING "zmq_v2_sync"
+#define REDIS_COMMUNICATION_MODE_SHM_SYNC_STRING    "shm_sync"
 
 /*
  * Asic state table commands. Those names are special and they will be used
@@ -37,6 +39,10 @@
 
 #define REDIS_ASIC_STATE_COMMAND_GET_STATS          "get_stats"
 #define REDIS_ASIC_STATE_COMMAND_CLEAR_STATS        "clear_stats"
+#define REDIS_ASIC_STATE_COMMAND_GET_STATS_EXT      "get_stats_ext"
+
+#define REDIS_ASIC_STATE_COMMAND_BULK_GET_STATS     "bulk_get_stats"
+#define REDIS_ASIC_STATE_COMMAND_BULK_CLEAR_STATS   "bulk_clear_stats"
 
 #define REDIS_ASIC_STATE_COMMAND_GETRESPONSE        "getresponse"
 
@@ -52,6 +58,26 @@
 #define REDIS_ASIC_STATE_COMMAND_OBJECT_TYPE_GET_AVAILABILITY_QUERY     "object_type_get_availability_query"
 #define REDIS_ASIC_STATE_COMMAND_OBJECT_TYPE_GET_AVAILABILITY_RESPONSE  "object_type_get_availability_response"
 
+#define REDIS_ASIC_STATE_COMMAND_STATS_CAPABILITY_QUERY      "stats_capability_query"
+#define REDIS_ASIC_STATE_COMMAND_STATS_CAPABILITY_RESPONSE   "stats_capability_response"
+
+/*
+ * Stats request fields. Mode is sent as first field of get_stats_ext and
+ * bulk stats requests, bulk stats requests then carry comma separated list
+ * of counter ids, followed by one field per object.
+ */
+
+#define REDIS_STATS_MODE_FIELD      "STATS_MODE"
+#define REDIS_STATS_COUNTERS_FIELD  "COUNTER_IDS"
+
+/*
+ * Correlation id field, appended as last field value pair to request and
+ * response messages by channels which can carry it (ZMQ). It's never passed
+ * through redis, since request fields are written to ASIC DB.
+ */
+
+#define REDIS_CORRELATION_ID_FIELD "correlation_id"
+
 #define REDIS_FLEX_COUNTER_COMMAND_START_POLL       "start_poll"
 #define REDIS_FLEX_COUNTER_COMMAND_STOP_POLL        "stop_poll"
 #define REDIS_FLEX_COUNTER_COMMAND_SET_GROUP        "set_counter_group"
@@ -13,12 +13,22 @@ extern "C" {
 #include "meta/sai_serialize.h"
 #include "meta/SaiAttributeList.h"
 #include "meta/Globals.h"
+#include "meta/SaiObjectCollection.h"
+#include "meta/OidRefCounter.h"
+#include "meta/Meta.h"
+#include "meta/MetaTestSaiInterface.h"
 
 #include <unistd.h>
+#include <arpa/inet.h>
+#include <malloc.h>
 
 #include <iostream>
+#include <cstring>
 #include <chrono>
 #include <vector>
+#include <atomic>
+#include <new>
+#include <functional>
 
 #define ASSERT_EQ(a,b) if ((a) != (b)) { SWSS_LOG_THROW("ASSERT EQ FAILED: " #a " != " #b); }
 
@@ -27,6 +37,34 @@ using namespace sairedis;
 
 const std::string SairedisRecFilename = "sairedis.rec";
 
+/*
+ * Count heap allocations, used to compare serialization paths.
+ */
+static std::atomic<uint64_t> g_allocations(0);
+
+void* operator new(size_t size)
+{
+    // SWSS_LOG_ENTER() omitted, logger itself may allocate
+
+    g_allocations++;
+
+    void* ptr = malloc(size);
+
+    if (ptr == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+
+    return ptr;
+}
+
+void operator delete(void* ptr) noexcept
+{
+    // SWSS_LOG_ENTER() omitted, logger itself may allocate
+
+    free(ptr);
+}
+
 sai_object_type_t sai_object_type_query(
         _In_ sai_object_id_t objectId)
 {
@@ -169,6 +207,163 @@ void test_deserialize_route_entry(int n)
     std::cout << "ms: " << (double)us.count()/1000 << " / " << n << std::endl;
 }
 
+int32_t deserialize_enum_linear(
+        _In_ const char* name,
+        _In_ const sai_enum_metadata_t* meta)
+{
+    SWSS_LOG_ENTER();
+
+    for (size_t i = 0; i < meta->valuescount; ++i)
+    {
+        if (strcmp(name, meta->valuesnames[i]) == 0)
+        {
+            return meta->values[i];
+        }
+    }
+
+    return -1;
+}
+
+void test_deserialize_enum(
+        _In_ const sai_enum_metadata_t* meta,
+        _In_ int n)
+{
+    SWSS_LOG_ENTER();
+
+    std::cout << meta->name << " values: " << meta->valuescount << std::endl;
+
+    int64_t sum = 0;
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    for (int i = 0; i < n; i++)
+    {
+        for (size_t j = 0; j < meta->valuescount; j++)
+        {
+            sum += deserialize_enum_linear(meta->valuesnames[j], meta);
+        }
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+    auto time = end - start;
+    auto us = std::chrono::duration_cast<std::chrono::microseconds>(time);
+    std::cout << "linear ms: " << (double)us.count()/1000 << " / " << n << std::endl;
+
+    int64_t sum2 = 0;
+
+    start = std::chrono::high_resolution_clock::now();
+
+    for (int i = 0; i < n; i++)
+    {
+        for (size_t j = 0; j < meta->valuescount; j++)
+        {
+            int32_t value;
+            sai_deserialize_enum_name(meta->valuesnames[j], meta, value);
+            sum2 += value;
+        }
+    }
+
+    end = std::chrono::high_resolution_clock::now();
+    time = end - start;
+    us = std::chrono::duration_cast<std::chrono::microseconds>(time);
+    std::cout << "index ms: " << (double)us.count()/1000 << " / " << n << std::endl;
+
+    ASSERT_EQ(sum, sum2);
+}
+
+template <typename T>
+void test_deserialize_scalar(
+        _In_ const char* name,
+        _In_ const std::vector<std::string>& values,
+        _In_ std::function<void(const std::string&, T&)> reference,
+        _In_ std::function<void(const std::string&, T&)> deserialize,
+        _In_ int n)
+{
+    SWSS_LOG_ENTER();
+
+    std::cout << name << " values: " << values.size() << std::endl;
+
+    std::vector<T> expected(values.size());
+    std::vector<T> result(values.size());
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    for (int i = 0; i < n; i++)
+    {
+        for (size_t j = 0; j < values.size(); j++)
+        {
+            reference(values[j], expected[j]);
+        }
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+    auto time = end - start;
+    auto us = std::chrono::duration_cast<std::chrono::microseconds>(time);
+    std::cout << "reference ms: " << (double)us.count()/1000 << " / " << n << std::endl;
+
+    start = std::chrono::high_resolution_clock::now();
+
+    for (int i = 0; i < n; i++)
+    {
+        for (size_t j = 0; j < values.size(); j++)
+        {
+            deserialize(values[j], result[j]);
+        }
+    }
+
+    end = std::chrono::high_resolution_clock::now();
+    time = end - start;
+    us = std::chrono::duration_cast<std::chrono::microseconds>(time);
+    std::cout << "fast path ms: " << (double)us.count()/1000 << " / " << n << std::endl;
+
+    ASSERT_EQ(memcmp(expected.data(), result.data(), sizeof(T) * values.size()), 0);
+}
+
+void test_deserialize_scalars(int n)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<std::string> oids;
+    std::vector<std::string> ipv4s;
+    std::vector<std::string> ipv6s;
+
+    for (uint32_t i = 0; i < 64; i++)
+    {
+        oids.push_back(sai_serialize_object_id(0x2a000000000000 + i * 0x10001));
+
+        sai_ip_address_t ip;
+
+        memset(&ip, 0, sizeof(ip));
+
+        ip.addr_family = SAI_IP_ADDR_FAMILY_IPV4;
+        ip.addr.ip4 = htonl(0x0a000000 + i * 0x10101);
+
+        ipv4s.push_back(sai_serialize_ip_address(ip));
+
+        ip.addr_family = SAI_IP_ADDR_FAMILY_IPV6;
+        ip.addr.ip6[0] = 0xfc;
+        ip.addr.ip6[15] = (uint8_t)i;
+        ip.addr.ip6[7] = (uint8_t)(i * 3);
+
+        ipv6s.push_back(sai_serialize_ip_address(ip));
+    }
+
+    test_deserialize_scalar<sai_object_id_t>("oid", oids,
+            [](const std::string& s, sai_object_id_t& oid) { oid = strtoull(s.c_str() + 4, NULL, 16); },
+            [](const std::string& s, sai_object_id_t& oid) { sai_deserialize_object_id(s, oid); },
+            n);
+
+    test_deserialize_scalar<sai_ip4_t>("ipv4", ipv4s,
+            [](const std::string& s, sai_ip4_t& ip) { inet_pton(AF_INET, s.c_str(), &ip); },
+            [](const std::string& s, sai_ip4_t& ip) { sai_deserialize_ipv4(s, ip); },
+            n);
+
+    test_deserialize_scalar<sai_ip_address_t>("ipv6", ipv6s,
+            [](const std::string& s, sai_ip_address_t& ip) { ip.addr_family = SAI_IP_ADDR_FAMILY_IPV6; inet_pton(AF_INET6, s.c_str(), ip.addr.ip6); },
+            [](const std::string& s, sai_ip_address_t& ip) { sai_deserialize_ip_address(s, ip); },
+            n);
+}
+
 void test_serialize_remove_oid(int n)
 {
     SWSS_LOG_ENTER();
@@ -200,6 +395,76 @@ sai_fdb_entry_t get_fdb_entry()
     return fdb_entry;
 }
 
+sai_neighbor_entry_t get_neighbor_entry()
+{
+    SWSS_LOG_ENTER();
+
+    sai_neighbor_entry_t neighbor_entry = { };
+
+    neighbor_entry.switch_id = 0x123456789abcdef;
+    neighbor_entry.rif_id = 0x123456789abcdef;
+    neighbor_entry.ip_address.addr_family = SAI_IP_ADDR_FAMILY_IPV4;
+    neighbor_entry.ip_address.addr.ip4 = 0x12345678;
+
+    return neighbor_entry;
+}
+
+template <typename T>
+void test_deserialize_entry(
+        _In_ const std::string& s,
+        _In_ void (*deserialize)(const std::string&, T&),
+        _In_ int n)
+{
+    SWSS_LOG_ENTER();
+
+    // canonical form goes through single pass parser, same key with
+    // additional whitespace falls back to json parser
+
+    auto slow = "{ " + s.substr(1);
+
+    std::cout << s << std::endl;
+
+    T entry;
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    for (int i = 0; i < n; i++)
+    {
+        deserialize(s, entry);
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+    auto time = end - start;
+    auto us = std::chrono::duration_cast<std::chrono::microseconds>(time);
+    std::cout << "fast ms: " << (double)us.count()/1000 << " / " << n << std::endl;
+
+    start = std::chrono::high_resolution_clock::now();
+
+    for (int i = 0; i < n; i++)
+    {
+        deserialize(slow, entry);
+    }
+
+    end = std::chrono::high_resolution_clock::now();
+    time = end - start;
+    us = std::chrono::duration_cast<std::chrono::microseconds>(time);
+    std::cout << "json ms: " << (double)us.count()/1000 << " / " << n << std::endl;
+}
+
+void test_deserialize_fdb_entry(int n)
+{
+    SWSS_LOG_ENTER();
+
+    test_deserialize_entry<sai_fdb_entry_t>(sai_serialize_fdb_entry(get_fdb_entry()), sai_deserialize_fdb_entry, n);
+}
+
+void test_deserialize_neighbor_entry(int n)
+{
+    SWSS_LOG_ENTER();
+
+    test_deserialize_entry<sai_neighbor_entry_t>(sai_serialize_neighbor_entry(get_neighbor_entry()), sai_deserialize_neighbor_entry, n);
+}
+
 std::string serialize_fdb_entry()
 {
     SWSS_LOG_ENTER();
@@ -617,6 +882,64 @@ std::string serialize_bulk_create_route_entry(int per)
     return str_object_type + ":" + std::to_string(entries.size()) + joined;
 }
 
+void test_bulk_route_entry_allocations(int per)
+{
+    SWSS_LOG_ENTER();
+
+    static auto route_entry = get_route_entry();
+
+    static SaiAttributeList *list = get_route_entry_list();
+
+    std::vector<std::string> ids;
+
+    for (int idx = 0; idx < per; ++idx)
+    {
+        ids.push_back(sai_serialize_route_entry(route_entry));
+    }
+
+    // field value tuples joined per entry, as bulk create did before
+
+    auto before = g_allocations.load();
+
+    std::vector<swss::FieldValueTuple> entries;
+
+    for (int idx = 0; idx < per; ++idx)
+    {
+        auto entry = SaiAttributeList::serialize_attr_list(SAI_OBJECT_TYPE_ROUTE_ENTRY, list->get_attr_count(), list->get_attr_list(), false);
+
+        std::string str_attr = Globals::joinFieldValues(entry);
+
+        swss::FieldValueTuple fvt(ids[idx], str_attr);
+
+        entries.push_back(fvt);
+    }
+
+    auto tuples = g_allocations.load() - before;
+
+    // append serialization
+
+    before = g_allocations.load();
+
+    std::vector<swss::FieldValueTuple> entries2;
+
+    entries2.reserve(per);
+
+    for (int idx = 0; idx < per; ++idx)
+    {
+        std::string str_attr;
+
+        SaiAttributeList::serialize_attr_list(str_attr, SAI_OBJECT_TYPE_ROUTE_ENTRY, list->get_attr_count(), list->get_attr_list(), false);
+
+        entries2.emplace_back(ids[idx], std::move(str_attr));
+    }
+
+    auto append = g_allocations.load() - before;
+
+    ASSERT_EQ(entries, entries2);
+
+    std::cout << "allocations per request: tuples " << tuples << " append " << append << " / per " << per << std::endl;
+}
+
 void test_serialize_bulk_create_route_entry(int n, int per)
 {
     SWSS_LOG_ENTER();
@@ -825,7 +1148,8 @@ static void test_recorder_enum_value_capability_query_response(
         status,
         object_type,
         attr_id,
-        &enum_values_capability
+        &enum_values_capability,
+        false
     );
 
     auto tokens = parseFirstRecordedAPI();
@@ -897,6 +1221,169 @@ static void test_recorder_enum_value_capability_query()
     );
 }
 
+static void test_recorder_stats_line(
+    _In_ const std::function<void(Recorder&)>& record,
+    _In_ const std::vector<std::string>& expectedOutput)
+{
+    SWSS_LOG_ENTER();
+
+    remove(SairedisRecFilename.c_str());
+
+    Recorder recorder;
+
+    recorder.enableRecording(true);
+
+    record(recorder);
+
+    auto tokens = parseFirstRecordedAPI();
+
+    ASSERT_EQ(tokens, expectedOutput);
+}
+
+static void test_recorder_stats()
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<swss::FieldValueTuple> bulk =
+    {
+        swss::FieldValueTuple("STATS_MODE", "SAI_STATS_MODE_READ"),
+        swss::FieldValueTuple("COUNTER_IDS", "SAI_QUEUE_STAT_PACKETS,SAI_QUEUE_STAT_BYTES"),
+        swss::FieldValueTuple("oid:0x15000000000001", ""),
+        swss::FieldValueTuple("oid:0x15000000000002", ""),
+    };
+
+    test_recorder_stats_line(
+        [&](Recorder& recorder) { recorder.recordBulkGetStats("SAI_OBJECT_TYPE_QUEUE:oid:0x21000000000000", bulk); },
+        {
+            "q",
+            "bulk_get_stats",
+            "SAI_OBJECT_TYPE_QUEUE:oid:0x21000000000000",
+            "STATS_MODE=SAI_STATS_MODE_READ",
+            "COUNTER_IDS=SAI_QUEUE_STAT_PACKETS,SAI_QUEUE_STAT_BYTES",
+            "oid:0x15000000000001=",
+            "oid:0x15000000000002=",
+        }
+    );
+
+    sai_status_t statuses[2] = { SAI_STATUS_SUCCESS, SAI_STATUS_INVALID_OBJECT_ID };
+    uint64_t counters[4] = { 1, 2, 3, 4 };
+
+    // counters of failed object are not recorded
+
+    test_recorder_stats_line(
+        [&](Recorder& recorder) { recorder.recordBulkGetStatsResponse(SAI_STATUS_FAILURE, 2, statuses, 2, counters); },
+        {
+            "Q",
+            "bulk_get_stats",
+            "SAI_STATUS_FAILURE",
+            "SAI_STATUS_SUCCESS=1,2",
+            "SAI_STATUS_INVALID_OBJECT_ID=",
+        }
+    );
+
+    test_recorder_stats_line(
+        [&](Recorder& recorder) { recorder.recordBulkClearStats("SAI_OBJECT_TYPE_QUEUE:oid:0x21000000000000", bulk); },
+        {
+            "q",
+            "bulk_clear_stats",
+            "SAI_OBJECT_TYPE_QUEUE:oid:0x21000000000000",
+            "STATS_MODE=SAI_STATS_MODE_READ",
+            "COUNTER_IDS=SAI_QUEUE_STAT_PACKETS,SAI_QUEUE_STAT_BYTES",
+            "oid:0x15000000000001=",
+            "oid:0x15000000000002=",
+        }
+    );
+
+    test_recorder_stats_line(
+        [&](Recorder& recorder) { recorder.recordBulkClearStatsResponse(SAI_STATUS_FAILURE, 2, statuses); },
+        {
+            "Q",
+            "bulk_clear_stats",
+            "SAI_STATUS_FAILURE",
+            "SAI_STATUS_SUCCESS",
+            "SAI_STATUS_INVALID_OBJECT_ID",
+        }
+    );
+
+    std::vector<swss::FieldValueTuple> ext =
+    {
+        swss::FieldValueTuple("STATS_MODE", "SAI_STATS_MODE_READ_AND_CLEAR"),
+        swss::FieldValueTuple("SAI_PORT_STAT_IF_IN_OCTETS", ""),
+        swss::FieldValueTuple("SAI_PORT_STAT_IF_OUT_OCTETS", ""),
+    };
+
+    test_recorder_stats_line(
+        [&](Recorder& recorder) { recorder.recordGenericGetStatsExt("SAI_OBJECT_TYPE_PORT:oid:0x1000000000002", ext); },
+        {
+            "q",
+            "get_stats_ext",
+            "SAI_OBJECT_TYPE_PORT:oid:0x1000000000002",
+            "STATS_MODE=SAI_STATS_MODE_READ_AND_CLEAR",
+            "SAI_PORT_STAT_IF_IN_OCTETS=",
+            "SAI_PORT_STAT_IF_OUT_OCTETS=",
+        }
+    );
+
+    test_recorder_stats_line(
+        [&](Recorder& recorder) { recorder.recordGenericGetStatsExtResponse(SAI_STATUS_SUCCESS, 2, counters); },
+        {
+            "Q",
+            "get_stats_ext",
+            "SAI_STATUS_SUCCESS",
+            "1",
+            "2",
+        }
+    );
+
+    test_recorder_stats_line(
+        [&](Recorder& recorder) { recorder.recordGenericGetStatsExtResponse(SAI_STATUS_FAILURE, 2, counters); },
+        {
+            "Q",
+            "get_stats_ext",
+            "SAI_STATUS_FAILURE",
+        }
+    );
+
+    // stats lines are not recorded when stats recording is disabled
+
+    test_recorder_stats_line(
+        [&](Recorder& recorder) { recorder.recordStats(false); recorder.recordBulkGetStats("SAI_OBJECT_TYPE_QUEUE:oid:0x21000000000000", bulk); },
+        { }
+    );
+
+    std::vector<swss::FieldValueTuple> capability =
+    {
+        swss::FieldValueTuple("OBJECT_TYPE", "SAI_OBJECT_TYPE_QUEUE"),
+        swss::FieldValueTuple("LIST_SIZE", "2"),
+    };
+
+    test_recorder_stats_line(
+        [&](Recorder& recorder) { recorder.recordQueryStatsCapability("oid:0x21000000000000", capability); },
+        {
+            "q",
+            "stats_capability",
+            "oid:0x21000000000000",
+            "OBJECT_TYPE=SAI_OBJECT_TYPE_QUEUE",
+            "LIST_SIZE=2",
+        }
+    );
+
+    std::vector<swss::FieldValueTuple> overflow =
+    {
+        swss::FieldValueTuple("STAT_COUNT", "5"),
+    };
+
+    test_recorder_stats_line(
+        [&](Recorder& recorder) { recorder.recordQueryStatsCapabilityResponse(SAI_STATUS_BUFFER_OVERFLOW, overflow, true); },
+        {
+            "Q",
+            "stats_capability_cached",
+            "SAI_STATUS_BUFFER_OVERFLOW",
+            "STAT_COUNT=5",
+        }
+    );
+}
+
 void test_tokenize_bulk_route_entry()
 {
     SWSS_LOG_ENTER();
@@ -977,6 +1464,276 @@ void test_tokenize_bulk_route_entry()
     std::cout << "s: " << (double)us.count()/1000000.0 << " for total routes: " <<( n * per) << std::endl;
 }
 
+static size_t get_heap_usage()
+{
+    SWSS_LOG_ENTER();
+
+    // mallinfo is deprecated in newer glibc, but mallinfo2 is not available in older
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+
+    struct mallinfo mi = mallinfo();
+
+#pragma GCC diagnostic pop
+
+    return (size_t)mi.uordblks;
+}
+
+/*
+ * Layout used by meta object collection before attribute values were
+ * interned, kept here only for comparison.
+ */
+struct LegacySaiObject
+{
+    sai_object_meta_key_t metaKey;
+
+    std::unordered_map<sai_attr_id_t, std::shared_ptr<SaiAttrWrapper>> attrs;
+};
+
+void test_meta_object_collection(int n)
+{
+    SWSS_LOG_ENTER();
+
+    auto nhmd = sai_metadata_get_attr_metadata(SAI_OBJECT_TYPE_ROUTE_ENTRY, SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID);
+    auto pamd = sai_metadata_get_attr_metadata(SAI_OBJECT_TYPE_ROUTE_ENTRY, SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION);
+
+    std::vector<sai_object_meta_key_t> keys;
+
+    for (int i = 0; i < n; i++)
+    {
+        sai_object_meta_key_t mk = { .objecttype = SAI_OBJECT_TYPE_ROUTE_ENTRY, .objectkey = { .key = { .route_entry = get_route_entry() } } };
+
+        mk.objectkey.key.route_entry.destination.addr.ip4 = 0x0a000000 + i;
+
+        keys.push_back(mk);
+    }
+
+    sai_attribute_t pa;
+
+    pa.id = SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION;
+    pa.value.s32 = SAI_PACKET_ACTION_FORWARD;
+
+    sai_attribute_t nh;
+
+    nh.id = SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID;
+
+    // routes are sharing only few next hops
+
+    size_t heap = get_heap_usage();
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    auto legacy = std::make_shared<std::unordered_map<sai_object_meta_key_t, std::shared_ptr<LegacySaiObject>, MetaKeyHasher, MetaKeyHasher>>();
+
+    for (int i = 0; i < n; i++)
+    {
+        auto obj = std::make_shared<LegacySaiObject>();
+
+        obj->metaKey = keys[i];
+
+        nh.value.oid = 0x1000000000001 + (i % 4);
+
+        obj->attrs[pa.id] = std::make_shared<SaiAttrWrapper>(pamd, pa);
+        obj->attrs[nh.id] = std::make_shared<SaiAttrWrapper>(nhmd, nh);
+
+        (*legacy)[keys[i]] = obj;
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+    auto us = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+
+    std::cout << "legacy: create ms: " << (double)us.count()/1000 << " / " << n
+        << " heap MB: " << (double)(get_heap_usage() - heap)/1024/1024 << std::endl;
+
+    start = std::chrono::high_resolution_clock::now();
+
+    for (int i = 0; i < n; i++)
+    {
+        auto attr = legacy->at(keys[i])->attrs.at(nh.id);
+
+        ASSERT_EQ(attr->getSaiAttr()->value.oid, (sai_object_id_t)(0x1000000000001 + (i % 4)));
+    }
+
+    end = std::chrono::high_resolution_clock::now();
+    us = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+
+    std::cout << "legacy: lookup ms: " << (double)us.count()/1000 << " / " << n << std::endl;
+
+    legacy = nullptr;
+
+    heap = get_heap_usage();
+
+    start = std::chrono::high_resolution_clock::now();
+
+    auto oc = std::make_shared<SaiObjectCollection>();
+
+    for (int i = 0; i < n; i++)
+    {
+        oc->createObject(keys[i]);
+
+        nh.value.oid = 0x1000000000001 + (i % 4);
+
+        oc->setObjectAttr(keys[i], *pamd, &pa);
+        oc->setObjectAttr(keys[i], *nhmd, &nh);
+    }
+
+    end = std::chrono::high_resolution_clock::now();
+    us = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+
+    std::cout << "collection: create ms: " << (double)us.count()/1000 << " / " << n
+        << " heap MB: " << (double)(get_heap_usage() - heap)/1024/1024
+        << " interned values: " << oc->getAttrValuePool().size() << std::endl;
+
+    start = std::chrono::high_resolution_clock::now();
+
+    for (int i = 0; i < n; i++)
+    {
+        auto attr = oc->getObjectAttr(keys[i], nh.id);
+
+        ASSERT_EQ(attr->getSaiAttr()->value.oid, (sai_object_id_t)(0x1000000000001 + (i % 4)));
+    }
+
+    end = std::chrono::high_resolution_clock::now();
+    us = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+
+    std::cout << "collection: lookup ms: " << (double)us.count()/1000 << " / " << n << std::endl;
+}
+
+void test_oid_ref_counter(int n, int per)
+{
+    SWSS_LOG_ENTER();
+
+    // per is number of oids referenced by single create, like members of a group
+
+    std::vector<sai_object_id_t> oids;
+
+    for (int i = 0; i < per; i++)
+    {
+        oids.push_back(0x2d000000000000 + (sai_object_id_t)i);
+    }
+
+    std::unordered_map<sai_object_id_t, int32_t> hash;
+
+    for (auto oid: oids)
+    {
+        hash[oid] = 0;
+    }
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    for (int i = 0; i < n; i++)
+    {
+        for (auto oid: oids)
+        {
+            if (hash.find(oid) == hash.end())
+            {
+                SWSS_LOG_THROW("missing oid");
+            }
+
+            hash[oid]++;
+        }
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+    auto us = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+
+    std::cout << "unordered_map: ms: " << (double)us.count()/1000 << " / " << n << " x " << per << std::endl;
+
+    OidRefCounter counter;
+
+    for (auto oid: oids)
+    {
+        counter.objectReferenceInsert(oid);
+    }
+
+    start = std::chrono::high_resolution_clock::now();
+
+    for (int i = 0; i < n; i++)
+    {
+        for (auto oid: oids)
+        {
+            counter.objectReferenceIncrement(oid);
+        }
+    }
+
+    end = std::chrono::high_resolution_clock::now();
+    us = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+
+    std::cout << "OidRefCounter single: ms: " << (double)us.count()/1000 << " / " << n << " x " << per << std::endl;
+
+    start = std::chrono::high_resolution_clock::now();
+
+    for (int i = 0; i < n; i++)
+    {
+        counter.objectReferenceIncrement(oids);
+    }
+
+    end = std::chrono::high_resolution_clock::now();
+    us = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+
+    std::cout << "OidRefCounter bulk: ms: " << (double)us.count()/1000 << " / " << n << " x " << per << std::endl;
+
+    ASSERT_EQ(counter.getObjectReferenceCount(oids[0]), 2 * n);
+}
+
+void test_meta_attr_shape_cache(int n)
+{
+    SWSS_LOG_ENTER();
+
+    Meta m(std::make_shared<MetaTestSaiInterface>());
+
+    sai_object_id_t switchId = 0;
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_SWITCH_ATTR_INIT_SWITCH;
+    attr.value.booldata = true;
+
+    ASSERT_EQ(m.create(SAI_OBJECT_TYPE_SWITCH, &switchId, SAI_NULL_OBJECT_ID, 1, &attr), SAI_STATUS_SUCCESS);
+
+    sai_object_id_t vrId = 0;
+
+    ASSERT_EQ(m.create(SAI_OBJECT_TYPE_VIRTUAL_ROUTER, &vrId, switchId, 0, &attr), SAI_STATUS_SUCCESS);
+
+    sai_attribute_t attrs[2];
+
+    attrs[0].id = SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION;
+    attrs[0].value.s32 = SAI_PACKET_ACTION_FORWARD;
+
+    attrs[1].id = SAI_ROUTE_ENTRY_ATTR_META_DATA;
+    attrs[1].value.u32 = 0;
+
+    sai_route_entry_t e;
+
+    memset(&e, 0, sizeof(e));
+
+    e.switch_id = switchId;
+    e.vr_id = vrId;
+    e.destination.mask.ip4 = 0xffffffff;
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    for (int i = 0; i < n; i++)
+    {
+        e.destination.addr.ip4 = htonl(0x0a000000 + (uint32_t)i);
+
+        ASSERT_EQ(m.create(&e, 2, attrs), SAI_STATUS_SUCCESS);
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+    auto us = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+
+    auto& cache = m.getAttrShapeCache();
+
+    double hits = (double)cache.getHitCount();
+    double total = hits + (double)cache.getMissCount();
+
+    std::cout << "meta create route: ms: " << (double)us.count()/1000 << " / " << n << std::endl;
+    std::cout << "shape cache hit rate: " << (total ? 100 * hits / total : 0) << "%"
+        << " saved ms: " << (double)cache.getSavedTimeNs()/1000000 << std::endl;
+}
+
 int main()
 {
     SWSS_LOG_ENTER();
@@ -994,6 +1751,20 @@ int main()
     test_deserialize_route_entry_meta(10000);
     test_deserialize_route_entry(10000);
 
+    std::cout << " * test deserialize entries" << std::endl;
+
+    test_deserialize_fdb_entry(10000);
+    test_deserialize_neighbor_entry(10000);
+
+    std::cout << " * test deserialize enum" << std::endl;
+
+    test_deserialize_enum(&sai_metadata_enum_sai_port_stat_t, 1000);
+    test_deserialize_enum(&sai_metadata_enum_sai_object_type_t, 1000);
+
+    std::cout << " * test deserialize scalars" << std::endl;
+
+    test_deserialize_scalars(10000);
+
     std::cout << " * test remove" << std::endl;
 
     test_serialize_remove_route_entry(10000);
@@ -1017,9 +1788,27 @@ int main()
     test_serialize_bulk_create_route_entry(10,10000);
     test_serialize_bulk_create_oid(10,10000);
 
+    std::cout << " * test bulk create allocations" << std::endl;
+
+    test_bulk_route_entry_allocations(10000);
+
     std::cout << " * test recorder" << std::endl;
 
     test_recorder_enum_value_capability_query();
 
+    test_recorder_stats();
+
+    std::cout << " * test meta object collection" << std::endl;
+
+    test_meta_object_collection(100000);
+
+    std::cout << " * test oid ref counter" << std::endl;
+
+    test_oid_ref_counter(100000, 16);
+
+    std::cout << " * test meta attr shape cache" << std::endl;
+
+    test_meta_attr_shape_cache(100000);
+
     return 0;
 }
@@ -2,38 +2,122 @@
 
 #include "sai_serialize.h"
 
+#include <inttypes.h>
+
+#include <algorithm>
+
 using namespace saimeta;
 
+template <typename T>
+static void append_raw(
+        _Inout_ std::string& key,
+        _In_ const T& value)
+{
+    SWSS_LOG_ENTER();
+
+    key.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
 void AttrKeyMap::clear()
 {
     SWSS_LOG_ENTER();
 
     m_map.clear();
+    m_hashes.clear();
+    m_collisions.clear();
 }
 
-void AttrKeyMap::insert(
-        _In_ const std::string& metaKey,
+uint64_t AttrKeyMap::hash(
         _In_ const std::string& attrKey)
 {
     SWSS_LOG_ENTER();
 
-    m_map[metaKey] = attrKey;
+    // FNV-1a
+
+    uint64_t h = 0xcbf29ce484222325ULL;
+
+    for (unsigned char c: attrKey)
+    {
+        h ^= c;
+        h *= 0x100000001b3ULL;
+    }
+
+    return h;
 }
 
+void AttrKeyMap::insert(
+        _In_ const sai_object_meta_key_t& metaKey,
+        _In_ const std::string& attrKey)
+{
+    SWSS_LOG_ENTER();
+
+    eraseMetaKey(metaKey);
+
+    uint64_t h = hash(attrKey);
+
+    m_map[metaKey] = Entry{h, attrKey};
+
+    auto it = m_hashes.find(h);
+
+    if (it == m_hashes.end())
+    {
+        m_hashes[h] = metaKey;
+        return;
+    }
+
+    SWSS_LOG_INFO("attributes key hash 0x%" PRIx64 " collision, using side table", h);
+
+    m_collisions[attrKey] = metaKey;
+}
 
 void AttrKeyMap::eraseMetaKey(
-        _In_ const std::string& metaKey)
+        _In_ const sai_object_meta_key_t& metaKey)
 {
     SWSS_LOG_ENTER();
 
     auto it = m_map.find(metaKey);
 
-    if (it != m_map.end())
+    if (it == m_map.end())
     {
-        SWSS_LOG_DEBUG("erasing attributes key %s", it->second.c_str());
+        return;
+    }
+
+    const Entry& entry = it->second;
+
+    SWSS_LOG_DEBUG("erasing attributes key hash 0x%" PRIx64, entry.hash);
+
+    MetaKeyHasher equal;
+
+    auto h = m_hashes.find(entry.hash);
+
+    if (h != m_hashes.end() && equal(h->second, metaKey))
+    {
+        m_hashes.erase(h);
+
+        // move colliding key with the same hash to main index
+
+        for (auto c = m_collisions.begin(); c != m_collisions.end(); c++)
+        {
+            if (hash(c->first) == entry.hash)
+            {
+                m_hashes[entry.hash] = c->second;
 
-        m_map.erase(it);
+                m_collisions.erase(c);
+                break;
+            }
+        }
+    }
+    else
+    {
+        auto c = m_collisions.find(entry.attrKey);
+
+        if (c != m_collisions.end() && equal(c->second, metaKey))
+        {
+            m_collisions.erase(c);
+        }
     }
+
+    m_map.erase(it);
 }
 
 bool AttrKeyMap::attrKeyExists(
@@ -41,15 +125,21 @@ bool AttrKeyMap::attrKeyExists(
 {
     SWSS_LOG_ENTER();
 
-    for (auto& it: m_map)
+    auto h = m_hashes.find(hash(attrKey));
+
+    if (h == m_hashes.end())
     {
-        if (it.second == attrKey)
-        {
-            return true;
-        }
+        return false;
+    }
+
+    if (m_map.at(h->second).attrKey == attrKey)
+    {
+        return true;
     }
 
-    return false;
+    // hash collision, check full key in side table
+
+    return m_collisions.find(attrKey) != m_collisions.end();
 }
 
 std::string AttrKeyMap::constructKey(
@@ -154,12 +244,130 @@ std::string AttrKeyMap::constructKey(
     return key;
 }
 
+std::string AttrKeyMap::constructBinaryKey(
+        _In_ sai_object_id_t switchId,
+        _In_ const sai_object_meta_key_t& metaKey,
+        _In_ uint32_t attrCount,
+        _In_ const sai_attribute_t* attrList)
+{
+    SWSS_LOG_ENTER();
+
+    if (switchId == SAI_NULL_OBJECT_ID)
+    {
+        SWSS_LOG_THROW("switchId is NULL for %s",
+                sai_serialize_object_meta_key(metaKey).c_str());
+    }
+
+    std::vector<std::pair<const sai_attr_metadata_t*, const sai_attribute_t*>> keys;
+
+    for (uint32_t idx = 0; idx < attrCount; ++idx)
+    {
+        const auto& attr = attrList[idx];
+
+        auto* md = sai_metadata_get_attr_metadata(metaKey.objecttype, attr.id);
+
+        if (!md)
+        {
+            SWSS_LOG_THROW("failed to get metadata for object type: %s and attr id: %d",
+                    sai_serialize_object_id(metaKey.objecttype).c_str(),
+                    attr.id);
+        }
+
+        if (SAI_HAS_FLAG_KEY(md->flags))
+        {
+            keys.emplace_back(md, &attr);
+        }
+    }
+
+    // make sure that keys will be always sorted by attr id
+
+    std::sort(keys.begin(), keys.end(), [](
+                const std::pair<const sai_attr_metadata_t*, const sai_attribute_t*>& a,
+                const std::pair<const sai_attr_metadata_t*, const sai_attribute_t*>& b)
+            {
+                return a.first->attrid < b.first->attrid;
+            });
+
+    // switch ID is added, since same key pattern is allowed on different switch objects
+
+    std::string key;
+
+    key.reserve(sizeof(sai_object_id_t) + keys.size() * 2 * sizeof(uint64_t));
+
+    append_raw(key, switchId);
+
+    for (auto& k: keys)
+    {
+        const auto* md = k.first;
+
+        const auto& value = k.second->value;
+
+        append_raw(key, md->attrid);
+
+        switch (md->attrvaluetype)
+        {
+            case SAI_ATTR_VALUE_TYPE_UINT32_LIST: // only for port lanes
+
+                append_raw(key, value.u32list.count);
+
+                if (value.u32list.count)
+                {
+                    key.append(reinterpret_cast<const char*>(value.u32list.list), value.u32list.count * sizeof(uint32_t));
+                }
+
+                break;
+
+            case SAI_ATTR_VALUE_TYPE_INT32:
+                append_raw(key, value.s32);
+                break;
+
+            case SAI_ATTR_VALUE_TYPE_UINT32:
+                append_raw(key, value.u32);
+                break;
+
+            case SAI_ATTR_VALUE_TYPE_UINT8:
+                append_raw(key, value.u8);
+                break;
+
+            case SAI_ATTR_VALUE_TYPE_UINT16:
+                append_raw(key, value.u16);
+                break;
+
+            case SAI_ATTR_VALUE_TYPE_OBJECT_ID:
+                append_raw(key, value.oid);
+                break;
+
+            default:
+
+                // NOTE: only primitive types should be considered as keys
+                SWSS_LOG_THROW("FATAL: attribute %s marked as key, but have invalid serialization type, FIXME",
+                        md->attridname);
+        }
+    }
+
+    return key;
+}
+
 std::vector<std::string> AttrKeyMap::getAllKeys() const
 {
     SWSS_LOG_ENTER();
 
     std::vector<std::string> vec;
 
+    for (auto& it: m_map)
+    {
+        vec.push_back(sai_serialize_object_meta_key(it.first));
+    }
+
+    return vec;
+}
+
+std::vector<sai_object_meta_key_t> AttrKeyMap::getAllMetaKeys() const
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<sai_object_meta_key_t> vec;
+
     for (auto& it: m_map)
     {
         vec.push_back(it.first);
@@ -167,3 +375,10 @@ std::vector<std::string> AttrKeyMap::getAllKeys() const
 
     return vec;
 }
+
+size_t AttrKeyMap::size() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_map.size();
+}
@@ -4,6 +4,8 @@ extern "C" {
 #include "saimetadata.h"
 }
 
+#include "MetaKeyHasher.h"
+
 #include <string>
 #include <vector>
 #include <unordered_map>
@@ -22,18 +24,32 @@ namespace saimeta
 
             void clear();
 
+            /**
+             * @brief Check if attribute key exists.
+             *
+             * @param attrKey Binary key constructed by constructBinaryKey.
+             */
             bool attrKeyExists(
                     _In_ const std::string& attrKey) const;
 
+            /**
+             * @brief Insert object attribute key.
+             *
+             * @param metaKey Object meta key.
+             * @param attrKey Binary key constructed by constructBinaryKey.
+             */
             void insert(
-                    _In_ const std::string& metaKey,
+                    _In_ const sai_object_meta_key_t& metaKey,
                     _In_ const std::string& attrKey);
 
             void eraseMetaKey(
-                    _In_ const std::string& metaKey);
+                    _In_ const sai_object_meta_key_t& metaKey);
 
             /**
-             * @brief Construct key based on attributes marked as keys.
+             * @brief Construct human readable key based on attributes marked
+             * as keys.
+             *
+             * Should be used only for logging.
              */
             static std::string constructKey(
                     _In_ sai_object_id_t switchId,
@@ -41,21 +57,63 @@ namespace saimeta
                     _In_ uint32_t attrCount,
                     _In_ const sai_attribute_t* attrList);
 
+            /**
+             * @brief Construct binary key based on attributes marked as keys.
+             *
+             * Key contains switch id and raw values of key attributes sorted
+             * by attribute id, so no string formatting is involved.
+             */
+            static std::string constructBinaryKey(
+                    _In_ sai_object_id_t switchId,
+                    _In_ const sai_object_meta_key_t& metaKey,
+                    _In_ uint32_t attrCount,
+                    _In_ const sai_attribute_t* attrList);
+
+            /**
+             * @brief Get all serialized meta keys, used for dumps.
+             */
             std::vector<std::string> getAllKeys() const;
 
+            std::vector<sai_object_meta_key_t> getAllMetaKeys() const;
+
+            size_t size() const;
+
         private:
 
+            static uint64_t hash(
+                    _In_ const std::string& attrKey);
+
+        private:
+
+            typedef struct _Entry
+            {
+                uint64_t hash;
+
+                std::string attrKey;
+
+            } Entry;
+
             /**
-             * @brief map holding attribute keys.
-             *
-             * Key is serialized meta key.
-             *
-             * Value is constructed key from attributes.
+             * @brief Map holding attribute keys of objects.
              *
              * Map must contain meta Key and attr Key, since when we are removing
              * object, we only have meta Key, and we can't construct attr Key (we
              * could since we have local db, but this way is safer).
              */
-            std::unordered_map<std::string, std::string> m_map;
+            std::unordered_map<sai_object_meta_key_t, Entry, MetaKeyHasher, MetaKeyHasher> m_map;
+
+            /**
+             * @brief Index of attribute key hashes.
+             *
+             * Value is meta key of the object which owns the hash, its full
+             * attribute key is used to check for collisions.
+             */
+            std::unordered_map<uint64_t, sai_object_meta_key_t> m_hashes;
+
+            /**
+             * @brief Side table of attribute keys which hash is already owned
+             * by different attribute key.
+             */
+            std::unordered_map<std::string, sai_object_meta_key_t> m_collisions;
     };
 }
@@ -0,0 +1,134 @@
+#include "AttrSerializerTable.h"
+
+#include "swss/logger.h"
+
+using namespace saimeta;
+
+constexpr uint32_t AttrSerializerTable::DENSE_ATTR_ID_MAX;
+
+AttrSerializerTable::AttrSerializerTable()
+{
+    SWSS_LOG_ENTER();
+
+    size_t count = sai_metadata_attr_sorted_by_id_name_count;
+
+    // reserve up front, entries are referenced by pointers
+
+    m_entries.reserve(count);
+
+    for (size_t idx = 0; idx < count; idx++)
+    {
+        const sai_attr_metadata_t* meta = sai_metadata_attr_sorted_by_id_name[idx];
+
+        m_entries.push_back(Entry{
+                meta,
+                sai_get_attr_value_serializer(*meta),
+                sai_get_attr_value_append_serializer(*meta),
+                sai_get_attr_value_deserializer(*meta) });
+    }
+
+    for (auto& entry: m_entries)
+    {
+        const sai_attr_metadata_t* meta = entry.meta;
+
+        m_names[meta->attridname] = &entry;
+
+        size_t ot = (size_t)meta->objecttype;
+
+        if (ot < (size_t)SAI_OBJECT_TYPE_MAX && meta->attrid < DENSE_ATTR_ID_MAX)
+        {
+            if (m_dense.size() <= ot)
+            {
+                m_dense.resize(ot + 1);
+            }
+
+            auto& attrs = m_dense[ot];
+
+            if (attrs.size() <= meta->attrid)
+            {
+                attrs.resize(meta->attrid + 1, nullptr);
+            }
+
+            attrs[meta->attrid] = &entry;
+        }
+        else
+        {
+            m_sparse[makeKey(meta->objecttype, meta->attrid)] = &entry;
+        }
+    }
+
+    SWSS_LOG_INFO("attr serializer table built with %zu entries", m_entries.size());
+}
+
+uint64_t AttrSerializerTable::makeKey(
+        _In_ sai_object_type_t objectType,
+        _In_ sai_attr_id_t attrId)
+{
+    SWSS_LOG_ENTER();
+
+    return ((uint64_t)objectType << 32) | attrId;
+}
+
+const AttrSerializerTable::Entry* AttrSerializerTable::find(
+        _In_ sai_object_type_t objectType,
+        _In_ sai_attr_id_t attrId) const
+{
+    SWSS_LOG_ENTER();
+
+    size_t ot = (size_t)objectType;
+
+    if (ot < m_dense.size() && attrId < DENSE_ATTR_ID_MAX)
+    {
+        auto& attrs = m_dense[ot];
+
+        return attrId < attrs.size() ? attrs[attrId] : nullptr;
+    }
+
+    auto it = m_sparse.find(makeKey(objectType, attrId));
+
+    return it == m_sparse.end() ? nullptr : it->second;
+}
+
+const AttrSerializerTable::Entry* AttrSerializerTable::find(
+        _In_ const sai_attr_metadata_t& meta) const
+{
+    SWSS_LOG_ENTER();
+
+    auto entry = find(meta.objecttype, meta.attrid);
+
+    // functions are specialized for metadata flags, so metadata must be
+    // exactly the same as the one entry was built from
+
+    if (entry && entry->meta == &meta)
+    {
+        return entry;
+    }
+
+    return nullptr;
+}
+
+const AttrSerializerTable::Entry* AttrSerializerTable::findByName(
+        _In_ const std::string& attrIdName) const
+{
+    SWSS_LOG_ENTER();
+
+    auto it = m_names.find(attrIdName);
+
+    return it == m_names.end() ? nullptr : it->second;
+}
+
+size_t AttrSerializerTable::size() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_entries.size();
+}
+
+const AttrSerializerTable& AttrSerializerTable::getInstance()
+{
+    SWSS_LOG_ENTER();
+
+    static AttrSerializerTable table;
+
+    return table;
+}
@@ -0,0 +1,99 @@
+#pragma once
+
+extern "C" {
+#include "saimetadata.h"
+}
+
+#include "sai_serialize.h"
+
+#include <vector>
+#include <string>
+#include <unordered_map>
+
+namespace saimeta
+{
+    /**
+     * @brief Per attribute serializers lookup.
+     *
+     * Serializer and deserializer functions specialized for each attribute
+     * are resolved once from sai_metadata_attr_sorted_by_id_name, so value
+     * type and metadata flags don't need to be checked on each call.
+     * Table is immutable after construction, so it can be used from
+     * multiple threads.
+     */
+    class AttrSerializerTable
+    {
+        public:
+
+            typedef struct _Entry
+            {
+                const sai_attr_metadata_t* meta;
+
+                sai_serialize_attr_value_fn serialize;
+
+                sai_serialize_attr_value_append_fn serializeAppend;
+
+                sai_deserialize_attr_value_fn deserialize;
+
+            } Entry;
+
+        public:
+
+            AttrSerializerTable();
+
+            virtual ~AttrSerializerTable() = default;
+
+        public:
+
+            /**
+             * @brief Find entry for given attribute metadata.
+             *
+             * @return Entry or nullptr if metadata is not part of SAI
+             * metadata (for example local copy of metadata).
+             */
+            const Entry* find(
+                    _In_ const sai_attr_metadata_t& meta) const;
+
+            const Entry* find(
+                    _In_ sai_object_type_t objectType,
+                    _In_ sai_attr_id_t attrId) const;
+
+            /**
+             * @brief Find entry by attribute id name.
+             *
+             * @param attrIdName Attribute id name, like SAI_PORT_ATTR_SPEED.
+             *
+             * @return Entry or nullptr if name was not found.
+             */
+            const Entry* findByName(
+                    _In_ const std::string& attrIdName) const;
+
+            size_t size() const;
+
+            static const AttrSerializerTable& getInstance();
+
+        private:
+
+            static constexpr uint32_t DENSE_ATTR_ID_MAX = 0x1000;
+
+            static uint64_t makeKey(
+                    _In_ sai_object_type_t objectType,
+                    _In_ sai_attr_id_t attrId);
+
+        private:
+
+            std::vector<Entry> m_entries;
+
+            /**
+             * @brief Entries indexed by object type and attribute id.
+             *
+             * Only attribute ids below DENSE_ATTR_ID_MAX are held here,
+             * custom and extension ranges are held in sparse map.
+             */
+            std::vector<std::vector<const Entry*>> m_dense;
+
+            std::unordered_map<uint64_t, const Entry*> m_sparse;
+
+            std::unordered_map<std::string, const Entry*> m_names;
+    };
+}
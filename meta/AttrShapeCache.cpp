@@ -0,0 +1,170 @@
+#include "AttrShapeCache.h"
+
+#include "swss/logger.h"
+
+#include <algorithm>
+
+using namespace saimeta;
+
+constexpr size_t AttrShapeCache::MAX_SHAPES;
+
+AttrShapeCache::AttrShapeCache(
+        _In_ size_t maxSize):
+    m_maxSize(maxSize),
+    m_hits(0),
+    m_misses(0),
+    m_checkTimeNs(0),
+    m_inserts(0)
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+size_t AttrShapeCache::KeyHash::operator()(
+        _In_ const std::vector<uint32_t>& key) const
+{
+    SWSS_LOG_ENTER();
+
+    size_t hash = 0;
+
+    for (auto id: key)
+    {
+        hash ^= std::hash<uint32_t>()(id) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    }
+
+    return hash;
+}
+
+std::vector<uint32_t> AttrShapeCache::makeKey(
+        _In_ sai_object_type_t objectType,
+        _In_ uint32_t attrCount,
+        _In_ const sai_attribute_t* attrList)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<uint32_t> key;
+
+    key.reserve(attrCount + 1);
+
+    for (uint32_t idx = 0; idx < attrCount; idx++)
+    {
+        key.push_back(attrList[idx].id);
+    }
+
+    // attribute order on list don't matter
+
+    std::sort(key.begin(), key.end());
+
+    key.insert(key.begin(), (uint32_t)objectType);
+
+    return key;
+}
+
+bool AttrShapeCache::find(
+        _In_ sai_object_type_t objectType,
+        _In_ uint32_t attrCount,
+        _In_ const sai_attribute_t* attrList,
+        _Out_ Shape& shape)
+{
+    SWSS_LOG_ENTER();
+
+    auto key = makeKey(objectType, attrCount, attrList);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto it = m_shapes.find(key);
+
+    if (it == m_shapes.end())
+    {
+        m_misses++;
+
+        return false;
+    }
+
+    m_hits++;
+
+    shape = it->second;
+
+    return true;
+}
+
+void AttrShapeCache::insert(
+        _In_ sai_object_type_t objectType,
+        _In_ uint32_t attrCount,
+        _In_ const sai_attribute_t* attrList,
+        _In_ const Shape& shape,
+        _In_ uint64_t checkTimeNs)
+{
+    SWSS_LOG_ENTER();
+
+    auto key = makeKey(objectType, attrCount, attrList);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (m_shapes.size() >= m_maxSize)
+    {
+        // shapes are not value dependent, so cache should never grow that much
+
+        SWSS_LOG_DEBUG("shape cache is full (%zu), not inserting", m_shapes.size());
+
+        return;
+    }
+
+    if (m_shapes.emplace(key, shape).second)
+    {
+        m_checkTimeNs += checkTimeNs;
+        m_inserts++;
+    }
+}
+
+void AttrShapeCache::clear()
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_shapes.clear();
+
+    m_hits = 0;
+    m_misses = 0;
+    m_checkTimeNs = 0;
+    m_inserts = 0;
+}
+
+size_t AttrShapeCache::size() const
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_shapes.size();
+}
+
+uint64_t AttrShapeCache::getHitCount() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_hits;
+}
+
+uint64_t AttrShapeCache::getMissCount() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_misses;
+}
+
+uint64_t AttrShapeCache::getSavedTimeNs() const
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (m_inserts == 0)
+    {
+        return 0;
+    }
+
+    return m_hits * (m_checkTimeNs / m_inserts);
+}
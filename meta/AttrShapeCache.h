@@ -0,0 +1,131 @@
+#pragma once
+
+extern "C" {
+#include "saimetadata.h"
+}
+
+#include <vector>
+#include <unordered_map>
+#include <mutex>
+#include <atomic>
+
+namespace saimeta
+{
+    /**
+     * @brief Cache of validated create attribute shapes.
+     *
+     * Shape is object type and set of attribute ids passed to create. Checks
+     * which depend only on metadata (attribute existence, duplicates, read
+     * only flag, mandatory and conditional attributes) will give the same
+     * result for each create with the same shape, so once shape passed them,
+     * only value dependent checks need to be executed again.
+     *
+     * This class is thread safe.
+     */
+    class AttrShapeCache
+    {
+        public:
+
+            /**
+             * @brief Result of metadata only checks for given shape.
+             */
+            typedef struct _Shape
+            {
+                /**
+                 * @brief Any attribute in shape is marked as key.
+                 */
+                bool haskeys;
+
+                /**
+                 * @brief Condition attributes are present in shape.
+                 *
+                 * In that case conditions depend on passed values and
+                 * conditional checks must be executed again.
+                 */
+                bool conditionsOnValues;
+
+            } Shape;
+
+        public:
+
+            AttrShapeCache(
+                    _In_ size_t maxSize = MAX_SHAPES);
+
+            virtual ~AttrShapeCache() = default;
+
+        public:
+
+            /**
+             * @brief Find shape of given attributes.
+             *
+             * @return True if shape was found, false otherwise.
+             */
+            bool find(
+                    _In_ sai_object_type_t objectType,
+                    _In_ uint32_t attrCount,
+                    _In_ const sai_attribute_t* attrList,
+                    _Out_ Shape& shape);
+
+            /**
+             * @brief Insert shape which passed metadata only checks.
+             *
+             * @param checkTimeNs Time spent on metadata only checks, used to
+             * estimate time saved by cache hits.
+             */
+            void insert(
+                    _In_ sai_object_type_t objectType,
+                    _In_ uint32_t attrCount,
+                    _In_ const sai_attribute_t* attrList,
+                    _In_ const Shape& shape,
+                    _In_ uint64_t checkTimeNs);
+
+            void clear();
+
+            size_t size() const;
+
+            uint64_t getHitCount() const;
+
+            uint64_t getMissCount() const;
+
+            /**
+             * @brief Estimated time saved by cache hits in nanoseconds.
+             *
+             * Computed as hit count multiplied by average metadata only check
+             * time measured on inserted shapes.
+             */
+            uint64_t getSavedTimeNs() const;
+
+        private:
+
+            static std::vector<uint32_t> makeKey(
+                    _In_ sai_object_type_t objectType,
+                    _In_ uint32_t attrCount,
+                    _In_ const sai_attribute_t* attrList);
+
+            struct KeyHash
+            {
+                size_t operator()(
+                        _In_ const std::vector<uint32_t>& key) const;
+            };
+
+        public:
+
+            static constexpr size_t MAX_SHAPES = 4096;
+
+        private:
+
+            size_t m_maxSize;
+
+            mutable std::mutex m_mutex;
+
+            std::unordered_map<std::vector<uint32_t>, Shape, KeyHash> m_shapes;
+
+            std::atomic<uint64_t> m_hits;
+
+            std::atomic<uint64_t> m_misses;
+
+            uint64_t m_checkTimeNs;
+
+            uint64_t m_inserts;
+    };
+}
@@ -0,0 +1,171 @@
+#include "EnumNameIndex.h"
+
+#include "swss/logger.h"
+
+#include <cstring>
+#include <memory>
+#include <unordered_map>
+
+using namespace saimeta;
+
+EnumNameIndex::EnumNameIndex(
+        _In_ const sai_enum_metadata_t* meta):
+    m_mask(0),
+    m_size(0)
+{
+    SWSS_LOG_ENTER();
+
+    size_t count = meta->valuescount;
+
+    if (meta->ignorevaluesnames)
+    {
+        for (size_t i = 0; meta->ignorevaluesnames[i] != NULL; i++)
+        {
+            count++;
+        }
+    }
+
+    // keep load factor below 0.5 so probe sequences stay short
+
+    size_t capacity = 4;
+
+    while (capacity < 2 * count)
+    {
+        capacity <<= 1;
+    }
+
+    m_entries.resize(capacity, Entry{ nullptr, 0, false });
+
+    m_mask = capacity - 1;
+
+    for (size_t i = 0; i < meta->valuescount; i++)
+    {
+        insert(meta->valuesnames[i], meta->values[i], false);
+    }
+
+    if (meta->ignorevaluesnames)
+    {
+        for (size_t i = 0; meta->ignorevaluesnames[i] != NULL; i++)
+        {
+            insert(meta->ignorevaluesnames[i], meta->ignorevalues[i], true);
+        }
+    }
+}
+
+uint64_t EnumNameIndex::hash(
+        _In_ const char* name)
+{
+    SWSS_LOG_ENTER();
+
+    // FNV-1a
+
+    uint64_t hash = 0xcbf29ce484222325ULL;
+
+    for (; *name; name++)
+    {
+        hash ^= (uint8_t)*name;
+        hash *= 0x100000001b3ULL;
+    }
+
+    return hash;
+}
+
+void EnumNameIndex::insert(
+        _In_ const char* name,
+        _In_ int32_t value,
+        _In_ bool ignored)
+{
+    SWSS_LOG_ENTER();
+
+    for (size_t idx = hash(name) & m_mask; ; idx = (idx + 1) & m_mask)
+    {
+        auto& entry = m_entries[idx];
+
+        if (entry.name == nullptr)
+        {
+            entry.name = name;
+            entry.value = value;
+            entry.ignored = ignored;
+
+            m_size++;
+
+            return;
+        }
+
+        if (strcmp(entry.name, name) == 0)
+        {
+            // first inserted name wins, same as linear search
+
+            return;
+        }
+    }
+}
+
+bool EnumNameIndex::find(
+        _In_ const char* name,
+        _Out_ int32_t& value,
+        _Out_ bool& ignored) const
+{
+    SWSS_LOG_ENTER();
+
+    for (size_t idx = hash(name) & m_mask; ; idx = (idx + 1) & m_mask)
+    {
+        auto& entry = m_entries[idx];
+
+        if (entry.name == nullptr)
+        {
+            return false;
+        }
+
+        if (strcmp(entry.name, name) == 0)
+        {
+            value = entry.value;
+            ignored = entry.ignored;
+
+            return true;
+        }
+    }
+}
+
+size_t EnumNameIndex::size() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_size;
+}
+
+const EnumNameIndex* EnumNameIndex::getIndex(
+        _In_ const sai_enum_metadata_t* meta)
+{
+    SWSS_LOG_ENTER();
+
+    typedef std::unordered_map<const sai_enum_metadata_t*, std::unique_ptr<EnumNameIndex>> IndexMap;
+
+    // static initialization is thread safe, and map is never modified after
+
+    static const IndexMap indexes = []()
+    {
+        IndexMap map;
+
+        for (size_t i = 0; i < sai_metadata_all_enums_count; i++)
+        {
+            auto* em = sai_metadata_all_enums[i];
+
+            if (em)
+            {
+                map[em] = std::unique_ptr<EnumNameIndex>(new EnumNameIndex(em));
+            }
+        }
+
+        return map;
+    }();
+
+    auto it = indexes.find(meta);
+
+    if (it == indexes.end())
+    {
+        return nullptr;
+    }
+
+    return it->second.get();
+}
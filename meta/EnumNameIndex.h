@@ -0,0 +1,86 @@
+#pragma once
+
+extern "C" {
+#include "saimetadata.h"
+}
+
+#include <vector>
+
+namespace saimeta
+{
+    /**
+     * @brief Name to value index of single enum metadata.
+     *
+     * Open addressing hash table which holds pointers to names from
+     * metadata, so lookup don't allocate memory. Index contains both values
+     * names and deprecated/ignored values names. Index is immutable after
+     * construction, so it can be used from multiple threads.
+     */
+    class EnumNameIndex
+    {
+        public:
+
+            EnumNameIndex(
+                    _In_ const sai_enum_metadata_t* meta);
+
+            virtual ~EnumNameIndex() = default;
+
+        public:
+
+            /**
+             * @brief Find enum value by name.
+             *
+             * @param name Enum value name, like SAI_PORT_STAT_IF_IN_OCTETS.
+             * @param value Found enum value.
+             * @param ignored Set to true if name is deprecated/ignored name.
+             *
+             * @return True if name was found, false otherwise.
+             */
+            bool find(
+                    _In_ const char* name,
+                    _Out_ int32_t& value,
+                    _Out_ bool& ignored) const;
+
+            size_t size() const;
+
+            /**
+             * @brief Get index for given enum metadata.
+             *
+             * Indexes for all enums from sai_metadata_all_enums are built
+             * once on first call.
+             *
+             * @return Index or nullptr if metadata is not part of SAI
+             * metadata (for example sairedis extension enums).
+             */
+            static const EnumNameIndex* getIndex(
+                    _In_ const sai_enum_metadata_t* meta);
+
+        private:
+
+            void insert(
+                    _In_ const char* name,
+                    _In_ int32_t value,
+                    _In_ bool ignored);
+
+            static uint64_t hash(
+                    _In_ const char* name);
+
+        private:
+
+            typedef struct _Entry
+            {
+                const char* name;
+
+                int32_t value;
+
+                bool ignored;
+
+            } Entry;
+
+            std::vector<Entry> m_entries;
+
+            size_t m_mask;
+
+            size_t m_size;
+    };
+}
@@ -74,17 +74,28 @@ std::string Globals::joinFieldValues(
 {
     SWSS_LOG_ENTER();
 
-    std::stringstream ss;
+    size_t size = 0;
+
+    for (const auto& fv: values)
+    {
+        size += fvField(fv).size() + fvValue(fv).size() + 2;
+    }
+
+    std::string joined;
+
+    joined.reserve(size);
 
     for (size_t i = 0; i < values.size(); ++i)
     {
         if (i != 0)
         {
-            ss << "|";
+            joined += '|';
         }
 
-        ss << fvField(values[i]) << "=" << fvValue(values[i]);
+        joined += fvField(values[i]);
+        joined += '=';
+        joined += fvValue(values[i]);
     }
 
-    return ss.str();
+    return joined;
 }
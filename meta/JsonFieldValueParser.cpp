@@ -0,0 +1,260 @@
+#include "JsonFieldValueParser.h"
+
+#include "swss/logger.h"
+
+using namespace sairedis;
+
+static void skip_whitespace(
+        _In_ const char* data,
+        _In_ size_t size,
+        _Inout_ size_t& pos)
+{
+    SWSS_LOG_ENTER();
+
+    while (pos < size && (data[pos] == ' ' || data[pos] == '\t' || data[pos] == '\n' || data[pos] == '\r'))
+    {
+        pos++;
+    }
+}
+
+static uint32_t parse_hex4(
+        _In_ const char* data,
+        _In_ size_t size,
+        _Inout_ size_t& pos)
+{
+    SWSS_LOG_ENTER();
+
+    if (size - pos < 4)
+    {
+        SWSS_LOG_THROW("truncated unicode escape at %zu", pos);
+    }
+
+    uint32_t value = 0;
+
+    for (int i = 0; i < 4; i++)
+    {
+        char c = data[pos++];
+
+        value <<= 4;
+
+        if (c >= '0' && c <= '9')
+        {
+            value |= (uint32_t)(c - '0');
+        }
+        else if (c >= 'a' && c <= 'f')
+        {
+            value |= (uint32_t)(c - 'a' + 10);
+        }
+        else if (c >= 'A' && c <= 'F')
+        {
+            value |= (uint32_t)(c - 'A' + 10);
+        }
+        else
+        {
+            SWSS_LOG_THROW("invalid unicode escape at %zu", pos - 1);
+        }
+    }
+
+    return value;
+}
+
+static void append_utf8(
+        _Inout_ std::string& str,
+        _In_ uint32_t cp)
+{
+    SWSS_LOG_ENTER();
+
+    if (cp < 0x80)
+    {
+        str.push_back((char)cp);
+    }
+    else if (cp < 0x800)
+    {
+        str.push_back((char)(0xc0 | (cp >> 6)));
+        str.push_back((char)(0x80 | (cp & 0x3f)));
+    }
+    else if (cp < 0x10000)
+    {
+        str.push_back((char)(0xe0 | (cp >> 12)));
+        str.push_back((char)(0x80 | ((cp >> 6) & 0x3f)));
+        str.push_back((char)(0x80 | (cp & 0x3f)));
+    }
+    else
+    {
+        str.push_back((char)(0xf0 | (cp >> 18)));
+        str.push_back((char)(0x80 | ((cp >> 12) & 0x3f)));
+        str.push_back((char)(0x80 | ((cp >> 6) & 0x3f)));
+        str.push_back((char)(0x80 | (cp & 0x3f)));
+    }
+}
+
+static void parse_string(
+        _In_ const char* data,
+        _In_ size_t size,
+        _Inout_ size_t& pos,
+        _Out_ std::string& str)
+{
+    SWSS_LOG_ENTER();
+
+    if (pos >= size || data[pos] != '"')
+    {
+        SWSS_LOG_THROW("expected string at %zu", pos);
+    }
+
+    pos++;
+
+    str.clear();
+
+    while (true)
+    {
+        // copy unescaped run at once
+
+        size_t start = pos;
+
+        while (pos < size && data[pos] != '"' && data[pos] != '\\')
+        {
+            pos++;
+        }
+
+        str.append(data + start, pos - start);
+
+        if (pos >= size)
+        {
+            SWSS_LOG_THROW("unterminated string");
+        }
+
+        if (data[pos++] == '"')
+        {
+            return;
+        }
+
+        if (pos >= size)
+        {
+            SWSS_LOG_THROW("unterminated escape");
+        }
+
+        char c = data[pos++];
+
+        switch (c)
+        {
+            case '"':  str.push_back('"'); break;
+            case '\\': str.push_back('\\'); break;
+            case '/':  str.push_back('/'); break;
+            case 'b':  str.push_back('\b'); break;
+            case 'f':  str.push_back('\f'); break;
+            case 'n':  str.push_back('\n'); break;
+            case 'r':  str.push_back('\r'); break;
+            case 't':  str.push_back('\t'); break;
+
+            case 'u':
+                {
+                    uint32_t cp = parse_hex4(data, size, pos);
+
+                    if (cp >= 0xd800 && cp <= 0xdbff)
+                    {
+                        // surrogate pair
+
+                        if (size - pos < 2 || data[pos] != '\\' || data[pos + 1] != 'u')
+                        {
+                            SWSS_LOG_THROW("missing low surrogate at %zu", pos);
+                        }
+
+                        pos += 2;
+
+                        uint32_t low = parse_hex4(data, size, pos);
+
+                        if (low < 0xdc00 || low > 0xdfff)
+                        {
+                            SWSS_LOG_THROW("invalid low surrogate at %zu", pos);
+                        }
+
+                        cp = 0x10000 + ((cp - 0xd800) << 10) + (low - 0xdc00);
+                    }
+
+                    append_utf8(str, cp);
+                }
+                break;
+
+            default:
+                SWSS_LOG_THROW("invalid escape '%c' at %zu", c, pos - 1);
+        }
+    }
+}
+
+void JsonFieldValueParser::parse(
+        _In_ const char* data,
+        _In_ size_t size,
+        _Out_ std::vector<swss::FieldValueTuple>& values)
+{
+    SWSS_LOG_ENTER();
+
+    values.clear();
+
+    size_t pos = 0;
+
+    skip_whitespace(data, size, pos);
+
+    if (pos >= size || data[pos] != '[')
+    {
+        SWSS_LOG_THROW("expected json array");
+    }
+
+    pos++;
+
+    skip_whitespace(data, size, pos);
+
+    if (pos < size && data[pos] == ']')
+    {
+        pos++;
+    }
+    else
+    {
+        while (true)
+        {
+            values.emplace_back();
+
+            auto& fv = values.back();
+
+            parse_string(data, size, pos, fvField(fv));
+
+            skip_whitespace(data, size, pos);
+
+            if (pos >= size || data[pos] != ',')
+            {
+                SWSS_LOG_THROW("expected value for field '%s'", fvField(fv).c_str());
+            }
+
+            pos++;
+
+            skip_whitespace(data, size, pos);
+
+            parse_string(data, size, pos, fvValue(fv));
+
+            skip_whitespace(data, size, pos);
+
+            if (pos < size && data[pos] == ',')
+            {
+                pos++;
+
+                skip_whitespace(data, size, pos);
+
+                continue;
+            }
+
+            if (pos < size && data[pos] == ']')
+            {
+                pos++;
+                break;
+            }
+
+            SWSS_LOG_THROW("expected ',' or ']' at %zu", pos);
+        }
+    }
+
+    skip_whitespace(data, size, pos);
+
+    if (pos != size)
+    {
+        SWSS_LOG_THROW("unexpected data after json array at %zu", pos);
+    }
+}
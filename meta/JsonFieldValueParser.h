@@ -0,0 +1,40 @@
+#pragma once
+
+#include "swss/table.h"
+#include "swss/sal.h"
+
+#include <string>
+#include <vector>
+
+namespace sairedis
+{
+    /**
+     * @brief Parses flat JSON array of strings into field value tuples.
+     *
+     * Accepts format produced by swss::JSon::buildJson, array of strings
+     * where each two consecutive strings form field and value. Strings are
+     * unescaped directly into field value tuples, without building JSON
+     * document, and input doesn't need to be zero terminated, so it can be
+     * parsed straight from received message buffer.
+     */
+    class JsonFieldValueParser
+    {
+        private:
+
+            JsonFieldValueParser() = delete;
+            ~JsonFieldValueParser() = delete;
+
+        public:
+
+            /**
+             * @brief Parse JSON array.
+             *
+             * Throws on invalid JSON, non string array elements or odd
+             * number of elements.
+             */
+            static void parse(
+                    _In_ const char* data,
+                    _In_ size_t size,
+                    _Out_ std::vector<swss::FieldValueTuple>& values);
+    };
+}
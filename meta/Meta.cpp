@@ -9,6 +9,10 @@
 #include <inttypes.h>
 
 #include <set>
+#include <future>
+#include <algorithm>
+#include <chrono>
+#include <unordered_set>
 
 // TODO add validation for all oids belong to the same switch
 
@@ -144,6 +148,8 @@ Meta::Meta(
     // then warm boot must be per each switch
 
     m_warmBoot = false;
+
+    m_bulkValidationThreads = 1;
 }
 
 sai_status_t Meta::apiInitialize(
@@ -198,13 +204,155 @@ void Meta::meta_init_db()
     SWSS_LOG_NOTICE("end");
 }
 
+void Meta::setBulkValidationThreads(
+        _In_ uint32_t threads)
+{
+    SWSS_LOG_ENTER();
+
+    m_bulkValidationThreads = (threads == 0) ? 1 : threads;
+
+    SWSS_LOG_NOTICE("bulk validation threads: %u", m_bulkValidationThreads);
+}
+
+uint32_t Meta::getBulkValidationThreads() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_bulkValidationThreads;
+}
+
+const AttrShapeCache& Meta::getAttrShapeCache() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_attrShapeCache;
+}
+
+#define BULK_VALIDATION_MIN_CHUNK 64
+
+sai_status_t Meta::meta_bulk_validate(
+        _In_ const std::vector<sai_object_meta_key_t>& vmk,
+        _In_ sai_status_t duplicateStatus,
+        _In_ const std::function<sai_status_t(uint32_t)>& validate)
+{
+    SWSS_LOG_ENTER();
+
+    uint32_t count = (uint32_t)vmk.size();
+
+    bool checkDuplicates = (duplicateStatus != SAI_STATUS_SUCCESS);
+
+    std::unordered_set<sai_object_meta_key_t, MetaKeyHasher, MetaKeyHasher> keys;
+
+    uint32_t threads = m_bulkValidationThreads;
+
+    /*
+     * Unittests readonly flag is erased during set validation, so in that
+     * mode validation is not read only and must stay serial.
+     */
+
+    if (threads <= 1 || m_unittestsEnabled || count < 2 * BULK_VALIDATION_MIN_CHUNK)
+    {
+        for (uint32_t idx = 0; idx < count; idx++)
+        {
+            if (checkDuplicates && !keys.insert(vmk[idx]).second)
+            {
+                SWSS_LOG_ERROR("object %s is duplicated in bulk at index %u",
+                        sai_serialize_object_meta_key(vmk[idx]).c_str(), idx);
+
+                return duplicateStatus;
+            }
+
+            sai_status_t status = validate(idx);
+
+            CHECK_STATUS_SUCCESS(status);
+        }
+
+        return SAI_STATUS_SUCCESS;
+    }
+
+    /*
+     * Validation only reads metadata DB, nothing is modified until post
+     * operations, which are executed serially after bulk API returns, so
+     * chunks can be validated concurrently. Each chunk stops on its first
+     * failure, and we pick the lowest failing index, so returned status is
+     * the same as in serial validation.
+     */
+
+    uint32_t chunk = (count + threads - 1) / threads;
+
+    if (chunk < BULK_VALIDATION_MIN_CHUNK)
+    {
+        chunk = BULK_VALIDATION_MIN_CHUNK;
+    }
+
+    std::vector<std::future<std::pair<uint32_t, sai_status_t>>> futures;
+
+    for (uint32_t start = 0; start < count; start += chunk)
+    {
+        uint32_t end = std::min(count, start + chunk);
+
+        futures.push_back(std::async(std::launch::async, [&validate, start, end]()
+                    {
+                        for (uint32_t idx = start; idx < end; idx++)
+                        {
+                            sai_status_t status = validate(idx);
+
+                            if (status != SAI_STATUS_SUCCESS)
+                            {
+                                return std::make_pair(idx, status);
+                            }
+                        }
+
+                        return std::make_pair(end, (sai_status_t)SAI_STATUS_SUCCESS);
+                    }));
+    }
+
+    // duplicates are checked while chunks are running
+
+    uint32_t duplicateIndex = count;
+
+    for (uint32_t idx = 0; checkDuplicates && idx < count; idx++)
+    {
+        if (!keys.insert(vmk[idx]).second)
+        {
+            duplicateIndex = idx;
+            break;
+        }
+    }
+
+    uint32_t failIndex = count;
+
+    sai_status_t failStatus = SAI_STATUS_SUCCESS;
+
+    for (auto& f: futures)
+    {
+        auto result = f.get(); // wait for all chunks, rethrows exception if any
+
+        if (result.second != SAI_STATUS_SUCCESS && result.first < failIndex)
+        {
+            failIndex = result.first;
+            failStatus = result.second;
+        }
+    }
+
+    if (duplicateIndex < count && duplicateIndex <= failIndex)
+    {
+        SWSS_LOG_ERROR("object %s is duplicated in bulk at index %u",
+                sai_serialize_object_meta_key(vmk[duplicateIndex]).c_str(), duplicateIndex);
+
+        return duplicateStatus;
+    }
+
+    return failStatus;
+}
+
 bool Meta::isEmpty() const
 {
     SWSS_LOG_ENTER();
 
     return m_portRelatedSet.getAllPorts().empty()
         && m_oids.getAllOids().empty()
-        && m_attrKeys.getAllKeys().empty()
+        && m_attrKeys.size() == 0
         && m_saiObjectCollection.getAllKeys().empty();
 }
 
@@ -214,7 +362,7 @@ void Meta::dump() const
 
     SWSS_LOG_NOTICE("portRelatedSet: %zu", m_portRelatedSet.getAllPorts().size());
     SWSS_LOG_NOTICE("oids: %zu", m_oids.getAllOids().size());
-    SWSS_LOG_NOTICE("attrKeys: %zu", m_attrKeys.getAllKeys().size());
+    SWSS_LOG_NOTICE("attrKeys: %zu", m_attrKeys.size());
     SWSS_LOG_NOTICE("saiObjectCollection: %zu", m_saiObjectCollection.getAllKeys().size());
 
     for (auto &oid: m_oids.getAllReferences())
@@ -612,16 +760,19 @@ sai_status_t Meta::bulkCreate(
     std::vector<sai_object_meta_key_t> vmk;                                                                             \
     for (uint32_t idx = 0; idx < object_count; idx++)                                                                   \
     {                                                                                                                   \
-        sai_status_t status = meta_sai_validate_ ##ot (&ot[idx], true);                                                 \
-        CHECK_STATUS_SUCCESS(status);                                                                                   \
         sai_object_meta_key_t meta_key = {                                                                              \
             .objecttype = (sai_object_type_t)SAI_OBJECT_TYPE_ ## OT,                                                    \
             .objectkey = { .key = { .ot = ot[idx] } }                                                                   \
              };                                                                                                         \
         vmk.push_back(meta_key);                                                                                        \
-        status = meta_generic_validation_create(meta_key, ot[idx].switch_id, attr_count[idx], attr_list[idx]);          \
-        CHECK_STATUS_SUCCESS(status);                                                                                   \
     }                                                                                                                   \
+    sai_status_t vstatus = meta_bulk_validate(vmk, SAI_STATUS_ITEM_ALREADY_EXISTS, [&](uint32_t idx)                    \
+    {                                                                                                                   \
+        sai_status_t status = meta_sai_validate_ ##ot (&ot[idx], true);                                                 \
+        CHECK_STATUS_SUCCESS(status);                                                                                   \
+        return meta_generic_validation_create(vmk[idx], ot[idx].switch_id, attr_count[idx], attr_list[idx]);            \
+    });                                                                                                                 \
+    CHECK_STATUS_SUCCESS(vstatus);                                                                                      \
     auto status = m_implementation->bulkCreate(object_count, ot, attr_count, attr_list, mode, object_statuses);         \
     for (uint32_t idx = 0; idx < object_count; idx++)                                                                   \
     {                                                                                                                   \
@@ -656,16 +807,19 @@ sai_status_t Meta::bulkRemove(
     std::vector<sai_object_meta_key_t> vmk;                                                                             \
     for (uint32_t idx = 0; idx < object_count; idx++)                                                                   \
     {                                                                                                                   \
-        sai_status_t status = meta_sai_validate_ ##ot (&ot[idx], false);                                                \
-        CHECK_STATUS_SUCCESS(status);                                                                                   \
         sai_object_meta_key_t meta_key = {                                                                              \
             .objecttype = (sai_object_type_t)SAI_OBJECT_TYPE_ ## OT,                                                    \
             .objectkey = { .key = { .ot = ot[idx] } }                                                                   \
             };                                                                                                          \
         vmk.push_back(meta_key);                                                                                        \
-        status = meta_generic_validation_remove(meta_key);                                                              \
-        CHECK_STATUS_SUCCESS(status);                                                                                   \
     }                                                                                                                   \
+    sai_status_t vstatus = meta_bulk_validate(vmk, SAI_STATUS_INVALID_PARAMETER, [&](uint32_t idx)                      \
+    {                                                                                                                   \
+        sai_status_t status = meta_sai_validate_ ##ot (&ot[idx], false);                                                \
+        CHECK_STATUS_SUCCESS(status);                                                                                   \
+        return meta_generic_validation_remove(vmk[idx]);                                                                \
+    });                                                                                                                 \
+    CHECK_STATUS_SUCCESS(vstatus);                                                                                      \
     auto status = m_implementation->bulkRemove(object_count, ot, mode, object_statuses);                                \
     for (uint32_t idx = 0; idx < object_count; idx++)                                                                   \
     {                                                                                                                   \
@@ -702,16 +856,19 @@ sai_status_t Meta::bulkSet(
     std::vector<sai_object_meta_key_t> vmk;                                                                             \
     for (uint32_t idx = 0; idx < object_count; idx++)                                                                   \
     {                                                                                                                   \
-        sai_status_t status = meta_sai_validate_ ##ot (&ot[idx], false);                                                \
-        CHECK_STATUS_SUCCESS(status);                                                                                   \
         sai_object_meta_key_t meta_key = {                                                                              \
             .objecttype = (sai_object_type_t)SAI_OBJECT_TYPE_ ## OT,                                                    \
             .objectkey = { .key = { .ot = ot[idx] } }                                                                   \
              };                                                                                                         \
         vmk.push_back(meta_key);                                                                                        \
-        status = meta_generic_validation_set(meta_key, &attr_list[idx]);                                                \
-        CHECK_STATUS_SUCCESS(status);                                                                                   \
     }                                                                                                                   \
+    sai_status_t vstatus = meta_bulk_validate(vmk, SAI_STATUS_SUCCESS, [&](uint32_t idx)                                \
+    {                                                                                                                   \
+        sai_status_t status = meta_sai_validate_ ##ot (&ot[idx], false);                                                \
+        CHECK_STATUS_SUCCESS(status);                                                                                   \
+        return meta_generic_validation_set(vmk[idx], &attr_list[idx]);                                                  \
+    });                                                                                                                 \
+    CHECK_STATUS_SUCCESS(vstatus);                                                                                      \
     auto status = m_implementation->bulkSet(object_count, ot, attr_list, mode, object_statuses);                        \
     for (uint32_t idx = 0; idx < object_count; idx++)                                                                   \
     {                                                                                                                   \
@@ -1010,15 +1167,11 @@ sai_status_t Meta::meta_validate_query_stats_capability(
     SWSS_LOG_ENTER();
 
     PARAMETER_CHECK_OBJECT_TYPE_VALID(object_type);
-    PARAMETER_CHECK_OID_OBJECT_TYPE(object_id, object_type);
-    PARAMETER_CHECK_OID_EXISTS(object_id, object_type);
 
-    sai_object_id_t switch_id = switchIdQuery(object_id);
+    // object id is switch on which capability is queried
 
-    // checks also if object type is OID
-    sai_status_t status = meta_sai_validate_oid(object_type, &object_id, switch_id, false);
-
-    CHECK_STATUS_SUCCESS(status);
+    PARAMETER_CHECK_OID_OBJECT_TYPE(object_id, SAI_OBJECT_TYPE_SWITCH);
+    PARAMETER_CHECK_OID_EXISTS(object_id, SAI_OBJECT_TYPE_SWITCH);
 
     auto info = sai_metadata_get_object_type_info(object_type);
 
@@ -1034,6 +1187,45 @@ sai_status_t Meta::meta_validate_query_stats_capability(
     return SAI_STATUS_SUCCESS;
 }
 
+sai_status_t Meta::meta_validate_bulk_stats(
+        _In_ sai_object_id_t switch_id,
+        _In_ sai_object_type_t object_type,
+        _In_ uint32_t object_count,
+        _In_ const sai_object_key_t *object_key,
+        _In_ uint32_t number_of_counters,
+        _In_ const sai_stat_id_t *counter_ids,
+        _In_ sai_stats_mode_t mode,
+        _In_ const sai_status_t *object_statuses)
+{
+    SWSS_LOG_ENTER();
+
+    PARAMETER_CHECK_OID_OBJECT_TYPE(switch_id, SAI_OBJECT_TYPE_SWITCH);
+    PARAMETER_CHECK_OID_EXISTS(switch_id, SAI_OBJECT_TYPE_SWITCH);
+    PARAMETER_CHECK_POSITIVE(object_count);
+    PARAMETER_CHECK_IF_NOT_NULL(object_key);
+    PARAMETER_CHECK_IF_NOT_NULL(object_statuses);
+
+    uint64_t counter;
+
+    for (uint32_t idx = 0; idx < object_count; idx++)
+    {
+        auto status = meta_validate_stats(object_type, object_key[idx].key.object_id, number_of_counters, counter_ids, &counter, mode);
+
+        CHECK_STATUS_SUCCESS(status);
+
+        if (switchIdQuery(object_key[idx].key.object_id) != switch_id)
+        {
+            SWSS_LOG_ERROR("object %s is not on switch %s",
+                    sai_serialize_object_id(object_key[idx].key.object_id).c_str(),
+                    sai_serialize_object_id(switch_id).c_str());
+
+            return SAI_STATUS_INVALID_PARAMETER;
+        }
+    }
+
+    return SAI_STATUS_SUCCESS;
+}
+
 sai_status_t Meta::getStats(
         _In_ sai_object_type_t object_type,
         _In_ sai_object_id_t object_id,
@@ -1061,6 +1253,8 @@ sai_status_t Meta::queryStatsCapability(
 {
     SWSS_LOG_ENTER();
 
+    PARAMETER_CHECK_IF_NOT_NULL(stats_capability);
+
     auto status = meta_validate_query_stats_capability(objectType, switchId);
 
     CHECK_STATUS_SUCCESS(status);
@@ -1126,7 +1320,17 @@ sai_status_t Meta::bulkGetStats(
 {
     SWSS_LOG_ENTER();
 
-    return SAI_STATUS_NOT_IMPLEMENTED;
+    PARAMETER_CHECK_IF_NOT_NULL(counters);
+
+    auto status = meta_validate_bulk_stats(switchId, object_type, object_count, object_key, number_of_counters, counter_ids, mode, object_statuses);
+
+    CHECK_STATUS_SUCCESS(status);
+
+    status = m_implementation->bulkGetStats(switchId, object_type, object_count, object_key, number_of_counters, counter_ids, mode, object_statuses, counters);
+
+    // no post validation required
+
+    return status;
 }
 
 sai_status_t Meta::bulkClearStats(
@@ -1141,7 +1345,15 @@ sai_status_t Meta::bulkClearStats(
 {
     SWSS_LOG_ENTER();
 
-    return SAI_STATUS_NOT_IMPLEMENTED;
+    auto status = meta_validate_bulk_stats(switchId, object_type, object_count, object_key, number_of_counters, counter_ids, mode, object_statuses);
+
+    CHECK_STATUS_SUCCESS(status);
+
+    status = m_implementation->bulkClearStats(switchId, object_type, object_count, object_key, number_of_counters, counter_ids, mode, object_statuses);
+
+    // no post validation required
+
+    return status;
 }
 
 // for bulk operations actually we could make copy of current db and actually
@@ -1181,18 +1393,21 @@ sai_status_t Meta::bulkRemove(
 
     for (uint32_t idx = 0; idx < object_count; idx++)
     {
-        sai_status_t status = meta_sai_validate_oid(object_type, &object_id[idx], SAI_NULL_OBJECT_ID, false);
-
-        CHECK_STATUS_SUCCESS(status);
-
         sai_object_meta_key_t meta_key = { .objecttype = object_type, .objectkey = { .key = { .object_id  = object_id[idx] } } };
 
         vmk.push_back(meta_key);
+    }
 
-        status = meta_generic_validation_remove(meta_key);
+    sai_status_t vstatus = meta_bulk_validate(vmk, SAI_STATUS_INVALID_PARAMETER, [&](uint32_t idx)
+    {
+        sai_status_t status = meta_sai_validate_oid(object_type, &object_id[idx], SAI_NULL_OBJECT_ID, false);
 
         CHECK_STATUS_SUCCESS(status);
-    }
+
+        return meta_generic_validation_remove(vmk[idx]);
+    });
+
+    CHECK_STATUS_SUCCESS(vstatus);
 
     auto status = m_implementation->bulkRemove(object_type, object_count, object_id, mode, object_statuses);
 
@@ -1243,18 +1458,21 @@ sai_status_t Meta::bulkSet(
 
     for (uint32_t idx = 0; idx < object_count; idx++)
     {
-        sai_status_t status = meta_sai_validate_oid(object_type, &object_id[idx], SAI_NULL_OBJECT_ID, false);
-
-        CHECK_STATUS_SUCCESS(status);
-
         sai_object_meta_key_t meta_key = { .objecttype = object_type, .objectkey = { .key = { .object_id  = object_id[idx] } } };
 
         vmk.push_back(meta_key);
+    }
 
-        status = meta_generic_validation_set(meta_key, &attr_list[idx]);
+    sai_status_t vstatus = meta_bulk_validate(vmk, SAI_STATUS_SUCCESS, [&](uint32_t idx)
+    {
+        sai_status_t status = meta_sai_validate_oid(object_type, &object_id[idx], SAI_NULL_OBJECT_ID, false);
 
         CHECK_STATUS_SUCCESS(status);
-    }
+
+        return meta_generic_validation_set(vmk[idx], &attr_list[idx]);
+    });
+
+    CHECK_STATUS_SUCCESS(vstatus);
 
     auto status = m_implementation->bulkSet(object_type, object_count, object_id, attr_list, mode, object_statuses);
 
@@ -1337,24 +1555,22 @@ sai_status_t Meta::bulkCreate(
         return SAI_STATUS_INVALID_PARAMETER;
     }
 
-    std::vector<sai_object_meta_key_t> vmk;
+    // this is create, oid's don't exist yet, so there are no duplicates
 
-    for (uint32_t idx = 0; idx < object_count; idx++)
+    sai_object_meta_key_t meta_key = { .objecttype = object_type, .objectkey = { .key = { .object_id  = SAI_NULL_OBJECT_ID } } };
+
+    std::vector<sai_object_meta_key_t> vmk(object_count, meta_key);
+
+    sai_status_t vstatus = meta_bulk_validate(vmk, SAI_STATUS_SUCCESS, [&](uint32_t idx)
     {
         sai_status_t status = meta_sai_validate_oid(object_type, &object_id[idx], switchId, true);
 
         CHECK_STATUS_SUCCESS(status);
 
-        // this is create, oid's don't exist yet
-
-        sai_object_meta_key_t meta_key = { .objecttype = object_type, .objectkey = { .key = { .object_id  = SAI_NULL_OBJECT_ID } } };
+        return meta_generic_validation_create(vmk[idx], switchId, attr_count[idx], attr_list[idx]);
+    });
 
-        vmk.push_back(meta_key);
-
-        status = meta_generic_validation_create(meta_key, switchId, attr_count[idx], attr_list[idx]);
-
-        CHECK_STATUS_SUCCESS(status);
-    }
+    CHECK_STATUS_SUCCESS(vstatus);
 
     auto status = m_implementation->bulkCreate(object_type, switchId, object_count, attr_count, attr_list, mode, object_id, object_statuses);
 
@@ -1456,17 +1672,14 @@ void Meta::clean_after_switch_remove(
 
     // clear attr keys
 
-    for (auto& key: m_attrKeys.getAllKeys())
+    for (auto& mk: m_attrKeys.getAllMetaKeys())
     {
-        sai_object_meta_key_t mk;
-        sai_deserialize_object_meta_key(key, mk);
-
         // we guarantee that switch_id is first in the key structure so we can
         // use that as object_id as well
 
         if (switchIdQuery(mk.objectkey.key.object_id) == switchId)
         {
-            m_attrKeys.eraseMetaKey(key);
+            m_attrKeys.eraseMetaKey(mk);
         }
     }
 
@@ -1799,6 +2012,13 @@ void Meta::meta_generic_validation_post_remove(
         return;
     }
 
+    /*
+     * All object ids referenced by removed object, reference count on them is
+     * decreased at once.
+     */
+
+    std::vector<sai_object_id_t> oids;
+
     // get all attributes that was set
 
     for (auto&it: m_saiObjectCollection.getObject(meta_key)->getAttributes())
@@ -1835,11 +2055,11 @@ void Meta::meta_generic_validation_post_remove(
                 break;
 
             case SAI_ATTR_VALUE_TYPE_OBJECT_ID:
-                m_oids.objectReferenceDecrement(value.oid);
+                oids.push_back(value.oid);
                 break;
 
             case SAI_ATTR_VALUE_TYPE_OBJECT_LIST:
-                m_oids.objectReferenceDecrement(value.objlist);
+                meta_append_object_list(oids, value.objlist);
                 break;
 
                 // ACL FIELD
@@ -1860,14 +2080,14 @@ void Meta::meta_generic_validation_post_remove(
             case SAI_ATTR_VALUE_TYPE_ACL_FIELD_DATA_OBJECT_ID:
                 if (value.aclfield.enable)
                 {
-                    m_oids.objectReferenceDecrement(value.aclfield.data.oid);
+                    oids.push_back(value.aclfield.data.oid);
                 }
                 break;
 
             case SAI_ATTR_VALUE_TYPE_ACL_FIELD_DATA_OBJECT_LIST:
                 if (value.aclfield.enable)
                 {
-                    m_oids.objectReferenceDecrement(value.aclfield.data.objlist);
+                    meta_append_object_list(oids, value.aclfield.data.objlist);
                 }
                 break;
 
@@ -1890,14 +2110,14 @@ void Meta::meta_generic_validation_post_remove(
             case SAI_ATTR_VALUE_TYPE_ACL_ACTION_DATA_OBJECT_ID:
                 if (value.aclaction.enable)
                 {
-                    m_oids.objectReferenceDecrement(value.aclaction.parameter.oid);
+                    oids.push_back(value.aclaction.parameter.oid);
                 }
                 break;
 
             case SAI_ATTR_VALUE_TYPE_ACL_ACTION_DATA_OBJECT_LIST:
                 if (value.aclaction.enable)
                 {
-                    m_oids.objectReferenceDecrement(value.aclaction.parameter.objlist);
+                    meta_append_object_list(oids, value.aclaction.parameter.objlist);
                 }
                 break;
 
@@ -1963,19 +2183,21 @@ void Meta::meta_generic_validation_post_remove(
                 continue;
             }
 
-            m_oids.objectReferenceDecrement(m->getoid(&meta_key));
+            oids.push_back(m->getoid(&meta_key));
         }
+
+        m_oids.objectReferenceDecrement(oids);
     }
     else
     {
+        m_oids.objectReferenceDecrement(oids);
+
         m_oids.objectReferenceRemove(meta_key.objectkey.key.object_id);
     }
 
     m_saiObjectCollection.removeObject(meta_key);
 
-    std::string metaKey = sai_serialize_object_meta_key(meta_key);
-
-    m_attrKeys.eraseMetaKey(metaKey);
+    m_attrKeys.eraseMetaKey(meta_key);
 
     if (meta_key.objecttype == SAI_OBJECT_TYPE_PORT)
     {
@@ -3227,6 +3449,22 @@ sai_status_t Meta::meta_generic_validation_create(
 
     bool haskeys = false;
 
+    /*
+     * If the same attribute shape was already validated, skip checks which
+     * depend only on metadata and execute only value dependent checks.
+     */
+
+    AttrShapeCache::Shape shape = { .haskeys = false, .conditionsOnValues = false };
+
+    bool shapeCached = !switchcreate && m_attrShapeCache.find(meta_key.objecttype, attr_count, attr_list, shape);
+
+    if (shapeCached)
+    {
+        haskeys = shape.haskeys;
+    }
+
+    bool checkConditions = !shapeCached || shape.conditionsOnValues;
+
     // check each attribute separately
     for (uint32_t idx = 0; idx < attr_count; ++idx)
     {
@@ -3249,27 +3487,33 @@ sai_status_t Meta::meta_generic_validation_create(
 
         META_LOG_DEBUG(md, "(create)");
 
-        if (attrs.find(attr->id) != attrs.end())
+        if (!shapeCached && attrs.find(attr->id) != attrs.end())
         {
             META_LOG_ERROR(md, "attribute id (%u) is defined on attr list multiple times", attr->id);
 
             return SAI_STATUS_INVALID_PARAMETER;
         }
 
-        attrs[attr->id] = attr;
-
-        if (SAI_HAS_FLAG_READ_ONLY(md.flags))
+        if (checkConditions)
         {
-            META_LOG_ERROR(md, "attr is read only and cannot be created");
-
-            return SAI_STATUS_INVALID_PARAMETER;
+            attrs[attr->id] = attr;
         }
 
-        if (SAI_HAS_FLAG_KEY(md.flags))
+        if (!shapeCached)
         {
-            haskeys = true;
+            if (SAI_HAS_FLAG_READ_ONLY(md.flags))
+            {
+                META_LOG_ERROR(md, "attr is read only and cannot be created");
 
-            META_LOG_DEBUG(md, "attr is key");
+                return SAI_STATUS_INVALID_PARAMETER;
+            }
+
+            if (SAI_HAS_FLAG_KEY(md.flags))
+            {
+                haskeys = true;
+
+                META_LOG_DEBUG(md, "attr is key");
+            }
         }
 
         // if we set OID check if exists and if type is correct
@@ -3655,114 +3899,130 @@ sai_status_t Meta::meta_generic_validation_create(
          */
     }
 
-    const auto& metadata = get_attributes_metadata(meta_key.objecttype);
-
-    if (metadata.empty())
-    {
-        SWSS_LOG_ERROR("get attributes metadata returned empty list for object type: %d", meta_key.objecttype);
+    auto checkStart = std::chrono::steady_clock::now();
 
-        return SAI_STATUS_FAILURE;
-    }
+    bool cacheable = !switchcreate;
 
-    // check if all mandatory attributes were passed
+    std::vector<const sai_attr_metadata_t*> metadata;
 
-    for (auto mdp: metadata)
+    if (checkConditions)
     {
-        const sai_attr_metadata_t& md = *mdp;
+        metadata = get_attributes_metadata(meta_key.objecttype);
 
-        if (!SAI_HAS_FLAG_MANDATORY_ON_CREATE(md.flags))
+        if (metadata.empty())
         {
-            continue;
-        }
+            SWSS_LOG_ERROR("get attributes metadata returned empty list for object type: %d", meta_key.objecttype);
 
-        if (md.isconditional)
-        {
-            // skip conditional attributes for now
-            continue;
+            return SAI_STATUS_FAILURE;
         }
+    }
 
-        const auto &it = attrs.find(md.attrid);
+    if (!shapeCached)
+    {
+        // check if all mandatory attributes were passed
 
-        if (it == attrs.end())
+        for (auto mdp: metadata)
         {
-            /*
-             * Buffer profile shared static/dynamic is special case since it's
-             * mandatory on create but condition is on
-             * SAI_BUFFER_PROFILE_ATTR_POOL_ID attribute (see file saibuffer.h).
-             */
+            const sai_attr_metadata_t& md = *mdp;
 
-            if (md.objecttype == SAI_OBJECT_TYPE_BUFFER_PROFILE &&
-                    (md.attrid == SAI_BUFFER_PROFILE_ATTR_SHARED_DYNAMIC_TH ||
-                     (md.attrid == SAI_BUFFER_PROFILE_ATTR_SHARED_STATIC_TH)))
+            if (!SAI_HAS_FLAG_MANDATORY_ON_CREATE(md.flags))
             {
-                auto pool_id_attr = sai_metadata_get_attr_by_id(SAI_BUFFER_PROFILE_ATTR_POOL_ID, attr_count, attr_list);
+                continue;
+            }
 
-                if (pool_id_attr == NULL)
-                {
-                    META_LOG_ERROR(md, "buffer pool ID is not passed when creating buffer profile, attr is mandatory");
+            if (md.isconditional)
+            {
+                // skip conditional attributes for now
+                continue;
+            }
 
-                    return SAI_STATUS_MANDATORY_ATTRIBUTE_MISSING;
-                }
+            const auto &it = attrs.find(md.attrid);
 
-                sai_object_id_t pool_id = pool_id_attr->value.oid;
+            if (it == attrs.end())
+            {
+                /*
+                 * Buffer profile shared static/dynamic is special case since it's
+                 * mandatory on create but condition is on
+                 * SAI_BUFFER_PROFILE_ATTR_POOL_ID attribute (see file saibuffer.h).
+                 */
 
-                if (pool_id == SAI_NULL_OBJECT_ID)
+                if (md.objecttype == SAI_OBJECT_TYPE_BUFFER_PROFILE &&
+                        (md.attrid == SAI_BUFFER_PROFILE_ATTR_SHARED_DYNAMIC_TH ||
+                         (md.attrid == SAI_BUFFER_PROFILE_ATTR_SHARED_STATIC_TH)))
                 {
-                    /* attribute allows null */
-                    continue;
-                }
+                    // depends on pool threshold mode, so shape can't be cached
 
-                /*
-                 * Object type  pool_id is correct since previous loop checked that.
-                 * Now extract SAI_BUFFER_POOL_THRESHOLD_MODE attribute
-                 */
+                    cacheable = false;
 
-                sai_object_meta_key_t mk = { .objecttype = SAI_OBJECT_TYPE_BUFFER_POOL, .objectkey = { .key = { .object_id = pool_id } } };
+                    auto pool_id_attr = sai_metadata_get_attr_by_id(SAI_BUFFER_PROFILE_ATTR_POOL_ID, attr_count, attr_list);
 
-                auto pool_md = sai_metadata_get_attr_metadata(SAI_OBJECT_TYPE_BUFFER_POOL, SAI_BUFFER_POOL_ATTR_THRESHOLD_MODE);
+                    if (pool_id_attr == NULL)
+                    {
+                        META_LOG_ERROR(md, "buffer pool ID is not passed when creating buffer profile, attr is mandatory");
 
-                auto prev = get_object_previous_attr(mk, *pool_md);
+                        return SAI_STATUS_MANDATORY_ATTRIBUTE_MISSING;
+                    }
 
-                sai_buffer_pool_threshold_mode_t mode;
+                    sai_object_id_t pool_id = pool_id_attr->value.oid;
 
-                if (prev == NULL)
-                {
-                    mode = (sai_buffer_pool_threshold_mode_t)pool_md->defaultvalue->s32;
-                }
-                else
-                {
-                    mode = (sai_buffer_pool_threshold_mode_t)prev->getSaiAttr()->value.s32;
-                }
+                    if (pool_id == SAI_NULL_OBJECT_ID)
+                    {
+                        /* attribute allows null */
+                        continue;
+                    }
 
-                if ((mode == SAI_BUFFER_POOL_THRESHOLD_MODE_DYNAMIC && md.attrid == SAI_BUFFER_PROFILE_ATTR_SHARED_DYNAMIC_TH) ||
-                        (mode == SAI_BUFFER_POOL_THRESHOLD_MODE_STATIC && md.attrid == SAI_BUFFER_PROFILE_ATTR_SHARED_STATIC_TH))
-                {
-                    /* attribute is mandatory */
+                    /*
+                     * Object type  pool_id is correct since previous loop checked that.
+                     * Now extract SAI_BUFFER_POOL_THRESHOLD_MODE attribute
+                     */
+
+                    sai_object_meta_key_t mk = { .objecttype = SAI_OBJECT_TYPE_BUFFER_POOL, .objectkey = { .key = { .object_id = pool_id } } };
+
+                    auto pool_md = sai_metadata_get_attr_metadata(SAI_OBJECT_TYPE_BUFFER_POOL, SAI_BUFFER_POOL_ATTR_THRESHOLD_MODE);
+
+                    auto prev = get_object_previous_attr(mk, *pool_md);
+
+                    sai_buffer_pool_threshold_mode_t mode;
+
+                    if (prev == NULL)
+                    {
+                        mode = (sai_buffer_pool_threshold_mode_t)pool_md->defaultvalue->s32;
+                    }
+                    else
+                    {
+                        mode = (sai_buffer_pool_threshold_mode_t)prev->getSaiAttr()->value.s32;
+                    }
+
+                    if ((mode == SAI_BUFFER_POOL_THRESHOLD_MODE_DYNAMIC && md.attrid == SAI_BUFFER_PROFILE_ATTR_SHARED_DYNAMIC_TH) ||
+                            (mode == SAI_BUFFER_POOL_THRESHOLD_MODE_STATIC && md.attrid == SAI_BUFFER_PROFILE_ATTR_SHARED_STATIC_TH))
+                    {
+                        /* attribute is mandatory */
+                    }
+                    else
+                    {
+                        /* in this case attribute is not mandatory */
+                        META_LOG_INFO(md, "not mandatory");
+                        continue;
+                    }
                 }
-                else
+
+                if (md.attrid == SAI_ACL_TABLE_ATTR_FIELD_ACL_RANGE_TYPE && md.objecttype == SAI_OBJECT_TYPE_ACL_TABLE)
                 {
-                    /* in this case attribute is not mandatory */
-                    META_LOG_INFO(md, "not mandatory");
+                    /*
+                     * TODO Remove in future. Workaround for range type which in
+                     * headers was marked as mandatory by mistake, and we need to
+                     * wait for next SAI integration to pull this change in.
+                     */
+
+                    META_LOG_WARN(md, "Workaround: attribute is mandatory but not passed in attr list, REMOVE ME");
+
                     continue;
                 }
-            }
-
-            if (md.attrid == SAI_ACL_TABLE_ATTR_FIELD_ACL_RANGE_TYPE && md.objecttype == SAI_OBJECT_TYPE_ACL_TABLE)
-            {
-                /*
-                 * TODO Remove in future. Workaround for range type which in
-                 * headers was marked as mandatory by mistake, and we need to
-                 * wait for next SAI integration to pull this change in.
-                 */
 
-                META_LOG_WARN(md, "Workaround: attribute is mandatory but not passed in attr list, REMOVE ME");
+                META_LOG_ERROR(md, "attribute is mandatory but not passed in attr list");
 
-                continue;
+                return SAI_STATUS_MANDATORY_ATTRIBUTE_MISSING;
             }
-
-            META_LOG_ERROR(md, "attribute is mandatory but not passed in attr list");
-
-            return SAI_STATUS_MANDATORY_ATTRIBUTE_MISSING;
         }
     }
 
@@ -3796,6 +4056,8 @@ sai_status_t Meta::meta_generic_validation_create(
                 META_LOG_DEBUG(md, "condition attr %d was passed, using it's value", c.attrid);
 
                 cvalue = &cattr->value;
+
+                shape.conditionsOnValues = true;
             }
 
             if (cmd.attrvaluetype == SAI_ATTR_VALUE_TYPE_BOOL)
@@ -3867,14 +4129,24 @@ sai_status_t Meta::meta_generic_validation_create(
         }
     }
 
+    if (!shapeCached && cacheable)
+    {
+        shape.haskeys = haskeys;
+
+        auto checkTime = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - checkStart);
+
+        m_attrShapeCache.insert(meta_key.objecttype, attr_count, attr_list, shape, (uint64_t)checkTime.count());
+    }
+
     if (haskeys)
     {
-        std::string key = AttrKeyMap::constructKey(switch_id, meta_key, attr_count, attr_list);
+        std::string key = AttrKeyMap::constructBinaryKey(switch_id, meta_key, attr_count, attr_list);
 
         // since we didn't created oid yet, we don't know if attribute key exists, check all
         if (m_attrKeys.attrKeyExists(key))
         {
-            SWSS_LOG_ERROR("attribute key %s already exists, can't create", key.c_str());
+            SWSS_LOG_ERROR("attribute key %s already exists, can't create",
+                    AttrKeyMap::constructKey(switch_id, meta_key, attr_count, attr_list).c_str());
 
             return SAI_STATUS_INVALID_PARAMETER;
         }
@@ -5254,6 +5526,18 @@ sai_object_id_t Meta::meta_extract_switch_id(
     }
 }
 
+void Meta::meta_append_object_list(
+        _Inout_ std::vector<sai_object_id_t>& oids,
+        _In_ const sai_object_list_t& list)
+{
+    SWSS_LOG_ENTER();
+
+    if (list.count && list.list)
+    {
+        oids.insert(oids.end(), list.list, list.list + list.count);
+    }
+}
+
 std::shared_ptr<SaiAttrWrapper> Meta::get_object_previous_attr(
         _In_ const sai_object_meta_key_t& metaKey,
         _In_ const sai_attr_metadata_t& md)
@@ -5553,6 +5837,13 @@ void Meta::meta_generic_validation_post_create(
         m_saiObjectCollection.createObject(meta_key);
     }
 
+    /*
+     * All object ids referenced by created object, reference count on them is
+     * increased at once at the end.
+     */
+
+    std::vector<sai_object_id_t> oids;
+
     auto info = sai_metadata_get_object_type_info(meta_key.objecttype);
 
     if (info->isnonobjectid)
@@ -5571,7 +5862,7 @@ void Meta::meta_generic_validation_post_create(
                 continue;
             }
 
-            m_oids.objectReferenceIncrement(m->getoid(&meta_key));
+            oids.push_back(m->getoid(&meta_key));
         }
     }
     else
@@ -5695,11 +5986,11 @@ void Meta::meta_generic_validation_post_create(
                 break;
 
             case SAI_ATTR_VALUE_TYPE_OBJECT_ID:
-                m_oids.objectReferenceIncrement(value.oid);
+                oids.push_back(value.oid);
                 break;
 
             case SAI_ATTR_VALUE_TYPE_OBJECT_LIST:
-                m_oids.objectReferenceIncrement(value.objlist);
+                meta_append_object_list(oids, value.objlist);
                 break;
 
             case SAI_ATTR_VALUE_TYPE_VLAN_LIST:
@@ -5724,14 +6015,14 @@ void Meta::meta_generic_validation_post_create(
             case SAI_ATTR_VALUE_TYPE_ACL_FIELD_DATA_OBJECT_ID:
                 if (value.aclfield.enable)
                 {
-                    m_oids.objectReferenceIncrement(value.aclfield.data.oid);
+                    oids.push_back(value.aclfield.data.oid);
                 }
                 break;
 
             case SAI_ATTR_VALUE_TYPE_ACL_FIELD_DATA_OBJECT_LIST:
                 if (value.aclfield.enable)
                 {
-                    m_oids.objectReferenceIncrement(value.aclfield.data.objlist);
+                    meta_append_object_list(oids, value.aclfield.data.objlist);
                 }
                 break;
 
@@ -5755,14 +6046,14 @@ void Meta::meta_generic_validation_post_create(
             case SAI_ATTR_VALUE_TYPE_ACL_ACTION_DATA_OBJECT_ID:
                 if (value.aclaction.enable)
                 {
-                    m_oids.objectReferenceIncrement(value.aclaction.parameter.oid);
+                    oids.push_back(value.aclaction.parameter.oid);
                 }
                 break;
 
             case SAI_ATTR_VALUE_TYPE_ACL_ACTION_DATA_OBJECT_LIST:
                 if (value.aclaction.enable)
                 {
-                    m_oids.objectReferenceIncrement(value.aclaction.parameter.objlist);
+                    meta_append_object_list(oids, value.aclaction.parameter.objlist);
                 }
                 break;
 
@@ -5810,13 +6101,13 @@ void Meta::meta_generic_validation_post_create(
         m_saiObjectCollection.setObjectAttr(meta_key, md, attr);
     }
 
+    m_oids.objectReferenceIncrement(oids);
+
     if (haskeys)
     {
-        auto mKey = sai_serialize_object_meta_key(meta_key);
+        auto attrKey = AttrKeyMap::constructBinaryKey(switch_id, meta_key, attr_count, attr_list);
 
-        auto attrKey = AttrKeyMap::constructKey(switch_id, meta_key, attr_count, attr_list);
-
-        m_attrKeys.insert(mKey, attrKey);
+        m_attrKeys.insert(meta_key, attrKey);
     }
 }
 
@@ -7064,13 +7355,11 @@ void Meta::populate(
 
         if (haskeys)
         {
-            auto mKey = sai_serialize_object_meta_key(mk);
-
             auto switchId = switchIdQuery(mk.objectkey.key.object_id);
 
-            auto attrKey = AttrKeyMap::constructKey(switchId, mk, attr_count, attr_list);
+            auto attrKey = AttrKeyMap::constructBinaryKey(switchId, mk, attr_count, attr_list);
 
-            m_attrKeys.insert(mKey, attrKey);
+            m_attrKeys.insert(mk, attrKey);
         }
     }
 }
@@ -6,6 +6,7 @@
 #include "SaiObjectCollection.h"
 #include "PortRelatedSet.h"
 #include "AttrKeyMap.h"
+#include "AttrShapeCache.h"
 #include "OidRefCounter.h"
 
 #include "swss/table.h"
@@ -13,6 +14,7 @@
 #include <vector>
 #include <memory>
 #include <set>
+#include <functional>
 
 #define DEFAULT_VLAN_NUMBER 1
 #define MINIMUM_VLAN_NUMBER 1
@@ -296,6 +298,10 @@ namespace saimeta
                     _In_ const sai_object_meta_key_t& meta_key,
                     _In_ sai_object_id_t switch_id);
 
+            static void meta_append_object_list(
+                    _Inout_ std::vector<sai_object_id_t>& oids,
+                    _In_ const sai_object_list_t& list);
+
             std::shared_ptr<SaiAttrWrapper> get_object_previous_attr(
                     _In_ const sai_object_meta_key_t& metaKey,
                     _In_ const sai_attr_metadata_t& md);
@@ -463,6 +469,16 @@ namespace saimeta
                     _In_ sai_object_type_t object_type,
                     _In_ sai_object_id_t object_id);
 
+            sai_status_t meta_validate_bulk_stats(
+                    _In_ sai_object_id_t switch_id,
+                    _In_ sai_object_type_t object_type,
+                    _In_ uint32_t object_count,
+                    _In_ const sai_object_key_t *object_key,
+                    _In_ uint32_t number_of_counters,
+                    _In_ const sai_stat_id_t *counter_ids,
+                    _In_ sai_stats_mode_t mode,
+                    _In_ const sai_status_t *object_statuses);
+
         private: // validate OID
 
             sai_status_t meta_sai_validate_oid(
@@ -565,6 +581,46 @@ namespace saimeta
             void populate(
                     _In_ const swss::TableDump& dump);
 
+        public: // bulk validation
+
+            /**
+             * @brief Set number of threads used to validate bulk items.
+             *
+             * When greater than 1, items of a big enough bulk request are
+             * validated in parallel chunks against current (read only) state
+             * of the metadata DB. Returned status is the same as in serial
+             * validation, and post create/remove/set is still executed
+             * serially. Default is 1 (serial validation).
+             */
+            void setBulkValidationThreads(
+                    _In_ uint32_t threads);
+
+            uint32_t getBulkValidationThreads() const;
+
+        public: // create validation
+
+            /**
+             * @brief Get cache of validated create attribute shapes.
+             *
+             * Can be used to report cache hit rate and validation time saved.
+             */
+            const AttrShapeCache& getAttrShapeCache() const;
+
+        private:
+
+            /**
+             * @brief Validate all items of bulk request.
+             *
+             * Items are validated in order, first failing item status is
+             * returned. If duplicateStatus is not SAI_STATUS_SUCCESS, repeated
+             * keys inside the same bulk are reported as duplicateStatus at the
+             * position of the first repeated key.
+             */
+            sai_status_t meta_bulk_validate(
+                    _In_ const std::vector<sai_object_meta_key_t>& vmk,
+                    _In_ sai_status_t duplicateStatus,
+                    _In_ const std::function<sai_status_t(uint32_t)>& validate);
+
         private:
 
             void clean_after_switch_remove(
@@ -599,6 +655,13 @@ namespace saimeta
 
             AttrKeyMap m_attrKeys;
 
+            /**
+             * @brief Cache of attribute shapes which passed create validation.
+             *
+             * Depends only on metadata, so it's not cleared with DB.
+             */
+            AttrShapeCache m_attrShapeCache;
+
         private: // unittests
 
             std::set<std::string> m_meta_unittests_set_readonly_set;
@@ -608,5 +671,9 @@ namespace saimeta
         private: // warm boot
 
             bool m_warmBoot;
+
+        private: // bulk validation
+
+            uint32_t m_bulkValidationThreads;
     };
 }
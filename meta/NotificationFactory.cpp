@@ -53,3 +53,45 @@ std::shared_ptr<Notification> NotificationFactory::deserialize(
 
     SWSS_LOG_THROW("unknown notification: '%s', FIXME", name.c_str());
 }
+
+std::string NotificationFactory::getName(
+        _In_ const Notification& notification)
+{
+    SWSS_LOG_ENTER();
+
+    switch (notification.getNotificationType())
+    {
+        case SAI_SWITCH_NOTIFICATION_TYPE_FDB_EVENT:
+            return SAI_SWITCH_NOTIFICATION_NAME_FDB_EVENT;
+
+        case SAI_SWITCH_NOTIFICATION_TYPE_NAT_EVENT:
+            return SAI_SWITCH_NOTIFICATION_NAME_NAT_EVENT;
+
+        case SAI_SWITCH_NOTIFICATION_TYPE_PORT_HOST_TX_READY:
+            return SAI_SWITCH_NOTIFICATION_NAME_PORT_HOST_TX_READY;
+
+        case SAI_SWITCH_NOTIFICATION_TYPE_PORT_STATE_CHANGE:
+            return SAI_SWITCH_NOTIFICATION_NAME_PORT_STATE_CHANGE;
+
+        case SAI_SWITCH_NOTIFICATION_TYPE_QUEUE_PFC_DEADLOCK:
+            return SAI_SWITCH_NOTIFICATION_NAME_QUEUE_PFC_DEADLOCK;
+
+        case SAI_SWITCH_NOTIFICATION_TYPE_SWITCH_SHUTDOWN_REQUEST:
+            return SAI_SWITCH_NOTIFICATION_NAME_SWITCH_SHUTDOWN_REQUEST;
+
+        case SAI_SWITCH_NOTIFICATION_TYPE_SWITCH_ASIC_SDK_HEALTH_EVENT:
+            return SAI_SWITCH_NOTIFICATION_NAME_SWITCH_ASIC_SDK_HEALTH_EVENT;
+
+        case SAI_SWITCH_NOTIFICATION_TYPE_SWITCH_STATE_CHANGE:
+            return SAI_SWITCH_NOTIFICATION_NAME_SWITCH_STATE_CHANGE;
+
+        case SAI_SWITCH_NOTIFICATION_TYPE_BFD_SESSION_STATE_CHANGE:
+            return SAI_SWITCH_NOTIFICATION_NAME_BFD_SESSION_STATE_CHANGE;
+
+        case SAI_SWITCH_NOTIFICATION_TYPE_TWAMP_SESSION_EVENT:
+            return SAI_SWITCH_NOTIFICATION_NAME_TWAMP_SESSION_EVENT;
+
+        default:
+            SWSS_LOG_THROW("unknown notification type: %d, FIXME", notification.getNotificationType());
+    }
+}
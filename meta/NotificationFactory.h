@@ -3,6 +3,7 @@
 #include "Notification.h"
 
 #include <memory>
+#include <string>
 
 namespace sairedis
 {
@@ -18,5 +19,12 @@ namespace sairedis
             static std::shared_ptr<Notification> deserialize(
                     _In_ const std::string& name,
                     _In_ const std::string& serializedNotification);
+
+            /**
+             * @brief Get notification name, which deserialize expects for
+             * given notification.
+             */
+            static std::string getName(
+                    _In_ const Notification& notification);
     };
 }
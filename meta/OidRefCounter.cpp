@@ -6,11 +6,217 @@
 
 using namespace saimeta;
 
+constexpr size_t OidRefCounter::NPOS;
+constexpr size_t OidRefCounter::NULL_SLOT;
+constexpr size_t OidRefCounter::MIN_CAPACITY;
+
+OidRefCounter::OidRefCounter():
+    m_slots(MIN_CAPACITY, Slot{SAI_NULL_OBJECT_ID, 0}),
+    m_size(0),
+    m_nullExists(false),
+    m_nullCount(0)
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+size_t OidRefCounter::hash(
+        _In_ sai_object_id_t oid)
+{
+    SWSS_LOG_ENTER();
+
+    /*
+     * Object ids have object type and switch index in high bits and object
+     * index in low bits, mix all of them (murmur3 finalizer).
+     */
+
+    uint64_t h = oid;
+
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+
+    return (size_t)h;
+}
+
+size_t OidRefCounter::findSlot(
+        _In_ sai_object_id_t oid) const
+{
+    SWSS_LOG_ENTER();
+
+    if (oid == SAI_NULL_OBJECT_ID)
+    {
+        return m_nullExists ? NULL_SLOT : NPOS;
+    }
+
+    size_t mask = m_slots.size() - 1;
+
+    for (size_t idx = hash(oid) & mask; ; idx = (idx + 1) & mask)
+    {
+        const Slot& slot = m_slots[idx];
+
+        if (slot.oid == oid)
+        {
+            return idx;
+        }
+
+        if (slot.oid == SAI_NULL_OBJECT_ID)
+        {
+            return NPOS;
+        }
+    }
+}
+
+size_t OidRefCounter::findSlotOrThrow(
+        _In_ sai_object_id_t oid) const
+{
+    SWSS_LOG_ENTER();
+
+    size_t slot = findSlot(oid);
+
+    if (slot == NPOS)
+    {
+        SWSS_LOG_THROW("FATAL: object oid 0x%" PRIx64 " not in reference map", oid);
+    }
+
+    return slot;
+}
+
+int32_t& OidRefCounter::getCount(
+        _In_ size_t slot)
+{
+    SWSS_LOG_ENTER();
+
+    if (slot == NULL_SLOT)
+    {
+        return m_nullCount;
+    }
+
+    return m_slots[slot].count;
+}
+
+void OidRefCounter::insertSlot(
+        _In_ sai_object_id_t oid)
+{
+    SWSS_LOG_ENTER();
+
+    if (oid == SAI_NULL_OBJECT_ID)
+    {
+        m_nullExists = true;
+        m_nullCount = 0;
+        return;
+    }
+
+    // keep load factor below 3/4
+
+    if ((m_size + 1) * 4 > m_slots.size() * 3)
+    {
+        rehash(m_slots.size() * 2);
+    }
+
+    size_t mask = m_slots.size() - 1;
+
+    size_t idx = hash(oid) & mask;
+
+    while (m_slots[idx].oid != SAI_NULL_OBJECT_ID)
+    {
+        idx = (idx + 1) & mask;
+    }
+
+    m_slots[idx].oid = oid;
+    m_slots[idx].count = 0;
+
+    m_size++;
+}
+
+void OidRefCounter::eraseSlot(
+        _In_ size_t slot)
+{
+    SWSS_LOG_ENTER();
+
+    if (slot == NULL_SLOT)
+    {
+        m_nullExists = false;
+        m_nullCount = 0;
+        return;
+    }
+
+    /*
+     * Backward shift deletion, move following entries of the same probe
+     * sequence into the hole, so we don't need tombstones.
+     */
+
+    size_t mask = m_slots.size() - 1;
+
+    size_t hole = slot;
+
+    for (size_t idx = (hole + 1) & mask; m_slots[idx].oid != SAI_NULL_OBJECT_ID; idx = (idx + 1) & mask)
+    {
+        size_t home = hash(m_slots[idx].oid) & mask;
+
+        // check if home position of entry is cyclically outside (hole, idx]
+
+        bool movable = (hole <= idx)
+            ? (home <= hole || home > idx)
+            : (home <= hole && home > idx);
+
+        if (movable)
+        {
+            m_slots[hole] = m_slots[idx];
+            hole = idx;
+        }
+    }
+
+    m_slots[hole].oid = SAI_NULL_OBJECT_ID;
+    m_slots[hole].count = 0;
+
+    m_size--;
+}
+
+void OidRefCounter::rehash(
+        _In_ size_t capacity)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<Slot> slots(capacity, Slot{SAI_NULL_OBJECT_ID, 0});
+
+    size_t mask = capacity - 1;
+
+    for (auto& slot: m_slots)
+    {
+        if (slot.oid == SAI_NULL_OBJECT_ID)
+        {
+            continue;
+        }
+
+        size_t idx = hash(slot.oid) & mask;
+
+        while (slots[idx].oid != SAI_NULL_OBJECT_ID)
+        {
+            idx = (idx + 1) & mask;
+        }
+
+        slots[idx] = slot;
+    }
+
+    m_slots.swap(slots);
+}
+
 void OidRefCounter::clear()
 {
     SWSS_LOG_ENTER();
 
-    m_hash.clear();
+    std::vector<Slot> slots(MIN_CAPACITY, Slot{SAI_NULL_OBJECT_ID, 0});
+
+    m_slots.swap(slots);
+
+    m_size = 0;
+
+    m_nullExists = false;
+    m_nullCount = 0;
 }
 
 bool OidRefCounter::objectReferenceExists(
@@ -18,7 +224,7 @@ bool OidRefCounter::objectReferenceExists(
 {
     SWSS_LOG_ENTER();
 
-    bool exists = m_hash.find(oid) != m_hash.end();
+    bool exists = findSlot(oid) != NPOS;
 
     SWSS_LOG_DEBUG("object 0x%" PRIx64 " reference: %s", oid, exists ? "exists" : "missing");
 
@@ -36,14 +242,11 @@ void OidRefCounter::objectReferenceIncrement(
         return;
     }
 
-    if (!objectReferenceExists(oid))
-    {
-        SWSS_LOG_THROW("FATAL: object oid 0x%" PRIx64 " not in reference map", oid);
-    }
+    int32_t& count = getCount(findSlotOrThrow(oid));
 
-    m_hash[oid]++;
+    count++;
 
-    SWSS_LOG_DEBUG("increased reference on oid 0x%" PRIx64 " to %d", oid, m_hash[oid]);
+    SWSS_LOG_DEBUG("increased reference on oid 0x%" PRIx64 " to %d", oid, count);
 }
 
 void OidRefCounter::objectReferenceIncrement(
@@ -51,10 +254,38 @@ void OidRefCounter::objectReferenceIncrement(
 {
     SWSS_LOG_ENTER();
 
-    for (uint32_t i = 0; i < list.count; ++i)
+    objectReferenceIncrement(std::vector<sai_object_id_t>(list.list, list.list + list.count));
+}
+
+void OidRefCounter::objectReferenceIncrement(
+        _In_ const std::vector<sai_object_id_t>& oids)
+{
+    SWSS_LOG_ENTER();
+
+    /*
+     * First pass only looks up all slots, so if any object is missing we will
+     * throw before modifying any reference count. Table is not modified
+     * during increment, so slots indexes stay valid.
+     */
+
+    std::vector<size_t> slots;
+
+    slots.reserve(oids.size());
+
+    for (auto oid: oids)
     {
-        objectReferenceIncrement(list.list[i]);
+        if (oid != SAI_NULL_OBJECT_ID)
+        {
+            slots.push_back(findSlotOrThrow(oid));
+        }
     }
+
+    for (auto slot: slots)
+    {
+        getCount(slot)++;
+    }
+
+    SWSS_LOG_DEBUG("increased reference on %zu oids", slots.size());
 }
 
 void OidRefCounter::objectReferenceDecrement(
@@ -68,19 +299,16 @@ void OidRefCounter::objectReferenceDecrement(
         return;
     }
 
-    if (!objectReferenceExists(oid))
-    {
-        SWSS_LOG_THROW("FATAL: object oid 0x%" PRIx64 " not in reference map", oid);
-    }
+    int32_t& count = getCount(findSlotOrThrow(oid));
 
-    m_hash[oid]--;
+    count--;
 
-    if (m_hash[oid] < 0)
+    if (count < 0)
     {
         SWSS_LOG_THROW("FATAL: object oid 0x%" PRIx64 " reference count is negative!", oid);
     }
 
-    SWSS_LOG_DEBUG("decreased reference on oid 0x%" PRIx64 " to %d", oid, m_hash[oid]);
+    SWSS_LOG_DEBUG("decreased reference on oid 0x%" PRIx64 " to %d", oid, count);
 }
 
 void OidRefCounter::objectReferenceDecrement(
@@ -88,10 +316,45 @@ void OidRefCounter::objectReferenceDecrement(
 {
     SWSS_LOG_ENTER();
 
-    for (uint32_t i = 0; i < list.count; ++i)
+    objectReferenceDecrement(std::vector<sai_object_id_t>(list.list, list.list + list.count));
+}
+
+void OidRefCounter::objectReferenceDecrement(
+        _In_ const std::vector<sai_object_id_t>& oids)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<size_t> slots;
+
+    slots.reserve(oids.size());
+
+    for (auto oid: oids)
     {
-        objectReferenceDecrement(list.list[i]);
+        if (oid != SAI_NULL_OBJECT_ID)
+        {
+            slots.push_back(findSlotOrThrow(oid));
+        }
+    }
+
+    for (size_t idx = 0; idx < slots.size(); idx++)
+    {
+        if (--getCount(slots[idx]) >= 0)
+        {
+            continue;
+        }
+
+        // same object can be on the list multiple times, revert what was done
+
+        for (size_t i = 0; i <= idx; i++)
+        {
+            getCount(slots[i])++;
+        }
+
+        SWSS_LOG_THROW("FATAL: object oid 0x%" PRIx64 " reference count is negative!",
+                slots[idx] == NULL_SLOT ? SAI_NULL_OBJECT_ID : m_slots[slots[idx]].oid);
     }
+
+    SWSS_LOG_DEBUG("decreased reference on %zu oids", slots.size());
 }
 
 void OidRefCounter::objectReferenceInsert(
@@ -104,7 +367,7 @@ void OidRefCounter::objectReferenceInsert(
         SWSS_LOG_THROW("FATAL: object oid 0x%" PRIx64 " already in reference map", oid);
     }
 
-    m_hash[oid] = 0;
+    insertSlot(oid);
 
     SWSS_LOG_DEBUG("inserted reference on 0x%" PRIx64 "", oid);
 }
@@ -114,9 +377,11 @@ void OidRefCounter::objectReferenceRemove(
 {
     SWSS_LOG_ENTER();
 
-    if (objectReferenceExists(oid))
+    size_t slot = findSlot(oid);
+
+    if (slot != NPOS)
     {
-        int32_t count = getObjectReferenceCount(oid);
+        int32_t count = getCount(slot);
 
         if (count > 0)
         {
@@ -130,7 +395,7 @@ void OidRefCounter::objectReferenceRemove(
 
     SWSS_LOG_DEBUG("removing object oid 0x%" PRIx64 " reference", oid);
 
-    m_hash.erase(oid);
+    eraseSlot(slot);
 }
 
 int32_t OidRefCounter::getObjectReferenceCount(
@@ -138,9 +403,11 @@ int32_t OidRefCounter::getObjectReferenceCount(
 {
     SWSS_LOG_ENTER();
 
-    if (objectReferenceExists(oid))
+    size_t slot = findSlot(oid);
+
+    if (slot != NPOS)
     {
-        int32_t count = m_hash.at(oid);
+        int32_t count = (slot == NULL_SLOT) ? m_nullCount : m_slots[slot].count;
 
         SWSS_LOG_DEBUG("reference count on oid 0x%" PRIx64 " is %d", oid, count);
 
@@ -162,7 +429,22 @@ std::unordered_map<sai_object_id_t, int32_t> OidRefCounter::getAllReferences() c
 {
     SWSS_LOG_ENTER();
 
-    return m_hash; // copy
+    std::unordered_map<sai_object_id_t, int32_t> map;
+
+    if (m_nullExists)
+    {
+        map[SAI_NULL_OBJECT_ID] = m_nullCount;
+    }
+
+    for (auto& slot: m_slots)
+    {
+        if (slot.oid != SAI_NULL_OBJECT_ID)
+        {
+            map[slot.oid] = slot.count;
+        }
+    }
+
+    return map;
 }
 
 std::vector<sai_object_id_t> OidRefCounter::getAllOids() const
@@ -171,9 +453,17 @@ std::vector<sai_object_id_t> OidRefCounter::getAllOids() const
 
     std::vector<sai_object_id_t> vec;
 
-    for (auto& it: m_hash)
+    if (m_nullExists)
     {
-        vec.push_back(it.first);
+        vec.push_back(SAI_NULL_OBJECT_ID);
+    }
+
+    for (auto& slot: m_slots)
+    {
+        if (slot.oid != SAI_NULL_OBJECT_ID)
+        {
+            vec.push_back(slot.oid);
+        }
     }
 
     return vec;
@@ -184,11 +474,13 @@ void OidRefCounter::objectReferenceClear(
 {
     SWSS_LOG_ENTER();
 
-    if (objectReferenceExists(oid))
+    size_t slot = findSlot(oid);
+
+    if (slot != NPOS)
     {
         SWSS_LOG_DEBUG("removing object oid 0x%" PRIx64 " reference", oid);
 
-        m_hash.erase(oid);
+        eraseSlot(slot);
     }
     else
     {
@@ -13,7 +13,7 @@ namespace saimeta
     {
         public:
 
-            OidRefCounter() = default;
+            OidRefCounter();
 
             virtual ~OidRefCounter() = default;
 
@@ -43,6 +43,16 @@ namespace saimeta
             void objectReferenceIncrement(
                     _In_ const sai_object_list_t& list);
 
+            /**
+             * @brief Increment reference count on multiple objects at once.
+             *
+             * Object may be present on the list multiple times, NULL objects
+             * are skipped. Throws if any of objects was not previously
+             * inserted, in that case no reference count is modified.
+             */
+            void objectReferenceIncrement(
+                    _In_ const std::vector<sai_object_id_t>& oids);
+
             /**
              * @brief Decrement reference count on object.
              *
@@ -55,6 +65,17 @@ namespace saimeta
             void objectReferenceDecrement(
                     _In_ const sai_object_list_t& list);
 
+            /**
+             * @brief Decrement reference count on multiple objects at once.
+             *
+             * Object may be present on the list multiple times, NULL objects
+             * are skipped. Throws if any of objects was not previously
+             * inserted or if any reference count would become negative, in
+             * that case no reference count is modified.
+             */
+            void objectReferenceDecrement(
+                    _In_ const std::vector<sai_object_id_t>& oids);
+
             /**
              * @brief Insert object reference.
              *
@@ -103,14 +124,61 @@ namespace saimeta
 
             std::vector<sai_object_id_t> getAllOids() const;
 
+        private:
+
+            static constexpr size_t NPOS = (size_t)-1;
+
+            static constexpr size_t NULL_SLOT = (size_t)-2;
+
+            static constexpr size_t MIN_CAPACITY = 64;
+
+            typedef struct _Slot
+            {
+                sai_object_id_t oid;
+
+                int32_t count;
+
+            } Slot;
+
+            size_t findSlot(
+                    _In_ sai_object_id_t oid) const;
+
+            size_t findSlotOrThrow(
+                    _In_ sai_object_id_t oid) const;
+
+            int32_t& getCount(
+                    _In_ size_t slot);
+
+            void insertSlot(
+                    _In_ sai_object_id_t oid);
+
+            void eraseSlot(
+                    _In_ size_t slot);
+
+            void rehash(
+                    _In_ size_t capacity);
+
+            static size_t hash(
+                    _In_ sai_object_id_t oid);
+
         private:
 
             /**
              * @brief Object id to reference count hash.
              *
+             * Open addressing hash with linear probing, capacity is always
+             * power of 2. Empty slot is marked by SAI_NULL_OBJECT_ID, that's
+             * why NULL object reference is kept outside of the table.
+             *
              * Object may exist in the hash, and have reference count 0, which
              * means is not not used anywhere and can be safely removed.
              */
-            std::unordered_map<sai_object_id_t, int32_t> m_hash;
+            std::vector<Slot> m_slots;
+
+            size_t m_size;
+
+            bool m_nullExists;
+
+            int32_t m_nullCount;
     };
 }
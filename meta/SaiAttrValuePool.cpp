@@ -0,0 +1,119 @@
+#include "SaiAttrValuePool.h"
+
+#include "swss/logger.h"
+
+#include "sai_serialize.h"
+
+using namespace saimeta;
+
+SaiAttrValuePool::SaiAttrValuePool():
+    m_index(std::make_shared<Index>()),
+    m_hits(0),
+    m_misses(0)
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+std::shared_ptr<SaiAttrWrapper> SaiAttrValuePool::intern(
+        _In_ const sai_attr_metadata_t* meta,
+        _In_ const sai_attribute_t& attr)
+{
+    SWSS_LOG_ENTER();
+
+    if (!meta)
+    {
+        SWSS_LOG_THROW("metadata can't be null");
+    }
+
+    // value alone is not enough, same value can be used by different attributes
+
+    std::string key = std::to_string(meta->objecttype) + ":"
+        + std::to_string(meta->attrid) + "="
+        + sai_serialize_attr_value(*meta, attr, false);
+
+    auto it = m_index->find(key);
+
+    if (it != m_index->end())
+    {
+        auto wrapper = it->second.lock();
+
+        if (wrapper)
+        {
+            m_hits++;
+
+            return wrapper;
+        }
+    }
+
+    m_misses++;
+
+    std::unique_ptr<SaiAttrWrapper> ptr(new SaiAttrWrapper(meta, attr));
+
+    it = m_index->emplace(key, std::weak_ptr<SaiAttrWrapper>()).first;
+
+    /*
+     * Element references are stable in unordered_map, so we can point to the
+     * key stored in index node. Index is only held weakly, since wrapper can
+     * outlive the pool or the pool can be cleared.
+     */
+
+    const std::string* keyPtr = &it->first;
+
+    std::weak_ptr<Index> weakIndex = m_index;
+
+    std::shared_ptr<SaiAttrWrapper> wrapper(ptr.release(), [weakIndex, keyPtr](SaiAttrWrapper* p)
+            {
+                auto index = weakIndex.lock();
+
+                if (index)
+                {
+                    auto i = index->find(*keyPtr);
+
+                    if (i != index->end() && i->second.expired())
+                    {
+                        index->erase(i);
+                    }
+                }
+
+                delete p;
+            });
+
+    it->second = wrapper;
+
+    return wrapper;
+}
+
+void SaiAttrValuePool::clear()
+{
+    SWSS_LOG_ENTER();
+
+    // don't clear existing index, live wrappers are still pointing to its keys
+
+    m_index = std::make_shared<Index>();
+
+    m_hits = 0;
+    m_misses = 0;
+}
+
+size_t SaiAttrValuePool::size() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_index->size();
+}
+
+uint64_t SaiAttrValuePool::getHitCount() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_hits;
+}
+
+uint64_t SaiAttrValuePool::getMissCount() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_misses;
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "SaiAttrWrapper.h"
+
+#include <string>
+#include <unordered_map>
+#include <memory>
+
+namespace saimeta
+{
+    /**
+     * @brief Pool of interned attribute values.
+     *
+     * Attribute wrappers are immutable once created, so objects which share
+     * the same attribute value (like thousands of routes pointing to the same
+     * next hop) can share the same wrapper instance instead of keeping their
+     * own deep copy of the attribute.
+     *
+     * Value is removed from the pool when last object referencing it is
+     * removed or its attribute is changed.
+     *
+     * This class is not thread safe.
+     */
+    class SaiAttrValuePool
+    {
+        public:
+
+            SaiAttrValuePool();
+
+            virtual ~SaiAttrValuePool() = default;
+
+        private:
+
+            SaiAttrValuePool(const SaiAttrValuePool&) = delete;
+            SaiAttrValuePool& operator=(const SaiAttrValuePool&) = delete;
+
+        public:
+
+            /**
+             * @brief Get shared wrapper holding given attribute value.
+             *
+             * If the same value of the same attribute is already in the pool,
+             * existing wrapper is returned, otherwise new one is created.
+             */
+            std::shared_ptr<SaiAttrWrapper> intern(
+                    _In_ const sai_attr_metadata_t* meta,
+                    _In_ const sai_attribute_t& attr);
+
+            /**
+             * @brief Drop all values from the pool.
+             *
+             * Wrappers already handed out stay valid.
+             */
+            void clear();
+
+            /**
+             * @brief Number of distinct values currently in the pool.
+             */
+            size_t size() const;
+
+            uint64_t getHitCount() const;
+
+            uint64_t getMissCount() const;
+
+        private:
+
+            typedef std::unordered_map<std::string, std::weak_ptr<SaiAttrWrapper>> Index;
+
+            std::shared_ptr<Index> m_index;
+
+            uint64_t m_hits;
+
+            uint64_t m_misses;
+    };
+}
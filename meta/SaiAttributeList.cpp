@@ -1,6 +1,7 @@
 #include "SaiAttributeList.h"
 
 #include "sai_serialize.h"
+#include "AttrSerializerTable.h"
 
 using namespace saimeta;
 
@@ -26,15 +27,7 @@ SaiAttributeList::SaiAttributeList(
         sai_attribute_t attr;
         memset(&attr, 0, sizeof(sai_attribute_t));
 
-        sai_deserialize_attr_id(str_attr_id, attr.id);
-
-        // TODO object type is not necessary, we can use get attr metadata from attr id name
-        auto meta = sai_metadata_get_attr_metadata(objectType, attr.id);
-
-        if (meta == NULL)
-        {
-            SWSS_LOG_THROW("FATAL: failed to find metadata for object type %d and attr id %d", objectType, attr.id);
-        }
+        auto meta = get_attr_metadata(objectType, str_attr_id, attr.id);
 
         sai_deserialize_attr_value(str_attr_value, *meta, attr, countOnly);
 
@@ -63,15 +56,7 @@ SaiAttributeList::SaiAttributeList(
         sai_attribute_t attr;
         memset(&attr, 0, sizeof(sai_attribute_t));
 
-        sai_deserialize_attr_id(str_attr_id, attr.id);
-
-        // TODO object type is not necessary, we can use get attr metadata from attr id name
-        auto meta = sai_metadata_get_attr_metadata(objectType, attr.id);
-
-        if (meta == NULL)
-        {
-            SWSS_LOG_THROW("FATAL: failed to find metadata for object type %d and attr id %d", objectType, attr.id);
-        }
+        auto meta = get_attr_metadata(objectType, str_attr_id, attr.id);
 
         sai_deserialize_attr_value(str_attr_value, *meta, attr, countOnly);
 
@@ -80,6 +65,37 @@ SaiAttributeList::SaiAttributeList(
     }
 }
 
+const sai_attr_metadata_t* SaiAttributeList::get_attr_metadata(
+        _In_ sai_object_type_t objectType,
+        _In_ const std::string& attrIdName,
+        _Out_ sai_attr_id_t& attrId)
+{
+    SWSS_LOG_ENTER();
+
+    auto entry = AttrSerializerTable::getInstance().findByName(attrIdName);
+
+    if (entry && entry->meta->objecttype == objectType)
+    {
+        attrId = entry->meta->attrid;
+
+        return entry->meta;
+    }
+
+    // ignored attribute names and attributes of other object types
+
+    sai_deserialize_attr_id(attrIdName, attrId);
+
+    // TODO object type is not necessary, we can use get attr metadata from attr id name
+    auto meta = sai_metadata_get_attr_metadata(objectType, attrId);
+
+    if (meta == NULL)
+    {
+        SWSS_LOG_THROW("FATAL: failed to find metadata for object type %d and attr id %d", objectType, attrId);
+    }
+
+    return meta;
+}
+
 SaiAttributeList::~SaiAttributeList()
 {
     SWSS_LOG_ENTER();
@@ -106,29 +122,65 @@ std::vector<swss::FieldValueTuple> SaiAttributeList::serialize_attr_list(
 
     std::vector<swss::FieldValueTuple> entry;
 
+    entry.reserve(attr_count);
+
     for (uint32_t index = 0; index < attr_count; ++index)
     {
         const sai_attribute_t *attr = &attr_list[index];
 
-        auto meta = sai_metadata_get_attr_metadata(objectType, attr->id);
+        auto entry = AttrSerializerTable::getInstance().find(objectType, attr->id);
+
+        auto meta = entry ? entry->meta : sai_metadata_get_attr_metadata(objectType, attr->id);
 
         if (meta == NULL)
         {
             SWSS_LOG_THROW("FATAL: failed to find metadata for object type %d and attr id %d", objectType, attr->id);
         }
 
-        std::string str_attr_id = sai_serialize_attr_id(*meta);
-
-        std::string str_attr_value = sai_serialize_attr_value(*meta, *attr, countOnly);
+        std::string str_attr_value;
 
-        swss::FieldValueTuple fvt(str_attr_id, str_attr_value);
+        sai_serialize_attr_value(str_attr_value, *meta, *attr, countOnly);
 
-        entry.push_back(fvt);
+        entry.emplace_back(meta->attridname, std::move(str_attr_value));
     }
 
     return entry;
 }
 
+void SaiAttributeList::serialize_attr_list(
+        _Inout_ std::string& buf,
+        _In_ sai_object_type_t objectType,
+        _In_ uint32_t attr_count,
+        _In_ const sai_attribute_t *attr_list,
+        _In_ bool countOnly)
+{
+    SWSS_LOG_ENTER();
+
+    for (uint32_t index = 0; index < attr_count; ++index)
+    {
+        const sai_attribute_t *attr = &attr_list[index];
+
+        auto entry = AttrSerializerTable::getInstance().find(objectType, attr->id);
+
+        auto meta = entry ? entry->meta : sai_metadata_get_attr_metadata(objectType, attr->id);
+
+        if (meta == NULL)
+        {
+            SWSS_LOG_THROW("FATAL: failed to find metadata for object type %d and attr id %d", objectType, attr->id);
+        }
+
+        if (index != 0)
+        {
+            buf += '|';
+        }
+
+        buf += meta->attridname;
+        buf += '=';
+
+        sai_serialize_attr_value(buf, *meta, *attr, countOnly);
+    }
+}
+
 sai_attribute_t* SaiAttributeList::get_attr_list()
 {
     SWSS_LOG_ENTER();
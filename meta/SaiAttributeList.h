@@ -40,6 +40,33 @@ namespace saimeta
                     _In_ const sai_attribute_t *attr_list,
                     _In_ bool countOnly);
 
+            /**
+             * @brief Serialize attribute list appending to buffer.
+             *
+             * Produces the same output as serialize_attr_list joined by
+             * Globals::joinFieldValues, "attr=value|attr=value", but without
+             * creating intermediate field value tuples.
+             */
+            static void serialize_attr_list(
+                    _Inout_ std::string& buf,
+                    _In_ sai_object_type_t object_type,
+                    _In_ uint32_t attr_count,
+                    _In_ const sai_attribute_t *attr_list,
+                    _In_ bool countOnly);
+
+        private:
+
+            /**
+             * @brief Get attribute metadata by attribute id name.
+             *
+             * Attribute id name is resolved by AttrSerializerTable, so both
+             * attribute id and metadata are found with single lookup.
+             */
+            static const sai_attr_metadata_t* get_attr_metadata(
+                    _In_ sai_object_type_t objectType,
+                    _In_ const std::string& attrIdName,
+                    _Out_ sai_attr_id_t& attrId);
+
         private:
 
             SaiAttributeList(const SaiAttributeList&);
@@ -4,8 +4,19 @@
 
 #include "sai_serialize.h"
 
+#include <algorithm>
+
 using namespace saimeta;
 
+static bool attrIdLess(
+        _In_ const std::shared_ptr<SaiAttrWrapper>& attr,
+        _In_ sai_attr_id_t id)
+{
+    SWSS_LOG_ENTER();
+
+    return attr->getAttrId() < id;
+}
+
 SaiObject::SaiObject(
         _In_ const sai_object_meta_key_t& metaKey):
     m_metaKey(metaKey)
@@ -30,7 +41,9 @@ bool SaiObject::hasAttr(
 {
     SWSS_LOG_ENTER();
 
-    return m_attrs.find(id) != m_attrs.end();
+    auto it = std::lower_bound(m_attrs.begin(), m_attrs.end(), id, attrIdLess);
+
+    return it != m_attrs.end() && (*it)->getAttrId() == id;
 }
 
 const sai_object_meta_key_t& SaiObject::getMetaKey() const
@@ -46,7 +59,7 @@ void SaiObject::setAttr(
 {
     SWSS_LOG_ENTER();
 
-    m_attrs[attr->id] = std::make_shared<SaiAttrWrapper>(md, *attr);
+    setAttr(std::make_shared<SaiAttrWrapper>(md, *attr));
 }
 
 void SaiObject::setAttr(
@@ -54,7 +67,16 @@ void SaiObject::setAttr(
 {
     SWSS_LOG_ENTER();
 
-    m_attrs[attr->getAttrId()] = attr;
+    auto it = std::lower_bound(m_attrs.begin(), m_attrs.end(), attr->getAttrId(), attrIdLess);
+
+    if (it != m_attrs.end() && (*it)->getAttrId() == attr->getAttrId())
+    {
+        *it = attr;
+    }
+    else
+    {
+        m_attrs.insert(it, attr);
+    }
 }
 
 std::shared_ptr<SaiAttrWrapper> SaiObject::getAttr(
@@ -62,10 +84,10 @@ std::shared_ptr<SaiAttrWrapper> SaiObject::getAttr(
 {
     SWSS_LOG_ENTER();
 
-    auto it = m_attrs.find(id);
+    auto it = std::lower_bound(m_attrs.begin(), m_attrs.end(), id, attrIdLess);
 
-    if (it != m_attrs.end())
-        return it->second;
+    if (it != m_attrs.end() && (*it)->getAttrId() == id)
+        return *it;
 
     return nullptr;
 }
@@ -74,10 +96,5 @@ std::vector<std::shared_ptr<SaiAttrWrapper>> SaiObject::getAttributes() const
 {
     SWSS_LOG_ENTER();
 
-    std::vector<std::shared_ptr<SaiAttrWrapper>> values;
-
-    for (auto&kvp: m_attrs)
-        values.push_back(kvp.second);
-
-    return values;
+    return m_attrs; // copy
 }
@@ -3,7 +3,6 @@
 #include "SaiAttrWrapper.h"
 
 #include <memory>
-#include <unordered_map>
 #include <vector>
 
 namespace saimeta
@@ -47,6 +46,12 @@ namespace saimeta
 
             sai_object_meta_key_t m_metaKey;
 
-            std::unordered_map<sai_attr_id_t, std::shared_ptr<SaiAttrWrapper>> m_attrs;
+            /**
+             * @brief Attributes sorted by attribute id.
+             *
+             * Objects usually have only few attributes set, so flat vector is
+             * more compact and faster to search than hash map.
+             */
+            std::vector<std::shared_ptr<SaiAttrWrapper>> m_attrs;
     };
 }
@@ -4,11 +4,219 @@
 
 using namespace saimeta;
 
+constexpr size_t SaiObjectCollection::NPOS;
+constexpr size_t SaiObjectCollection::MIN_CAPACITY;
+
 void SaiObjectCollection::clear()
 {
     SWSS_LOG_ENTER();
 
     m_objects.clear();
+
+    m_attrValuePool.clear();
+}
+
+size_t SaiObjectCollection::getObjectTypeIndex(
+        _In_ sai_object_type_t objectType)
+{
+    SWSS_LOG_ENTER();
+
+    if (objectType < SAI_OBJECT_TYPE_MAX)
+    {
+        return (size_t)objectType;
+    }
+
+    if (objectType >= (sai_object_type_t)SAI_OBJECT_TYPE_EXTENSIONS_RANGE_START &&
+            objectType < (sai_object_type_t)SAI_OBJECT_TYPE_EXTENSIONS_RANGE_END)
+    {
+        return (size_t)SAI_OBJECT_TYPE_MAX + (size_t)(objectType - SAI_OBJECT_TYPE_EXTENSIONS_RANGE_START);
+    }
+
+    return NPOS;
+}
+
+SaiObjectCollection::ObjectTypeStore* SaiObjectCollection::getOrCreateStore(
+        _In_ sai_object_type_t objectType)
+{
+    SWSS_LOG_ENTER();
+
+    size_t idx = getObjectTypeIndex(objectType);
+
+    if (idx == NPOS)
+    {
+        SWSS_LOG_THROW("invalid object type: %d", objectType);
+    }
+
+    if (idx >= m_objects.size())
+    {
+        m_objects.resize(idx + 1);
+    }
+
+    return &m_objects[idx];
+}
+
+const SaiObjectCollection::ObjectTypeStore* SaiObjectCollection::getStore(
+        _In_ sai_object_type_t objectType) const
+{
+    SWSS_LOG_ENTER();
+
+    size_t idx = getObjectTypeIndex(objectType);
+
+    if (idx >= m_objects.size()) // also covers NPOS
+    {
+        return nullptr;
+    }
+
+    return &m_objects[idx];
+}
+
+size_t SaiObjectCollection::findSlot(
+        _In_ const ObjectTypeStore& store,
+        _In_ const sai_object_meta_key_t& metaKey)
+{
+    SWSS_LOG_ENTER();
+
+    if (store.index.empty())
+    {
+        return NPOS;
+    }
+
+    MetaKeyHasher hasher;
+
+    size_t mask = store.index.size() - 1;
+
+    for (size_t idx = hasher(metaKey) & mask; ; idx = (idx + 1) & mask)
+    {
+        uint32_t position = store.index[idx];
+
+        if (position == 0)
+        {
+            return NPOS;
+        }
+
+        if (hasher(store.objects[position - 1]->getMetaKey(), metaKey))
+        {
+            return idx;
+        }
+    }
+}
+
+void SaiObjectCollection::insertSlot(
+        _Inout_ ObjectTypeStore& store,
+        _In_ const sai_object_meta_key_t& metaKey,
+        _In_ uint32_t position)
+{
+    SWSS_LOG_ENTER();
+
+    // keep load factor below 3/4, object is already in array so rehash
+    // will index it as well
+
+    if (store.index.empty())
+    {
+        rehash(store, MIN_CAPACITY);
+        return;
+    }
+
+    if (store.objects.size() * 4 > store.index.size() * 3)
+    {
+        rehash(store, store.index.size() * 2);
+        return;
+    }
+
+    size_t mask = store.index.size() - 1;
+
+    size_t idx = MetaKeyHasher()(metaKey) & mask;
+
+    while (store.index[idx] != 0)
+    {
+        idx = (idx + 1) & mask;
+    }
+
+    store.index[idx] = position + 1;
+}
+
+void SaiObjectCollection::eraseSlot(
+        _Inout_ ObjectTypeStore& store,
+        _In_ size_t slot)
+{
+    SWSS_LOG_ENTER();
+
+    /*
+     * Backward shift deletion, move following entries of the same probe
+     * sequence into the hole, so we don't need tombstones.
+     */
+
+    MetaKeyHasher hasher;
+
+    size_t mask = store.index.size() - 1;
+
+    size_t hole = slot;
+
+    for (size_t idx = (hole + 1) & mask; store.index[idx] != 0; idx = (idx + 1) & mask)
+    {
+        size_t home = hasher(store.objects[store.index[idx] - 1]->getMetaKey()) & mask;
+
+        // check if home position of entry is cyclically outside (hole, idx]
+
+        bool movable = (hole <= idx)
+            ? (home <= hole || home > idx)
+            : (home <= hole && home > idx);
+
+        if (movable)
+        {
+            store.index[hole] = store.index[idx];
+            hole = idx;
+        }
+    }
+
+    store.index[hole] = 0;
+}
+
+void SaiObjectCollection::rehash(
+        _Inout_ ObjectTypeStore& store,
+        _In_ size_t capacity)
+{
+    SWSS_LOG_ENTER();
+
+    store.index.assign(capacity, 0);
+
+    MetaKeyHasher hasher;
+
+    size_t mask = capacity - 1;
+
+    for (size_t position = 0; position < store.objects.size(); position++)
+    {
+        size_t idx = hasher(store.objects[position]->getMetaKey()) & mask;
+
+        while (store.index[idx] != 0)
+        {
+            idx = (idx + 1) & mask;
+        }
+
+        store.index[idx] = (uint32_t)(position + 1);
+    }
+}
+
+const std::shared_ptr<SaiObject>* SaiObjectCollection::findObject(
+        _In_ const sai_object_meta_key_t& metaKey) const
+{
+    SWSS_LOG_ENTER();
+
+    auto store = getStore(metaKey.objecttype);
+
+    if (store == nullptr)
+    {
+        return nullptr;
+    }
+
+    size_t slot = findSlot(*store, metaKey);
+
+    if (slot == NPOS)
+    {
+        return nullptr;
+    }
+
+    return &store->objects[store->index[slot] - 1];
 }
 
 bool SaiObjectCollection::objectExists(
@@ -16,7 +224,7 @@ bool SaiObjectCollection::objectExists(
 {
     SWSS_LOG_ENTER();
 
-    bool exists = m_objects.find(metaKey) != m_objects.end();
+    bool exists = findObject(metaKey) != nullptr;
 
     return exists;
 }
@@ -34,7 +242,11 @@ void SaiObjectCollection::createObject(
                 sai_serialize_object_meta_key(metaKey).c_str());
     }
 
-    m_objects[metaKey] = obj;
+    auto store = getOrCreateStore(metaKey.objecttype);
+
+    store->objects.push_back(obj);
+
+    insertSlot(*store, metaKey, (uint32_t)(store->objects.size() - 1));
 }
 
 void SaiObjectCollection::removeObject(
@@ -48,7 +260,33 @@ void SaiObjectCollection::removeObject(
                 sai_serialize_object_meta_key(metaKey).c_str());
     }
 
-    m_objects.erase(metaKey);
+    auto store = getOrCreateStore(metaKey.objecttype);
+
+    size_t slot = findSlot(*store, metaKey);
+
+    size_t position = store->index[slot] - 1;
+
+    eraseSlot(*store, slot);
+
+    size_t last = store->objects.size() - 1;
+
+    if (position != last)
+    {
+        // move last object into the gap and point its index slot there
+
+        store->index[findSlot(*store, store->objects[last]->getMetaKey())] = (uint32_t)(position + 1);
+
+        store->objects[position] = std::move(store->objects[last]);
+    }
+
+    store->objects.pop_back();
+
+    if (store->objects.empty())
+    {
+        // release memory of object type which is no longer used
+
+        *store = ObjectTypeStore();
+    }
 }
 
 void SaiObjectCollection::setObjectAttr(
@@ -58,13 +296,15 @@ void SaiObjectCollection::setObjectAttr(
 {
     SWSS_LOG_ENTER();
 
-    if (!objectExists(metaKey))
+    auto obj = findObject(metaKey);
+
+    if (obj == nullptr)
     {
         SWSS_LOG_THROW("FATAL: object %s doesn't exist",
                 sai_serialize_object_meta_key(metaKey).c_str());
     }
 
-    m_objects[metaKey]->setAttr(&md, attr);
+    (*obj)->setAttr(m_attrValuePool.intern(&md, *attr));
 }
 
 std::shared_ptr<SaiAttrWrapper> SaiObjectCollection::getObjectAttr(
@@ -79,17 +319,17 @@ std::shared_ptr<SaiAttrWrapper> SaiObjectCollection::getObjectAttr(
      * should make exists check before.
      */
 
-    auto it = m_objects.find(metaKey);
+    auto obj = findObject(metaKey);
 
-    if (it == m_objects.end())
+    if (obj)
     {
-        SWSS_LOG_ERROR("object key %s not found",
-                sai_serialize_object_meta_key(metaKey).c_str());
-
-        return nullptr;
+        return (*obj)->getAttr(id);
     }
 
-    return it->second->getAttr(id);
+    SWSS_LOG_ERROR("object key %s not found",
+            sai_serialize_object_meta_key(metaKey).c_str());
+
+    return nullptr;
 }
 
 std::vector<std::shared_ptr<SaiObject>> SaiObjectCollection::getObjectsByObjectType(
@@ -97,15 +337,14 @@ std::vector<std::shared_ptr<SaiObject>> SaiObjectCollection::getObjectsByObjectT
 {
     SWSS_LOG_ENTER();
 
-    std::vector<std::shared_ptr<SaiObject>> vec;
+    auto store = getStore(objectType);
 
-    for (auto& kvp: m_objects)
+    if (store == nullptr)
     {
-        if (kvp.second->getObjectType() == objectType)
-            vec.push_back(kvp.second);
+        return {};
     }
 
-    return vec;
+    return store->objects;
 }
 
 std::shared_ptr<SaiObject> SaiObjectCollection::getObject(
@@ -113,13 +352,15 @@ std::shared_ptr<SaiObject> SaiObjectCollection::getObject(
 {
     SWSS_LOG_ENTER();
 
-    if (!objectExists(metaKey))
+    auto obj = findObject(metaKey);
+
+    if (obj == nullptr)
     {
         SWSS_LOG_THROW("FATAL: object %s doesn't exist",
                 sai_serialize_object_meta_key(metaKey).c_str());
     }
 
-    return m_objects.at(metaKey);
+    return *obj;
 }
 
 std::vector<sai_object_meta_key_t> SaiObjectCollection::getAllKeys() const
@@ -128,10 +369,20 @@ std::vector<sai_object_meta_key_t> SaiObjectCollection::getAllKeys() const
 
     std::vector<sai_object_meta_key_t> vec;
 
-    for (auto& it: m_objects)
+    for (auto& store: m_objects)
     {
-        vec.push_back(it.first);
+        for (auto& obj: store.objects)
+        {
+            vec.push_back(obj->getMetaKey());
+        }
     }
 
     return vec;
 }
+
+const SaiAttrValuePool& SaiObjectCollection::getAttrValuePool() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_attrValuePool;
+}
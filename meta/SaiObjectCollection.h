@@ -2,10 +2,10 @@
 
 #include "SaiAttrWrapper.h"
 #include "SaiObject.h"
+#include "SaiAttrValuePool.h"
 #include "MetaKeyHasher.h"
 
 #include <string>
-#include <unordered_map>
 #include <memory>
 #include <vector>
 
@@ -56,9 +56,74 @@ namespace saimeta
 
             std::vector<sai_object_meta_key_t> getAllKeys() const;
 
+            const SaiAttrValuePool& getAttrValuePool() const;
+
+        private:
+
+            static constexpr size_t NPOS = (size_t)-1;
+
+            static constexpr size_t MIN_CAPACITY = 64;
+
+            /**
+             * @brief Objects of single object type.
+             *
+             * Objects are kept in flat array, and index is open addressing
+             * hash with linear probing of array positions plus 1 (0 marks
+             * empty slot), so meta key is stored only once, inside object.
+             * When object is removed, last object is moved to its position.
+             */
+            typedef struct _ObjectTypeStore
+            {
+                std::vector<std::shared_ptr<SaiObject>> objects;
+
+                std::vector<uint32_t> index;
+
+            } ObjectTypeStore;
+
+            static size_t getObjectTypeIndex(
+                    _In_ sai_object_type_t objectType);
+
+            ObjectTypeStore* getOrCreateStore(
+                    _In_ sai_object_type_t objectType);
+
+            const ObjectTypeStore* getStore(
+                    _In_ sai_object_type_t objectType) const;
+
+            static size_t findSlot(
+                    _In_ const ObjectTypeStore& store,
+                    _In_ const sai_object_meta_key_t& metaKey);
+
+            static void insertSlot(
+                    _Inout_ ObjectTypeStore& store,
+                    _In_ const sai_object_meta_key_t& metaKey,
+                    _In_ uint32_t position);
+
+            static void eraseSlot(
+                    _Inout_ ObjectTypeStore& store,
+                    _In_ size_t slot);
+
+            static void rehash(
+                    _Inout_ ObjectTypeStore& store,
+                    _In_ size_t capacity);
+
+            const std::shared_ptr<SaiObject>* findObject(
+                    _In_ const sai_object_meta_key_t& metaKey) const;
+
         private:
 
-            std::unordered_map<sai_object_meta_key_t, std::shared_ptr<SaiObject>, MetaKeyHasher, MetaKeyHasher> m_objects;
+            /**
+             * @brief Objects split by object type, indexed by object type
+             * index (extension object types follow regular ones).
+             *
+             * Getting all objects of given type (like all FDB entries on
+             * flush) don't need to iterate over entire collection.
+             */
+            std::vector<ObjectTypeStore> m_objects;
+
+            /**
+             * @brief Attribute values shared by all objects.
+             */
+            SaiAttrValuePool m_attrValuePool;
 
     };
 }
@@ -1,5 +1,7 @@
 #include "sai_serialize.h"
 #include "sairediscommon.h"
+#include "EnumNameIndex.h"
+#include "AttrSerializerTable.h"
 
 #include "swss/tokenize.h"
 
@@ -7,6 +9,7 @@
 
 #include <inttypes.h>
 #include <vector>
+#include <array>
 #include <climits>
 #include <unordered_map>
 
@@ -40,6 +43,320 @@ static int char_to_int(
     SWSS_LOG_THROW("unable to convert char %d to int", c);
 }
 
+/*
+ * Fast path parsers for fixed format scalars.
+ *
+ * They accept only canonical input (the same as produced by serialize
+ * functions) and return false on anything else, in that case caller falls
+ * back to generic parsing, so error behaviour stays exactly the same.
+ */
+
+static const std::array<int8_t, 256> g_hexValue = []()
+{
+    std::array<int8_t, 256> table;
+
+    table.fill(-1);
+
+    for (int c = '0'; c <= '9'; c++)
+        table[c] = (int8_t)(c - '0');
+
+    for (int c = 'a'; c <= 'f'; c++)
+        table[c] = (int8_t)(c - 'a' + 10);
+
+    for (int c = 'A'; c <= 'F'; c++)
+        table[c] = (int8_t)(c - 'A' + 10);
+
+    return table;
+}();
+
+#define HEX_VALUE(c) ((int)g_hexValue[(uint8_t)(c)])
+#define IS_DIGIT(c) ((unsigned)((c) - '0') < 10)
+
+static bool sai_parse_hex_u64(
+        _In_ const char* p,
+        _In_ size_t len,
+        _Out_ uint64_t& value)
+{
+    SWSS_LOG_ENTER();
+
+    if (len == 0)
+    {
+        return false;
+    }
+
+    size_t i = 0;
+
+    while (i < len && p[i] == '0')
+    {
+        i++;
+    }
+
+    if (len - i > 16)
+    {
+        return false; // out of range
+    }
+
+    uint64_t v = 0;
+
+    for (; i < len; i++)
+    {
+        int d = HEX_VALUE(p[i]);
+
+        if (d < 0)
+        {
+            return false;
+        }
+
+        v = (v << 4) | (uint64_t)d;
+    }
+
+    value = v;
+
+    return true;
+}
+
+static bool sai_parse_object_id(
+        _In_ const char* p,
+        _In_ size_t len,
+        _Out_ sai_object_id_t& oid)
+{
+    SWSS_LOG_ENTER();
+
+    if (len < 7 || memcmp(p, "oid:0x", 6) != 0)
+    {
+        return false;
+    }
+
+    uint64_t value;
+
+    if (!sai_parse_hex_u64(p + 6, len - 6, value))
+    {
+        return false;
+    }
+
+    oid = value;
+
+    return true;
+}
+
+static bool sai_parse_mac(
+        _In_ const char* p,
+        _In_ size_t len,
+        _Out_ sai_mac_t& mac)
+{
+    SWSS_LOG_ENTER();
+
+    if (len != 17)
+    {
+        return false;
+    }
+
+    int bad = 0;
+
+    for (int j = 0; j < 6; j++, p += 3)
+    {
+        int h = HEX_VALUE(p[0]);
+        int l = HEX_VALUE(p[1]);
+
+        bad |= h | l;
+
+        mac[j] = (uint8_t)(((unsigned)h << 4) | (unsigned)l);
+    }
+
+    // any invalid digit is -1 which sets sign bit
+
+    return bad >= 0;
+}
+
+static bool sai_parse_ipv4(
+        _In_ const char* p,
+        _In_ size_t len,
+        _Out_ uint8_t* ip)
+{
+    SWSS_LOG_ENTER();
+
+    // same rules as inet_pton: 4 decimal octets, no leading zeros
+
+    if (len < 7 || len > 15)
+    {
+        return false;
+    }
+
+    const char* end = p + len;
+
+    for (int octet = 0; octet < 4; octet++)
+    {
+        if (octet)
+        {
+            if (p == end || *p != '.')
+            {
+                return false;
+            }
+
+            p++;
+        }
+
+        if (p == end || !IS_DIGIT(*p))
+        {
+            return false;
+        }
+
+        uint32_t v = (uint32_t)(*p++ - '0');
+
+        if (v == 0 && p != end && IS_DIGIT(*p))
+        {
+            return false;
+        }
+
+        for (int k = 0; k < 2 && p != end && IS_DIGIT(*p); k++)
+        {
+            v = v * 10 + (uint32_t)(*p++ - '0');
+        }
+
+        if (v > 255)
+        {
+            return false;
+        }
+
+        ip[octet] = (uint8_t)v;
+    }
+
+    return p == end;
+}
+
+static bool sai_parse_ipv6(
+        _In_ const char* p,
+        _In_ size_t len,
+        _Out_ uint8_t* ip)
+{
+    SWSS_LOG_ENTER();
+
+    // hex groups with optional single "::", embedded IPv4 is left to
+    // inet_pton
+
+    if (len < 2 || len > 39)
+    {
+        return false;
+    }
+
+    const char* end = p + len;
+
+    uint16_t groups[8];
+
+    int count = 0;
+    int gap = -1;
+
+    if (*p == ':')
+    {
+        if (p[1] != ':')
+        {
+            return false;
+        }
+
+        gap = 0;
+        p += 2;
+    }
+
+    while (p != end)
+    {
+        uint32_t v = 0;
+        int digits = 0;
+
+        for (; p != end && digits < 5; p++, digits++)
+        {
+            int d = HEX_VALUE(*p);
+
+            if (d < 0)
+            {
+                break;
+            }
+
+            v = (v << 4) | (uint32_t)d;
+        }
+
+        if (digits == 0 || digits > 4 || count == 8)
+        {
+            return false;
+        }
+
+        groups[count++] = (uint16_t)v;
+
+        if (p == end)
+        {
+            break;
+        }
+
+        if (*p++ != ':')
+        {
+            return false;
+        }
+
+        if (p == end)
+        {
+            return false; // trailing single colon
+        }
+
+        if (*p == ':')
+        {
+            if (gap >= 0)
+            {
+                return false;
+            }
+
+            gap = count;
+            p++;
+        }
+    }
+
+    if ((gap < 0 && count != 8) || (gap >= 0 && count > 7))
+    {
+        return false;
+    }
+
+    int tail = (gap < 0) ? 0 : count - gap;
+
+    memset(ip, 0, 16);
+
+    for (int i = 0; i < count; i++)
+    {
+        int dst = (i < count - tail) ? i : 8 - count + i;
+
+        ip[2 * dst] = (uint8_t)(groups[i] >> 8);
+        ip[2 * dst + 1] = (uint8_t)(groups[i] & 0xff);
+    }
+
+    return true;
+}
+
+static bool sai_parse_ip_address(
+        _In_ const char* p,
+        _In_ size_t len,
+        _Out_ sai_ip_address_t& ipaddr)
+{
+    SWSS_LOG_ENTER();
+
+    if (memchr(p, ':', len) == NULL)
+    {
+        if (!sai_parse_ipv4(p, len, (uint8_t*)&ipaddr.addr.ip4))
+        {
+            return false;
+        }
+
+        ipaddr.addr_family = SAI_IP_ADDR_FAMILY_IPV4;
+
+        return true;
+    }
+
+    if (!sai_parse_ipv6(p, len, ipaddr.addr.ip6))
+    {
+        return false;
+    }
+
+    ipaddr.addr_family = SAI_IP_ADDR_FAMILY_IPV6;
+
+    return true;
+}
+
 template<class T, typename U>
 T* sai_alloc_n_of_ptr_type(U count, T*)
 {
@@ -1954,83 +2271,96 @@ std::string sai_serialize_segment_list(
     return s + ":" + l;
 }
 
-std::string sai_serialize_attr_value(
-        _In_ const sai_attr_metadata_t& meta,
-        _In_ const sai_attribute_t &attr,
-        _In_ const bool countOnly)
+/*
+ * Attribute value serializers are resolved once per attribute metadata and
+ * stored in AttrSerializerTable, so serialize of attribute value don't need
+ * to switch on value type and check metadata on each call.
+ */
+
+#define ATTR_SERIALIZER(expr) \
+    [](const sai_attr_metadata_t& meta, const sai_attribute_t& attr, bool countOnly) -> std::string { return expr; }
+
+sai_serialize_attr_value_fn sai_get_attr_value_serializer(
+        _In_ const sai_attr_metadata_t& attrMeta)
 {
     SWSS_LOG_ENTER();
 
-    switch (meta.attrvaluetype)
+    switch (attrMeta.attrvaluetype)
     {
         case SAI_ATTR_VALUE_TYPE_BOOL:
-            return sai_serialize_bool(attr.value.booldata);
+            return ATTR_SERIALIZER(sai_serialize_bool(attr.value.booldata));
 
         case SAI_ATTR_VALUE_TYPE_CHARDATA:
-            return sai_serialize_chardata(attr.value.chardata);
+            return ATTR_SERIALIZER(sai_serialize_chardata(attr.value.chardata));
 
         case SAI_ATTR_VALUE_TYPE_UINT8:
-            return sai_serialize_number(attr.value.u8);
+            return ATTR_SERIALIZER(sai_serialize_number(attr.value.u8));
 
         case SAI_ATTR_VALUE_TYPE_INT8:
-            return sai_serialize_number(attr.value.s8);
+            return ATTR_SERIALIZER(sai_serialize_number(attr.value.s8));
 
         case SAI_ATTR_VALUE_TYPE_UINT16:
-            return sai_serialize_number(attr.value.u16);
+            return ATTR_SERIALIZER(sai_serialize_number(attr.value.u16));
 
         case SAI_ATTR_VALUE_TYPE_JSON:
-            return sai_serialize_json(attr.value.json);
+            return ATTR_SERIALIZER(sai_serialize_json(attr.value.json));
 
         case SAI_ATTR_VALUE_TYPE_INT16:
-            return sai_serialize_number(attr.value.s16);
+            return ATTR_SERIALIZER(sai_serialize_number(attr.value.s16));
 
         case SAI_ATTR_VALUE_TYPE_UINT32:
-            return sai_serialize_number(attr.value.u32);
+            return ATTR_SERIALIZER(sai_serialize_number(attr.value.u32));
 
         case SAI_ATTR_VALUE_TYPE_INT32:
-            return sai_serialize_enum(attr.value.s32, meta.enummetadata);
+
+            if (attrMeta.enummetadata == NULL)
+            {
+                return ATTR_SERIALIZER(sai_serialize_number(attr.value.s32));
+            }
+
+            return ATTR_SERIALIZER(sai_serialize_enum(attr.value.s32, meta.enummetadata));
 
         case SAI_ATTR_VALUE_TYPE_UINT64:
-            return sai_serialize_number(attr.value.u64);
+            return ATTR_SERIALIZER(sai_serialize_number(attr.value.u64));
 
 //        case SAI_ATTR_VALUE_TYPE_INT64:
 //            return sai_serialize_number(attr.value.s64);
 
         case SAI_ATTR_VALUE_TYPE_MAC:
-            return sai_serialize_mac(attr.value.mac);
+            return ATTR_SERIALIZER(sai_serialize_mac(attr.value.mac));
 
         case SAI_ATTR_VALUE_TYPE_IPV4:
-            return sai_serialize_ipv4(attr.value.ip4);
+            return ATTR_SERIALIZER(sai_serialize_ipv4(attr.value.ip4));
 
         case SAI_ATTR_VALUE_TYPE_IPV6:
-            return sai_serialize_ipv6(attr.value.ip6);
+            return ATTR_SERIALIZER(sai_serialize_ipv6(attr.value.ip6));
 
         case SAI_ATTR_VALUE_TYPE_POINTER:
-            return sai_serialize_pointer(attr.value.ptr);
+            return ATTR_SERIALIZER(sai_serialize_pointer(attr.value.ptr));
 
         case SAI_ATTR_VALUE_TYPE_IP_ADDRESS:
-            return sai_serialize_ip_address(attr.value.ipaddr);
+            return ATTR_SERIALIZER(sai_serialize_ip_address(attr.value.ipaddr));
 
         case SAI_ATTR_VALUE_TYPE_IP_PREFIX:
-            return sai_serialize_ip_prefix(attr.value.ipprefix);
+            return ATTR_SERIALIZER(sai_serialize_ip_prefix(attr.value.ipprefix));
 
         case SAI_ATTR_VALUE_TYPE_OBJECT_ID:
-            return sai_serialize_object_id(attr.value.oid);
+            return ATTR_SERIALIZER(sai_serialize_object_id(attr.value.oid));
 
         case SAI_ATTR_VALUE_TYPE_OBJECT_LIST:
-            return sai_serialize_oid_list(attr.value.objlist, countOnly);
+            return ATTR_SERIALIZER(sai_serialize_oid_list(attr.value.objlist, countOnly));
 
         case SAI_ATTR_VALUE_TYPE_UINT8_LIST:
-            return sai_serialize_number_list(attr.value.u8list, countOnly);
+            return ATTR_SERIALIZER(sai_serialize_number_list(attr.value.u8list, countOnly));
 
         case SAI_ATTR_VALUE_TYPE_INT8_LIST:
-            return sai_serialize_number_list(attr.value.s8list, countOnly);
+            return ATTR_SERIALIZER(sai_serialize_number_list(attr.value.s8list, countOnly));
 
         case SAI_ATTR_VALUE_TYPE_LATCH_STATUS:
-            return sai_serialize_latch_status(attr.value.latchstatus);
+            return ATTR_SERIALIZER(sai_serialize_latch_status(attr.value.latchstatus));
 
         case SAI_ATTR_VALUE_TYPE_PORT_LANE_LATCH_STATUS_LIST:
-            return sai_serialize_port_lane_latch_status_list(attr.value.portlanelatchstatuslist, countOnly);
+            return ATTR_SERIALIZER(sai_serialize_port_lane_latch_status_list(attr.value.portlanelatchstatuslist, countOnly));
 
 //        case SAI_ATTR_VALUE_TYPE_UINT16_LIST:
 //            return sai_serialize_number_list(attr.value.u16list, countOnly);
@@ -2039,37 +2369,43 @@ std::string sai_serialize_attr_value(
 //            return sai_serialize_number_list(attr.value.s16list, countOnly);
 
         case SAI_ATTR_VALUE_TYPE_UINT32_LIST:
-            return sai_serialize_number_list(attr.value.u32list, countOnly);
+            return ATTR_SERIALIZER(sai_serialize_number_list(attr.value.u32list, countOnly));
 
         case SAI_ATTR_VALUE_TYPE_INT32_LIST:
-            return sai_serialize_enum_list(attr.value.s32list, meta.enummetadata, countOnly);
+
+            if (attrMeta.enummetadata == NULL)
+            {
+                return ATTR_SERIALIZER(sai_serialize_number_list(attr.value.s32list, countOnly));
+            }
+
+            return ATTR_SERIALIZER(sai_serialize_enum_list(attr.value.s32list, meta.enummetadata, countOnly));
 
         case SAI_ATTR_VALUE_TYPE_UINT32_RANGE:
-            return sai_serialize_range(attr.value.u32range);
+            return ATTR_SERIALIZER(sai_serialize_range(attr.value.u32range));
 
 //        case SAI_ATTR_VALUE_TYPE_INT32_RANGE:
 //            return sai_serialize_range(attr.value.s32range);
 
         case SAI_ATTR_VALUE_TYPE_UINT16_RANGE_LIST:
-            return sai_serialize_u16_range_list(attr.value.u16rangelist, countOnly);
+            return ATTR_SERIALIZER(sai_serialize_u16_range_list(attr.value.u16rangelist, countOnly));
 
         case SAI_ATTR_VALUE_TYPE_VLAN_LIST:
-            return sai_serialize_number_list(attr.value.vlanlist, countOnly);
+            return ATTR_SERIALIZER(sai_serialize_number_list(attr.value.vlanlist, countOnly));
 
         case SAI_ATTR_VALUE_TYPE_QOS_MAP_LIST:
-            return sai_serialize_qos_map_list(attr.value.qosmap, countOnly);
+            return ATTR_SERIALIZER(sai_serialize_qos_map_list(attr.value.qosmap, countOnly));
 
         case SAI_ATTR_VALUE_TYPE_MAP_LIST:
-            return sai_serialize_map_list(attr.value.maplist, countOnly);
+            return ATTR_SERIALIZER(sai_serialize_map_list(attr.value.maplist, countOnly));
 
         case SAI_ATTR_VALUE_TYPE_ACL_RESOURCE_LIST:
-            return sai_serialize_acl_resource_list(attr.value.aclresource, countOnly);
+            return ATTR_SERIALIZER(sai_serialize_acl_resource_list(attr.value.aclresource, countOnly));
 
         case SAI_ATTR_VALUE_TYPE_IP_ADDRESS_LIST:
-            return sai_serialize_ip_address_list(attr.value.ipaddrlist, countOnly);
+            return ATTR_SERIALIZER(sai_serialize_ip_address_list(attr.value.ipaddrlist, countOnly));
 
         case SAI_ATTR_VALUE_TYPE_SEGMENT_LIST:
-            return sai_serialize_segment_list(attr.value.segmentlist, countOnly);
+            return ATTR_SERIALIZER(sai_serialize_segment_list(attr.value.segmentlist, countOnly));
 
             // ACL FIELD DATA
 
@@ -2087,7 +2423,7 @@ std::string sai_serialize_attr_value(
         case SAI_ATTR_VALUE_TYPE_ACL_FIELD_DATA_OBJECT_ID:
         case SAI_ATTR_VALUE_TYPE_ACL_FIELD_DATA_OBJECT_LIST:
         case SAI_ATTR_VALUE_TYPE_ACL_FIELD_DATA_UINT8_LIST:
-            return sai_serialize_acl_field(meta, attr.value.aclfield, countOnly);
+            return ATTR_SERIALIZER(sai_serialize_acl_field(meta, attr.value.aclfield, countOnly));
 
             // ACL ACTION DATA
 
@@ -2104,45 +2440,64 @@ std::string sai_serialize_attr_value(
         case SAI_ATTR_VALUE_TYPE_ACL_ACTION_DATA_OBJECT_ID:
         case SAI_ATTR_VALUE_TYPE_ACL_ACTION_DATA_OBJECT_LIST:
         case SAI_ATTR_VALUE_TYPE_ACL_ACTION_DATA_IP_ADDRESS:
-            return sai_serialize_acl_action(meta, attr.value.aclaction, countOnly);
+            return ATTR_SERIALIZER(sai_serialize_acl_action(meta, attr.value.aclaction, countOnly));
 
         case SAI_ATTR_VALUE_TYPE_ACL_CAPABILITY:
-            return sai_serialize_acl_capability(meta, attr.value.aclcapability, countOnly);
+            return ATTR_SERIALIZER(sai_serialize_acl_capability(meta, attr.value.aclcapability, countOnly));
 
             // MACsec Attributions
 
         case SAI_ATTR_VALUE_TYPE_MACSEC_SAK:
-            return sai_serialize_hex_binary(attr.value.macsecsak);
+            return ATTR_SERIALIZER(sai_serialize_hex_binary(attr.value.macsecsak));
 
         case SAI_ATTR_VALUE_TYPE_MACSEC_AUTH_KEY:
-            return sai_serialize_hex_binary(attr.value.macsecauthkey);
+            return ATTR_SERIALIZER(sai_serialize_hex_binary(attr.value.macsecauthkey));
 
         case SAI_ATTR_VALUE_TYPE_MACSEC_SALT:
-            return sai_serialize_hex_binary(attr.value.macsecsalt);
+            return ATTR_SERIALIZER(sai_serialize_hex_binary(attr.value.macsecsalt));
 
         case SAI_ATTR_VALUE_TYPE_AUTH_KEY:
-            return sai_serialize_hex_binary(attr.value.authkey);
+            return ATTR_SERIALIZER(sai_serialize_hex_binary(attr.value.authkey));
 
         case SAI_ATTR_VALUE_TYPE_ENCRYPT_KEY:
-            return sai_serialize_hex_binary(attr.value.encrypt_key);
+            return ATTR_SERIALIZER(sai_serialize_hex_binary(attr.value.encrypt_key));
 
         case SAI_ATTR_VALUE_TYPE_SYSTEM_PORT_CONFIG:
-            return sai_serialize_system_port_config(meta, attr.value.sysportconfig);
+            return ATTR_SERIALIZER(sai_serialize_system_port_config(meta, attr.value.sysportconfig));
 
         case SAI_ATTR_VALUE_TYPE_SYSTEM_PORT_CONFIG_LIST:
-            return sai_serialize_system_port_config_list(meta, attr.value.sysportconfiglist, countOnly);
+            return ATTR_SERIALIZER(sai_serialize_system_port_config_list(meta, attr.value.sysportconfiglist, countOnly));
 
         case SAI_ATTR_VALUE_TYPE_IP_PREFIX_LIST:
-            return sai_serialize_ip_prefix_list(attr.value.ipprefixlist, countOnly);
+            return ATTR_SERIALIZER(sai_serialize_ip_prefix_list(attr.value.ipprefixlist, countOnly));
 
         case SAI_ATTR_VALUE_TYPE_POE_PORT_POWER_CONSUMPTION:
-            return sai_serialize_poe_port_power_consumption(attr.value.portpowerconsumption);
+            return ATTR_SERIALIZER(sai_serialize_poe_port_power_consumption(attr.value.portpowerconsumption));
 
         default:
-            SWSS_LOG_THROW("sai attr value type %s is not implemented, FIXME", sai_serialize_attr_value_type(meta.attrvaluetype).c_str());
+            return nullptr;
     }
 }
 
+std::string sai_serialize_attr_value(
+        _In_ const sai_attr_metadata_t& meta,
+        _In_ const sai_attribute_t &attr,
+        _In_ const bool countOnly)
+{
+    SWSS_LOG_ENTER();
+
+    auto entry = AttrSerializerTable::getInstance().find(meta);
+
+    auto fn = entry ? entry->serialize : sai_get_attr_value_serializer(meta);
+
+    if (fn == nullptr)
+    {
+        SWSS_LOG_THROW("sai attr value type %s is not implemented, FIXME", sai_serialize_attr_value_type(meta.attrvaluetype).c_str());
+    }
+
+    return fn(meta, attr, countOnly);
+}
+
 std::string sai_serialize_ip_prefix(
         _In_ const sai_ip_prefix_t& prefix)
 {
@@ -2164,6 +2519,317 @@ std::string sai_serialize_ip_prefix(
     }
 }
 
+// append serialize, used on hot paths to avoid temporary strings
+
+void sai_serialize_number(
+        _Inout_ std::string& buf,
+        _In_ uint64_t number,
+        _In_ bool hex)
+{
+    SWSS_LOG_ENTER();
+
+    char tmp[24];
+
+    char* end = tmp + sizeof(tmp);
+    char* ptr = end;
+
+    if (hex)
+    {
+        do
+        {
+            *--ptr = "0123456789abcdef"[number & 0xf];
+            number >>= 4;
+        }
+        while (number);
+
+        *--ptr = 'x';
+        *--ptr = '0';
+    }
+    else
+    {
+        do
+        {
+            *--ptr = (char)('0' + number % 10);
+            number /= 10;
+        }
+        while (number);
+    }
+
+    buf.append(ptr, end - ptr);
+}
+
+void sai_serialize_object_id(
+        _Inout_ std::string& buf,
+        _In_ sai_object_id_t oid)
+{
+    SWSS_LOG_ENTER();
+
+    buf.append("oid:", 4);
+
+    sai_serialize_number(buf, oid, true);
+}
+
+void sai_serialize_mac(
+        _Inout_ std::string& buf,
+        _In_ const sai_mac_t mac)
+{
+    SWSS_LOG_ENTER();
+
+    static const char hex[] = "0123456789ABCDEF";
+
+    for (int i = 0; i < 6; i++)
+    {
+        if (i)
+        {
+            buf += ':';
+        }
+
+        buf += hex[mac[i] >> 4];
+        buf += hex[mac[i] & 0xf];
+    }
+}
+
+void sai_serialize_enum(
+        _Inout_ std::string& buf,
+        _In_ const int32_t value,
+        _In_ const sai_enum_metadata_t* meta)
+{
+    SWSS_LOG_ENTER();
+
+    if (meta)
+    {
+        for (size_t i = 0; i < meta->valuescount; ++i)
+        {
+            if (meta->values[i] == value)
+            {
+                buf += meta->valuesnames[i];
+                return;
+            }
+        }
+    }
+
+    // not found, let string version handle it
+
+    buf += sai_serialize_enum(value, meta);
+}
+
+static void sai_serialize_ipv4(
+        _Inout_ std::string& buf,
+        _In_ sai_ip4_t ip)
+{
+    SWSS_LOG_ENTER();
+
+    char tmp[INET_ADDRSTRLEN];
+
+    if (inet_ntop(AF_INET, &ip, tmp, INET_ADDRSTRLEN) == NULL)
+    {
+        SWSS_LOG_THROW("FATAL: failed to convert IPv4 address, errno: %s", strerror(errno));
+    }
+
+    buf += tmp;
+}
+
+static void sai_serialize_ipv6(
+        _Inout_ std::string& buf,
+        _In_ const sai_ip6_t& ip)
+{
+    SWSS_LOG_ENTER();
+
+    char tmp[INET6_ADDRSTRLEN];
+
+    if (inet_ntop(AF_INET6, ip, tmp, INET6_ADDRSTRLEN) == NULL)
+    {
+        SWSS_LOG_THROW("FATAL: failed to convert IPv6 address, errno: %s", strerror(errno));
+    }
+
+    buf += tmp;
+}
+
+static void sai_serialize_ip_address(
+        _Inout_ std::string& buf,
+        _In_ const sai_ip_address_t& ipaddress)
+{
+    SWSS_LOG_ENTER();
+
+    switch (ipaddress.addr_family)
+    {
+        case SAI_IP_ADDR_FAMILY_IPV4:
+
+            return sai_serialize_ipv4(buf, ipaddress.addr.ip4);
+
+        case SAI_IP_ADDR_FAMILY_IPV6:
+
+            return sai_serialize_ipv6(buf, ipaddress.addr.ip6);
+
+        default:
+
+            SWSS_LOG_THROW("FATAL: invalid ip address family: %d", ipaddress.addr_family);
+    }
+}
+
+static void sai_serialize_ip_prefix(
+        _Inout_ std::string& buf,
+        _In_ const sai_ip_prefix_t& prefix)
+{
+    SWSS_LOG_ENTER();
+
+    switch (prefix.addr_family)
+    {
+        case SAI_IP_ADDR_FAMILY_IPV4:
+
+            sai_serialize_ipv4(buf, prefix.addr.ip4);
+            buf += '/';
+            sai_serialize_number(buf, get_ipv4_mask(prefix.mask.ip4));
+            return;
+
+        case SAI_IP_ADDR_FAMILY_IPV6:
+
+            sai_serialize_ipv6(buf, prefix.addr.ip6);
+            buf += '/';
+            sai_serialize_number(buf, (uint64_t)get_ipv6_mask(prefix.mask.ip6));
+            return;
+
+        default:
+
+            SWSS_LOG_THROW("FATAL: invalid ip prefix address family: %d", prefix.addr_family);
+    }
+}
+
+template<typename T, typename F>
+static void sai_serialize_list(
+        _Inout_ std::string& buf,
+        _In_ const T& list,
+        _In_ bool countOnly,
+        F serialize_item)
+{
+    SWSS_LOG_ENTER();
+
+    sai_serialize_number(buf, list.count);
+
+    if (countOnly)
+    {
+        return;
+    }
+
+    if (list.list == NULL || list.count == 0)
+    {
+        buf += ":null";
+        return;
+    }
+
+    buf += ':';
+
+    for (uint32_t i = 0; i < list.count; ++i)
+    {
+        if (i)
+        {
+            buf += ',';
+        }
+
+        serialize_item(list.list[i]);
+    }
+}
+
+void sai_serialize_oid_list(
+        _Inout_ std::string& buf,
+        _In_ const sai_object_list_t &list,
+        _In_ bool countOnly)
+{
+    SWSS_LOG_ENTER();
+
+    sai_serialize_list(buf, list, countOnly, [&](sai_object_id_t item) { sai_serialize_object_id(buf, item); });
+}
+
+#define ATTR_APPEND_SERIALIZER(expr) \
+    [](std::string& buf, const sai_attr_metadata_t& meta, const sai_attribute_t& attr, bool countOnly) { expr; }
+
+sai_serialize_attr_value_append_fn sai_get_attr_value_append_serializer(
+        _In_ const sai_attr_metadata_t& attrMeta)
+{
+    SWSS_LOG_ENTER();
+
+    // only most common types are appended directly, output must be the same
+    // as from string version
+
+    switch (attrMeta.attrvaluetype)
+    {
+        case SAI_ATTR_VALUE_TYPE_BOOL:
+            return ATTR_APPEND_SERIALIZER(buf += attr.value.booldata ? "true" : "false");
+
+        case SAI_ATTR_VALUE_TYPE_UINT8:
+            return ATTR_APPEND_SERIALIZER(sai_serialize_number(buf, attr.value.u8));
+
+        case SAI_ATTR_VALUE_TYPE_UINT16:
+            return ATTR_APPEND_SERIALIZER(sai_serialize_number(buf, attr.value.u16));
+
+        case SAI_ATTR_VALUE_TYPE_UINT32:
+            return ATTR_APPEND_SERIALIZER(sai_serialize_number(buf, attr.value.u32));
+
+        case SAI_ATTR_VALUE_TYPE_UINT64:
+            return ATTR_APPEND_SERIALIZER(sai_serialize_number(buf, attr.value.u64));
+
+        case SAI_ATTR_VALUE_TYPE_INT32:
+            return ATTR_APPEND_SERIALIZER(sai_serialize_enum(buf, attr.value.s32, meta.enummetadata));
+
+        case SAI_ATTR_VALUE_TYPE_MAC:
+            return ATTR_APPEND_SERIALIZER(sai_serialize_mac(buf, attr.value.mac));
+
+        case SAI_ATTR_VALUE_TYPE_IPV4:
+            return ATTR_APPEND_SERIALIZER(sai_serialize_ipv4(buf, attr.value.ip4));
+
+        case SAI_ATTR_VALUE_TYPE_IPV6:
+            return ATTR_APPEND_SERIALIZER(sai_serialize_ipv6(buf, attr.value.ip6));
+
+        case SAI_ATTR_VALUE_TYPE_IP_ADDRESS:
+            return ATTR_APPEND_SERIALIZER(sai_serialize_ip_address(buf, attr.value.ipaddr));
+
+        case SAI_ATTR_VALUE_TYPE_IP_PREFIX:
+            return ATTR_APPEND_SERIALIZER(sai_serialize_ip_prefix(buf, attr.value.ipprefix));
+
+        case SAI_ATTR_VALUE_TYPE_OBJECT_ID:
+            return ATTR_APPEND_SERIALIZER(sai_serialize_object_id(buf, attr.value.oid));
+
+        case SAI_ATTR_VALUE_TYPE_OBJECT_LIST:
+            return ATTR_APPEND_SERIALIZER(sai_serialize_oid_list(buf, attr.value.objlist, countOnly));
+
+        case SAI_ATTR_VALUE_TYPE_UINT32_LIST:
+            return ATTR_APPEND_SERIALIZER(sai_serialize_list(buf, attr.value.u32list, countOnly, [&](uint32_t item) { sai_serialize_number(buf, item); }));
+
+        case SAI_ATTR_VALUE_TYPE_VLAN_LIST:
+            return ATTR_APPEND_SERIALIZER(sai_serialize_list(buf, attr.value.vlanlist, countOnly, [&](sai_vlan_id_t item) { sai_serialize_number(buf, item); }));
+
+        default:
+            break;
+    }
+
+    if (sai_get_attr_value_serializer(attrMeta) == nullptr)
+    {
+        return nullptr;
+    }
+
+    return ATTR_APPEND_SERIALIZER(buf += sai_serialize_attr_value(meta, attr, countOnly));
+}
+
+void sai_serialize_attr_value(
+        _Inout_ std::string& buf,
+        _In_ const sai_attr_metadata_t& meta,
+        _In_ const sai_attribute_t &attr,
+        _In_ const bool countOnly)
+{
+    SWSS_LOG_ENTER();
+
+    auto entry = AttrSerializerTable::getInstance().find(meta);
+
+    auto fn = entry ? entry->serializeAppend : sai_get_attr_value_append_serializer(meta);
+
+    if (fn == nullptr)
+    {
+        SWSS_LOG_THROW("sai attr value type %s is not implemented, FIXME", sai_serialize_attr_value_type(meta.attrvaluetype).c_str());
+    }
+
+    fn(buf, meta, attr, countOnly);
+}
+
 std::string sai_serialize_port_oper_status(
         _In_ sai_port_oper_status_t status)
 {
@@ -2732,6 +3398,12 @@ std::string sai_serialize_redis_communication_mode(
         case SAI_REDIS_COMMUNICATION_MODE_ZMQ_SYNC:
             return REDIS_COMMUNICATION_MODE_ZMQ_SYNC_STRING;
 
+        case SAI_REDIS_COMMUNICATION_MODE_ZMQ_V2_SYNC:
+            return REDIS_COMMUNICATION_MODE_ZMQ_V2_SYNC_STRING;
+
+        case SAI_REDIS_COMMUNICATION_MODE_SHM_SYNC:
+            return REDIS_COMMUNICATION_MODE_SHM_SYNC_STRING;
+
         default:
 
             SWSS_LOG_THROW("unknown value on sai_redis_communication_mode_t: %d", value);
@@ -2944,8 +3616,8 @@ void sai_deserialize_number(
     sai_deserialize_number<uint32_t>(s, number, hex);
 }
 
-void sai_deserialize_enum(
-        _In_ const std::string& s,
+bool sai_deserialize_enum_name(
+        _In_ const char* s,
         _In_ const sai_enum_metadata_t *meta,
         _Out_ int32_t& value)
 {
@@ -2953,35 +3625,76 @@ void sai_deserialize_enum(
 
     if (meta == NULL)
     {
-        return sai_deserialize_number(s, value);
+        return false;
     }
 
+    auto index = saimeta::EnumNameIndex::getIndex(meta);
+
+    if (index)
+    {
+        bool ignored;
+
+        if (!index->find(s, value, ignored))
+        {
+            return false;
+        }
+
+        if (ignored)
+        {
+            // this can happen when we deserialize older SAI values
+
+            SWSS_LOG_NOTICE("translating depreacated/ignored enum value: %s", s);
+        }
+
+        return true;
+    }
+
+    // enum is not part of SAI metadata, those are small, use linear search
+
     for (size_t i = 0; i < meta->valuescount; ++i)
     {
-        if (strcmp(s.c_str(), meta->valuesnames[i]) == 0)
+        if (strcmp(s, meta->valuesnames[i]) == 0)
         {
             value = meta->values[i];
-            return;
+            return true;
         }
     }
 
     // check depreacated values if present
     if (meta->ignorevaluesnames)
     {
-        // this can happen when we deserialize older SAI values
-
         for (size_t i = 0; meta->ignorevaluesnames[i] != NULL; i++)
         {
-            if (strcmp(s.c_str(), meta->ignorevaluesnames[i]) == 0)
+            if (strcmp(s, meta->ignorevaluesnames[i]) == 0)
             {
-                SWSS_LOG_NOTICE("translating depreacated/ignored enum value: %s", s.c_str());
+                SWSS_LOG_NOTICE("translating depreacated/ignored enum value: %s", s);
 
                 value = meta->ignorevalues[i];
-                return;
+                return true;
             }
         }
     }
 
+    return false;
+}
+
+void sai_deserialize_enum(
+        _In_ const std::string& s,
+        _In_ const sai_enum_metadata_t *meta,
+        _Out_ int32_t& value)
+{
+    SWSS_LOG_ENTER();
+
+    if (meta == NULL)
+    {
+        return sai_deserialize_number(s, value);
+    }
+
+    if (sai_deserialize_enum_name(s.c_str(), meta, value))
+    {
+        return;
+    }
+
     SWSS_LOG_WARN("enum %s not found in enum %s", s.c_str(), meta->name);
 
     sai_deserialize_number(s, value);
@@ -2993,6 +3706,11 @@ void sai_deserialize_mac(
 {
     SWSS_LOG_ENTER();
 
+    if (sai_parse_mac(s.c_str(), s.length(), mac))
+    {
+        return;
+    }
+
     if (s.length() != (6*2+5))
     {
         SWSS_LOG_THROW("invalid mac address %s", s.c_str());
@@ -3017,6 +3735,11 @@ void sai_deserialize_object_id(
 {
     SWSS_LOG_ENTER();
 
+    if (sai_parse_object_id(s.c_str(), s.length(), oid))
+    {
+        return;
+    }
+
     if (s.find("oid:0x") != 0)
     {
         SWSS_LOG_THROW("invalid oid %s", s.c_str());
@@ -3334,6 +4057,11 @@ void sai_deserialize_ipv6(
 {
     SWSS_LOG_ENTER();
 
+    if (sai_parse_ipv6(s.c_str(), s.length(), ipaddr))
+    {
+        return;
+    }
+
     if (inet_pton(AF_INET6, s.c_str(), ipaddr) != 1)
     {
         SWSS_LOG_THROW("invalid ip address %s", s.c_str());
@@ -3346,6 +4074,11 @@ void sai_deserialize_ipv4(
 {
     SWSS_LOG_ENTER();
 
+    if (sai_parse_ipv4(s.c_str(), s.length(), (uint8_t*)&ipaddr))
+    {
+        return;
+    }
+
     if (inet_pton(AF_INET, s.c_str(), &ipaddr) != 1)
     {
         SWSS_LOG_THROW("invalid ip address %s", s.c_str());
@@ -3367,6 +4100,11 @@ void sai_deserialize_ip_address(
 {
     SWSS_LOG_ENTER();
 
+    if (sai_parse_ip_address(s.c_str(), s.length(), ipaddr))
+    {
+        return;
+    }
+
     if (inet_pton(AF_INET, s.c_str(), &ipaddr.addr.ip4) == 1)
     {
         ipaddr.addr_family = SAI_IP_ADDR_FAMILY_IPV4;
@@ -3388,6 +4126,48 @@ void sai_deserialize_ip_prefix(
 {
     SWSS_LOG_ENTER();
 
+    // fast path for canonical "ip/mask", mask populate throws same as below
+
+    auto slash = s.find('/');
+
+    if (slash != std::string::npos && slash + 1 < s.length() && s.length() - slash - 1 <= 3)
+    {
+        const char* m = s.c_str() + slash + 1;
+
+        uint32_t bits = 0;
+
+        bool valid = true;
+
+        for (; *m; m++)
+        {
+            valid &= IS_DIGIT(*m);
+
+            bits = bits * 10 + (uint32_t)(*m - '0');
+        }
+
+        sai_ip_address_t ip;
+
+        if (valid && bits <= 255 && sai_parse_ip_address(s.c_str(), slash, ip))
+        {
+            ip_prefix.addr_family = ip.addr_family;
+
+            if (ip.addr_family == SAI_IP_ADDR_FAMILY_IPV4)
+            {
+                ip_prefix.addr.ip4 = ip.addr.ip4;
+
+                sai_populate_ip_mask((uint8_t)bits, (uint8_t*)&ip_prefix.mask.ip4, false);
+            }
+            else
+            {
+                memcpy(ip_prefix.addr.ip6, ip.addr.ip6, sizeof(ip.addr.ip6));
+
+                sai_populate_ip_mask((uint8_t)bits, ip_prefix.mask.ip6, true);
+            }
+
+            return;
+        }
+    }
+
     auto tokens = swss::tokenize(s, '/');
 
     if (tokens.size() != 2)
@@ -3935,86 +4715,90 @@ void sai_deserialize_system_port_config_list(
     }
 }
 
-void sai_deserialize_attr_value(
-        _In_ const std::string& s,
-        _In_ const sai_attr_metadata_t& meta,
-        _Out_ sai_attribute_t &attr,
-        _In_ const bool countOnly)
+#define ATTR_DESERIALIZER(expr) \
+    [](const std::string& s, const sai_attr_metadata_t& meta, sai_attribute_t& attr, bool countOnly) { expr; }
+
+sai_deserialize_attr_value_fn sai_get_attr_value_deserializer(
+        _In_ const sai_attr_metadata_t& attrMeta)
 {
     SWSS_LOG_ENTER();
 
-    memset(&attr.value, 0, sizeof(attr.value));
-
-    switch (meta.attrvaluetype)
+    switch (attrMeta.attrvaluetype)
     {
         case SAI_ATTR_VALUE_TYPE_BOOL:
-            return sai_deserialize_bool(s, attr.value.booldata);
+            return ATTR_DESERIALIZER(sai_deserialize_bool(s, attr.value.booldata));
 
         case SAI_ATTR_VALUE_TYPE_CHARDATA:
-            return sai_deserialize_chardata(s, attr.value.chardata);
+            return ATTR_DESERIALIZER(sai_deserialize_chardata(s, attr.value.chardata));
 
         case SAI_ATTR_VALUE_TYPE_UINT8:
-            return sai_deserialize_number(s, attr.value.u8);
+            return ATTR_DESERIALIZER(sai_deserialize_number(s, attr.value.u8));
 
         case SAI_ATTR_VALUE_TYPE_INT8:
-            return sai_deserialize_number(s, attr.value.s8);
+            return ATTR_DESERIALIZER(sai_deserialize_number(s, attr.value.s8));
 
         case SAI_ATTR_VALUE_TYPE_UINT16:
-            return sai_deserialize_number(s, attr.value.u16);
+            return ATTR_DESERIALIZER(sai_deserialize_number(s, attr.value.u16));
 
         case SAI_ATTR_VALUE_TYPE_JSON:
-            return sai_deserialize_json(s, attr.value.json);
+            return ATTR_DESERIALIZER(sai_deserialize_json(s, attr.value.json));
 
         case SAI_ATTR_VALUE_TYPE_INT16:
-            return sai_deserialize_number(s, attr.value.s16);
+            return ATTR_DESERIALIZER(sai_deserialize_number(s, attr.value.s16));
 
         case SAI_ATTR_VALUE_TYPE_UINT32:
-            return sai_deserialize_number(s, attr.value.u32);
+            return ATTR_DESERIALIZER(sai_deserialize_number(s, attr.value.u32));
 
         case SAI_ATTR_VALUE_TYPE_INT32:
-            return sai_deserialize_enum(s, meta.enummetadata, attr.value.s32);
+
+            if (attrMeta.enummetadata == NULL)
+            {
+                return ATTR_DESERIALIZER(sai_deserialize_number(s, attr.value.s32));
+            }
+
+            return ATTR_DESERIALIZER(sai_deserialize_enum(s, meta.enummetadata, attr.value.s32));
 
         case SAI_ATTR_VALUE_TYPE_UINT64:
-            return sai_deserialize_number(s, attr.value.u64);
+            return ATTR_DESERIALIZER(sai_deserialize_number(s, attr.value.u64));
 
 //        case SAI_ATTR_VALUE_TYPE_INT64:
 //            return sai_deserialize_number(s, attr.value.s64);
 
         case SAI_ATTR_VALUE_TYPE_MAC:
-            return sai_deserialize_mac(s, attr.value.mac);
+            return ATTR_DESERIALIZER(sai_deserialize_mac(s, attr.value.mac));
 
         case SAI_ATTR_VALUE_TYPE_IPV4:
-            return sai_deserialize_ipv4(s, attr.value.ip4);
+            return ATTR_DESERIALIZER(sai_deserialize_ipv4(s, attr.value.ip4));
 
         case SAI_ATTR_VALUE_TYPE_IPV6:
-            return sai_deserialize_ipv6(s, attr.value.ip6);
+            return ATTR_DESERIALIZER(sai_deserialize_ipv6(s, attr.value.ip6));
 
         case SAI_ATTR_VALUE_TYPE_POINTER:
-            return sai_deserialize_pointer(s, attr.value.ptr);
+            return ATTR_DESERIALIZER(sai_deserialize_pointer(s, attr.value.ptr));
 
         case SAI_ATTR_VALUE_TYPE_IP_ADDRESS:
-            return sai_deserialize_ip_address(s, attr.value.ipaddr);
+            return ATTR_DESERIALIZER(sai_deserialize_ip_address(s, attr.value.ipaddr));
 
         case SAI_ATTR_VALUE_TYPE_IP_PREFIX:
-            return sai_deserialize_ip_prefix(s, attr.value.ipprefix);
+            return ATTR_DESERIALIZER(sai_deserialize_ip_prefix(s, attr.value.ipprefix));
 
         case SAI_ATTR_VALUE_TYPE_OBJECT_ID:
-            return sai_deserialize_object_id(s, attr.value.oid);
+            return ATTR_DESERIALIZER(sai_deserialize_object_id(s, attr.value.oid));
 
         case SAI_ATTR_VALUE_TYPE_OBJECT_LIST:
-            return sai_deserialize_oid_list(s, attr.value.objlist, countOnly);
+            return ATTR_DESERIALIZER(sai_deserialize_oid_list(s, attr.value.objlist, countOnly));
 
         case SAI_ATTR_VALUE_TYPE_UINT8_LIST:
-            return sai_deserialize_number_list(s, attr.value.u8list, countOnly);
+            return ATTR_DESERIALIZER(sai_deserialize_number_list(s, attr.value.u8list, countOnly));
 
         case SAI_ATTR_VALUE_TYPE_INT8_LIST:
-            return sai_deserialize_number_list(s, attr.value.s8list, countOnly);
+            return ATTR_DESERIALIZER(sai_deserialize_number_list(s, attr.value.s8list, countOnly));
 
         case SAI_ATTR_VALUE_TYPE_LATCH_STATUS:
-            return sai_deserialize_latch_status(s, attr.value.latchstatus);
+            return ATTR_DESERIALIZER(sai_deserialize_latch_status(s, attr.value.latchstatus));
 
         case SAI_ATTR_VALUE_TYPE_PORT_LANE_LATCH_STATUS_LIST:
-            return sai_deserialize_port_lane_latch_status_list(s, attr.value.portlanelatchstatuslist, countOnly);
+            return ATTR_DESERIALIZER(sai_deserialize_port_lane_latch_status_list(s, attr.value.portlanelatchstatuslist, countOnly));
 
 //        case SAI_ATTR_VALUE_TYPE_UINT16_LIST:
 //            return sai_deserialize_number_list(s, attr.value.u16list, countOnly);
@@ -4023,37 +4807,43 @@ void sai_deserialize_attr_value(
 //            return sai_deserialize_number_list(s, attr.value.s16list, countOnly);
 
         case SAI_ATTR_VALUE_TYPE_UINT32_LIST:
-            return sai_deserialize_number_list(s, attr.value.u32list, countOnly);
+            return ATTR_DESERIALIZER(sai_deserialize_number_list(s, attr.value.u32list, countOnly));
 
         case SAI_ATTR_VALUE_TYPE_INT32_LIST:
-            return sai_deserialize_enum_list(s, meta.enummetadata, attr.value.s32list, countOnly);
+
+            if (attrMeta.enummetadata == NULL)
+            {
+                return ATTR_DESERIALIZER(sai_deserialize_number_list(s, attr.value.s32list, countOnly));
+            }
+
+            return ATTR_DESERIALIZER(sai_deserialize_enum_list(s, meta.enummetadata, attr.value.s32list, countOnly));
 
         case SAI_ATTR_VALUE_TYPE_UINT32_RANGE:
-            return sai_deserialize_range(s, attr.value.u32range);
+            return ATTR_DESERIALIZER(sai_deserialize_range(s, attr.value.u32range));
 
 //        case SAI_ATTR_VALUE_TYPE_INT32_RANGE:
 //            return sai_deserialize_range(s, attr.value.s32range);
 
         case SAI_ATTR_VALUE_TYPE_UINT16_RANGE_LIST:
-            return sai_deserialize_u16_range_list(s, attr.value.u16rangelist, countOnly);
+            return ATTR_DESERIALIZER(sai_deserialize_u16_range_list(s, attr.value.u16rangelist, countOnly));
 
         case SAI_ATTR_VALUE_TYPE_VLAN_LIST:
-            return sai_deserialize_number_list(s, attr.value.vlanlist, countOnly);
+            return ATTR_DESERIALIZER(sai_deserialize_number_list(s, attr.value.vlanlist, countOnly));
 
         case SAI_ATTR_VALUE_TYPE_QOS_MAP_LIST:
-            return sai_deserialize_qos_map_list(s, attr.value.qosmap, countOnly);
+            return ATTR_DESERIALIZER(sai_deserialize_qos_map_list(s, attr.value.qosmap, countOnly));
 
         case SAI_ATTR_VALUE_TYPE_MAP_LIST:
-            return sai_deserialize_map_list(s, attr.value.maplist, countOnly);
+            return ATTR_DESERIALIZER(sai_deserialize_map_list(s, attr.value.maplist, countOnly));
 
         case SAI_ATTR_VALUE_TYPE_ACL_RESOURCE_LIST:
-            return sai_deserialize_acl_resource_list(s, attr.value.aclresource, countOnly);
+            return ATTR_DESERIALIZER(sai_deserialize_acl_resource_list(s, attr.value.aclresource, countOnly));
 
         case SAI_ATTR_VALUE_TYPE_IP_ADDRESS_LIST:
-            return sai_deserialize_ip_address_list(s, attr.value.ipaddrlist, countOnly);
+            return ATTR_DESERIALIZER(sai_deserialize_ip_address_list(s, attr.value.ipaddrlist, countOnly));
 
         case SAI_ATTR_VALUE_TYPE_SEGMENT_LIST:
-            return sai_deserialize_segment_list(s, attr.value.segmentlist, countOnly);
+            return ATTR_DESERIALIZER(sai_deserialize_segment_list(s, attr.value.segmentlist, countOnly));
 
             // ACL FIELD DATA
 
@@ -4071,7 +4861,7 @@ void sai_deserialize_attr_value(
         case SAI_ATTR_VALUE_TYPE_ACL_FIELD_DATA_OBJECT_ID:
         case SAI_ATTR_VALUE_TYPE_ACL_FIELD_DATA_OBJECT_LIST:
         case SAI_ATTR_VALUE_TYPE_ACL_FIELD_DATA_UINT8_LIST:
-            return sai_deserialize_acl_field(s, meta, attr.value.aclfield, countOnly);
+            return ATTR_DESERIALIZER(sai_deserialize_acl_field(s, meta, attr.value.aclfield, countOnly));
 
             // ACL ACTION DATA
 
@@ -4088,42 +4878,64 @@ void sai_deserialize_attr_value(
         case SAI_ATTR_VALUE_TYPE_ACL_ACTION_DATA_OBJECT_ID:
         case SAI_ATTR_VALUE_TYPE_ACL_ACTION_DATA_OBJECT_LIST:
         case SAI_ATTR_VALUE_TYPE_ACL_ACTION_DATA_IP_ADDRESS:
-            return sai_deserialize_acl_action(s, meta, attr.value.aclaction, countOnly);
+            return ATTR_DESERIALIZER(sai_deserialize_acl_action(s, meta, attr.value.aclaction, countOnly));
 
         case SAI_ATTR_VALUE_TYPE_ACL_CAPABILITY:
-            return sai_deserialize_acl_capability(s, attr.value.aclcapability);
+            return ATTR_DESERIALIZER(sai_deserialize_acl_capability(s, attr.value.aclcapability));
 
         case SAI_ATTR_VALUE_TYPE_AUTH_KEY:
-            return sai_deserialize_hex_binary(s, attr.value.authkey);
+            return ATTR_DESERIALIZER(sai_deserialize_hex_binary(s, attr.value.authkey));
 
         case SAI_ATTR_VALUE_TYPE_ENCRYPT_KEY:
-            return sai_deserialize_hex_binary(s, attr.value.encrypt_key);
+            return ATTR_DESERIALIZER(sai_deserialize_hex_binary(s, attr.value.encrypt_key));
 
         case SAI_ATTR_VALUE_TYPE_MACSEC_SAK:
-            return sai_deserialize_hex_binary(s, attr.value.macsecsak);
+            return ATTR_DESERIALIZER(sai_deserialize_hex_binary(s, attr.value.macsecsak));
 
         case SAI_ATTR_VALUE_TYPE_MACSEC_AUTH_KEY:
-            return sai_deserialize_hex_binary(s, attr.value.macsecauthkey);
+            return ATTR_DESERIALIZER(sai_deserialize_hex_binary(s, attr.value.macsecauthkey));
 
         case SAI_ATTR_VALUE_TYPE_MACSEC_SALT:
-            return sai_deserialize_hex_binary(s, attr.value.macsecsalt);
+            return ATTR_DESERIALIZER(sai_deserialize_hex_binary(s, attr.value.macsecsalt));
 
         case SAI_ATTR_VALUE_TYPE_SYSTEM_PORT_CONFIG:
-            return sai_deserialize_system_port_config(s, attr.value.sysportconfig);
+            return ATTR_DESERIALIZER(sai_deserialize_system_port_config(s, attr.value.sysportconfig));
 
         case SAI_ATTR_VALUE_TYPE_SYSTEM_PORT_CONFIG_LIST:
-            return sai_deserialize_system_port_config_list(s, attr.value.sysportconfiglist, countOnly);
+            return ATTR_DESERIALIZER(sai_deserialize_system_port_config_list(s, attr.value.sysportconfiglist, countOnly));
 
         case SAI_ATTR_VALUE_TYPE_IP_PREFIX_LIST:
-            return sai_deserialize_ip_prefix_list(s, attr.value.ipprefixlist, countOnly);
+            return ATTR_DESERIALIZER(sai_deserialize_ip_prefix_list(s, attr.value.ipprefixlist, countOnly));
 
         case SAI_ATTR_VALUE_TYPE_POE_PORT_POWER_CONSUMPTION:
-            return sai_deserialize_poe_port_power_consumption(s, attr.value.portpowerconsumption);
+            return ATTR_DESERIALIZER(sai_deserialize_poe_port_power_consumption(s, attr.value.portpowerconsumption));
 
         default:
-            SWSS_LOG_THROW("deserialize type %s is not supported yet FIXME",
-                    sai_serialize_attr_value_type(meta.attrvaluetype).c_str());
+            return nullptr;
+    }
+}
+
+void sai_deserialize_attr_value(
+        _In_ const std::string& s,
+        _In_ const sai_attr_metadata_t& meta,
+        _Out_ sai_attribute_t &attr,
+        _In_ const bool countOnly)
+{
+    SWSS_LOG_ENTER();
+
+    memset(&attr.value, 0, sizeof(attr.value));
+
+    auto entry = AttrSerializerTable::getInstance().find(meta);
+
+    auto fn = entry ? entry->deserialize : sai_get_attr_value_deserializer(meta);
+
+    if (fn == nullptr)
+    {
+        SWSS_LOG_THROW("deserialize type %s is not supported yet FIXME",
+                sai_serialize_attr_value_type(meta.attrvaluetype).c_str());
     }
+
+    fn(s, meta, attr, countOnly);
 }
 
 void sai_deserialize_status(
@@ -4345,12 +5157,166 @@ void sai_deserialize_vlan_id(
     sai_deserialize_number(s, vlan_id);
 }
 
+/*
+ * Single pass parser for entry keys produced by json::dump(), which are flat
+ * objects with string values and keys in alphabetical order, like:
+ *
+ * {"bvid":"oid:0x26000000000001","mac":"00:00:00:00:00:01","switch_id":"oid:0x21000000000000"}
+ *
+ * Parser never throws, if input is not in that exact form (whitespace,
+ * different key order, escaped characters), parse will fail and caller
+ * should fall back to json parser.
+ */
+class EntryKeyParser
+{
+    public:
+
+        EntryKeyParser(
+                _In_ const std::string& s):
+            m_buf(s.c_str()),
+            m_first(true)
+        {
+            SWSS_LOG_ENTER();
+
+            // empty
+        }
+
+    public:
+
+        bool begin()
+        {
+            SWSS_LOG_ENTER();
+
+            m_first = true;
+
+            return expect('{');
+        }
+
+        bool field(
+                _In_ const char* name,
+                _Out_ std::string& value)
+        {
+            SWSS_LOG_ENTER();
+
+            if (!key(name) || !expect('"'))
+            {
+                return false;
+            }
+
+            const char* start = m_buf;
+
+            while (*m_buf != '"')
+            {
+                if (*m_buf == 0 || *m_buf == '\\')
+                {
+                    return false;
+                }
+
+                m_buf++;
+            }
+
+            value.assign(start, m_buf - start);
+
+            m_buf++;
+
+            return true;
+        }
+
+        bool object(
+                _In_ const char* name)
+        {
+            SWSS_LOG_ENTER();
+
+            return key(name) && begin();
+        }
+
+        bool close()
+        {
+            SWSS_LOG_ENTER();
+
+            m_first = false;
+
+            return expect('}');
+        }
+
+        bool end()
+        {
+            SWSS_LOG_ENTER();
+
+            return close() && *m_buf == 0;
+        }
+
+    private:
+
+        bool expect(
+                _In_ char c)
+        {
+            SWSS_LOG_ENTER();
+
+            if (*m_buf != c)
+            {
+                return false;
+            }
+
+            m_buf++;
+
+            return true;
+        }
+
+        bool key(
+                _In_ const char* name)
+        {
+            SWSS_LOG_ENTER();
+
+            if (!m_first && !expect(','))
+            {
+                return false;
+            }
+
+            m_first = false;
+
+            if (!expect('"'))
+            {
+                return false;
+            }
+
+            size_t len = strlen(name);
+
+            if (strncmp(m_buf, name, len) != 0)
+            {
+                return false;
+            }
+
+            m_buf += len;
+
+            return expect('"') && expect(':');
+        }
+
+    private:
+
+        const char* m_buf;
+
+        bool m_first;
+};
+
 void sai_deserialize_fdb_entry(
         _In_ const std::string &s,
         _Out_ sai_fdb_entry_t &fdb_entry)
 {
     SWSS_LOG_ENTER();
 
+    std::string bvid, mac, switch_id;
+
+    EntryKeyParser p(s);
+
+    if (p.begin() && p.field("bvid", bvid) && p.field("mac", mac) && p.field("switch_id", switch_id) && p.end())
+    {
+        sai_deserialize_object_id(switch_id, fdb_entry.switch_id);
+        sai_deserialize_mac(mac, fdb_entry.mac_address);
+        sai_deserialize_object_id(bvid, fdb_entry.bv_id);
+        return;
+    }
+
     json j = json::parse(s);
 
     sai_deserialize_object_id(j["switch_id"], fdb_entry.switch_id);
@@ -4364,6 +5330,18 @@ void sai_deserialize_neighbor_entry(
 {
     SWSS_LOG_ENTER();
 
+    std::string ip, rif, switch_id;
+
+    EntryKeyParser p(s);
+
+    if (p.begin() && p.field("ip", ip) && p.field("rif", rif) && p.field("switch_id", switch_id) && p.end())
+    {
+        sai_deserialize_object_id(switch_id, ne.switch_id);
+        sai_deserialize_object_id(rif, ne.rif_id);
+        sai_deserialize_ip_address(ip, ne.ip_address);
+        return;
+    }
+
     json j = json::parse(s);
 
     sai_deserialize_object_id(j["switch_id"], ne.switch_id);
@@ -4451,6 +5429,20 @@ static int sai_deserialize_object_id_buf(
         SWSS_LOG_THROW("invalid oid %s", buf);
     }
 
+    // fast path, in route entry oid is always followed by quote
+
+    size_t n = 0;
+
+    while (HEX_VALUE(buf[6 + n]) >= 0)
+    {
+        n++;
+    }
+
+    if (buf[6 + n] == '"' && sai_parse_hex_u64(buf + 6, n, *oid))
+    {
+        return (int)(6 + n);
+    }
+
     errno = 0;
 
     char *endptr = NULL;
@@ -4504,6 +5496,17 @@ void sai_deserialize_inseg_entry(
 {
     SWSS_LOG_ENTER();
 
+    std::string label, switch_id;
+
+    EntryKeyParser p(s);
+
+    if (p.begin() && p.field("label", label) && p.field("switch_id", switch_id) && p.end())
+    {
+        sai_deserialize_object_id(switch_id, inseg_entry.switch_id);
+        sai_deserialize_number(label, inseg_entry.label);
+        return;
+    }
+
     json j = json::parse(s);
 
     sai_deserialize_object_id(j["switch_id"], inseg_entry.switch_id);
@@ -4516,6 +5519,30 @@ void sai_deserialize_my_sid_entry(
 {
     SWSS_LOG_ENTER();
 
+    std::string args_len, function_len, locator_block_len, locator_node_len, sid, switch_id, vr_id;
+
+    EntryKeyParser p(s);
+
+    if (p.begin() &&
+            p.field("args_len", args_len) &&
+            p.field("function_len", function_len) &&
+            p.field("locator_block_len", locator_block_len) &&
+            p.field("locator_node_len", locator_node_len) &&
+            p.field("sid", sid) &&
+            p.field("switch_id", switch_id) &&
+            p.field("vr_id", vr_id) &&
+            p.end())
+    {
+        sai_deserialize_object_id(switch_id, ne.switch_id);
+        sai_deserialize_object_id(vr_id, ne.vr_id);
+        sai_deserialize_number(locator_block_len, ne.locator_block_len);
+        sai_deserialize_number(locator_node_len, ne.locator_node_len);
+        sai_deserialize_number(function_len, ne.function_len);
+        sai_deserialize_number(args_len, ne.args_len);
+        sai_deserialize_ipv6(sid, ne.sid);
+        return;
+    }
+
     json j = json::parse(s);
 
     sai_deserialize_object_id(j["switch_id"], ne.switch_id);
@@ -4553,6 +5580,36 @@ static void sai_deserialize_nat_entry_mask(
     sai_deserialize_number(j["l4_dst_port"], nat_entry_mask.l4_dst_port);
 }
 
+template <typename T>
+static bool sai_deserialize_nat_entry_fields(
+        _Inout_ EntryKeyParser& p,
+        _Out_ T& fields)
+{
+    SWSS_LOG_ENTER();
+
+    // same fields are used in key and mask
+
+    std::string dst_ip, l4_dst_port, l4_src_port, proto, src_ip;
+
+    if (!(p.field("dst_ip", dst_ip) &&
+            p.field("l4_dst_port", l4_dst_port) &&
+            p.field("l4_src_port", l4_src_port) &&
+            p.field("proto", proto) &&
+            p.field("src_ip", src_ip) &&
+            p.close()))
+    {
+        return false;
+    }
+
+    sai_deserialize_ipv4(src_ip, fields.src_ip);
+    sai_deserialize_ipv4(dst_ip, fields.dst_ip);
+    sai_deserialize_number(proto, fields.proto);
+    sai_deserialize_number(l4_src_port, fields.l4_src_port);
+    sai_deserialize_number(l4_dst_port, fields.l4_dst_port);
+
+    return true;
+}
+
 static void sai_deserialize_nat_entry_data(
         _In_ const json& j,
         _Out_ sai_nat_entry_data_t& nat_entry_data)
@@ -4578,6 +5635,28 @@ void sai_deserialize_nat_entry(
 {
     SWSS_LOG_ENTER();
 
+    std::string nat_type, switch_id, vr;
+
+    EntryKeyParser p(s);
+
+    if (p.begin() &&
+            p.object("nat_data") &&
+            p.object("key") &&
+            sai_deserialize_nat_entry_fields(p, nat_entry.data.key) &&
+            p.object("mask") &&
+            sai_deserialize_nat_entry_fields(p, nat_entry.data.mask) &&
+            p.close() &&
+            p.field("nat_type", nat_type) &&
+            p.field("switch_id", switch_id) &&
+            p.field("vr", vr) &&
+            p.end())
+    {
+        sai_deserialize_object_id(switch_id, nat_entry.switch_id);
+        sai_deserialize_object_id(vr, nat_entry.vr_id);
+        sai_deserialize_nat_entry_type(nat_type, nat_entry.nat_type);
+        return;
+    }
+
     json j = json::parse(s);
 
     sai_deserialize_object_id(j["switch_id"], nat_entry.switch_id);
@@ -4592,6 +5671,26 @@ void sai_deserialize_ipmc_entry(
 {
     SWSS_LOG_ENTER();
 
+    std::string destination, source, switch_id, type, vr_id;
+
+    EntryKeyParser p(s);
+
+    if (p.begin() &&
+            p.field("destination", destination) &&
+            p.field("source", source) &&
+            p.field("switch_id", switch_id) &&
+            p.field("type", type) &&
+            p.field("vr_id", vr_id) &&
+            p.end())
+    {
+        sai_deserialize_object_id(switch_id, ipmc_entry.switch_id);
+        sai_deserialize_object_id(vr_id, ipmc_entry.vr_id);
+        sai_deserialize_ipmc_entry_type(type, ipmc_entry.type);
+        sai_deserialize_ip_address(destination, ipmc_entry.destination);
+        sai_deserialize_ip_address(source, ipmc_entry.source);
+        return;
+    }
+
     json j = json::parse(s);
 
     sai_deserialize_object_id(j["switch_id"], ipmc_entry.switch_id);
@@ -4607,6 +5706,26 @@ void sai_deserialize_l2mc_entry(
 {
     SWSS_LOG_ENTER();
 
+    std::string bv_id, destination, source, switch_id, type;
+
+    EntryKeyParser p(s);
+
+    if (p.begin() &&
+            p.field("bv_id", bv_id) &&
+            p.field("destination", destination) &&
+            p.field("source", source) &&
+            p.field("switch_id", switch_id) &&
+            p.field("type", type) &&
+            p.end())
+    {
+        sai_deserialize_object_id(switch_id, l2mc_entry.switch_id);
+        sai_deserialize_object_id(bv_id, l2mc_entry.bv_id);
+        sai_deserialize_l2mc_entry_type(type, l2mc_entry.type);
+        sai_deserialize_ip_address(destination, l2mc_entry.destination);
+        sai_deserialize_ip_address(source, l2mc_entry.source);
+        return;
+    }
+
     json j = json::parse(s);
 
     sai_deserialize_object_id(j["switch_id"], l2mc_entry.switch_id);
@@ -4622,6 +5741,18 @@ void sai_deserialize_mcast_fdb_entry(
 {
     SWSS_LOG_ENTER();
 
+    std::string bv_id, mac_address, switch_id;
+
+    EntryKeyParser p(s);
+
+    if (p.begin() && p.field("bv_id", bv_id) && p.field("mac_address", mac_address) && p.field("switch_id", switch_id) && p.end())
+    {
+        sai_deserialize_object_id(switch_id, mcast_fdb_entry.switch_id);
+        sai_deserialize_object_id(bv_id, mcast_fdb_entry.bv_id);
+        sai_deserialize_mac(mac_address, mcast_fdb_entry.mac_address);
+        return;
+    }
+
     json j = json::parse(s);
 
     sai_deserialize_object_id(j["switch_id"], mcast_fdb_entry.switch_id);
@@ -4635,6 +5766,17 @@ void sai_deserialize_direction_lookup_entry(
 {
     SWSS_LOG_ENTER();
 
+    std::string switch_id, vni;
+
+    EntryKeyParser p(s);
+
+    if (p.begin() && p.field("switch_id", switch_id) && p.field("vni", vni) && p.end())
+    {
+        sai_deserialize_object_id(switch_id, direction_lookup_entry.switch_id);
+        sai_deserialize_number(vni, direction_lookup_entry.vni);
+        return;
+    }
+
     json j = json::parse(s);
 
     sai_deserialize_object_id(j["switch_id"], direction_lookup_entry.switch_id);
@@ -4647,6 +5789,17 @@ void sai_deserialize_eni_ether_address_map_entry(
 {
     SWSS_LOG_ENTER();
 
+    std::string address, switch_id;
+
+    EntryKeyParser p(s);
+
+    if (p.begin() && p.field("address", address) && p.field("switch_id", switch_id) && p.end())
+    {
+        sai_deserialize_object_id(switch_id, eni_ether_address_map_entry.switch_id);
+        sai_deserialize_mac(address, eni_ether_address_map_entry.address);
+        return;
+    }
+
     json j = json::parse(s);
 
     sai_deserialize_object_id(j["switch_id"], eni_ether_address_map_entry.switch_id);
@@ -4659,6 +5812,17 @@ void sai_deserialize_vip_entry(
 {
     SWSS_LOG_ENTER();
 
+    std::string switch_id, vip;
+
+    EntryKeyParser p(s);
+
+    if (p.begin() && p.field("switch_id", switch_id) && p.field("vip", vip) && p.end())
+    {
+        sai_deserialize_object_id(switch_id, vip_entry.switch_id);
+        sai_deserialize_ip_address(vip, vip_entry.vip);
+        return;
+    }
+
     json j = json::parse(s);
 
     sai_deserialize_object_id(j["switch_id"], vip_entry.switch_id);
@@ -4671,6 +5835,28 @@ void sai_deserialize_inbound_routing_entry(
 {
     SWSS_LOG_ENTER();
 
+    std::string eni_id, priority, sip, sip_mask, switch_id, vni;
+
+    EntryKeyParser p(s);
+
+    if (p.begin() &&
+            p.field("eni_id", eni_id) &&
+            p.field("priority", priority) &&
+            p.field("sip", sip) &&
+            p.field("sip_mask", sip_mask) &&
+            p.field("switch_id", switch_id) &&
+            p.field("vni", vni) &&
+            p.end())
+    {
+        sai_deserialize_object_id(switch_id, inbound_routing_entry.switch_id);
+        sai_deserialize_object_id(eni_id, inbound_routing_entry.eni_id);
+        sai_deserialize_number(vni, inbound_routing_entry.vni);
+        sai_deserialize_ip_address(sip, inbound_routing_entry.sip);
+        sai_deserialize_ip_address(sip_mask, inbound_routing_entry.sip_mask);
+        sai_deserialize_number(priority, inbound_routing_entry.priority);
+        return;
+    }
+
     json j = json::parse(s);
 
     sai_deserialize_object_id(j["switch_id"], inbound_routing_entry.switch_id);
@@ -4687,6 +5873,18 @@ void sai_deserialize_pa_validation_entry(
 {
     SWSS_LOG_ENTER();
 
+    std::string sip, switch_id, vnet_id;
+
+    EntryKeyParser p(s);
+
+    if (p.begin() && p.field("sip", sip) && p.field("switch_id", switch_id) && p.field("vnet_id", vnet_id) && p.end())
+    {
+        sai_deserialize_object_id(switch_id, pa_validation_entry.switch_id);
+        sai_deserialize_object_id(vnet_id, pa_validation_entry.vnet_id);
+        sai_deserialize_ip_address(sip, pa_validation_entry.sip);
+        return;
+    }
+
     json j = json::parse(s);
 
     sai_deserialize_object_id(j["switch_id"], pa_validation_entry.switch_id);
@@ -4700,6 +5898,18 @@ void sai_deserialize_outbound_routing_entry(
 {
     SWSS_LOG_ENTER();
 
+    std::string destination, eni_id, switch_id;
+
+    EntryKeyParser p(s);
+
+    if (p.begin() && p.field("destination", destination) && p.field("eni_id", eni_id) && p.field("switch_id", switch_id) && p.end())
+    {
+        sai_deserialize_object_id(switch_id, outbound_routing_entry.switch_id);
+        sai_deserialize_object_id(eni_id, outbound_routing_entry.eni_id);
+        sai_deserialize_ip_prefix(destination, outbound_routing_entry.destination);
+        return;
+    }
+
     json j = json::parse(s);
 
     sai_deserialize_object_id(j["switch_id"], outbound_routing_entry.switch_id);
@@ -4713,6 +5923,18 @@ void sai_deserialize_outbound_ca_to_pa_entry(
 {
     SWSS_LOG_ENTER();
 
+    std::string dip, dst_vnet_id, switch_id;
+
+    EntryKeyParser p(s);
+
+    if (p.begin() && p.field("dip", dip) && p.field("dst_vnet_id", dst_vnet_id) && p.field("switch_id", switch_id) && p.end())
+    {
+        sai_deserialize_object_id(switch_id, outbound_ca_to_pa_entry.switch_id);
+        sai_deserialize_object_id(dst_vnet_id, outbound_ca_to_pa_entry.dst_vnet_id);
+        sai_deserialize_ip_address(dip, outbound_ca_to_pa_entry.dip);
+        return;
+    }
+
     json j = json::parse(s);
 
     sai_deserialize_object_id(j["switch_id"], outbound_ca_to_pa_entry.switch_id);
@@ -5484,6 +6706,14 @@ void sai_deserialize_redis_communication_mode(
     {
         value = SAI_REDIS_COMMUNICATION_MODE_ZMQ_SYNC;
     }
+    else if (s == REDIS_COMMUNICATION_MODE_ZMQ_V2_SYNC_STRING)
+    {
+        value = SAI_REDIS_COMMUNICATION_MODE_ZMQ_V2_SYNC;
+    }
+    else if (s == REDIS_COMMUNICATION_MODE_SHM_SYNC_STRING)
+    {
+        value = SAI_REDIS_COMMUNICATION_MODE_SHM_SYNC;
+    }
     else
     {
         SWSS_LOG_THROW("enum '%s' not found in sai_redis_communication_mode_t", s.c_str());
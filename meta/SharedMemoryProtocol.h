@@ -0,0 +1,82 @@
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * @brief Shared memory channel handshake magic.
+ */
+#define SHM_HANDSHAKE_MAGIC (0x53414953484d3031ULL) // "SAISHM01"
+
+/**
+ * @brief Default capacity of each shared memory ring in bytes.
+ */
+#define SHM_DEFAULT_RING_CAPACITY (16 * 1024 * 1024)
+
+/**
+ * @brief Correlation id bits used for connection generation.
+ *
+ * Client puts generation received in handshake to upper bits of each
+ * request correlation id, so syncd can skip requests left in request ring
+ * by previous client, and client can skip responses to them.
+ */
+#define SHM_GENERATION_SHIFT (48)
+
+#define SHM_CORRELATION_ID_MASK ((1ULL << SHM_GENERATION_SHIFT) - 1)
+
+namespace sairedis
+{
+    /**
+     * @brief Rings placed one after another in shared memory.
+     *
+     * Request ring is written by client and read by syncd, response and
+     * notification rings are written by syncd and read by client.
+     */
+    typedef enum _SharedMemoryRingIndex
+    {
+        SHM_RING_REQUEST = 0,
+
+        SHM_RING_RESPONSE = 1,
+
+        SHM_RING_NOTIFICATION = 2,
+
+        SHM_RING_COUNT = 3,
+
+    } SharedMemoryRingIndex;
+
+    /**
+     * @brief Descriptors passed from syncd to client (SCM_RIGHTS), in this
+     * order. Each eventfd is signaled when its ring was written.
+     */
+    typedef enum _SharedMemoryFdIndex
+    {
+        SHM_FD_MEMORY = 0,
+
+        SHM_FD_REQUEST_EVENT = 1,
+
+        SHM_FD_RESPONSE_EVENT = 2,
+
+        SHM_FD_NOTIFICATION_EVENT = 3,
+
+        SHM_FD_COUNT = 4,
+
+    } SharedMemoryFdIndex;
+
+    /**
+     * @brief Handshake sent by syncd to client over unix socket, together
+     * with descriptors.
+     *
+     * Shared memory size is SHM_RING_COUNT * ringMemorySize, and ring with
+     * index i starts at offset i * ringMemorySize.
+     *
+     * Generation is incremented for each accepted client.
+     */
+    typedef struct _SharedMemoryHandshake
+    {
+        uint64_t magic;
+
+        uint64_t ringMemorySize;
+
+        uint64_t generation;
+
+    } SharedMemoryHandshake;
+}
@@ -0,0 +1,193 @@
+#include "SharedMemoryRing.h"
+
+#include "swss/logger.h"
+
+#include <new>
+
+#include <string.h>
+#include <inttypes.h>
+
+using namespace sairedis;
+
+static inline uint64_t record_size(
+        _In_ uint64_t length)
+{
+    SWSS_LOG_ENTER();
+
+    return sizeof(uint32_t) + ((length + 3) & ~(uint64_t)3);
+}
+
+SharedMemoryRing::SharedMemoryRing(
+        _In_ void* memory,
+        _In_ size_t size,
+        _In_ bool initialize):
+    m_header(nullptr),
+    m_data(nullptr),
+    m_capacity(0)
+{
+    SWSS_LOG_ENTER();
+
+    if (memory == nullptr)
+    {
+        SWSS_LOG_THROW("memory can't be nullptr");
+    }
+
+    if (((uintptr_t)memory & 63) != 0)
+    {
+        SWSS_LOG_THROW("memory %p must be aligned to 64 bytes", memory);
+    }
+
+    if (size <= DATA_OFFSET + 2 * sizeof(uint32_t))
+    {
+        SWSS_LOG_THROW("memory size %zu is too small", size);
+    }
+
+    uint64_t capacity = (size - DATA_OFFSET) & ~(uint64_t)3;
+
+    if (initialize)
+    {
+        m_header = new (memory) Header();
+
+        m_header->magic = RING_MAGIC;
+        m_header->capacity = capacity;
+        m_header->head.store(0);
+        m_header->tail.store(0);
+    }
+    else
+    {
+        m_header = static_cast<Header*>(memory);
+
+        if (m_header->magic != RING_MAGIC)
+        {
+            SWSS_LOG_THROW("ring not initialized, magic 0x%" PRIx64, m_header->magic);
+        }
+
+        if (m_header->capacity != capacity)
+        {
+            SWSS_LOG_THROW("ring capacity %" PRIu64 " doesn't match memory size %zu",
+                    m_header->capacity,
+                    size);
+        }
+    }
+
+    m_data = static_cast<uint8_t*>(memory) + DATA_OFFSET;
+
+    m_capacity = capacity;
+}
+
+size_t SharedMemoryRing::getMemorySize(
+        _In_ size_t capacity)
+{
+    SWSS_LOG_ENTER();
+
+    return DATA_OFFSET + ((capacity + 3) & ~(size_t)3);
+}
+
+size_t SharedMemoryRing::getCapacity() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_capacity;
+}
+
+bool SharedMemoryRing::push(
+        _In_ const std::string& record)
+{
+    SWSS_LOG_ENTER();
+
+    uint64_t size = record_size(record.size());
+
+    // record together with skipped space before wrap must fit into empty
+    // ring, regardless of current position
+
+    if (record.size() >= WRAP_MARKER || size > m_capacity / 2)
+    {
+        SWSS_LOG_THROW("record of %zu bytes will never fit into ring of %" PRIu64 " bytes",
+                record.size(),
+                m_capacity);
+    }
+
+    uint64_t head = m_header->head.load(std::memory_order_relaxed);
+    uint64_t tail = m_header->tail.load(std::memory_order_acquire);
+
+    uint64_t pos = head % m_capacity;
+
+    uint64_t contiguous = m_capacity - pos;
+
+    uint64_t needed = (contiguous < size) ? contiguous + size : size;
+
+    if (m_capacity - (head - tail) < needed)
+    {
+        return false;
+    }
+
+    if (contiguous < size)
+    {
+        uint32_t marker = WRAP_MARKER;
+
+        memcpy(m_data + pos, &marker, sizeof(marker));
+
+        pos = 0;
+    }
+
+    uint32_t length = (uint32_t)record.size();
+
+    memcpy(m_data + pos, &length, sizeof(length));
+    memcpy(m_data + pos + sizeof(length), record.data(), record.size());
+
+    m_header->head.store(head + needed, std::memory_order_release);
+
+    return true;
+}
+
+bool SharedMemoryRing::pop(
+        _Out_ std::string& record)
+{
+    SWSS_LOG_ENTER();
+
+    uint64_t tail = m_header->tail.load(std::memory_order_relaxed);
+    uint64_t head = m_header->head.load(std::memory_order_acquire);
+
+    if (tail == head)
+    {
+        return false;
+    }
+
+    uint64_t pos = tail % m_capacity;
+
+    uint32_t length;
+
+    memcpy(&length, m_data + pos, sizeof(length));
+
+    if (length == WRAP_MARKER)
+    {
+        tail += m_capacity - pos;
+
+        pos = 0;
+
+        memcpy(&length, m_data, sizeof(length));
+    }
+
+    uint64_t size = record_size(length);
+
+    if (tail + size > head)
+    {
+        SWSS_LOG_THROW("ring corrupted, record of %u bytes at %" PRIu64 " exceeds head %" PRIu64,
+                length,
+                tail,
+                head);
+    }
+
+    record.assign((const char*)m_data + pos + sizeof(length), length);
+
+    m_header->tail.store(tail + size, std::memory_order_release);
+
+    return true;
+}
+
+bool SharedMemoryRing::empty() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_header->tail.load(std::memory_order_relaxed) == m_header->head.load(std::memory_order_acquire);
+}
@@ -0,0 +1,106 @@
+#pragma once
+
+#include "swss/sal.h"
+
+#include <string>
+#include <atomic>
+
+#include <stdint.h>
+
+namespace sairedis
+{
+    /**
+     * @brief Single producer single consumer ring of variable size records.
+     *
+     * Ring is placed in memory provided by caller, typically shared memory
+     * mapped by two processes, so it can't contain any pointers. Memory
+     * starts with header holding head and tail byte offsets, followed by
+     * ring data. Offsets are only growing, so head == tail means empty.
+     *
+     * Each record is u32 length followed by data, padded to 4 bytes. When
+     * record doesn't fit before end of ring, wrap marker is written and
+     * record is placed at beginning of ring.
+     *
+     * Producer publishes head with release, consumer publishes tail with
+     * release, so record data is visible before its offset, and producer
+     * will not overwrite record which is still read.
+     *
+     * Only one thread can push and only one thread can pop at the same time.
+     */
+    class SharedMemoryRing
+    {
+        public:
+
+            /**
+             * @brief Create ring over given memory.
+             *
+             * @param memory Memory of size getMemorySize(capacity).
+             * @param size Size of memory.
+             * @param initialize Whether to initialize header, only one side
+             * should initialize ring, before other side attaches.
+             */
+            SharedMemoryRing(
+                    _In_ void* memory,
+                    _In_ size_t size,
+                    _In_ bool initialize);
+
+            virtual ~SharedMemoryRing() = default;
+
+        public:
+
+            /**
+             * @brief Get memory size needed for ring of given capacity.
+             */
+            static size_t getMemorySize(
+                    _In_ size_t capacity);
+
+            size_t getCapacity() const;
+
+            /**
+             * @brief Push record.
+             *
+             * Throws if record is larger than half of ring capacity, since
+             * such record may never fit into ring.
+             *
+             * @return False if ring is currently full.
+             */
+            bool push(
+                    _In_ const std::string& record);
+
+            /**
+             * @brief Pop record.
+             *
+             * @return False if ring is empty.
+             */
+            bool pop(
+                    _Out_ std::string& record);
+
+            bool empty() const;
+
+        private:
+
+            typedef struct _Header
+            {
+                uint64_t magic;
+
+                uint64_t capacity;
+
+                alignas(64) std::atomic<uint64_t> head;
+
+                alignas(64) std::atomic<uint64_t> tail;
+
+            } Header;
+
+            static constexpr uint64_t RING_MAGIC = 0x53414952494e4731ULL; // "SAIRING1"
+
+            static constexpr uint32_t WRAP_MARKER = 0xFFFFFFFF;
+
+            static constexpr size_t DATA_OFFSET = (sizeof(Header) + 63) & ~(size_t)63;
+
+            Header* m_header;
+
+            uint8_t* m_data;
+
+            uint64_t m_capacity;
+    };
+}
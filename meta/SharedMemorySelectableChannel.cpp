@@ -0,0 +1,474 @@
+#include "SharedMemorySelectableChannel.h"
+#include "ZeroMQFrameCodec.h"
+
+#include "swss/logger.h"
+
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/eventfd.h>
+#include <sys/un.h>
+#include <poll.h>
+#include <unistd.h>
+#include <string.h>
+#include <errno.h>
+
+#define SHM_PUSH_RETRY_SLEEP_US (100)
+
+using namespace sairedis;
+
+static int create_eventfd()
+{
+    SWSS_LOG_ENTER();
+
+    int fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+
+    if (fd < 0)
+    {
+        SWSS_LOG_THROW("eventfd failed: %s", strerror(errno));
+    }
+
+    return fd;
+}
+
+static void signal_eventfd(
+        _In_ int fd)
+{
+    SWSS_LOG_ENTER();
+
+    uint64_t value = 1;
+
+    // if counter would overflow, eventfd is already signaled
+
+    if (write(fd, &value, sizeof(value)) < 0 && errno != EAGAIN)
+    {
+        SWSS_LOG_ERROR("failed to signal eventfd %d: %s", fd, strerror(errno));
+    }
+}
+
+SharedMemorySelectableChannel::SharedMemorySelectableChannel(
+        _In_ const std::string& endpoint,
+        _In_ size_t ringCapacity):
+    m_endpoint(endpoint),
+    m_memoryFd(-1),
+    m_memory(MAP_FAILED),
+    m_ringMemorySize(0),
+    m_requestEvent(-1),
+    m_responseEvent(-1),
+    m_notificationEvent(-1),
+    m_stopEvent(-1),
+    m_listenFd(-1),
+    m_clientFd(-1),
+    m_correlationId(0),
+    m_generation(0)
+{
+    SWSS_LOG_ENTER();
+
+    // each ring must start at cache line
+
+    m_ringMemorySize = (SharedMemoryRing::getMemorySize(ringCapacity) + 63) & ~(size_t)63;
+
+    size_t size = SHM_RING_COUNT * m_ringMemorySize;
+
+    // anonymous memory file is never visible in file system, so it can't
+    // leak when syncd crashes, client receives it over unix socket
+
+    m_memoryFd = memfd_create("sairedis_shm", MFD_CLOEXEC);
+
+    if (m_memoryFd < 0)
+    {
+        SWSS_LOG_THROW("memfd_create failed: %s", strerror(errno));
+    }
+
+    if (ftruncate(m_memoryFd, (off_t)size) != 0)
+    {
+        SWSS_LOG_THROW("ftruncate to %zu failed: %s", size, strerror(errno));
+    }
+
+    m_memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, m_memoryFd, 0);
+
+    if (m_memory == MAP_FAILED)
+    {
+        SWSS_LOG_THROW("mmap of %zu bytes failed: %s", size, strerror(errno));
+    }
+
+    uint8_t* base = static_cast<uint8_t*>(m_memory);
+
+    m_requestRing = std::make_shared<SharedMemoryRing>(base + SHM_RING_REQUEST * m_ringMemorySize, m_ringMemorySize, true);
+    m_responseRing = std::make_shared<SharedMemoryRing>(base + SHM_RING_RESPONSE * m_ringMemorySize, m_ringMemorySize, true);
+    m_notificationRing = std::make_shared<SharedMemoryRing>(base + SHM_RING_NOTIFICATION * m_ringMemorySize, m_ringMemorySize, true);
+
+    m_requestEvent = create_eventfd();
+    m_responseEvent = create_eventfd();
+    m_notificationEvent = create_eventfd();
+    m_stopEvent = create_eventfd();
+
+    SWSS_LOG_NOTICE("binding on %s, ring capacity %zu", endpoint.c_str(), m_requestRing->getCapacity());
+
+    sockaddr_un addr;
+
+    memset(&addr, 0, sizeof(addr));
+
+    if (endpoint.size() >= sizeof(addr.sun_path))
+    {
+        SWSS_LOG_THROW("endpoint path too long: %s", endpoint.c_str());
+    }
+
+    addr.sun_family = AF_UNIX;
+
+    strncpy(addr.sun_path, endpoint.c_str(), sizeof(addr.sun_path) - 1);
+
+    m_listenFd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+
+    if (m_listenFd < 0)
+    {
+        SWSS_LOG_THROW("socket failed: %s", strerror(errno));
+    }
+
+    // remove socket left by previous instance
+
+    unlink(endpoint.c_str());
+
+    if (bind(m_listenFd, (const sockaddr*)&addr, sizeof(addr)) != 0)
+    {
+        SWSS_LOG_THROW("bind on %s failed: %s", endpoint.c_str(), strerror(errno));
+    }
+
+    if (listen(m_listenFd, 4) != 0)
+    {
+        SWSS_LOG_THROW("listen on %s failed: %s", endpoint.c_str(), strerror(errno));
+    }
+
+    m_listenerThread = std::make_shared<std::thread>(&SharedMemorySelectableChannel::listenerThread, this);
+}
+
+SharedMemorySelectableChannel::~SharedMemorySelectableChannel()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_listenerThread)
+    {
+        signal_eventfd(m_stopEvent);
+
+        SWSS_LOG_NOTICE("ending listener thread for channel %s", m_endpoint.c_str());
+
+        m_listenerThread->join();
+
+        SWSS_LOG_NOTICE("ended listener thread for channel %s", m_endpoint.c_str());
+    }
+
+    for (int fd: { m_clientFd, m_listenFd, m_stopEvent, m_notificationEvent, m_responseEvent, m_requestEvent, m_memoryFd })
+    {
+        if (fd >= 0)
+        {
+            close(fd);
+        }
+    }
+
+    if (m_listenFd >= 0)
+    {
+        unlink(m_endpoint.c_str());
+    }
+
+    if (m_memory != MAP_FAILED)
+    {
+        munmap(m_memory, SHM_RING_COUNT * m_ringMemorySize);
+    }
+}
+
+void SharedMemorySelectableChannel::listenerThread()
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_NOTICE("begin");
+
+    while (true)
+    {
+        pollfd fds[3];
+
+        fds[0] = { m_stopEvent, POLLIN, 0 };
+        fds[1] = { m_listenFd, POLLIN, 0 };
+        fds[2] = { m_clientFd, POLLIN, 0 }; // ignored by poll when -1
+
+        int rc = poll(fds, 3, -1);
+
+        if (rc < 0 && errno == EINTR)
+        {
+            continue;
+        }
+
+        if (rc < 0)
+        {
+            SWSS_LOG_ERROR("poll failed: %s", strerror(errno));
+            break;
+        }
+
+        if (fds[0].revents)
+        {
+            SWSS_LOG_NOTICE("ending listener thread, since stop was requested");
+            break;
+        }
+
+        if (fds[2].revents)
+        {
+            char buffer[64];
+
+            ssize_t size = recv(m_clientFd, buffer, sizeof(buffer), MSG_DONTWAIT);
+
+            if (size <= 0 && !(size < 0 && (errno == EAGAIN || errno == EINTR)))
+            {
+                SWSS_LOG_NOTICE("client disconnected from %s", m_endpoint.c_str());
+
+                close(m_clientFd);
+
+                m_clientFd = -1;
+            }
+        }
+
+        if (fds[1].revents & POLLIN)
+        {
+            int fd = accept4(m_listenFd, nullptr, nullptr, SOCK_CLOEXEC);
+
+            if (fd < 0)
+            {
+                SWSS_LOG_ERROR("accept failed: %s", strerror(errno));
+                continue;
+            }
+
+            if (m_clientFd >= 0)
+            {
+                SWSS_LOG_ERROR("client already connected to %s, connection REJECTED", m_endpoint.c_str());
+
+                close(fd);
+                continue;
+            }
+
+            try
+            {
+                // requests of previous client which are still in ring
+                // will be skipped
+
+                m_generation++;
+
+                sendHandshake(fd);
+
+                SWSS_LOG_NOTICE("client connected to %s", m_endpoint.c_str());
+
+                m_clientFd = fd;
+            }
+            catch (const std::exception& e)
+            {
+                SWSS_LOG_ERROR("handshake failed: %s", e.what());
+
+                close(fd);
+            }
+        }
+    }
+
+    SWSS_LOG_NOTICE("end");
+}
+
+void SharedMemorySelectableChannel::sendHandshake(
+        _In_ int fd)
+{
+    SWSS_LOG_ENTER();
+
+    SharedMemoryHandshake handshake;
+
+    handshake.magic = SHM_HANDSHAKE_MAGIC;
+    handshake.ringMemorySize = m_ringMemorySize;
+    handshake.generation = m_generation;
+
+    int fds[SHM_FD_COUNT];
+
+    fds[SHM_FD_MEMORY] = m_memoryFd;
+    fds[SHM_FD_REQUEST_EVENT] = m_requestEvent;
+    fds[SHM_FD_RESPONSE_EVENT] = m_responseEvent;
+    fds[SHM_FD_NOTIFICATION_EVENT] = m_notificationEvent;
+
+    iovec iov;
+
+    iov.iov_base = &handshake;
+    iov.iov_len = sizeof(handshake);
+
+    union
+    {
+        char buffer[CMSG_SPACE(sizeof(fds))];
+
+        cmsghdr align;
+
+    } control;
+
+    memset(&control, 0, sizeof(control));
+
+    msghdr msg;
+
+    memset(&msg, 0, sizeof(msg));
+
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control.buffer;
+    msg.msg_controllen = sizeof(control.buffer);
+
+    cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+
+    cmsg->cmsg_level = SOL_SOCKET;
+    cmsg->cmsg_type = SCM_RIGHTS;
+    cmsg->cmsg_len = CMSG_LEN(sizeof(fds));
+
+    memcpy(CMSG_DATA(cmsg), fds, sizeof(fds));
+
+    if (sendmsg(fd, &msg, MSG_NOSIGNAL) != (ssize_t)sizeof(handshake))
+    {
+        SWSS_LOG_THROW("sendmsg failed: %s", strerror(errno));
+    }
+}
+
+bool SharedMemorySelectableChannel::pushRecord(
+        _In_ SharedMemoryRing& ring,
+        _In_ const std::string& record)
+{
+    SWSS_LOG_ENTER();
+
+    uint64_t waited = 0;
+
+    while (!ring.push(record))
+    {
+        if (waited >= PUSH_TIMEOUT_MS * 1000)
+        {
+            return false;
+        }
+
+        usleep(SHM_PUSH_RETRY_SLEEP_US);
+
+        waited += SHM_PUSH_RETRY_SLEEP_US;
+    }
+
+    return true;
+}
+
+void SharedMemorySelectableChannel::sendNotification(
+        _In_ const std::string& op,
+        _In_ const std::string& data,
+        _In_ const std::vector<swss::FieldValueTuple>& values)
+{
+    SWSS_LOG_ENTER();
+
+    std::string frame;
+
+    ZeroMQFrameCodec::encode(data, op, values, 0, frame);
+
+    std::lock_guard<std::mutex> lock(m_ntfMutex);
+
+    if (!pushRecord(*m_notificationRing, frame))
+    {
+        SWSS_LOG_ERROR("notification ring full, notification %s DROPPED", op.c_str());
+        return;
+    }
+
+    signal_eventfd(m_notificationEvent);
+}
+
+// SelectableChannel overrides
+
+bool SharedMemorySelectableChannel::empty()
+{
+    SWSS_LOG_ENTER();
+
+    return m_requestRing->empty();
+}
+
+void SharedMemorySelectableChannel::pop(
+        _Out_ swss::KeyOpFieldsValuesTuple& kco,
+        _In_ bool initViewMode)
+{
+    SWSS_LOG_ENTER();
+
+    std::string frame;
+
+    if (!m_requestRing->pop(frame))
+    {
+        SWSS_LOG_THROW("request ring is empty, can't pop");
+    }
+
+    while (true)
+    {
+        ZeroMQFrameCodec::decode(frame.data(), frame.size(), kco, m_correlationId);
+
+        if ((m_correlationId >> SHM_GENERATION_SHIFT) == m_generation)
+        {
+            return;
+        }
+
+        SWSS_LOG_WARN("skipping request %s:%s of previous client", kfvOp(kco).c_str(), kfvKey(kco).c_str());
+
+        if (!m_requestRing->pop(frame))
+        {
+            // empty key is ignored by syncd
+
+            kco = swss::KeyOpFieldsValuesTuple();
+            return;
+        }
+    }
+}
+
+void SharedMemorySelectableChannel::set(
+        _In_ const std::string& key,
+        _In_ const std::vector<swss::FieldValueTuple>& values,
+        _In_ const std::string& op)
+{
+    SWSS_LOG_ENTER();
+
+    std::string frame;
+
+    ZeroMQFrameCodec::encode(key, op, values, m_correlationId, frame);
+
+    if (!pushRecord(*m_responseRing, frame))
+    {
+        // client is not reading responses, it will time out
+
+        SWSS_LOG_ERROR("response ring full, response %s DROPPED", op.c_str());
+        return;
+    }
+
+    signal_eventfd(m_responseEvent);
+}
+
+// Selectable overrides
+
+int SharedMemorySelectableChannel::getFd()
+{
+    SWSS_LOG_ENTER();
+
+    return m_requestEvent;
+}
+
+uint64_t SharedMemorySelectableChannel::readData()
+{
+    SWSS_LOG_ENTER();
+
+    // clear event so it could be triggered in next select(), requests are
+    // read from ring in pop
+
+    uint64_t value;
+
+    if (read(m_requestEvent, &value, sizeof(value)) < 0 && errno != EAGAIN)
+    {
+        SWSS_LOG_ERROR("failed to read eventfd: %s", strerror(errno));
+    }
+
+    return 0;
+}
+
+bool SharedMemorySelectableChannel::hasData()
+{
+    SWSS_LOG_ENTER();
+
+    return !m_requestRing->empty();
+}
+
+bool SharedMemorySelectableChannel::hasCachedData()
+{
+    SWSS_LOG_ENTER();
+
+    return false;
+}
@@ -0,0 +1,155 @@
+#pragma once
+
+#include "SelectableChannel.h"
+#include "SharedMemoryRing.h"
+#include "SharedMemoryProtocol.h"
+
+#include "swss/table.h"
+
+#include <mutex>
+#include <thread>
+#include <memory>
+#include <atomic>
+
+namespace sairedis
+{
+    /**
+     * @brief Server side of shared memory channel.
+     *
+     * Requests, responses and notifications are passed through single
+     * producer single consumer rings in shared memory, encoded as ZMQ v2
+     * binary frames (see ZeroMQFrameCodec), and each ring has eventfd
+     * which is signaled after ring was written.
+     *
+     * Shared memory and eventfds are created by this channel and passed to
+     * client over unix socket. Since rings have single producer, only one
+     * client can be connected at a time, other connections are rejected
+     * until connected client closes its socket. Requests left in ring by
+     * previous client are skipped by connection generation.
+     */
+    class SharedMemorySelectableChannel:
+        public SelectableChannel
+    {
+        public:
+
+            SharedMemorySelectableChannel(
+                    _In_ const std::string& endpoint,
+                    _In_ size_t ringCapacity = SHM_DEFAULT_RING_CAPACITY);
+
+            virtual ~SharedMemorySelectableChannel();
+
+        public:
+
+            /**
+             * @brief Send notification to connected client.
+             *
+             * Notification is dropped if client doesn't read notification
+             * ring for too long. Can be called from any thread.
+             */
+            void sendNotification(
+                    _In_ const std::string& op,
+                    _In_ const std::string& data,
+                    _In_ const std::vector<swss::FieldValueTuple>& values);
+
+        public: // SelectableChannel overrides
+
+            virtual bool empty() override;
+
+            virtual void pop(
+                    _Out_ swss::KeyOpFieldsValuesTuple& kco,
+                    _In_ bool initViewMode) override;
+
+            virtual void set(
+                    _In_ const std::string& key,
+                    _In_ const std::vector<swss::FieldValueTuple>& values,
+                    _In_ const std::string& op) override;
+
+        public: // Selectable overrides
+
+            virtual int getFd() override;
+
+            virtual uint64_t readData() override;
+
+            virtual bool hasData() override;
+
+            virtual bool hasCachedData() override;
+
+        private:
+
+            void listenerThread();
+
+            /**
+             * @brief Send handshake and descriptors to accepted client.
+             */
+            void sendHandshake(
+                    _In_ int fd);
+
+            /**
+             * @brief Push record to ring, wait for free space up to timeout.
+             *
+             * @return False if record was dropped.
+             */
+            bool pushRecord(
+                    _In_ SharedMemoryRing& ring,
+                    _In_ const std::string& record);
+
+        public:
+
+            /**
+             * @brief Time after which record is dropped when ring is full.
+             */
+            static constexpr uint64_t PUSH_TIMEOUT_MS = 1000;
+
+        private:
+
+            std::string m_endpoint;
+
+            int m_memoryFd;
+
+            void* m_memory;
+
+            size_t m_ringMemorySize;
+
+            std::shared_ptr<SharedMemoryRing> m_requestRing;
+
+            std::shared_ptr<SharedMemoryRing> m_responseRing;
+
+            std::shared_ptr<SharedMemoryRing> m_notificationRing;
+
+            int m_requestEvent;
+
+            int m_responseEvent;
+
+            int m_notificationEvent;
+
+            /**
+             * @brief Event used to end listener thread.
+             */
+            int m_stopEvent;
+
+            int m_listenFd;
+
+            /**
+             * @brief Socket of connected client, used only by listener thread.
+             */
+            int m_clientFd;
+
+            /**
+             * @brief Serializes notifications, which may be sent from
+             * multiple threads.
+             */
+            std::mutex m_ntfMutex;
+
+            /**
+             * @brief Correlation id of last popped request.
+             */
+            uint64_t m_correlationId;
+
+            /**
+             * @brief Generation of connected client, set by listener thread.
+             */
+            std::atomic<uint64_t> m_generation;
+
+            std::shared_ptr<std::thread> m_listenerThread;
+    };
+}
@@ -0,0 +1,457 @@
+#include "ZeroMQBinarySelectableChannel.h"
+#include "ZeroMQFrameCodec.h"
+
+#include "swss/logger.h"
+
+#include <zmq.h>
+
+#include <sstream>
+
+#define ZMQ_POLL_TIMEOUT (1000)
+
+using namespace sairedis;
+
+/**
+ * @brief Receive all parts of multipart message.
+ *
+ * @return False when no message could be received.
+ */
+static bool zmq_recv_multipart(
+        _In_ void* socket,
+        _Out_ std::vector<std::string>& parts)
+{
+    SWSS_LOG_ENTER();
+
+    parts.clear();
+
+    while (true)
+    {
+        zmq_msg_t msg;
+
+        zmq_msg_init(&msg);
+
+        int rc = zmq_msg_recv(&msg, socket, ZMQ_DONTWAIT);
+
+        if (rc < 0)
+        {
+            zmq_msg_close(&msg);
+
+            if (parts.size())
+            {
+                SWSS_LOG_ERROR("zmq_msg_recv failed in middle of multipart message, zmqerrno: %d", zmq_errno());
+            }
+
+            return false;
+        }
+
+        parts.emplace_back((const char*)zmq_msg_data(&msg), zmq_msg_size(&msg));
+
+        int more = zmq_msg_more(&msg);
+
+        zmq_msg_close(&msg);
+
+        if (!more)
+        {
+            return true;
+        }
+    }
+}
+
+static void zmq_send_multipart(
+        _In_ void* socket,
+        _In_ const std::vector<std::string>& parts)
+{
+    SWSS_LOG_ENTER();
+
+    for (size_t idx = 0; idx < parts.size(); idx++)
+    {
+        int flags = (idx + 1 < parts.size()) ? ZMQ_SNDMORE : 0;
+
+        int rc = zmq_send(socket, parts[idx].data(), parts[idx].size(), flags);
+
+        if (rc < 0)
+        {
+            SWSS_LOG_THROW("zmq_send failed, zmqerrno: %d: %s",
+                    zmq_errno(),
+                    zmq_strerror(zmq_errno()));
+        }
+    }
+}
+
+ZeroMQBinarySelectableChannel::ZeroMQBinarySelectableChannel(
+        _In_ const std::string& endpoint):
+    m_endpoint(endpoint),
+    m_context(nullptr),
+    m_socket(nullptr),
+    m_responseSocket(nullptr),
+    m_sendSocket(nullptr),
+    m_correlationId(0),
+    m_popped(0),
+    m_queueSize(0),
+    m_runThread(true)
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_NOTICE("binding on %s", endpoint.c_str());
+
+    std::stringstream ss;
+
+    ss << "inproc://zmq_binary_response_" << (const void*)this;
+
+    m_inprocEndpoint = ss.str();
+
+    m_context = zmq_ctx_new();
+
+    m_socket = zmq_socket(m_context, ZMQ_ROUTER);
+
+    int linger = 0;
+
+    zmq_setsockopt(m_socket, ZMQ_LINGER, &linger, sizeof(linger));
+
+    int rc = zmq_bind(m_socket, endpoint.c_str());
+
+    if (rc != 0)
+    {
+        SWSS_LOG_THROW("zmq_bind failed on endpoint: %s, zmqerrno: %d",
+                endpoint.c_str(),
+                zmq_errno());
+    }
+
+    m_responseSocket = zmq_socket(m_context, ZMQ_PULL);
+
+    rc = zmq_bind(m_responseSocket, m_inprocEndpoint.c_str());
+
+    if (rc != 0)
+    {
+        SWSS_LOG_THROW("zmq_bind failed on endpoint: %s, zmqerrno: %d",
+                m_inprocEndpoint.c_str(),
+                zmq_errno());
+    }
+
+    m_sendSocket = zmq_socket(m_context, ZMQ_PUSH);
+
+    zmq_setsockopt(m_sendSocket, ZMQ_LINGER, &linger, sizeof(linger));
+
+    rc = zmq_connect(m_sendSocket, m_inprocEndpoint.c_str());
+
+    if (rc != 0)
+    {
+        SWSS_LOG_THROW("zmq_connect failed on endpoint: %s, zmqerrno: %d",
+                m_inprocEndpoint.c_str(),
+                zmq_errno());
+    }
+
+    m_routerThread = std::make_shared<std::thread>(&ZeroMQBinarySelectableChannel::zmqRouterThread, this);
+}
+
+ZeroMQBinarySelectableChannel::~ZeroMQBinarySelectableChannel()
+{
+    SWSS_LOG_ENTER();
+
+    m_runThread = false;
+
+    zmq_close(m_sendSocket);
+
+    // shutdown will interrupt zmq_poll in router thread with ETERM
+
+    zmq_ctx_shutdown(m_context);
+
+    SWSS_LOG_NOTICE("ending zmq router thread for channel %s", m_endpoint.c_str());
+
+    m_routerThread->join();
+
+    SWSS_LOG_NOTICE("ended zmq router thread for channel %s", m_endpoint.c_str());
+
+    zmq_close(m_responseSocket);
+    zmq_close(m_socket);
+
+    zmq_ctx_term(m_context);
+}
+
+void ZeroMQBinarySelectableChannel::zmqRouterThread()
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_NOTICE("begin");
+
+    while (m_runThread)
+    {
+        zmq_pollitem_t items [2] = { };
+
+        items[0].socket = m_socket;
+        items[0].events = ZMQ_POLLIN;
+
+        items[1].socket = m_responseSocket;
+        items[1].events = ZMQ_POLLIN;
+
+        int rc = zmq_poll(items, 2, ZMQ_POLL_TIMEOUT);
+
+        if (m_runThread == false)
+        {
+            SWSS_LOG_NOTICE("ending router thread, since run is false");
+            break;
+        }
+
+        if (rc < 0 && zmq_errno() == ETERM)
+        {
+            SWSS_LOG_NOTICE("zmq_poll ETERM");
+            break;
+        }
+
+        if (rc < 0 && zmq_errno() == EINTR)
+        {
+            continue;
+        }
+
+        if (rc < 0)
+        {
+            SWSS_LOG_ERROR("zmq_poll failed, zmqerrno: %d", zmq_errno());
+            break;
+        }
+
+        try
+        {
+            // send responses first, so client can proceed while we queue
+            // next requests
+
+            if (items[1].revents & ZMQ_POLLIN)
+            {
+                forwardResponse();
+            }
+
+            if (items[0].revents & ZMQ_POLLIN)
+            {
+                receiveRequests();
+            }
+        }
+        catch (const std::exception& e)
+        {
+            SWSS_LOG_ERROR("router thread exception: %s", e.what());
+        }
+    }
+
+    SWSS_LOG_NOTICE("end");
+}
+
+void ZeroMQBinarySelectableChannel::receiveRequests()
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<std::string> parts;
+
+    size_t count = 0;
+
+    while (zmq_recv_multipart(m_socket, parts))
+    {
+        if (parts.size() < 2)
+        {
+            SWSS_LOG_ERROR("expected identity and at least one frame, got %zu parts, message DROPPED", parts.size());
+            continue;
+        }
+
+        std::vector<Request> requests;
+
+        requests.reserve(parts.size() - 1);
+
+        for (size_t idx = 1; idx < parts.size(); idx++)
+        {
+            Request req;
+
+            req.identity = parts[0];
+
+            try
+            {
+                ZeroMQFrameCodec::decode(parts[idx].data(), parts[idx].size(), req.kco, req.correlationId);
+            }
+            catch (const std::exception& e)
+            {
+                SWSS_LOG_ERROR("failed to decode frame %zu: %s, frame DROPPED", idx, e.what());
+                continue;
+            }
+
+            requests.push_back(std::move(req));
+        }
+
+        if (requests.empty())
+        {
+            continue;
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        auto& queue = m_clientQueues[parts[0]];
+
+        if (queue.empty())
+        {
+            m_schedule.push_back(parts[0]);
+        }
+
+        for (auto& req: requests)
+        {
+            queue.push_back(std::move(req));
+        }
+
+        m_queueSize += requests.size();
+
+        count += requests.size();
+    }
+
+    if (count)
+    {
+        m_selectableEvent.notify(); // will release epoll
+    }
+}
+
+void ZeroMQBinarySelectableChannel::forwardResponse()
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<std::string> parts;
+
+    while (zmq_recv_multipart(m_responseSocket, parts))
+    {
+        zmq_send_multipart(m_socket, parts);
+    }
+}
+
+void ZeroMQBinarySelectableChannel::setClientWeight(
+        _In_ const std::string& identity,
+        _In_ uint32_t weight)
+{
+    SWSS_LOG_ENTER();
+
+    if (weight == 0)
+    {
+        SWSS_LOG_THROW("client weight can't be zero");
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_clientWeights[identity] = weight;
+}
+
+// SelectableChannel overrides
+
+bool ZeroMQBinarySelectableChannel::empty()
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_queueSize == 0;
+}
+
+void ZeroMQBinarySelectableChannel::pop(
+        _Out_ swss::KeyOpFieldsValuesTuple& kco,
+        _In_ bool initViewMode)
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (m_queueSize == 0)
+    {
+        SWSS_LOG_THROW("queue is empty, can't pop");
+    }
+
+    auto identity = m_schedule.front();
+
+    auto it = m_clientQueues.find(identity);
+
+    auto& req = it->second.front();
+
+    kco = std::move(req.kco);
+
+    m_identity = std::move(req.identity);
+
+    m_correlationId = req.correlationId;
+
+    it->second.pop_front();
+
+    m_queueSize--;
+
+    m_popped++;
+
+    auto wit = m_clientWeights.find(identity);
+
+    uint32_t weight = (wit == m_clientWeights.end()) ? 1 : wit->second;
+
+    if (it->second.empty())
+    {
+        m_clientQueues.erase(it);
+
+        m_schedule.pop_front();
+
+        m_popped = 0;
+    }
+    else if (m_popped >= weight)
+    {
+        // client used its turn, move it to the end
+
+        m_schedule.pop_front();
+
+        m_schedule.push_back(identity);
+
+        m_popped = 0;
+    }
+}
+
+void ZeroMQBinarySelectableChannel::set(
+        _In_ const std::string& key,
+        _In_ const std::vector<swss::FieldValueTuple>& values,
+        _In_ const std::string& op)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_identity.empty())
+    {
+        SWSS_LOG_THROW("no request was popped, don't know where to send response %s", op.c_str());
+    }
+
+    std::vector<std::string> parts(2);
+
+    parts[0] = m_identity;
+
+    ZeroMQFrameCodec::encode(key, op, values, m_correlationId, parts[1]);
+
+    zmq_send_multipart(m_sendSocket, parts);
+}
+
+// Selectable overrides
+
+int ZeroMQBinarySelectableChannel::getFd()
+{
+    SWSS_LOG_ENTER();
+
+    return m_selectableEvent.getFd();
+}
+
+uint64_t ZeroMQBinarySelectableChannel::readData()
+{
+    SWSS_LOG_ENTER();
+
+    // clear selectable event so it could be triggered in next select(),
+    // requests were already queued by router thread
+
+    m_selectableEvent.readData();
+
+    return 0;
+}
+
+bool ZeroMQBinarySelectableChannel::hasData()
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_queueSize > 0;
+}
+
+bool ZeroMQBinarySelectableChannel::hasCachedData()
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_queueSize > 1;
+}
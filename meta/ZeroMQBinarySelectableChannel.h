@@ -0,0 +1,172 @@
+#pragma once
+
+#include "SelectableChannel.h"
+
+#include "swss/table.h"
+#include "swss/selectableevent.h"
+
+#include <deque>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <memory>
+
+namespace sairedis
+{
+    /**
+     * @brief Server side of ZMQ v2 protocol.
+     *
+     * Requests are received on ROUTER socket as multipart messages, each
+     * part is binary frame with single operation (see ZeroMQFrameCodec).
+     * Unlike REQ/REP, client can have many requests in flight, and each
+     * response is routed back to client which sent popped request, with
+     * request correlation id.
+     *
+     * ROUTER socket is owned by internal thread, since ZMQ sockets are not
+     * thread safe. Responses are passed to that thread over inproc socket.
+     *
+     * Requests are queued per client identity, and popped in weighted round
+     * robin order: client can pop up to its weight requests in a row before
+     * next client with pending requests is served. Order of requests from
+     * single client is preserved.
+     *
+     * Weights only decide which queued request is popped next. Requests are
+     * still executed one at a time by the thread popping them, so long
+     * running request of one client delays requests of all other clients.
+     */
+    class ZeroMQBinarySelectableChannel:
+        public SelectableChannel
+    {
+        public:
+
+            ZeroMQBinarySelectableChannel(
+                    _In_ const std::string& endpoint);
+
+            virtual ~ZeroMQBinarySelectableChannel();
+
+        public:
+
+            /**
+             * @brief Set number of requests which client with given identity
+             * can pop in a row. Default weight is 1.
+             */
+            void setClientWeight(
+                    _In_ const std::string& identity,
+                    _In_ uint32_t weight);
+
+        public: // SelectableChannel overrides
+
+            virtual bool empty() override;
+
+            virtual void pop(
+                    _Out_ swss::KeyOpFieldsValuesTuple& kco,
+                    _In_ bool initViewMode) override;
+
+            virtual void set(
+                    _In_ const std::string& key,
+                    _In_ const std::vector<swss::FieldValueTuple>& values,
+                    _In_ const std::string& op) override;
+
+        public: // Selectable overrides
+
+            virtual int getFd() override;
+
+            virtual uint64_t readData() override;
+
+            virtual bool hasData() override;
+
+            virtual bool hasCachedData() override;
+
+        private:
+
+            typedef struct _Request
+            {
+                std::string identity;
+
+                uint64_t correlationId;
+
+                swss::KeyOpFieldsValuesTuple kco;
+
+            } Request;
+
+            void zmqRouterThread();
+
+            /**
+             * @brief Receive multipart request message from router socket.
+             *
+             * Executed by router thread.
+             */
+            void receiveRequests();
+
+            /**
+             * @brief Forward response from inproc socket to router socket.
+             *
+             * Executed by router thread.
+             */
+            void forwardResponse();
+
+        private:
+
+            std::string m_endpoint;
+
+            std::string m_inprocEndpoint;
+
+            void* m_context;
+
+            /**
+             * @brief Router socket, used only by router thread.
+             */
+            void* m_socket;
+
+            /**
+             * @brief Inproc socket used by router thread to receive responses.
+             */
+            void* m_responseSocket;
+
+            /**
+             * @brief Inproc socket used by set to send responses.
+             */
+            void* m_sendSocket;
+
+            std::mutex m_mutex;
+
+            /**
+             * @brief Pending requests of each client.
+             */
+            std::map<std::string, std::deque<Request>> m_clientQueues;
+
+            /**
+             * @brief Identities of clients with pending requests, in round
+             * robin order, front is client which is currently served.
+             */
+            std::deque<std::string> m_schedule;
+
+            std::map<std::string, uint32_t> m_clientWeights;
+
+            /**
+             * @brief Number of requests popped from current client in a row.
+             */
+            uint32_t m_popped;
+
+            /**
+             * @brief Number of pending requests of all clients.
+             */
+            size_t m_queueSize;
+
+            /**
+             * @brief Identity of client which sent last popped request.
+             */
+            std::string m_identity;
+
+            /**
+             * @brief Correlation id of last popped request.
+             */
+            uint64_t m_correlationId;
+
+            volatile bool m_runThread;
+
+            std::shared_ptr<std::thread> m_routerThread;
+
+            swss::SelectableEvent m_selectableEvent;
+    };
+}
@@ -0,0 +1,170 @@
+#include "ZeroMQFrameCodec.h"
+
+#include "swss/logger.h"
+
+using namespace sairedis;
+
+static void put_u32(
+        _Inout_ std::string& frame,
+        _In_ uint32_t value)
+{
+    SWSS_LOG_ENTER();
+
+    for (int i = 0; i < 4; i++)
+    {
+        frame.push_back((char)((value >> (8 * i)) & 0xff));
+    }
+}
+
+static void put_u64(
+        _Inout_ std::string& frame,
+        _In_ uint64_t value)
+{
+    SWSS_LOG_ENTER();
+
+    for (int i = 0; i < 8; i++)
+    {
+        frame.push_back((char)((value >> (8 * i)) & 0xff));
+    }
+}
+
+static void put_str(
+        _Inout_ std::string& frame,
+        _In_ const std::string& str)
+{
+    SWSS_LOG_ENTER();
+
+    put_u32(frame, (uint32_t)str.size());
+
+    frame.append(str);
+}
+
+static uint64_t get_uint(
+        _In_ const uint8_t* data,
+        _In_ size_t size,
+        _Inout_ size_t& offset,
+        _In_ size_t bytes)
+{
+    SWSS_LOG_ENTER();
+
+    if (size - offset < bytes)
+    {
+        SWSS_LOG_THROW("frame truncated at offset %zu, size %zu", offset, size);
+    }
+
+    uint64_t value = 0;
+
+    for (size_t i = 0; i < bytes; i++)
+    {
+        value |= (uint64_t)data[offset + i] << (8 * i);
+    }
+
+    offset += bytes;
+
+    return value;
+}
+
+static void get_str(
+        _In_ const uint8_t* data,
+        _In_ size_t size,
+        _Inout_ size_t& offset,
+        _Out_ std::string& str)
+{
+    SWSS_LOG_ENTER();
+
+    size_t len = (size_t)get_uint(data, size, offset, 4);
+
+    if (size - offset < len)
+    {
+        SWSS_LOG_THROW("frame string truncated at offset %zu, length %zu, size %zu", offset, len, size);
+    }
+
+    str.assign((const char*)data + offset, len);
+
+    offset += len;
+}
+
+void ZeroMQFrameCodec::encode(
+        _In_ const std::string& key,
+        _In_ const std::string& op,
+        _In_ const std::vector<swss::FieldValueTuple>& values,
+        _In_ uint64_t correlationId,
+        _Out_ std::string& frame)
+{
+    SWSS_LOG_ENTER();
+
+    size_t size = 1 + 8 + 4 + key.size() + 4 + op.size() + 4;
+
+    for (const auto& fv: values)
+    {
+        size += 8 + fvField(fv).size() + fvValue(fv).size();
+    }
+
+    frame.clear();
+    frame.reserve(size);
+
+    frame.push_back((char)ZMQ_FRAME_VERSION);
+
+    put_u64(frame, correlationId);
+
+    put_str(frame, key);
+    put_str(frame, op);
+
+    put_u32(frame, (uint32_t)values.size());
+
+    for (const auto& fv: values)
+    {
+        put_str(frame, fvField(fv));
+        put_str(frame, fvValue(fv));
+    }
+}
+
+void ZeroMQFrameCodec::decode(
+        _In_ const void* data,
+        _In_ size_t size,
+        _Out_ swss::KeyOpFieldsValuesTuple& kco,
+        _Out_ uint64_t& correlationId)
+{
+    SWSS_LOG_ENTER();
+
+    auto buffer = (const uint8_t*)data;
+
+    size_t offset = 0;
+
+    auto version = get_uint(buffer, size, offset, 1);
+
+    if (version != ZMQ_FRAME_VERSION)
+    {
+        SWSS_LOG_THROW("unsupported frame version %d, expected %d", (int)version, ZMQ_FRAME_VERSION);
+    }
+
+    correlationId = get_uint(buffer, size, offset, 8);
+
+    get_str(buffer, size, offset, kfvKey(kco));
+    get_str(buffer, size, offset, kfvOp(kco));
+
+    size_t count = (size_t)get_uint(buffer, size, offset, 4);
+
+    // each field value takes at least 8 bytes, don't trust count blindly
+
+    if (count > (size - offset) / 8)
+    {
+        SWSS_LOG_THROW("frame field count %zu exceeds frame size %zu", count, size);
+    }
+
+    auto& values = kfvFieldsValues(kco);
+
+    values.clear();
+    values.resize(count);
+
+    for (auto& fv: values)
+    {
+        get_str(buffer, size, offset, fvField(fv));
+        get_str(buffer, size, offset, fvValue(fv));
+    }
+
+    if (offset != size)
+    {
+        SWSS_LOG_THROW("frame has %zu trailing bytes", size - offset);
+    }
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "swss/table.h"
+#include "swss/sal.h"
+
+#include <string>
+#include <vector>
+
+#include <stdint.h>
+
+/**
+ * @brief Version of binary frame used by ZMQ v2 protocol.
+ */
+#define ZMQ_FRAME_VERSION (2)
+
+namespace sairedis
+{
+    /**
+     * @brief Encodes and decodes operations as binary frames.
+     *
+     * Each ZMQ v2 frame carries one operation:
+     *
+     *   u8  version
+     *   u64 correlation id
+     *   str key
+     *   str op
+     *   u32 count
+     *   count * (str field, str value)
+     *
+     * where str is u32 length followed by bytes. All integers are little
+     * endian. Unlike JSON, strings are copied without escaping and decoder
+     * does not need to search for delimiters.
+     *
+     * Multiple frames can be sent as single multipart message.
+     */
+    class ZeroMQFrameCodec
+    {
+        private:
+
+            ZeroMQFrameCodec() = delete;
+            ~ZeroMQFrameCodec() = delete;
+
+        public:
+
+            static void encode(
+                    _In_ const std::string& key,
+                    _In_ const std::string& op,
+                    _In_ const std::vector<swss::FieldValueTuple>& values,
+                    _In_ uint64_t correlationId,
+                    _Out_ std::string& frame);
+
+            /**
+             * @brief Decode frame.
+             *
+             * Throws when frame is truncated, has trailing data or has
+             * unsupported version.
+             */
+            static void decode(
+                    _In_ const void* data,
+                    _In_ size_t size,
+                    _Out_ swss::KeyOpFieldsValuesTuple& kco,
+                    _Out_ uint64_t& correlationId);
+    };
+}
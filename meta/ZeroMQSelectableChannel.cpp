@@ -1,5 +1,7 @@
 #include "ZeroMQSelectableChannel.h"
 
+#include "sairediscommon.h"
+
 #include "swss/logger.h"
 #include "swss/json.h"
 
@@ -180,6 +182,17 @@ void ZeroMQSelectableChannel::pop(
     kfvOp(kco) = fvValue(fvt);
 
     values.erase(values.begin());
+
+    // correlation id is transport only, it will be echoed back in response
+
+    m_correlationId.clear();
+
+    if (values.size() && fvField(values.back()) == REDIS_CORRELATION_ID_FIELD)
+    {
+        m_correlationId = fvValue(values.back());
+
+        values.pop_back();
+    }
 }
 
 void ZeroMQSelectableChannel::set(
@@ -195,6 +208,13 @@ void ZeroMQSelectableChannel::set(
 
     copy.insert(copy.begin(), opdata);
 
+    if (m_correlationId.size())
+    {
+        copy.emplace_back(REDIS_CORRELATION_ID_FIELD, m_correlationId);
+
+        m_correlationId.clear();
+    }
+
     std::string msg = swss::JSon::buildJson(copy);
 
     SWSS_LOG_DEBUG("sending: %s", msg.c_str());
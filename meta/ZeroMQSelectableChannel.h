@@ -68,6 +68,14 @@ namespace sairedis
 
             std::vector<uint8_t> m_buffer;
 
+            /**
+             * @brief Correlation id of last popped request.
+             *
+             * REQ/REP pattern allows only one request in flight, so next
+             * response sent will be for that request.
+             */
+            std::string m_correlationId;
+
             volatile bool m_allowZmqPoll;
 
             volatile bool m_runThread;
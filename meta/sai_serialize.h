@@ -326,6 +326,40 @@ std::string sai_serialize_redis_link_event_damping_algorithm(
 std::string sai_serialize_redis_link_event_damping_aied_config(
          _In_ const sai_redis_link_event_damping_algo_aied_config_t& value);
 
+// append serialize
+//
+// Those functions append serialized value to provided buffer instead of
+// returning new string, output is the same as from string versions.
+
+void sai_serialize_number(
+        _Inout_ std::string& buf,
+        _In_ uint64_t number,
+        _In_ bool hex = false);
+
+void sai_serialize_object_id(
+        _Inout_ std::string& buf,
+        _In_ sai_object_id_t oid);
+
+void sai_serialize_mac(
+        _Inout_ std::string& buf,
+        _In_ const sai_mac_t mac);
+
+void sai_serialize_enum(
+        _Inout_ std::string& buf,
+        _In_ const int32_t value,
+        _In_ const sai_enum_metadata_t* meta);
+
+void sai_serialize_oid_list(
+        _Inout_ std::string& buf,
+        _In_ const sai_object_list_t &list,
+        _In_ bool countOnly);
+
+void sai_serialize_attr_value(
+        _Inout_ std::string& buf,
+        _In_ const sai_attr_metadata_t& meta,
+        _In_ const sai_attribute_t &attr,
+        _In_ const bool countOnly = false);
+
 // deserialize
 
 void sai_deserialize_enum(
@@ -333,6 +367,18 @@ void sai_deserialize_enum(
         _In_ const sai_enum_metadata_t * meta,
         _Out_ int32_t& value);
 
+/**
+ * @brief Find enum value by name using hashed name index.
+ *
+ * Deprecated/ignored names are also accepted. Function don't throw.
+ *
+ * @return True if name was found, false otherwise.
+ */
+bool sai_deserialize_enum_name(
+        _In_ const char* s,
+        _In_ const sai_enum_metadata_t * meta,
+        _Out_ int32_t& value);
+
 void sai_deserialize_number(
         _In_ const std::string& s,
         _Out_ uint32_t& number,
@@ -622,3 +668,37 @@ void sai_deserialize_redis_link_event_damping_algorithm(
 void sai_deserialize_redis_link_event_damping_aied_config(
         _In_ const std::string& s,
          _Out_ sai_redis_link_event_damping_algo_aied_config_t& value);
+
+// attribute value dispatch
+
+typedef std::string (*sai_serialize_attr_value_fn)(
+        _In_ const sai_attr_metadata_t& meta,
+        _In_ const sai_attribute_t& attr,
+        _In_ bool countOnly);
+
+typedef void (*sai_serialize_attr_value_append_fn)(
+        _Inout_ std::string& buf,
+        _In_ const sai_attr_metadata_t& meta,
+        _In_ const sai_attribute_t& attr,
+        _In_ bool countOnly);
+
+typedef void (*sai_deserialize_attr_value_fn)(
+        _In_ const std::string& s,
+        _In_ const sai_attr_metadata_t& meta,
+        _Out_ sai_attribute_t& attr,
+        _In_ bool countOnly);
+
+/**
+ * @brief Get serializer specialized for given attribute metadata.
+ *
+ * @return Serializer function or nullptr if attribute value type is not
+ * supported.
+ */
+sai_serialize_attr_value_fn sai_get_attr_value_serializer(
+        _In_ const sai_attr_metadata_t& attrMeta);
+
+sai_serialize_attr_value_append_fn sai_get_attr_value_append_serializer(
+        _In_ const sai_attr_metadata_t& attrMeta);
+
+sai_deserialize_attr_value_fn sai_get_attr_value_deserializer(
+        _In_ const sai_attr_metadata_t& attrMeta);
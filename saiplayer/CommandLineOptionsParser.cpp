@@ -138,7 +138,7 @@ void CommandLineOptionsParser::printUsage()
     std::cout << "    -m --syncMode:" << std::endl;
     std::cout << "        Enable synchronous mode (depreacated, use -z)" << std::endl << std::endl;
     std::cout << "    -z --redisCommunicationMode" << std::endl;
-    std::cout << "        Redis communication mode (redis_async|redis_sync|zmq_sync), default: redis_async" << std::endl << std::endl;
+    std::cout << "        Redis communication mode (redis_async|redis_sync|zmq_sync|zmq_v2_sync|shm_sync), default: redis_async" << std::endl << std::endl;
     std::cout << "    -r --enableRecording:" << std::endl;
     std::cout << "        Enable sairedis recording" << std::endl << std::endl;
     std::cout << "    -p --profile profile" << std::endl;
@@ -3,6 +3,7 @@
 #include "sairedis.h"
 #include "sairediscommon.h"
 #include "VirtualObjectIdManager.h"
+#include "BinaryRecordingReader.h"
 
 #include "meta/sai_serialize.h"
 #include "meta/PerformanceIntervalTimer.h"
@@ -1275,6 +1276,161 @@ void SaiPlayer::performFdbFlush(
     // fdb flush OK
 }
 
+bool SaiPlayer::isStatsQuery(
+        _In_ const std::string& line)
+{
+    SWSS_LOG_ENTER();
+
+    auto fields = swss::tokenize(line, '|');
+
+    if (fields.size() < 3)
+    {
+        return false;
+    }
+
+    auto& query = fields[2];
+
+    return query == "get_stats" ||
+        query == "get_stats_ext" ||
+        query == "clear_stats" ||
+        query == "bulk_get_stats" ||
+        query == "bulk_clear_stats";
+}
+
+void SaiPlayer::performStatsQuery(
+        _In_ const std::string& request,
+        _In_ const std::string& response)
+{
+    SWSS_LOG_ENTER();
+
+    // 2017-05-13.20:47:24.883499|q|get_stats|SAI_OBJECT_TYPE_PORT:oid:0x1000000000002|SAI_PORT_STAT_IF_IN_OCTETS=|
+    // 2017-05-13.20:47:24.883499|Q|get_stats|SAI_STATUS_SUCCESS|0
+    // 2017-05-13.20:47:24.883499|q|bulk_get_stats|SAI_OBJECT_TYPE_QUEUE:oid:0x21000000000000|STATS_MODE=SAI_STATS_MODE_READ|COUNTER_IDS=SAI_QUEUE_STAT_PACKETS|oid:0x15000000000010=
+    // 2017-05-13.20:47:24.883499|Q|bulk_get_stats|SAI_STATUS_SUCCESS|SAI_STATUS_SUCCESS=0
+
+    // timestamp|action|query|objecttype:objectid|field=value|...
+    auto r = swss::tokenize(request, '|');
+    auto R = swss::tokenize(response, '|');
+
+    if (r.size() < 4 || R.size() < 4 || r[1] != "q" || R[1] != "Q" || r[2] != R[2])
+    {
+        SWSS_LOG_THROW("invalid stats query request/response %s/%s", request.c_str(), response.c_str());
+    }
+
+    auto& query = r[2];
+
+    bool bulk = (query == "bulk_get_stats" || query == "bulk_clear_stats");
+
+    // objecttype:objectid (object id may contain ':'), on bulk object id is switch id
+    auto start = r[3].find_first_of(":");
+    auto str_object_type = r[3].substr(0, start);
+    auto str_object_id  = r[3].substr(start + 1);
+
+    sai_object_type_t object_type = deserialize_object_type(str_object_type);
+
+    auto info = sai_metadata_get_object_type_info(object_type);
+
+    if (info->isnonobjectid || info->statenum == nullptr)
+    {
+        SWSS_LOG_THROW("object type %s don't support stats: %s", str_object_type.c_str(), request.c_str());
+    }
+
+    sai_object_id_t local_id;
+    sai_deserialize_object_id(str_object_id, local_id);
+
+    sai_object_id_t object_id = translate_local_to_redis(local_id);
+
+    int32_t mode = SAI_STATS_MODE_READ;
+
+    std::vector<sai_stat_id_t> counter_ids;
+    std::vector<sai_object_key_t> object_keys;
+
+    for (size_t i = 4; i < r.size(); ++i)
+    {
+        auto& item = r[i];
+
+        auto field = item.substr(0, item.find_first_of("="));
+        auto value = item.substr(field.size() + 1);
+
+        if (field == REDIS_STATS_MODE_FIELD)
+        {
+            sai_deserialize_enum(value, &sai_metadata_enum_sai_stats_mode_t, mode);
+        }
+        else if (field == REDIS_STATS_COUNTERS_FIELD)
+        {
+            for (auto& name: swss::tokenize(value, ','))
+            {
+                int32_t id;
+                sai_deserialize_enum(name, info->statenum, id);
+
+                counter_ids.push_back((sai_stat_id_t)id);
+            }
+        }
+        else if (bulk)
+        {
+            sai_object_key_t key;
+            sai_deserialize_object_id(field, local_id);
+
+            key.key.object_id = translate_local_to_redis(local_id);
+
+            object_keys.push_back(key);
+        }
+        else
+        {
+            int32_t id;
+            sai_deserialize_enum(field, info->statenum, id);
+
+            counter_ids.push_back((sai_stat_id_t)id);
+        }
+    }
+
+    uint32_t number_of_counters = (uint32_t)counter_ids.size();
+    uint32_t object_count = (uint32_t)object_keys.size();
+
+    std::vector<uint64_t> counters((size_t)number_of_counters * (bulk ? object_count : 1));
+    std::vector<sai_status_t> statuses(object_count);
+
+    sai_status_t status;
+
+    if (query == "get_stats")
+    {
+        status = m_sai->getStats(object_type, object_id, number_of_counters, counter_ids.data(), counters.data());
+    }
+    else if (query == "get_stats_ext")
+    {
+        status = m_sai->getStatsExt(object_type, object_id, number_of_counters, counter_ids.data(), (sai_stats_mode_t)mode, counters.data());
+    }
+    else if (query == "clear_stats")
+    {
+        status = m_sai->clearStats(object_type, object_id, number_of_counters, counter_ids.data());
+    }
+    else if (query == "bulk_get_stats")
+    {
+        status = m_sai->bulkGetStats(object_id, object_type, object_count, object_keys.data(),
+                number_of_counters, counter_ids.data(), (sai_stats_mode_t)mode, statuses.data(), counters.data());
+    }
+    else
+    {
+        status = m_sai->bulkClearStats(object_id, object_type, object_count, object_keys.data(),
+                number_of_counters, counter_ids.data(), (sai_stats_mode_t)mode, statuses.data());
+    }
+
+    // counter values will differ from recording, only status is compared
+
+    sai_status_t expected_status;
+    sai_deserialize_status(R[3], expected_status);
+
+    if (status != expected_status)
+    {
+        SWSS_LOG_THROW("%s got status %s, but expecting: %s",
+                query.c_str(),
+                sai_serialize_status(status).c_str(),
+                R[3].c_str());
+    }
+
+    // stats query OK
+}
+
 std::vector<std::string> SaiPlayer::tokenize(
         _In_ std::string input,
         _In_ const std::string &delim)
@@ -2522,17 +2678,35 @@ int SaiPlayer::replay()
 
     SWSS_LOG_NOTICE("using file: %s", filename.c_str());
 
-    std::ifstream infile(filename);
+    std::ifstream infile;
 
-    if (!infile.is_open())
+    std::shared_ptr<sairedis::BinaryRecordingReader> reader;
+
+    if (sairedis::BinaryRecordingReader::isBinaryRecording(filename))
     {
-        SWSS_LOG_ERROR("failed to open file %s", filename.c_str());
-        return -1;
+        // records are decoded to text lines, so the same handlers are used
+
+        reader = std::make_shared<sairedis::BinaryRecordingReader>(filename);
+    }
+    else
+    {
+        infile.open(filename);
+
+        if (!infile.is_open())
+        {
+            SWSS_LOG_ERROR("failed to open file %s", filename.c_str());
+            return -1;
+        }
     }
 
+    auto readLine = [&](std::string& l) -> bool
+    {
+        return reader ? reader->next(l) : (bool)std::getline(infile, l);
+    };
+
     std::string line;
 
-    while (std::getline(infile, line))
+    while (readLine(line))
     {
         // std::cout << "processing " << line << std::endl;
 
@@ -2551,7 +2725,7 @@ int SaiPlayer::replay()
                     do
                     {
                         // this line may be notification, we need to skip
-                        if (!std::getline(infile, response))
+                        if (!readLine(response))
                         {
                             SWSS_LOG_THROW("failed to read next file from file, previous: %s", line.c_str());
                         }
@@ -2569,7 +2743,7 @@ int SaiPlayer::replay()
                     do
                     {
                         // this line may be notification, we need to skip
-                        if (!std::getline(infile, response))
+                        if (!readLine(response))
                         {
                             SWSS_LOG_THROW("failed to read next file from file, previous: %s", line.c_str());
                         }
@@ -2605,7 +2779,23 @@ int SaiPlayer::replay()
                 api = SAI_COMMON_API_GET;
                 break;
             case 'q':
-                // TODO: implement SAI player support for query commands
+                if (isStatsQuery(line))
+                {
+                    std::string response;
+
+                    do
+                    {
+                        // this line may be notification, we need to skip
+                        if (!readLine(response))
+                        {
+                            SWSS_LOG_THROW("failed to read next file from file, previous: %s", line.c_str());
+                        }
+                    }
+                    while (response[response.find_first_of("|") + 1] == 'n');
+
+                    performStatsQuery(line, response);
+                }
+                // TODO: implement SAI player support for capability query commands
                 continue;
             case 'Q':
                 continue; // skip over query responses
@@ -2724,7 +2914,7 @@ int SaiPlayer::replay()
             do
             {
                 // this line may be notification, we need to skip
-                std::getline(infile, response);
+                readLine(response);
             }
             while (response[response.find_first_of("|") + 1] == 'n');
 
@@ -2771,6 +2961,8 @@ int SaiPlayer::replay()
 
     infile.close();
 
+    reader = nullptr;
+
     SWSS_LOG_NOTICE("finished replaying %s with SUCCESS", filename.c_str());
 
     if (m_commandLineOptions->m_sleep)
@@ -78,6 +78,13 @@ namespace saiplayer
                     _In_ const std::string& request,
                     _In_ const std::string& response);
 
+            bool isStatsQuery(
+                    _In_ const std::string& line);
+
+            void performStatsQuery(
+                    _In_ const std::string& request,
+                    _In_ const std::string& response);
+
             void performSleep(
                     _In_ const std::string& line);
 
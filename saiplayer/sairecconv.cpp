@@ -0,0 +1,251 @@
+#include "BinaryRecordingEncoder.h"
+#include "BinaryRecordingReader.h"
+
+#include "swss/logger.h"
+
+#include <getopt.h>
+
+#include <iostream>
+#include <fstream>
+#include <string>
+
+using namespace sairedis;
+
+struct CmdOptions
+{
+    uint64_t start;
+    uint64_t end;
+    std::string input;
+    std::string output;
+};
+
+static void printUsage()
+{
+    SWSS_LOG_ENTER();
+
+    std::cout << "Usage: sairecconv [-s timestamp] [-e timestamp] [-h] input output" << std::endl << std::endl;
+    std::cout << "    Converts binary recording to text recording, or text recording to binary" << std::endl;
+    std::cout << "    recording, input format is detected from file content." << std::endl << std::endl;
+    std::cout << "    -s --start:" << std::endl;
+    std::cout << "        Skip records older than timestamp, like 2024-01-31.12:34:56.000000." << std::endl;
+    std::cout << "        Binary input is not scanned, start is found using sync points" << std::endl << std::endl;
+    std::cout << "    -e --end:" << std::endl;
+    std::cout << "        Stop at first record newer than timestamp" << std::endl << std::endl;
+    std::cout << "    -h --help:" << std::endl;
+    std::cout << "        Print out this message" << std::endl << std::endl;
+}
+
+static CmdOptions handleCmdLine(
+        _In_ int argc,
+        _In_ char **argv)
+{
+    SWSS_LOG_ENTER();
+
+    CmdOptions options;
+
+    options.start = 0;
+    options.end = UINT64_MAX;
+
+    const char* const optstring = "s:e:h";
+
+    while (true)
+    {
+        static struct option long_options[] =
+        {
+            { "start",  required_argument, 0, 's' },
+            { "end",    required_argument, 0, 'e' },
+            { "help",   no_argument,       0, 'h' },
+            { 0,        0,                 0, 0   }
+        };
+
+        int option_index = 0;
+
+        int c = getopt_long(argc, argv, optstring, long_options, &option_index);
+
+        if (c == -1)
+        {
+            break;
+        }
+
+        switch (c)
+        {
+            case 's':
+                options.start = BinaryRecordingEncoder::parseTimestamp(optarg);
+                break;
+
+            case 'e':
+                options.end = BinaryRecordingEncoder::parseTimestamp(optarg);
+                break;
+
+            case 'h':
+                printUsage();
+                exit(EXIT_SUCCESS);
+
+            case '?':
+                printUsage();
+                exit(EXIT_FAILURE);
+
+            default:
+                SWSS_LOG_ERROR("getopt_long failure");
+                exit(EXIT_FAILURE);
+        }
+    }
+
+    if (argc - optind != 2)
+    {
+        printUsage();
+        exit(EXIT_FAILURE);
+    }
+
+    options.input = argv[optind];
+    options.output = argv[optind + 1];
+
+    return options;
+}
+
+static void binaryToText(
+        _In_ const CmdOptions& options)
+{
+    SWSS_LOG_ENTER();
+
+    BinaryRecordingReader reader(options.input);
+
+    std::ofstream out(options.output);
+
+    if (!out.is_open())
+    {
+        SWSS_LOG_THROW("failed to open %s", options.output.c_str());
+    }
+
+    if (options.start)
+    {
+        reader.seek(options.start);
+    }
+
+    std::string line;
+
+    while (reader.next(line))
+    {
+        if (reader.getTimestamp() > options.end)
+        {
+            break;
+        }
+
+        out << line << "\n";
+    }
+
+    out.close();
+
+    if (out.fail())
+    {
+        SWSS_LOG_THROW("failed to write %s", options.output.c_str());
+    }
+}
+
+static void textToBinary(
+        _In_ const CmdOptions& options)
+{
+    SWSS_LOG_ENTER();
+
+    std::ifstream in(options.input);
+
+    if (!in.is_open())
+    {
+        SWSS_LOG_THROW("failed to open %s", options.input.c_str());
+    }
+
+    std::ofstream out(options.output, std::ios::out | std::ios::trunc | std::ios::binary);
+
+    if (!out.is_open())
+    {
+        SWSS_LOG_THROW("failed to open %s", options.output.c_str());
+    }
+
+    BinaryRecordingEncoder encoder;
+
+    std::string buffer;
+
+    encoder.begin(true, buffer);
+
+    std::string line;
+
+    size_t lineNumber = 0;
+
+    while (std::getline(in, line))
+    {
+        lineNumber++;
+
+        if (line.empty())
+        {
+            continue;
+        }
+
+        try
+        {
+            uint64_t timestamp = BinaryRecordingEncoder::parseTimestamp(line.substr(0, line.find('|')));
+
+            if (timestamp < options.start)
+            {
+                continue;
+            }
+
+            if (timestamp > options.end)
+            {
+                break;
+            }
+
+            encoder.encode(line.data(), line.size(), buffer);
+        }
+        catch (const std::exception& e)
+        {
+            SWSS_LOG_THROW("line %zu: %s", lineNumber, e.what());
+        }
+
+        if (buffer.size() >= BinaryRecordingEncoder::SYNC_INTERVAL)
+        {
+            out.write(buffer.data(), (std::streamsize)buffer.size());
+
+            buffer.clear();
+        }
+    }
+
+    out.write(buffer.data(), (std::streamsize)buffer.size());
+
+    out.close();
+
+    if (out.fail())
+    {
+        SWSS_LOG_THROW("failed to write %s", options.output.c_str());
+    }
+}
+
+int main(int argc, char **argv)
+{
+    swss::Logger::getInstance().setMinPrio(swss::Logger::SWSS_DEBUG);
+
+    SWSS_LOG_ENTER();
+
+    swss::Logger::getInstance().setMinPrio(swss::Logger::SWSS_NOTICE);
+
+    try
+    {
+        auto options = handleCmdLine(argc, argv);
+
+        if (BinaryRecordingReader::isBinaryRecording(options.input))
+        {
+            binaryToText(options);
+        }
+        else
+        {
+            textToBinary(options);
+        }
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "ERR: " << e.what() << std::endl;
+
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -178,7 +178,7 @@ void CommandLineOptionsParser::printUsage()
     std::cout << "    -s --syncMode" << std::endl;
     std::cout << "        Enable synchronous mode (depreacated, use -z)" << std::endl;
     std::cout << "    -z --redisCommunicationMode" << std::endl;
-    std::cout << "        Redis communication mode (redis_async|redis_sync|zmq_sync), default: redis_async" << std::endl;
+    std::cout << "        Redis communication mode (redis_async|redis_sync|zmq_sync|zmq_v2_sync|shm_sync), default: redis_async" << std::endl;
     std::cout << "    -l --enableBulk" << std::endl;
     std::cout << "        Enable SAI Bulk support" << std::endl;
     std::cout << "    -g --globalContext" << std::endl;
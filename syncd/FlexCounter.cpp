@@ -536,9 +536,11 @@ public:
             }
 
             std::vector<swss::FieldValueTuple> values;
+            values.reserve(statIds.size());
             for (size_t i = 0; i != statIds.size(); i++)
             {
-                values.emplace_back(serializeStat(statIds[i]), std::to_string(stats[i]));
+                values.emplace_back(serializeStat(statIds[i]), std::string());
+                sai_serialize_number(fvValue(values.back()), stats[i]);
             }
             countersTable.set(sai_serialize_object_id(vid), values, "");
         }
@@ -694,7 +696,17 @@ private:
             SWSS_LOG_WARN("Failed to bulk get stats for %s: %u", m_name.c_str(), status);
         }
 
+        // counter names are the same for all objects, serialize them once
+        // and only replace values, so field strings are reused
+
         std::vector<swss::FieldValueTuple> values;
+        values.reserve(ctx.counter_ids.size());
+        for (const auto &counterId: ctx.counter_ids)
+        {
+            values.emplace_back(serializeStat(counterId), std::string());
+        }
+
+        std::string key;
         for (size_t i = 0; i < ctx.object_keys.size(); i++)
         {
             if (SAI_STATUS_SUCCESS != ctx.object_statuses[i])
@@ -706,10 +718,13 @@ private:
 
             for (size_t j = 0; j < ctx.counter_ids.size(); j++)
             {
-                values.emplace_back(serializeStat(ctx.counter_ids[j]), std::to_string(ctx.counters[i * ctx.counter_ids.size() + j]));
+                auto &value = fvValue(values[j]);
+                value.clear();
+                sai_serialize_number(value, ctx.counters[i * ctx.counter_ids.size() + j]);
             }
-            countersTable.set(sai_serialize_object_id(vid), values, "");
-            values.clear();
+            key.clear();
+            sai_serialize_object_id(key, vid);
+            countersTable.set(key, values, "");
         }
     }
 
@@ -0,0 +1,29 @@
+#include "SharedMemoryNotificationProducer.h"
+
+#include "swss/logger.h"
+
+using namespace syncd;
+
+SharedMemoryNotificationProducer::SharedMemoryNotificationProducer(
+        _In_ std::shared_ptr<sairedis::SharedMemorySelectableChannel> channel):
+    m_channel(channel)
+{
+    SWSS_LOG_ENTER();
+
+    if (!channel)
+    {
+        SWSS_LOG_THROW("channel can't be nullptr");
+    }
+}
+
+void SharedMemoryNotificationProducer::send(
+        _In_ const std::string& op,
+        _In_ const std::string& data,
+        _In_ const std::vector<swss::FieldValueTuple>& values)
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_DEBUG("sending: %s: %s", op.c_str(), data.c_str());
+
+    m_channel->sendNotification(op, data, values);
+}
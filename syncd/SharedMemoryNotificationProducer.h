@@ -0,0 +1,36 @@
+#pragma once
+
+#include "NotificationProducerBase.h"
+
+#include "meta/SharedMemorySelectableChannel.h"
+
+#include <memory>
+
+namespace syncd
+{
+    /**
+     * @brief Sends notifications over notification ring of shared memory
+     * channel.
+     */
+    class SharedMemoryNotificationProducer:
+        public NotificationProducerBase
+    {
+        public:
+
+            SharedMemoryNotificationProducer(
+                    _In_ std::shared_ptr<sairedis::SharedMemorySelectableChannel> channel);
+
+            virtual ~SharedMemoryNotificationProducer() = default;
+
+        public:
+
+            virtual void send(
+                    _In_ const std::string& op,
+                    _In_ const std::string& data,
+                    _In_ const std::vector<swss::FieldValueTuple>& values) override;
+
+        private:
+
+            std::shared_ptr<sairedis::SharedMemorySelectableChannel> m_channel;
+    };
+}
@@ -11,6 +11,7 @@
 #include "BreakConfigParser.h"
 #include "RedisNotificationProducer.h"
 #include "ZeroMQNotificationProducer.h"
+#include "SharedMemoryNotificationProducer.h"
 #include "WatchdogScope.h"
 
 #include "sairediscommon.h"
@@ -23,6 +24,8 @@
 
 #include "meta/sai_serialize.h"
 #include "meta/ZeroMQSelectableChannel.h"
+#include "meta/ZeroMQBinarySelectableChannel.h"
+#include "meta/SharedMemorySelectableChannel.h"
 #include "meta/RedisSelectableChannel.h"
 #include "meta/PerformanceIntervalTimer.h"
 
@@ -100,7 +103,8 @@ Syncd::Syncd(
         m_commandLineOptions->m_redisCommunicationMode = SAI_REDIS_COMMUNICATION_MODE_REDIS_SYNC;
     }
 
-    if (m_commandLineOptions->m_redisCommunicationMode == SAI_REDIS_COMMUNICATION_MODE_ZMQ_SYNC)
+    if (m_commandLineOptions->m_redisCommunicationMode == SAI_REDIS_COMMUNICATION_MODE_ZMQ_SYNC ||
+            m_commandLineOptions->m_redisCommunicationMode == SAI_REDIS_COMMUNICATION_MODE_ZMQ_V2_SYNC)
     {
         SWSS_LOG_NOTICE("zmq sync mode enabled via cmd line");
 
@@ -109,6 +113,15 @@ Syncd::Syncd(
         m_enableSyncMode = true;
     }
 
+    if (m_commandLineOptions->m_redisCommunicationMode == SAI_REDIS_COMMUNICATION_MODE_SHM_SYNC)
+    {
+        SWSS_LOG_NOTICE("shared memory sync mode enabled via cmd line");
+
+        m_contextConfig->m_zmqEnable = false;
+
+        m_enableSyncMode = true;
+    }
+
     m_manager = std::make_shared<FlexCounterManager>(m_vendorSai, m_contextConfig->m_dbCounters);
 
     loadProfileMap();
@@ -120,7 +133,15 @@ Syncd::Syncd(
     m_dbAsic = std::make_shared<swss::DBConnector>(m_contextConfig->m_dbAsic, 0);
     m_mdioIpcServer = std::make_shared<MdioIpcServer>(m_vendorSai, m_commandLineOptions->m_globalContext);
 
-    if (m_contextConfig->m_zmqEnable)
+    if (m_commandLineOptions->m_redisCommunicationMode == SAI_REDIS_COMMUNICATION_MODE_SHM_SYNC)
+    {
+        auto channel = std::make_shared<sairedis::SharedMemorySelectableChannel>(m_contextConfig->m_shmEndpoint);
+
+        m_notifications = std::make_shared<SharedMemoryNotificationProducer>(channel);
+
+        m_selectableChannel = channel;
+    }
+    else if (m_contextConfig->m_zmqEnable)
     {
         m_notifications = std::make_shared<ZeroMQNotificationProducer>(m_contextConfig->m_zmqNtfEndpoint);
 
@@ -128,7 +149,16 @@ Syncd::Syncd(
 
         m_enableSyncMode = true;
 
-        m_selectableChannel = std::make_shared<sairedis::ZeroMQSelectableChannel>(m_contextConfig->m_zmqEndpoint);
+        if (m_commandLineOptions->m_redisCommunicationMode == SAI_REDIS_COMMUNICATION_MODE_ZMQ_V2_SYNC)
+        {
+            SWSS_LOG_NOTICE("using zmq v2 binary protocol");
+
+            m_selectableChannel = std::make_shared<sairedis::ZeroMQBinarySelectableChannel>(m_contextConfig->m_zmqEndpoint);
+        }
+        else
+        {
+            m_selectableChannel = std::make_shared<sairedis::ZeroMQSelectableChannel>(m_contextConfig->m_zmqEndpoint);
+        }
     }
     else
     {
@@ -371,6 +401,15 @@ sai_status_t Syncd::processSingleEvent(
     if (op == REDIS_ASIC_STATE_COMMAND_CLEAR_STATS)
         return processClearStatsEvent(kco);
 
+    if (op == REDIS_ASIC_STATE_COMMAND_GET_STATS_EXT)
+        return processGetStatsEvent(kco);
+
+    if (op == REDIS_ASIC_STATE_COMMAND_BULK_GET_STATS)
+        return processBulkStatsEvent(kco);
+
+    if (op == REDIS_ASIC_STATE_COMMAND_BULK_CLEAR_STATS)
+        return processBulkStatsEvent(kco);
+
     if (op == REDIS_ASIC_STATE_COMMAND_FLUSH)
         return processFdbFlush(kco);
 
@@ -383,6 +422,9 @@ sai_status_t Syncd::processSingleEvent(
     if (op == REDIS_ASIC_STATE_COMMAND_OBJECT_TYPE_GET_AVAILABILITY_QUERY)
         return processObjectTypeGetAvailabilityQuery(kco);
 
+    if (op == REDIS_ASIC_STATE_COMMAND_STATS_CAPABILITY_QUERY)
+        return processStatsCapabilityQuery(kco);
+
     if (op == REDIS_FLEX_COUNTER_COMMAND_START_POLL)
         return processFlexCounterEvent(key, SET_COMMAND, kfvFieldsValues(kco));
 
@@ -580,6 +622,86 @@ sai_status_t Syncd::processObjectTypeGetAvailabilityQuery(
     return status;
 }
 
+sai_status_t Syncd::processStatsCapabilityQuery(
+        _In_ const swss::KeyOpFieldsValuesTuple &kco)
+{
+    SWSS_LOG_ENTER();
+
+    auto& strSwitchVid = kfvKey(kco);
+
+    sai_object_id_t switchVid;
+    sai_deserialize_object_id(strSwitchVid, switchVid);
+
+    sai_object_id_t switchRid = m_translator->translateVidToRid(switchVid);
+
+    auto& values = kfvFieldsValues(kco);
+
+    if (values.size() != 2)
+    {
+        SWSS_LOG_ERROR("Invalid input: expected 2 arguments, received %zu", values.size());
+
+        m_selectableChannel->set(sai_serialize_status(SAI_STATUS_INVALID_PARAMETER), {}, REDIS_ASIC_STATE_COMMAND_STATS_CAPABILITY_RESPONSE);
+
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    sai_object_type_t objectType;
+    sai_deserialize_object_type(fvValue(values[0]), objectType);
+
+    uint32_t list_size = (uint32_t)std::stoul(fvValue(values[1]));
+
+    std::vector<sai_stat_capability_t> stat_capability_list(list_size);
+
+    sai_stat_capability_list_t statCapList;
+
+    statCapList.count = list_size;
+    statCapList.list = stat_capability_list.data();
+
+    sai_status_t status = m_vendorSai->queryStatsCapability(switchRid, objectType, &statCapList);
+
+    std::vector<swss::FieldValueTuple> entry;
+
+    if (status == SAI_STATUS_SUCCESS)
+    {
+        std::string strEnums;
+        std::string strModes;
+
+        for (uint32_t idx = 0; idx < statCapList.count; idx++)
+        {
+            if (idx)
+            {
+                strEnums += ',';
+                strModes += ',';
+            }
+
+            strEnums += std::to_string(statCapList.list[idx].stat_enum);
+            strModes += std::to_string(statCapList.list[idx].stat_modes);
+        }
+
+        entry =
+        {
+            swss::FieldValueTuple("STAT_ENUM", strEnums),
+            swss::FieldValueTuple("STAT_MODES", strModes),
+            swss::FieldValueTuple("STAT_COUNT", std::to_string(statCapList.count))
+        };
+
+        SWSS_LOG_DEBUG("Sending response: stat enums = '%s', count = %u", strEnums.c_str(), statCapList.count);
+    }
+    else if (status == SAI_STATUS_BUFFER_OVERFLOW)
+    {
+        entry =
+        {
+            swss::FieldValueTuple("STAT_COUNT", std::to_string(statCapList.count))
+        };
+
+        SWSS_LOG_DEBUG("Sending response: count = %u", statCapList.count);
+    }
+
+    m_selectableChannel->set(sai_serialize_status(status), entry, REDIS_ASIC_STATE_COMMAND_STATS_CAPABILITY_RESPONSE);
+
+    return status;
+}
+
 sai_status_t Syncd::processFdbFlush(
         _In_ const swss::KeyOpFieldsValuesTuple &kco)
 {
@@ -752,9 +874,29 @@ sai_status_t Syncd::processGetStatsEvent(
         SWSS_LOG_THROW("non object id not supported on clear stats: %s, FIXME", key.c_str());
     }
 
+    auto values = kfvFieldsValues(kco);
+
+    // get_stats_ext carries mode as first argument
+
+    bool ext = (kfvOp(kco) == REDIS_ASIC_STATE_COMMAND_GET_STATS_EXT);
+
+    int32_t mode = SAI_STATS_MODE_READ;
+
+    if (ext)
+    {
+        if (values.empty() || fvField(values[0]) != REDIS_STATS_MODE_FIELD)
+        {
+            SWSS_LOG_THROW("get stats ext on %s is missing %s argument", key.c_str(), REDIS_STATS_MODE_FIELD);
+        }
+
+        sai_deserialize_enum(fvValue(values[0]), &sai_metadata_enum_sai_stats_mode_t, mode);
+
+        values.erase(values.begin());
+    }
+
     std::vector<sai_stat_id_t> counter_ids;
 
-    for (auto&v: kfvFieldsValues(kco))
+    for (auto&v: values)
     {
         int32_t val;
         sai_deserialize_enum(fvField(v), info->statenum, val);
@@ -764,12 +906,27 @@ sai_status_t Syncd::processGetStatsEvent(
 
     std::vector<uint64_t> result(counter_ids.size());
 
-    auto status = m_vendorSai->getStats(
-            metaKey.objecttype,
-            metaKey.objectkey.key.object_id,
-            (uint32_t)counter_ids.size(),
-            counter_ids.data(),
-            result.data());
+    sai_status_t status;
+
+    if (ext)
+    {
+        status = m_vendorSai->getStatsExt(
+                metaKey.objecttype,
+                metaKey.objectkey.key.object_id,
+                (uint32_t)counter_ids.size(),
+                counter_ids.data(),
+                (sai_stats_mode_t)mode,
+                result.data());
+    }
+    else
+    {
+        status = m_vendorSai->getStats(
+                metaKey.objecttype,
+                metaKey.objectkey.key.object_id,
+                (uint32_t)counter_ids.size(),
+                counter_ids.data(),
+                result.data());
+    }
 
     std::vector<swss::FieldValueTuple> entry;
 
@@ -779,8 +936,6 @@ sai_status_t Syncd::processGetStatsEvent(
     }
     else
     {
-        const auto& values = kfvFieldsValues(kco);
-
         for (size_t i = 0; i < values.size(); i++)
         {
             entry.emplace_back(fvField(values[i]), std::to_string(result[i]));
@@ -792,6 +947,198 @@ sai_status_t Syncd::processGetStatsEvent(
     return status;
 }
 
+sai_status_t Syncd::processBulkStatsEvent(
+        _In_ const swss::KeyOpFieldsValuesTuple &kco)
+{
+    SWSS_LOG_ENTER();
+
+    const std::string &key = kfvKey(kco);
+
+    bool clear = (kfvOp(kco) == REDIS_ASIC_STATE_COMMAND_BULK_CLEAR_STATS);
+
+    // object_type:switch_vid
+
+    auto start = key.find_first_of(":");
+
+    if (start == std::string::npos)
+    {
+        SWSS_LOG_THROW("invalid bulk stats key: %s", key.c_str());
+    }
+
+    sai_object_type_t objectType;
+    sai_deserialize_object_type(key.substr(0, start), objectType);
+
+    sai_object_id_t switchVid;
+    sai_deserialize_object_id(key.substr(start + 1), switchVid);
+
+    auto info = sai_metadata_get_object_type_info(objectType);
+
+    if (info->isnonobjectid || info->statenum == nullptr)
+    {
+        SWSS_LOG_THROW("bulk stats not supported on: %s, FIXME", key.c_str());
+    }
+
+    // mode, counter ids, then one field per object
+
+    auto& values = kfvFieldsValues(kco);
+
+    if (values.size() < 3 ||
+            fvField(values[0]) != REDIS_STATS_MODE_FIELD ||
+            fvField(values[1]) != REDIS_STATS_COUNTERS_FIELD)
+    {
+        SWSS_LOG_THROW("invalid bulk stats arguments on: %s", key.c_str());
+    }
+
+    int32_t mode;
+    sai_deserialize_enum(fvValue(values[0]), &sai_metadata_enum_sai_stats_mode_t, mode);
+
+    std::vector<sai_stat_id_t> counterIds;
+
+    for (auto& name: swss::tokenize(fvValue(values[1]), ','))
+    {
+        int32_t val;
+        sai_deserialize_enum(name, info->statenum, val);
+
+        counterIds.push_back((sai_stat_id_t)val);
+    }
+
+    uint32_t objectCount = (uint32_t)(values.size() - 2);
+    uint32_t counterCount = (uint32_t)counterIds.size();
+
+    std::vector<sai_object_key_t> objectKeys(objectCount);
+    std::vector<sai_status_t> statuses(objectCount, SAI_STATUS_NOT_EXECUTED);
+    std::vector<uint64_t> counters(clear ? 0 : (size_t)objectCount * counterCount);
+
+    sai_status_t status = SAI_STATUS_SUCCESS;
+
+    for (uint32_t idx = 0; idx < objectCount; idx++)
+    {
+        sai_object_id_t vid;
+        sai_deserialize_object_id(fvField(values[idx + 2]), vid);
+
+        if (isInitViewMode() && m_createdInInitView.find(vid) != m_createdInInitView.end())
+        {
+            SWSS_LOG_WARN("BULK STATS api can't be used on %s since it's created in INIT_VIEW mode",
+                    fvField(values[idx + 2]).c_str());
+
+            status = SAI_STATUS_INVALID_OBJECT_ID;
+            break;
+        }
+
+        if (!m_translator->tryTranslateVidToRid(vid, objectKeys[idx].key.object_id))
+        {
+            SWSS_LOG_WARN("VID to RID translation failure: %s", fvField(values[idx + 2]).c_str());
+
+            status = SAI_STATUS_INVALID_OBJECT_ID;
+            break;
+        }
+    }
+
+    if (status != SAI_STATUS_SUCCESS)
+    {
+        m_selectableChannel->set(sai_serialize_status(status), {}, REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
+
+        return status;
+    }
+
+    sai_object_id_t switchRid = m_translator->translateVidToRid(switchVid);
+
+    if (clear)
+    {
+        status = m_vendorSai->bulkClearStats(
+                switchRid,
+                objectType,
+                objectCount,
+                objectKeys.data(),
+                counterCount,
+                counterIds.data(),
+                (sai_stats_mode_t)mode,
+                statuses.data());
+    }
+    else
+    {
+        status = m_vendorSai->bulkGetStats(
+                switchRid,
+                objectType,
+                objectCount,
+                objectKeys.data(),
+                counterCount,
+                counterIds.data(),
+                (sai_stats_mode_t)mode,
+                statuses.data(),
+                counters.data());
+    }
+
+    if (status == SAI_STATUS_NOT_IMPLEMENTED || status == SAI_STATUS_NOT_SUPPORTED)
+    {
+        /*
+         * Vendor don't support bulk stats, read objects one by one here, so
+         * client still needs only single round trip.
+         */
+
+        SWSS_LOG_INFO("vendor bulk stats returned %s, falling back to per object stats",
+                sai_serialize_status(status).c_str());
+
+        status = SAI_STATUS_SUCCESS;
+
+        for (uint32_t idx = 0; idx < objectCount; idx++)
+        {
+            auto rid = objectKeys[idx].key.object_id;
+
+            if (clear)
+            {
+                statuses[idx] = m_vendorSai->clearStats(objectType, rid, counterCount, counterIds.data());
+            }
+            else if (mode == SAI_STATS_MODE_READ || mode == SAI_STATS_MODE_BULK_READ)
+            {
+                statuses[idx] = m_vendorSai->getStats(objectType, rid, counterCount, counterIds.data(), &counters[(size_t)idx * counterCount]);
+            }
+            else
+            {
+                statuses[idx] = m_vendorSai->getStatsExt(objectType, rid, counterCount, counterIds.data(),
+                        SAI_STATS_MODE_READ_AND_CLEAR, &counters[(size_t)idx * counterCount]);
+            }
+
+            if (statuses[idx] != SAI_STATUS_SUCCESS)
+            {
+                status = SAI_STATUS_FAILURE;
+            }
+        }
+    }
+
+    if (status != SAI_STATUS_SUCCESS)
+    {
+        SWSS_LOG_NOTICE("Bulk %s stats error: %s", clear ? "clear" : "get", sai_serialize_status(status).c_str());
+    }
+
+    // each object: status=counter,counter,...
+
+    std::vector<swss::FieldValueTuple> entry;
+
+    entry.reserve(objectCount);
+
+    for (uint32_t idx = 0; idx < objectCount; idx++)
+    {
+        std::string joined;
+
+        for (uint32_t cnt = 0; !clear && statuses[idx] == SAI_STATUS_SUCCESS && cnt < counterCount; cnt++)
+        {
+            if (cnt)
+            {
+                joined += ',';
+            }
+
+            sai_serialize_number(joined, counters[(size_t)idx * counterCount + cnt]);
+        }
+
+        entry.emplace_back(sai_serialize_status(statuses[idx]), joined);
+    }
+
+    m_selectableChannel->set(sai_serialize_status(status), entry, REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
+
+    return status;
+}
+
 sai_status_t Syncd::processBulkQuadEvent(
         _In_ sai_common_api_t api,
         _In_ const swss::KeyOpFieldsValuesTuple &kco)
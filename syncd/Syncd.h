@@ -136,6 +136,9 @@ namespace syncd
             sai_status_t processObjectTypeGetAvailabilityQuery(
                     _In_ const swss::KeyOpFieldsValuesTuple &kco);
 
+            sai_status_t processStatsCapabilityQuery(
+                    _In_ const swss::KeyOpFieldsValuesTuple &kco);
+
             sai_status_t processFdbFlush(
                     _In_ const swss::KeyOpFieldsValuesTuple &kco);
 
@@ -145,6 +148,9 @@ namespace syncd
             sai_status_t processGetStatsEvent(
                     _In_ const swss::KeyOpFieldsValuesTuple &kco);
 
+            sai_status_t processBulkStatsEvent(
+                    _In_ const swss::KeyOpFieldsValuesTuple &kco);
+
             sai_status_t processQuadEvent(
                     _In_ sai_common_api_t api,
                     _In_ const swss::KeyOpFieldsValuesTuple &kco);
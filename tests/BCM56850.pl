@@ -546,6 +546,13 @@ sub test_brcm_query_object_type_get_availability
     play "query_object_type_get_availability.rec";
 }
 
+sub test_brcm_stats_query
+{
+    fresh_start;
+
+    play "stats_query.rec";
+}
+
 sub test_brcm_acl_limit
 {
     fresh_start("-b", "$utils::DIR/bbm.ini", "-p", "$utils::DIR/vsprofile_acl_limit.ini");
@@ -911,6 +918,7 @@ test_brcm_full_to_empty_hostif_remove_segfault;
 test_brcm_full_to_empty_no_queue_no_ipg_no_buffer_profile;
 test_brcm_query_attr_enum_values_capability;
 test_brcm_query_object_type_get_availability;
+test_brcm_stats_query;
 test_voq_switch_create;
 
 kill_syncd;
@@ -0,0 +1,210 @@
+#include "SaiBench.h"
+
+#include "swss/logger.h"
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <iostream>
+
+#include <unistd.h>
+
+using json = nlohmann::json;
+
+SaiBench::State::State(
+        _In_ uint64_t iters):
+    iterations(iters),
+    m_start(std::chrono::high_resolution_clock::now()),
+    m_elapsedNs(0),
+    m_running(true)
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+void SaiBench::State::pauseTiming()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_running)
+    {
+        auto end = std::chrono::high_resolution_clock::now();
+
+        m_elapsedNs += std::chrono::duration_cast<std::chrono::nanoseconds>(end - m_start).count();
+
+        m_running = false;
+    }
+}
+
+void SaiBench::State::resumeTiming()
+{
+    SWSS_LOG_ENTER();
+
+    if (!m_running)
+    {
+        m_start = std::chrono::high_resolution_clock::now();
+
+        m_running = true;
+    }
+}
+
+uint64_t SaiBench::State::getElapsedNs() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_elapsedNs;
+}
+
+SaiBench::SaiBench(
+        _In_ uint32_t repetitions,
+        _In_ double minTimeMs,
+        _In_ const std::string& filter):
+    m_repetitions(std::max(repetitions, 1u)),
+    m_minTimeMs(minTimeMs),
+    m_filter(filter)
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+void SaiBench::add(
+        _In_ const std::string& name,
+        _In_ const Benchmark& benchmark)
+{
+    SWSS_LOG_ENTER();
+
+    if (name.find(m_filter) == std::string::npos)
+    {
+        return;
+    }
+
+    m_benchmarks.emplace_back(name, benchmark);
+}
+
+uint64_t SaiBench::calibrate(
+        _In_ const Benchmark& benchmark) const
+{
+    SWSS_LOG_ENTER();
+
+    uint64_t iterations = 1;
+
+    while (true)
+    {
+        State state(iterations);
+
+        benchmark(state);
+
+        state.pauseTiming();
+
+        double ms = (double)state.getElapsedNs() / 1000000;
+
+        if (ms >= m_minTimeMs || iterations >= (1ULL << 32))
+        {
+            return iterations;
+        }
+
+        // aim a bit above minimal time, but don't grow too fast on
+        // very short first runs
+
+        double factor = (ms > 0) ? (m_minTimeMs * 1.2 / ms) : 10.0;
+
+        factor = std::min(std::max(factor, 2.0), 10.0);
+
+        iterations = (uint64_t)((double)iterations * factor);
+    }
+}
+
+void SaiBench::run()
+{
+    SWSS_LOG_ENTER();
+
+    for (auto& b: m_benchmarks)
+    {
+        const std::string& name = b.first;
+
+        uint64_t iterations = calibrate(b.second);
+
+        std::vector<double> nsPerOp;
+
+        for (uint32_t rep = 0; rep < m_repetitions; rep++)
+        {
+            State state(iterations);
+
+            b.second(state);
+
+            state.pauseTiming();
+
+            nsPerOp.push_back((double)state.getElapsedNs() / (double)iterations);
+        }
+
+        std::sort(nsPerOp.begin(), nsPerOp.end());
+
+        Result result;
+
+        result.name = name;
+        result.iterations = iterations;
+        result.repetitions = m_repetitions;
+        result.nsPerOpMin = nsPerOp.front();
+        result.nsPerOpMedian = nsPerOp[nsPerOp.size() / 2];
+        result.nsPerOpMax = nsPerOp.back();
+
+        std::cerr << name << ": " << result.nsPerOpMedian << " ns/op" << std::endl;
+
+        m_results.push_back(result);
+    }
+}
+
+void SaiBench::list() const
+{
+    SWSS_LOG_ENTER();
+
+    for (auto& b: m_benchmarks)
+    {
+        std::cout << b.first << std::endl;
+    }
+}
+
+const std::vector<SaiBench::Result>& SaiBench::getResults() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_results;
+}
+
+std::string SaiBench::toJson() const
+{
+    SWSS_LOG_ENTER();
+
+    char hostname[256] = { 0 };
+
+    gethostname(hostname, sizeof(hostname) - 1);
+
+    json j;
+
+    j["context"]["host"] = hostname;
+    j["context"]["repetitions"] = m_repetitions;
+    j["context"]["min_time_ms"] = m_minTimeMs;
+    j["context"]["filter"] = m_filter;
+
+    json arr = json::array();
+
+    for (auto& r: m_results)
+    {
+        json item;
+
+        item["name"] = r.name;
+        item["iterations"] = r.iterations;
+        item["repetitions"] = r.repetitions;
+        item["ns_per_op_min"] = r.nsPerOpMin;
+        item["ns_per_op_median"] = r.nsPerOpMedian;
+        item["ns_per_op_max"] = r.nsPerOpMax;
+
+        arr.push_back(item);
+    }
+
+    j["benchmarks"] = arr;
+
+    return j.dump(4);
+}
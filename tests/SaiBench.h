@@ -0,0 +1,128 @@
+#pragma once
+
+#include "swss/sal.h"
+
+#include <string>
+#include <vector>
+#include <functional>
+#include <chrono>
+#include <cstdint>
+
+/**
+ * @brief Micro benchmark harness.
+ *
+ * Each benchmark is calibrated to run for at least minimal time, then it
+ * is executed given number of repetitions and min/median/max time per
+ * operation is reported, so results are comparable between runs.
+ */
+class SaiBench
+{
+    public:
+
+        class State
+        {
+            public:
+
+                State(
+                        _In_ uint64_t iterations);
+
+            public:
+
+                /**
+                 * @brief Exclude setup/cleanup code from measured time.
+                 */
+                void pauseTiming();
+
+                void resumeTiming();
+
+                uint64_t getElapsedNs() const;
+
+            public:
+
+                const uint64_t iterations;
+
+            private:
+
+                std::chrono::high_resolution_clock::time_point m_start;
+
+                uint64_t m_elapsedNs;
+
+                bool m_running;
+        };
+
+        typedef std::function<void(State&)> Benchmark;
+
+        typedef struct _Result
+        {
+            std::string name;
+
+            uint64_t iterations;
+
+            uint32_t repetitions;
+
+            double nsPerOpMin;
+
+            double nsPerOpMedian;
+
+            double nsPerOpMax;
+
+        } Result;
+
+    public:
+
+        SaiBench(
+                _In_ uint32_t repetitions,
+                _In_ double minTimeMs,
+                _In_ const std::string& filter);
+
+        virtual ~SaiBench() = default;
+
+    public:
+
+        /**
+         * @brief Register benchmark, name should be in form "group/op/type".
+         */
+        void add(
+                _In_ const std::string& name,
+                _In_ const Benchmark& benchmark);
+
+        /**
+         * @brief Run all benchmarks which name contains filter.
+         */
+        void run();
+
+        void list() const;
+
+        const std::vector<Result>& getResults() const;
+
+        std::string toJson() const;
+
+        /**
+         * @brief Prevent compiler from optimizing out computed value.
+         */
+        template <typename T>
+        static void doNotOptimize(
+                _In_ const T& value)
+        {
+            // SWSS_LOG_ENTER() omitted, used in measured loops
+
+            asm volatile("" : : "r,m"(value) : "memory");
+        }
+
+    private:
+
+        uint64_t calibrate(
+                _In_ const Benchmark& benchmark) const;
+
+    private:
+
+        uint32_t m_repetitions;
+
+        double m_minTimeMs;
+
+        std::string m_filter;
+
+        std::vector<std::pair<std::string, Benchmark>> m_benchmarks;
+
+        std::vector<Result> m_results;
+};
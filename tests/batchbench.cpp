@@ -0,0 +1,266 @@
+#include "Sai.h"
+#include "sairedis.h"
+
+#include "meta/sai_serialize.h"
+
+#include "swss/logger.h"
+
+#include <getopt.h>
+#include <string.h>
+#include <arpa/inet.h>
+
+#include <chrono>
+#include <iostream>
+#include <vector>
+#include <memory>
+
+/*
+ * Measures throughput of route entry create/remove sent one by one through
+ * libsairedis, with and without SAI_REDIS_SWITCH_ATTR_AUTO_BATCH_SIZE.
+ *
+ * Requires running redis and syncd with virtual switch, for example:
+ *
+ * ./vssyncd -SUu -l -p BCM56850/vsprofile.ini &
+ * ./batchbench -n 10000 -b 128
+ */
+
+#define ASSERT_SUCCESS(x) \
+    if ((x) != SAI_STATUS_SUCCESS) \
+{\
+    SWSS_LOG_THROW("expected success, line: %d, got: %s", __LINE__, sai_serialize_status(x).c_str());\
+}
+
+static const char* profile_get_value(
+        _In_ sai_switch_profile_id_t profile_id,
+        _In_ const char* variable)
+{
+    SWSS_LOG_ENTER();
+
+    return NULL;
+}
+
+static int profile_get_next_value(
+        _In_ sai_switch_profile_id_t profile_id,
+        _Out_ const char** variable,
+        _Out_ const char** value)
+{
+    SWSS_LOG_ENTER();
+
+    return -1;
+}
+
+static sai_service_method_table_t test_services = {
+    profile_get_value,
+    profile_get_next_value
+};
+
+static void set_redis_attr(
+        _In_ std::shared_ptr<sairedis::Sai> sai,
+        _In_ sai_attribute_t& attr)
+{
+    SWSS_LOG_ENTER();
+
+    ASSERT_SUCCESS(sai->set(SAI_OBJECT_TYPE_SWITCH, SAI_NULL_OBJECT_ID, &attr));
+}
+
+static void set_batch_size(
+        _In_ std::shared_ptr<sairedis::Sai> sai,
+        _In_ uint32_t batchSize)
+{
+    SWSS_LOG_ENTER();
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_REDIS_SWITCH_ATTR_AUTO_BATCH_SIZE;
+    attr.value.u32 = batchSize;
+
+    set_redis_attr(sai, attr);
+}
+
+/**
+ * @brief Wait until syncd processed all operations sent so far.
+ *
+ * Get is answered only after all previous messages were processed.
+ */
+static void sync_with_syncd(
+        _In_ std::shared_ptr<sairedis::Sai> sai,
+        _In_ sai_object_id_t switchId)
+{
+    SWSS_LOG_ENTER();
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_REDIS_SWITCH_ATTR_FLUSH;
+    attr.value.booldata = true;
+
+    set_redis_attr(sai, attr);
+
+    attr.id = SAI_SWITCH_ATTR_DEFAULT_VIRTUAL_ROUTER_ID;
+
+    ASSERT_SUCCESS(sai->get(SAI_OBJECT_TYPE_SWITCH, switchId, 1, &attr));
+}
+
+static void bench_routes(
+        _In_ std::shared_ptr<sairedis::Sai> sai,
+        _In_ sai_object_id_t switchId,
+        _In_ sai_object_id_t vrId,
+        _In_ uint32_t count,
+        _In_ uint32_t batchSize,
+        _In_ uint32_t base)
+{
+    SWSS_LOG_ENTER();
+
+    set_batch_size(sai, batchSize);
+
+    std::vector<sai_route_entry_t> routes(count);
+
+    for (uint32_t idx = 0; idx < count; idx++)
+    {
+        auto& r = routes[idx];
+
+        memset(&r, 0, sizeof(r));
+
+        r.switch_id = switchId;
+        r.vr_id = vrId;
+        r.destination.addr_family = SAI_IP_ADDR_FAMILY_IPV4;
+        r.destination.addr.ip4 = htonl(base + idx);
+        r.destination.mask.ip4 = 0xffffffff;
+    }
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION;
+    attr.value.s32 = SAI_PACKET_ACTION_DROP;
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    for (auto& r: routes)
+    {
+        ASSERT_SUCCESS(sai->create(&r, 1, &attr));
+    }
+
+    sync_with_syncd(sai, switchId);
+
+    auto mid = std::chrono::high_resolution_clock::now();
+
+    for (auto& r: routes)
+    {
+        ASSERT_SUCCESS(sai->remove(&r));
+    }
+
+    sync_with_syncd(sai, switchId);
+
+    auto end = std::chrono::high_resolution_clock::now();
+
+    auto create = std::chrono::duration_cast<std::chrono::microseconds>(mid - start).count();
+    auto remove = std::chrono::duration_cast<std::chrono::microseconds>(end - mid).count();
+
+    std::cout << "batch size " << batchSize << std::endl;
+    std::cout << "  create routes ms: " << create / 1000 << " / " << count
+        << " (" << (uint64_t)count * 1000000 / (uint64_t)(create ? create : 1) << " ops/s)" << std::endl;
+    std::cout << "  remove routes ms: " << remove / 1000 << " / " << count
+        << " (" << (uint64_t)count * 1000000 / (uint64_t)(remove ? remove : 1) << " ops/s)" << std::endl;
+}
+
+static void print_usage()
+{
+    SWSS_LOG_ENTER();
+
+    std::cout << "Usage: batchbench [-n count] [-b batch_size] [-h]" << std::endl << std::endl;
+    std::cout << "    -n --count count" << std::endl;
+    std::cout << "        Number of routes created and removed in each run, default 10000" << std::endl;
+    std::cout << "    -b --batchSize batch_size" << std::endl;
+    std::cout << "        Auto batch size compared with not batched run, default 128" << std::endl;
+    std::cout << "    -h --help" << std::endl;
+    std::cout << "        Print out this message" << std::endl;
+}
+
+int main(int argc, char **argv)
+{
+    SWSS_LOG_ENTER();
+
+    swss::Logger::getInstance().setMinPrio(swss::Logger::SWSS_NOTICE);
+
+    uint32_t count = 10000;
+    uint32_t batchSize = 128;
+
+    while (true)
+    {
+        static struct option long_options[] =
+        {
+            { "count",      required_argument, 0, 'n' },
+            { "batchSize",  required_argument, 0, 'b' },
+            { "help",       no_argument,       0, 'h' },
+            { 0,            0,                 0,  0  }
+        };
+
+        int option_index = 0;
+
+        int c = getopt_long(argc, argv, "n:b:h", long_options, &option_index);
+
+        if (c == -1)
+        {
+            break;
+        }
+
+        switch (c)
+        {
+            case 'n':
+                count = (uint32_t)std::stoul(optarg);
+                break;
+
+            case 'b':
+                batchSize = (uint32_t)std::stoul(optarg);
+                break;
+
+            case 'h':
+                print_usage();
+                return EXIT_SUCCESS;
+
+            default:
+                print_usage();
+                return EXIT_FAILURE;
+        }
+    }
+
+    try
+    {
+        auto sai = std::make_shared<sairedis::Sai>();
+
+        ASSERT_SUCCESS(sai->apiInitialize(0, &test_services));
+
+        sai_attribute_t attr;
+
+        attr.id = SAI_REDIS_SWITCH_ATTR_REDIS_COMMUNICATION_MODE;
+        attr.value.s32 = SAI_REDIS_COMMUNICATION_MODE_REDIS_ASYNC;
+
+        set_redis_attr(sai, attr);
+
+        attr.id = SAI_SWITCH_ATTR_INIT_SWITCH;
+        attr.value.booldata = true;
+
+        sai_object_id_t switchId;
+
+        ASSERT_SUCCESS(sai->create(SAI_OBJECT_TYPE_SWITCH, &switchId, SAI_NULL_OBJECT_ID, 1, &attr));
+
+        attr.id = SAI_SWITCH_ATTR_DEFAULT_VIRTUAL_ROUTER_ID;
+
+        ASSERT_SUCCESS(sai->get(SAI_OBJECT_TYPE_SWITCH, switchId, 1, &attr));
+
+        sai_object_id_t vrId = attr.value.oid;
+
+        bench_routes(sai, switchId, vrId, count, 0, 0x0a000000);
+
+        bench_routes(sai, switchId, vrId, count, batchSize, 0x0b000000);
+
+        ASSERT_SUCCESS(sai->apiUninitialize());
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "exception: " << e.what() << std::endl;
+
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
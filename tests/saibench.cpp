@@ -0,0 +1,486 @@
+#include "SaiBench.h"
+
+extern "C" {
+#include "saimetadata.h"
+}
+
+#include "meta/sai_serialize.h"
+#include "meta/SaiAttributeList.h"
+#include "meta/Meta.h"
+#include "meta/MetaKeyHasher.h"
+#include "meta/MetaTestSaiInterface.h"
+
+#include "swss/logger.h"
+
+#include <getopt.h>
+#include <arpa/inet.h>
+
+#include <iostream>
+#include <fstream>
+#include <map>
+#include <memory>
+
+using namespace saimeta;
+
+/*
+ * Sample serialized values used for attribute value benchmarks, types not
+ * listed here are benchmarked with zeroed value.
+ */
+static const std::map<sai_attr_value_type_t, std::string> g_sampleValues =
+{
+    { SAI_ATTR_VALUE_TYPE_BOOL,         "true" },
+    { SAI_ATTR_VALUE_TYPE_UINT32,       "123456" },
+    { SAI_ATTR_VALUE_TYPE_UINT64,       "1234567890123" },
+    { SAI_ATTR_VALUE_TYPE_MAC,          "11:22:33:44:55:66" },
+    { SAI_ATTR_VALUE_TYPE_IPV4,         "10.1.2.3" },
+    { SAI_ATTR_VALUE_TYPE_IPV6,         "fc00::1:2:3" },
+    { SAI_ATTR_VALUE_TYPE_IP_ADDRESS,   "10.1.2.3" },
+    { SAI_ATTR_VALUE_TYPE_IP_PREFIX,    "10.1.2.0/24" },
+    { SAI_ATTR_VALUE_TYPE_OBJECT_ID,    "oid:0x1000000000001" },
+    { SAI_ATTR_VALUE_TYPE_OBJECT_LIST,  "4:oid:0x1000000000001,oid:0x1000000000002,oid:0x1000000000003,oid:0x1000000000004" },
+    { SAI_ATTR_VALUE_TYPE_UINT32_LIST,  "4:1,2,3,4" },
+    { SAI_ATTR_VALUE_TYPE_VLAN_LIST,    "4:10,20,30,40" },
+};
+
+static sai_route_entry_t get_route_entry()
+{
+    SWSS_LOG_ENTER();
+
+    sai_route_entry_t e;
+
+    memset(&e, 0, sizeof(e));
+
+    e.switch_id = 0x21000000000000;
+    e.vr_id = 0x3000000000022;
+    e.destination.addr_family = SAI_IP_ADDR_FAMILY_IPV4;
+    e.destination.addr.ip4 = htonl(0x0a010200);
+    e.destination.mask.ip4 = htonl(0xffffff00);
+
+    return e;
+}
+
+static void add_key_benchmarks(
+        _In_ SaiBench& bench)
+{
+    SWSS_LOG_ENTER();
+
+    for (size_t i = 1; i < sai_metadata_enum_sai_object_type_t.valuescount; ++i)
+    {
+        auto ot = (sai_object_type_t)sai_metadata_enum_sai_object_type_t.values[i];
+
+        auto info = sai_metadata_get_object_type_info(ot);
+
+        if (info == NULL)
+        {
+            continue;
+        }
+
+        sai_object_meta_key_t mk;
+
+        memset(&mk, 0, sizeof(mk));
+
+        mk.objecttype = ot;
+
+        if (ot == SAI_OBJECT_TYPE_ROUTE_ENTRY)
+        {
+            mk.objectkey.key.route_entry = get_route_entry();
+        }
+        else if (!info->isnonobjectid)
+        {
+            // oid keys are all the same, benchmark them only once
+
+            if (ot != SAI_OBJECT_TYPE_PORT)
+            {
+                continue;
+            }
+
+            mk.objectkey.key.object_id = 0x1000000000001;
+        }
+
+        std::string name = sai_serialize_object_type(ot);
+
+        std::string s = sai_serialize_object_meta_key(mk);
+
+        bench.add("key/serialize/" + name, [=](SaiBench::State& state) {
+                for (uint64_t n = 0; n < state.iterations; n++)
+                {
+                    SaiBench::doNotOptimize(sai_serialize_object_meta_key(mk));
+                }
+        });
+
+        bench.add("key/deserialize/" + name, [=](SaiBench::State& state) {
+                sai_object_meta_key_t key;
+                for (uint64_t n = 0; n < state.iterations; n++)
+                {
+                    sai_deserialize_object_meta_key(s, key);
+                    SaiBench::doNotOptimize(key);
+                }
+        });
+
+        bench.add("key/hash/" + name, [=](SaiBench::State& state) {
+                MetaKeyHasher hasher;
+                for (uint64_t n = 0; n < state.iterations; n++)
+                {
+                    SaiBench::doNotOptimize(hasher(mk));
+                }
+        });
+    }
+}
+
+static void add_attr_value_benchmarks(
+        _In_ SaiBench& bench)
+{
+    SWSS_LOG_ENTER();
+
+    for (size_t i = 0; i < sai_metadata_enum_sai_attr_value_type_t.valuescount; ++i)
+    {
+        auto type = (sai_attr_value_type_t)sai_metadata_enum_sai_attr_value_type_t.values[i];
+
+        const sai_attr_metadata_t* meta = NULL;
+
+        for (size_t idx = 0; idx < sai_metadata_attr_sorted_by_id_name_count; ++idx)
+        {
+            if (sai_metadata_attr_sorted_by_id_name[idx]->attrvaluetype == type)
+            {
+                meta = sai_metadata_attr_sorted_by_id_name[idx];
+                break;
+            }
+        }
+
+        if (meta == NULL || type == SAI_ATTR_VALUE_TYPE_POINTER)
+        {
+            continue;
+        }
+
+        // value is shared by benchmark copies, lists are released with it
+
+        std::shared_ptr<sai_attribute_t> attr(new sai_attribute_t(), [type](sai_attribute_t* a) {
+                sai_deserialize_free_attribute_value(type, *a);
+                delete a;
+        });
+
+        attr->id = meta->attrid;
+
+        std::string s;
+
+        try
+        {
+            auto it = g_sampleValues.find(type);
+
+            if (it != g_sampleValues.end())
+            {
+                sai_deserialize_attr_value(it->second, *meta, *attr);
+            }
+
+            s = sai_serialize_attr_value(*meta, *attr);
+
+            // check if value can be deserialized back
+
+            sai_attribute_t tmp;
+
+            sai_deserialize_attr_value(s, *meta, tmp);
+            sai_deserialize_free_attribute_value(type, tmp);
+        }
+        catch (const std::exception& e)
+        {
+            SWSS_LOG_NOTICE("skipping %s: %s", meta->attridname, e.what());
+            continue;
+        }
+
+        std::string name = sai_serialize_attr_value_type(type);
+
+        bench.add("attr/serialize/" + name, [=](SaiBench::State& state) {
+                for (uint64_t n = 0; n < state.iterations; n++)
+                {
+                    SaiBench::doNotOptimize(sai_serialize_attr_value(*meta, *attr));
+                }
+        });
+
+        bench.add("attr/serialize_append/" + name, [=](SaiBench::State& state) {
+                std::string buf;
+                for (uint64_t n = 0; n < state.iterations; n++)
+                {
+                    buf.clear();
+                    sai_serialize_attr_value(buf, *meta, *attr);
+                    SaiBench::doNotOptimize(buf);
+                }
+        });
+
+        bench.add("attr/deserialize/" + name, [=](SaiBench::State& state) {
+                sai_attribute_t value;
+                value.id = meta->attrid;
+                for (uint64_t n = 0; n < state.iterations; n++)
+                {
+                    sai_deserialize_attr_value(s, *meta, value);
+                    SaiBench::doNotOptimize(value);
+                    sai_deserialize_free_attribute_value(type, value);
+                }
+        });
+    }
+}
+
+static void add_attr_list_benchmarks(
+        _In_ SaiBench& bench)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<swss::FieldValueTuple> values =
+    {
+        { "SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION", "SAI_PACKET_ACTION_FORWARD" },
+        { "SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID", "oid:0x4000000000001" },
+        { "SAI_ROUTE_ENTRY_ATTR_META_DATA", "7" },
+    };
+
+    bench.add("attrlist/construct/SAI_OBJECT_TYPE_ROUTE_ENTRY", [=](SaiBench::State& state) {
+            for (uint64_t n = 0; n < state.iterations; n++)
+            {
+                SaiAttributeList list(SAI_OBJECT_TYPE_ROUTE_ENTRY, values, false);
+                SaiBench::doNotOptimize(list.get_attr_count());
+            }
+    });
+
+    auto list = std::make_shared<SaiAttributeList>(SAI_OBJECT_TYPE_ROUTE_ENTRY, values, false);
+
+    bench.add("attrlist/serialize/SAI_OBJECT_TYPE_ROUTE_ENTRY", [=](SaiBench::State& state) {
+            for (uint64_t n = 0; n < state.iterations; n++)
+            {
+                SaiBench::doNotOptimize(SaiAttributeList::serialize_attr_list(
+                            SAI_OBJECT_TYPE_ROUTE_ENTRY, list->get_attr_count(), list->get_attr_list(), false));
+            }
+    });
+
+    bench.add("attrlist/serialize_append/SAI_OBJECT_TYPE_ROUTE_ENTRY", [=](SaiBench::State& state) {
+            std::string buf;
+            for (uint64_t n = 0; n < state.iterations; n++)
+            {
+                buf.clear();
+                SaiAttributeList::serialize_attr_list(buf, SAI_OBJECT_TYPE_ROUTE_ENTRY, list->get_attr_count(), list->get_attr_list(), false);
+                SaiBench::doNotOptimize(buf);
+            }
+    });
+}
+
+static void add_meta_benchmarks(
+        _In_ SaiBench& bench)
+{
+    SWSS_LOG_ENTER();
+
+    auto meta = std::make_shared<Meta>(std::make_shared<MetaTestSaiInterface>());
+
+    sai_object_id_t switchId = SAI_NULL_OBJECT_ID;
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_SWITCH_ATTR_INIT_SWITCH;
+    attr.value.booldata = true;
+
+    if (meta->create(SAI_OBJECT_TYPE_SWITCH, &switchId, SAI_NULL_OBJECT_ID, 1, &attr) != SAI_STATUS_SUCCESS)
+    {
+        SWSS_LOG_THROW("failed to create switch");
+    }
+
+    sai_object_id_t vrId = SAI_NULL_OBJECT_ID;
+
+    if (meta->create(SAI_OBJECT_TYPE_VIRTUAL_ROUTER, &vrId, switchId, 0, &attr) != SAI_STATUS_SUCCESS)
+    {
+        SWSS_LOG_THROW("failed to create virtual router");
+    }
+
+    sai_route_entry_t route = get_route_entry();
+
+    route.switch_id = switchId;
+    route.vr_id = vrId;
+    route.destination.mask.ip4 = 0xffffffff;
+
+    auto routes = [=](uint64_t count) {
+        std::vector<sai_route_entry_t> entries(count, route);
+        for (uint64_t n = 0; n < count; n++)
+        {
+            entries[n].destination.addr.ip4 = htonl(0x0a000000 + (uint32_t)n);
+        }
+        return entries;
+    };
+
+    auto attrs = std::make_shared<std::vector<sai_attribute_t>>(2);
+
+    (*attrs)[0].id = SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION;
+    (*attrs)[0].value.s32 = SAI_PACKET_ACTION_FORWARD;
+    (*attrs)[1].id = SAI_ROUTE_ENTRY_ATTR_META_DATA;
+    (*attrs)[1].value.u32 = 0;
+
+    bench.add("meta/create/SAI_OBJECT_TYPE_ROUTE_ENTRY", [=](SaiBench::State& state) {
+            state.pauseTiming();
+            auto entries = routes(state.iterations);
+            state.resumeTiming();
+            for (auto& e: entries)
+            {
+                meta->create(&e, 2, attrs->data());
+            }
+            state.pauseTiming();
+            for (auto& e: entries)
+            {
+                meta->remove(&e);
+            }
+    });
+
+    bench.add("meta/set/SAI_OBJECT_TYPE_ROUTE_ENTRY", [=](SaiBench::State& state) {
+            state.pauseTiming();
+            auto entries = routes(state.iterations);
+            for (auto& e: entries)
+            {
+                meta->create(&e, 2, attrs->data());
+            }
+            state.resumeTiming();
+            for (auto& e: entries)
+            {
+                meta->set(&e, &(*attrs)[0]);
+            }
+            state.pauseTiming();
+            for (auto& e: entries)
+            {
+                meta->remove(&e);
+            }
+    });
+
+    bench.add("meta/remove/SAI_OBJECT_TYPE_ROUTE_ENTRY", [=](SaiBench::State& state) {
+            state.pauseTiming();
+            auto entries = routes(state.iterations);
+            for (auto& e: entries)
+            {
+                meta->create(&e, 2, attrs->data());
+            }
+            state.resumeTiming();
+            for (auto& e: entries)
+            {
+                meta->remove(&e);
+            }
+    });
+}
+
+static void printUsage()
+{
+    SWSS_LOG_ENTER();
+
+    std::cout << "Usage: saibench [-o file] [-f filter] [-r repetitions] [-t ms] [-l] [-h]" << std::endl << std::endl;
+
+    std::cout << "    -o --output file" << std::endl;
+    std::cout << "        Write JSON results to file instead of standard output" << std::endl << std::endl;
+    std::cout << "    -f --filter substring" << std::endl;
+    std::cout << "        Run only benchmarks which name contains substring" << std::endl << std::endl;
+    std::cout << "    -r --repetitions count" << std::endl;
+    std::cout << "        Number of measured repetitions of each benchmark (default 5)" << std::endl << std::endl;
+    std::cout << "    -t --minTime ms" << std::endl;
+    std::cout << "        Minimal time of single repetition in milliseconds (default 100)" << std::endl << std::endl;
+    std::cout << "    -l --list" << std::endl;
+    std::cout << "        List benchmarks and exit" << std::endl << std::endl;
+    std::cout << "    -h --help" << std::endl;
+    std::cout << "        Print out this message" << std::endl << std::endl;
+}
+
+int main(int argc, char **argv)
+{
+    swss::Logger::getInstance().setMinPrio(swss::Logger::SWSS_NOTICE);
+
+    SWSS_LOG_ENTER();
+
+    std::string output;
+    std::string filter;
+
+    uint32_t repetitions = 5;
+
+    double minTimeMs = 100;
+
+    bool list = false;
+
+    const char* const optstring = "o:f:r:t:lh";
+
+    static struct option long_options[] =
+    {
+        { "output",      required_argument, 0, 'o' },
+        { "filter",      required_argument, 0, 'f' },
+        { "repetitions", required_argument, 0, 'r' },
+        { "minTime",     required_argument, 0, 't' },
+        { "list",        no_argument,       0, 'l' },
+        { "help",        no_argument,       0, 'h' },
+        { 0,             0,                 0,  0  }
+    };
+
+    while (true)
+    {
+        int option_index = 0;
+
+        int c = getopt_long(argc, argv, optstring, long_options, &option_index);
+
+        if (c == -1)
+        {
+            break;
+        }
+
+        switch (c)
+        {
+            case 'o':
+                output = optarg;
+                break;
+
+            case 'f':
+                filter = optarg;
+                break;
+
+            case 'r':
+                repetitions = (uint32_t)std::stoul(optarg);
+                break;
+
+            case 't':
+                minTimeMs = std::stod(optarg);
+                break;
+
+            case 'l':
+                list = true;
+                break;
+
+            case 'h':
+                printUsage();
+                return EXIT_SUCCESS;
+
+            default:
+                printUsage();
+                return EXIT_FAILURE;
+        }
+    }
+
+    SaiBench bench(repetitions, minTimeMs, filter);
+
+    add_key_benchmarks(bench);
+    add_attr_value_benchmarks(bench);
+    add_attr_list_benchmarks(bench);
+    add_meta_benchmarks(bench);
+
+    if (list)
+    {
+        bench.list();
+
+        return EXIT_SUCCESS;
+    }
+
+    bench.run();
+
+    if (output.empty())
+    {
+        std::cout << bench.toJson() << std::endl;
+
+        return EXIT_SUCCESS;
+    }
+
+    std::ofstream ofs(output);
+
+    if (!ofs.is_open())
+    {
+        SWSS_LOG_ERROR("failed to open %s", output.c_str());
+
+        return EXIT_FAILURE;
+    }
+
+    ofs << bench.toJson() << std::endl;
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,354 @@
+#include "Sai.h"
+#include "sairedis.h"
+#include "ContextConfigContainer.h"
+
+#include "meta/sai_serialize.h"
+
+#include "swss/logger.h"
+
+#include <getopt.h>
+#include <string.h>
+#include <arpa/inet.h>
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include <memory>
+
+/*
+ * Measures throughput of route entry create/remove sent from multiple
+ * threads through single libsairedis instance, while other threads are
+ * reading switch attribute, so scaling of API calls with number of threads
+ * and contexts can be measured.
+ *
+ * Writer threads are spread over contexts from context config, each context
+ * needs own syncd with virtual switch, for example:
+ *
+ * ./vssyncd -SUu -l -p BCM56850/vsprofile.ini -z redis_sync &
+ * ./threadbench -n 10000 -t 4 -r 2 -m redis_sync
+ */
+
+#define ASSERT_SUCCESS(x) \
+    if ((x) != SAI_STATUS_SUCCESS) \
+{\
+    SWSS_LOG_THROW("expected success, line: %d, got: %s", __LINE__, sai_serialize_status(x).c_str());\
+}
+
+static const char* g_contextConfig = NULL;
+
+static const char* profile_get_value(
+        _In_ sai_switch_profile_id_t profile_id,
+        _In_ const char* variable)
+{
+    SWSS_LOG_ENTER();
+
+    if (variable && strcmp(variable, SAI_REDIS_KEY_CONTEXT_CONFIG) == 0)
+    {
+        return g_contextConfig;
+    }
+
+    return NULL;
+}
+
+static int profile_get_next_value(
+        _In_ sai_switch_profile_id_t profile_id,
+        _Out_ const char** variable,
+        _Out_ const char** value)
+{
+    SWSS_LOG_ENTER();
+
+    return -1;
+}
+
+static sai_service_method_table_t test_services = {
+    profile_get_value,
+    profile_get_next_value
+};
+
+struct SwitchInfo
+{
+    sai_object_id_t switchId;
+
+    sai_object_id_t vrId;
+};
+
+static void writer(
+        _In_ std::shared_ptr<sairedis::Sai> sai,
+        _In_ SwitchInfo sw,
+        _In_ uint32_t count,
+        _In_ uint32_t base)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<sai_route_entry_t> routes(count);
+
+    for (uint32_t idx = 0; idx < count; idx++)
+    {
+        auto& r = routes[idx];
+
+        memset(&r, 0, sizeof(r));
+
+        r.switch_id = sw.switchId;
+        r.vr_id = sw.vrId;
+        r.destination.addr_family = SAI_IP_ADDR_FAMILY_IPV4;
+        r.destination.addr.ip4 = htonl(base + idx);
+        r.destination.mask.ip4 = 0xffffffff;
+    }
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION;
+    attr.value.s32 = SAI_PACKET_ACTION_DROP;
+
+    for (auto& r: routes)
+    {
+        ASSERT_SUCCESS(sai->create(&r, 1, &attr));
+    }
+
+    for (auto& r: routes)
+    {
+        ASSERT_SUCCESS(sai->remove(&r));
+    }
+}
+
+static void reader(
+        _In_ std::shared_ptr<sairedis::Sai> sai,
+        _In_ SwitchInfo sw,
+        _In_ const std::atomic<bool>& run,
+        _Out_ uint64_t& reads)
+{
+    SWSS_LOG_ENTER();
+
+    sai_attribute_t attr;
+
+    reads = 0;
+
+    while (run)
+    {
+        attr.id = SAI_SWITCH_ATTR_DEFAULT_VIRTUAL_ROUTER_ID;
+
+        ASSERT_SUCCESS(sai->get(SAI_OBJECT_TYPE_SWITCH, sw.switchId, 1, &attr));
+
+        reads++;
+    }
+}
+
+static void bench_threads(
+        _In_ std::shared_ptr<sairedis::Sai> sai,
+        _In_ const std::vector<SwitchInfo>& switches,
+        _In_ uint32_t count,
+        _In_ uint32_t writers,
+        _In_ uint32_t readers)
+{
+    SWSS_LOG_ENTER();
+
+    std::atomic<bool> run(true);
+
+    std::vector<uint64_t> reads(readers);
+
+    std::vector<std::thread> readerThreads;
+
+    for (uint32_t idx = 0; idx < readers; idx++)
+    {
+        readerThreads.emplace_back(reader, sai, switches[idx % switches.size()], std::cref(run), std::ref(reads[idx]));
+    }
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    std::vector<std::thread> writerThreads;
+
+    for (uint32_t idx = 0; idx < writers; idx++)
+    {
+        // each writer has own prefix range, so routes don't collide
+
+        uint32_t base = 0x0a000000 + (idx << 20);
+
+        writerThreads.emplace_back(writer, sai, switches[idx % switches.size()], count, base);
+    }
+
+    for (auto& t: writerThreads)
+    {
+        t.join();
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+
+    run = false;
+
+    for (auto& t: readerThreads)
+    {
+        t.join();
+    }
+
+    auto time = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+    uint64_t ops = 2 * (uint64_t)count * writers;
+
+    uint64_t totalReads = 0;
+
+    for (auto r: reads)
+    {
+        totalReads += r;
+    }
+
+    std::cout << "contexts " << switches.size() << ", writers " << writers << ", readers " << readers << std::endl;
+    std::cout << "  create/remove routes ms: " << time / 1000 << " / " << ops
+        << " (" << ops * 1000000 / (uint64_t)(time ? time : 1) << " ops/s)" << std::endl;
+    std::cout << "  get switch attribute: " << totalReads
+        << " (" << totalReads * 1000000 / (uint64_t)(time ? time : 1) << " ops/s)" << std::endl;
+}
+
+static void print_usage()
+{
+    SWSS_LOG_ENTER();
+
+    std::cout << "Usage: threadbench [-n count] [-t threads] [-r readers] [-m mode] [-x contextConfig] [-h]" << std::endl << std::endl;
+    std::cout << "    -n --count count" << std::endl;
+    std::cout << "        Number of routes created and removed by each writer thread, default 10000" << std::endl;
+    std::cout << "    -t --threads threads" << std::endl;
+    std::cout << "        Number of writer threads, default 4" << std::endl;
+    std::cout << "    -r --readers readers" << std::endl;
+    std::cout << "        Number of threads reading switch attribute meanwhile, default 0" << std::endl;
+    std::cout << "    -m --mode mode" << std::endl;
+    std::cout << "        Communication mode (redis_async|redis_sync|zmq_sync|zmq_v2_sync|shm_sync)," << std::endl;
+    std::cout << "        must match syncd -z option, default redis_sync" << std::endl;
+    std::cout << "    -x --contextConfig contextConfig" << std::endl;
+    std::cout << "        Context config file, threads are spread over all contexts" << std::endl;
+    std::cout << "    -h --help" << std::endl;
+    std::cout << "        Print out this message" << std::endl;
+}
+
+int main(int argc, char **argv)
+{
+    SWSS_LOG_ENTER();
+
+    swss::Logger::getInstance().setMinPrio(swss::Logger::SWSS_NOTICE);
+
+    uint32_t count = 10000;
+    uint32_t writers = 4;
+    uint32_t readers = 0;
+    sai_redis_communication_mode_t mode = SAI_REDIS_COMMUNICATION_MODE_REDIS_SYNC;
+
+    while (true)
+    {
+        static struct option long_options[] =
+        {
+            { "count",          required_argument, 0, 'n' },
+            { "threads",        required_argument, 0, 't' },
+            { "readers",        required_argument, 0, 'r' },
+            { "mode",           required_argument, 0, 'm' },
+            { "contextConfig",  required_argument, 0, 'x' },
+            { "help",           no_argument,       0, 'h' },
+            { 0,                0,                 0,  0  }
+        };
+
+        int option_index = 0;
+
+        int c = getopt_long(argc, argv, "n:t:r:m:x:h", long_options, &option_index);
+
+        if (c == -1)
+        {
+            break;
+        }
+
+        switch (c)
+        {
+            case 'n':
+                count = (uint32_t)std::stoul(optarg);
+                break;
+
+            case 't':
+                writers = (uint32_t)std::stoul(optarg);
+                break;
+
+            case 'r':
+                readers = (uint32_t)std::stoul(optarg);
+                break;
+
+            case 'm':
+                try
+                {
+                    sai_deserialize_redis_communication_mode(optarg, mode);
+                }
+                catch (const std::exception&)
+                {
+                    print_usage();
+                    return EXIT_FAILURE;
+                }
+                break;
+
+            case 'x':
+                g_contextConfig = optarg;
+                break;
+
+            case 'h':
+                print_usage();
+                return EXIT_SUCCESS;
+
+            default:
+                print_usage();
+                return EXIT_FAILURE;
+        }
+    }
+
+    if (writers == 0 || writers > 256 || count == 0 || count > (1 << 20))
+    {
+        print_usage();
+        return EXIT_FAILURE;
+    }
+
+    try
+    {
+        auto sai = std::make_shared<sairedis::Sai>();
+
+        ASSERT_SUCCESS(sai->apiInitialize(0, &test_services));
+
+        sai_attribute_t attr;
+
+        attr.id = SAI_REDIS_SWITCH_ATTR_REDIS_COMMUNICATION_MODE;
+        attr.value.s32 = mode;
+
+        ASSERT_SUCCESS(sai->set(SAI_OBJECT_TYPE_SWITCH, SAI_NULL_OBJECT_ID, &attr));
+
+        std::vector<SwitchInfo> switches;
+
+        auto ccc = sairedis::ContextConfigContainer::loadFromFile(g_contextConfig);
+
+        for (auto& cc: ccc->getAllContextConfigs())
+        {
+            sai_attribute_t attrs[2];
+
+            attrs[0].id = SAI_SWITCH_ATTR_INIT_SWITCH;
+            attrs[0].value.booldata = true;
+
+            attrs[1].id = SAI_REDIS_SWITCH_ATTR_CONTEXT;
+            attrs[1].value.u32 = cc->m_guid;
+
+            SwitchInfo sw;
+
+            ASSERT_SUCCESS(sai->create(SAI_OBJECT_TYPE_SWITCH, &sw.switchId, SAI_NULL_OBJECT_ID, 2, attrs));
+
+            attr.id = SAI_SWITCH_ATTR_DEFAULT_VIRTUAL_ROUTER_ID;
+
+            ASSERT_SUCCESS(sai->get(SAI_OBJECT_TYPE_SWITCH, sw.switchId, 1, &attr));
+
+            sw.vrId = attr.value.oid;
+
+            switches.push_back(sw);
+        }
+
+        bench_threads(sai, switches, count, writers, readers);
+
+        ASSERT_SUCCESS(sai->apiUninitialize());
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "exception: " << e.what() << std::endl;
+
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,100 @@
+#include "MockChannel.h"
+
+#include "meta/sai_serialize.h"
+
+#include "swss/logger.h"
+
+using namespace sairedis;
+
+MockChannel::MockChannel():
+    Channel(nullptr),
+    m_flushCount(0),
+    m_pipelined(false),
+    m_fullDuplex(false)
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+void MockChannel::setBuffered(
+        _In_ bool buffered)
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+void MockChannel::flush()
+{
+    SWSS_LOG_ENTER();
+
+    m_flushCount++;
+}
+
+void MockChannel::set(
+        _In_ const std::string& key,
+        _In_ const std::vector<swss::FieldValueTuple>& values,
+        _In_ const std::string& command)
+{
+    SWSS_LOG_ENTER();
+
+    nextCorrelationId();
+
+    m_sent.emplace_back(key, command, values);
+}
+
+void MockChannel::del(
+        _In_ const std::string& key,
+        _In_ const std::string& command)
+{
+    SWSS_LOG_ENTER();
+
+    nextCorrelationId();
+
+    m_sent.emplace_back(key, command, std::vector<swss::FieldValueTuple>());
+}
+
+sai_status_t MockChannel::wait(
+        _In_ const std::string& command,
+        _Out_ swss::KeyOpFieldsValuesTuple& kco)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_responses.empty())
+    {
+        return SAI_STATUS_FAILURE;
+    }
+
+    kco = m_responses.front();
+
+    m_responses.pop_front();
+
+    m_responseCorrelationId = popCorrelationId(kfvFieldsValues(kco));
+
+    sai_status_t status;
+    sai_deserialize_status(kfvKey(kco), status);
+
+    return status;
+}
+
+bool MockChannel::isPipelined() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_pipelined;
+}
+
+bool MockChannel::isFullDuplex() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_fullDuplex;
+}
+
+void MockChannel::notificationThreadFunction()
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
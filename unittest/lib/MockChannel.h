@@ -0,0 +1,64 @@
+#pragma once
+
+#include "Channel.h"
+
+#include <deque>
+
+namespace sairedis
+{
+    /**
+     * @brief Channel which records sent messages and returns queued responses.
+     *
+     * Sent messages get correlation ids like on real channel, and correlation
+     * id field is removed from queued responses when they are received.
+     */
+    class MockChannel:
+        public Channel
+    {
+        public:
+
+            MockChannel();
+
+            virtual ~MockChannel() = default;
+
+        public:
+
+            virtual void setBuffered(
+                    _In_ bool buffered) override;
+
+            virtual void flush() override;
+
+            virtual void set(
+                    _In_ const std::string& key,
+                    _In_ const std::vector<swss::FieldValueTuple>& values,
+                    _In_ const std::string& command) override;
+
+            virtual void del(
+                    _In_ const std::string& key,
+                    _In_ const std::string& command) override;
+
+            virtual sai_status_t wait(
+                    _In_ const std::string& command,
+                    _Out_ swss::KeyOpFieldsValuesTuple& kco) override;
+
+            virtual bool isPipelined() const override;
+
+            virtual bool isFullDuplex() const override;
+
+        protected:
+
+            virtual void notificationThreadFunction() override;
+
+        public:
+
+            std::vector<swss::KeyOpFieldsValuesTuple> m_sent;
+
+            std::deque<swss::KeyOpFieldsValuesTuple> m_responses;
+
+            int m_flushCount;
+
+            bool m_pipelined;
+
+            bool m_fullDuplex;
+    };
+}
@@ -0,0 +1,205 @@
+#include "BatchingChannel.h"
+#include "MockChannel.h"
+#include "sairediscommon.h"
+
+#include "meta/sai_serialize.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include <unistd.h>
+
+using namespace sairedis;
+
+static std::string route_key(
+        _In_ int idx)
+{
+    SWSS_LOG_ENTER();
+
+    return "SAI_OBJECT_TYPE_ROUTE_ENTRY:{\"dest\":\"10.0.0." + std::to_string(idx) +
+        "/32\",\"switch_id\":\"oid:0x21000000000000\",\"vr\":\"oid:0x3000000000022\"}";
+}
+
+static std::vector<swss::FieldValueTuple> route_values()
+{
+    SWSS_LOG_ENTER();
+
+    return { swss::FieldValueTuple("SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION", "SAI_PACKET_ACTION_DROP") };
+}
+
+TEST(BatchingChannel, ctr)
+{
+    EXPECT_THROW(std::make_shared<BatchingChannel>(nullptr, false, 10, 0), std::runtime_error);
+}
+
+TEST(BatchingChannel, batchSize)
+{
+    auto mock = std::make_shared<MockChannel>();
+
+    BatchingChannel c(mock, false, 3, 0);
+
+    for (int i = 0; i < 7; i++)
+    {
+        c.set(route_key(i), route_values(), REDIS_ASIC_STATE_COMMAND_CREATE);
+    }
+
+    EXPECT_EQ(c.getRequestCorrelationId(), 7);
+
+    ASSERT_EQ(mock->m_sent.size(), 2);
+
+    EXPECT_EQ(kfvKey(mock->m_sent[0]), "SAI_OBJECT_TYPE_ROUTE_ENTRY:3");
+    EXPECT_EQ(kfvOp(mock->m_sent[0]), REDIS_ASIC_STATE_COMMAND_BULK_CREATE);
+    EXPECT_EQ(kfvFieldsValues(mock->m_sent[0]).size(), 3);
+    EXPECT_EQ(fvValue(kfvFieldsValues(mock->m_sent[0])[0]), "SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION=SAI_PACKET_ACTION_DROP");
+
+    c.flush();
+
+    // single operation is sent as it is
+
+    ASSERT_EQ(mock->m_sent.size(), 3);
+
+    EXPECT_EQ(kfvKey(mock->m_sent[2]), route_key(6));
+    EXPECT_EQ(kfvOp(mock->m_sent[2]), REDIS_ASIC_STATE_COMMAND_CREATE);
+
+    EXPECT_EQ(mock->m_flushCount, 1);
+}
+
+TEST(BatchingChannel, flushOnChange)
+{
+    auto mock = std::make_shared<MockChannel>();
+
+    BatchingChannel c(mock, false, 100, 0);
+
+    c.set(route_key(0), route_values(), REDIS_ASIC_STATE_COMMAND_CREATE);
+    c.set(route_key(1), route_values(), REDIS_ASIC_STATE_COMMAND_CREATE);
+
+    // operation change
+
+    c.del(route_key(0), REDIS_ASIC_STATE_COMMAND_REMOVE);
+    c.del(route_key(1), REDIS_ASIC_STATE_COMMAND_REMOVE);
+
+    ASSERT_EQ(mock->m_sent.size(), 1);
+
+    EXPECT_EQ(kfvOp(mock->m_sent[0]), REDIS_ASIC_STATE_COMMAND_BULK_CREATE);
+
+    // object id objects are not batched and flush batch
+
+    c.set("SAI_OBJECT_TYPE_VLAN:oid:0x26000000000001", route_values(), REDIS_ASIC_STATE_COMMAND_CREATE);
+
+    ASSERT_EQ(mock->m_sent.size(), 3);
+
+    EXPECT_EQ(kfvOp(mock->m_sent[1]), REDIS_ASIC_STATE_COMMAND_BULK_REMOVE);
+    EXPECT_EQ(kfvKey(mock->m_sent[1]), "SAI_OBJECT_TYPE_ROUTE_ENTRY:2");
+    EXPECT_EQ(fvValue(kfvFieldsValues(mock->m_sent[1])[1]), "");
+
+    EXPECT_EQ(kfvOp(mock->m_sent[2]), REDIS_ASIC_STATE_COMMAND_CREATE);
+
+    // set is not batched
+
+    c.set(route_key(0), route_values(), REDIS_ASIC_STATE_COMMAND_SET);
+
+    EXPECT_EQ(mock->m_sent.size(), 4);
+}
+
+TEST(BatchingChannel, timeout)
+{
+    auto mock = std::make_shared<MockChannel>();
+
+    auto c = std::make_shared<BatchingChannel>(mock, false, 100, 50 * 1000);
+
+    c->set(route_key(0), route_values(), REDIS_ASIC_STATE_COMMAND_CREATE);
+    c->set(route_key(1), route_values(), REDIS_ASIC_STATE_COMMAND_CREATE);
+
+    EXPECT_EQ(mock->m_sent.size(), 0);
+
+    usleep(200*1000);
+
+    ASSERT_EQ(mock->m_sent.size(), 1);
+
+    EXPECT_EQ(kfvOp(mock->m_sent[0]), REDIS_ASIC_STATE_COMMAND_BULK_CREATE);
+
+    EXPECT_EQ(mock->m_flushCount, 0);
+}
+
+TEST(BatchingChannel, timeoutBuffered)
+{
+    auto mock = std::make_shared<MockChannel>();
+
+    auto c = std::make_shared<BatchingChannel>(mock, false, 100, 50 * 1000);
+
+    c->setBuffered(true);
+
+    c->set(route_key(0), route_values(), REDIS_ASIC_STATE_COMMAND_CREATE);
+    c->set(route_key(1), route_values(), REDIS_ASIC_STATE_COMMAND_CREATE);
+
+    usleep(200*1000);
+
+    ASSERT_EQ(mock->m_sent.size(), 1);
+
+    // batch flushed by timer is also flushed from underlying channel buffer
+
+    EXPECT_EQ(mock->m_flushCount, 1);
+}
+
+TEST(BatchingChannel, notBatchedEntry)
+{
+    auto mock = std::make_shared<MockChannel>();
+
+    BatchingChannel c(mock, false, 100, 0);
+
+    // entries which syncd can't execute one by one are passed through
+
+    std::string key = "SAI_OBJECT_TYPE_MY_SID_ENTRY:{\"locator_block_len\":\"32\",\"locator_node_len\":\"16\","
+        "\"function_len\":\"16\",\"args_len\":\"0\",\"sid\":\"fc00::1\","
+        "\"switch_id\":\"oid:0x21000000000000\",\"vr_id\":\"oid:0x3000000000022\"}";
+
+    c.set(key, route_values(), REDIS_ASIC_STATE_COMMAND_CREATE);
+    c.del(key, REDIS_ASIC_STATE_COMMAND_REMOVE);
+
+    ASSERT_EQ(mock->m_sent.size(), 2);
+
+    EXPECT_EQ(kfvKey(mock->m_sent[0]), key);
+    EXPECT_EQ(kfvOp(mock->m_sent[0]), REDIS_ASIC_STATE_COMMAND_CREATE);
+    EXPECT_EQ(kfvKey(mock->m_sent[1]), key);
+    EXPECT_EQ(kfvOp(mock->m_sent[1]), REDIS_ASIC_STATE_COMMAND_REMOVE);
+}
+
+TEST(BatchingChannel, syncModeResponses)
+{
+    auto mock = std::make_shared<MockChannel>();
+
+    BatchingChannel c(mock, true, 100, 0);
+
+    c.set(route_key(0), route_values(), REDIS_ASIC_STATE_COMMAND_CREATE);
+    c.set(route_key(1), route_values(), REDIS_ASIC_STATE_COMMAND_CREATE);
+    c.set(route_key(2), route_values(), REDIS_ASIC_STATE_COMMAND_CREATE);
+
+    std::vector<swss::FieldValueTuple> statuses;
+
+    statuses.emplace_back("SAI_STATUS_SUCCESS", "");
+    statuses.emplace_back("SAI_STATUS_ITEM_ALREADY_EXISTS", "");
+    statuses.emplace_back("SAI_STATUS_SUCCESS", "");
+
+    mock->m_responses.emplace_back("SAI_STATUS_FAILURE", REDIS_ASIC_STATE_COMMAND_GETRESPONSE, statuses);
+    mock->m_responses.emplace_back("SAI_STATUS_SUCCESS", REDIS_ASIC_STATE_COMMAND_GETRESPONSE, std::vector<swss::FieldValueTuple>());
+
+    swss::KeyOpFieldsValuesTuple kco;
+
+    // each batched operation gets own status
+
+    EXPECT_EQ(c.wait(REDIS_ASIC_STATE_COMMAND_GETRESPONSE, kco), SAI_STATUS_SUCCESS);
+
+    ASSERT_EQ(mock->m_sent.size(), 1);
+
+    EXPECT_EQ(c.wait(REDIS_ASIC_STATE_COMMAND_GETRESPONSE, kco), SAI_STATUS_ITEM_ALREADY_EXISTS);
+    EXPECT_EQ(c.wait(REDIS_ASIC_STATE_COMMAND_GETRESPONSE, kco), SAI_STATUS_SUCCESS);
+
+    // not batched response is passed as it is
+
+    c.set("SAI_OBJECT_TYPE_VLAN:oid:0x26000000000001", route_values(), REDIS_ASIC_STATE_COMMAND_SET);
+
+    EXPECT_EQ(c.wait(REDIS_ASIC_STATE_COMMAND_GETRESPONSE, kco), SAI_STATUS_SUCCESS);
+
+    EXPECT_EQ(mock->m_responses.size(), 0);
+}
@@ -0,0 +1,159 @@
+#include "BinaryRecordingEncoder.h"
+#include "BinaryRecordingReader.h"
+
+#include "swss/logger.h"
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <vector>
+
+#include <unistd.h>
+
+using namespace sairedis;
+
+#define BINARY_RECORDING_TEST_FILE "binary_recording_test.bin"
+
+static void write_file(
+        _In_ const std::string& name,
+        _In_ const std::string& data)
+{
+    SWSS_LOG_ENTER();
+
+    std::ofstream(name, std::ios::binary) << data;
+}
+
+TEST(BinaryRecording, timestamp)
+{
+    auto ts = BinaryRecordingEncoder::parseTimestamp("2024-01-31.12:34:56.123456");
+
+    EXPECT_EQ(BinaryRecordingEncoder::formatTimestamp(ts), "2024-01-31.12:34:56.123456");
+
+    EXPECT_THROW(BinaryRecordingEncoder::parseTimestamp("2024-01-31 12:34:56.123456"), std::runtime_error);
+    EXPECT_THROW(BinaryRecordingEncoder::parseTimestamp("2024-01-31.12:34:56"), std::runtime_error);
+    EXPECT_THROW(BinaryRecordingEncoder::parseTimestamp("2024-13-31.12:34:56.123456"), std::runtime_error);
+}
+
+TEST(BinaryRecording, roundTrip)
+{
+    std::vector<std::string> lines = {
+        "2024-01-31.12:34:56.123456|#|recording on: ./sairedis.rec",
+        "2024-01-31.12:34:56.123457|c|SAI_OBJECT_TYPE_SWITCH:oid:0x21000000000000|SAI_SWITCH_ATTR_INIT_SWITCH=true|SAI_REDIS_SWITCH_ATTR_FOO=1",
+        "2024-01-31.12:34:56.123400|s|SAI_OBJECT_TYPE_PORT:oid:0x0|SAI_PORT_ATTR_MTU=9100",
+        "2024-01-31.12:34:57.000000|s|SAI_OBJECT_TYPE_PORT:oid:0x01|SAI_PORT_ATTR_MTU=",
+        "2024-01-31.12:34:57.000001|C|SAI_OBJECT_TYPE_ROUTE_ENTRY||{\"dest\":\"10.0.0.0/8\"}|SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION=SAI_PACKET_ACTION_DROP||x",
+        "2024-01-31.12:34:57.000002|G|SAI_STATUS_SUCCESS",
+        "2024-01-31.12:34:57.000003|a",
+        "2024-01-31.12:34:57.000004|r|",
+        "2024-01-31.12:34:57.000005|r|SAI_OBJECT_TYPE_FOO:oid:0x1|SAI_OBJECT_TYPE_PORT",
+        "1999-12-31.23:59:59.999999|n|port_state_change|[]|",
+    };
+
+    BinaryRecordingEncoder encoder;
+
+    std::string data;
+
+    encoder.begin(true, data);
+
+    for (auto& line: lines)
+    {
+        encoder.encode(line.data(), line.size(), data);
+    }
+
+    EXPECT_THROW(encoder.encode("foo", 3, data), std::runtime_error);
+    EXPECT_THROW(encoder.encode("2024-01-31.12:34:57.000005|rr", 29, data), std::runtime_error);
+
+    write_file(BINARY_RECORDING_TEST_FILE, data);
+
+    EXPECT_TRUE(BinaryRecordingReader::isBinaryRecording(BINARY_RECORDING_TEST_FILE));
+
+    BinaryRecordingReader reader(BINARY_RECORDING_TEST_FILE);
+
+    std::string line;
+
+    size_t count = 0;
+
+    while (reader.next(line))
+    {
+        ASSERT_LT(count, lines.size());
+
+        EXPECT_EQ(line, lines[count]);
+
+        count++;
+    }
+
+    EXPECT_EQ(count, lines.size());
+
+    // record truncated by crash is end of file
+
+    write_file(BINARY_RECORDING_TEST_FILE, data.substr(0, data.size() - 2));
+
+    BinaryRecordingReader truncated(BINARY_RECORDING_TEST_FILE);
+
+    count = 0;
+
+    while (truncated.next(line))
+    {
+        count++;
+    }
+
+    EXPECT_EQ(count, lines.size() - 1);
+
+    write_file(BINARY_RECORDING_TEST_FILE, lines[0]);
+
+    EXPECT_FALSE(BinaryRecordingReader::isBinaryRecording(BINARY_RECORDING_TEST_FILE));
+
+    EXPECT_THROW(BinaryRecordingReader(BINARY_RECORDING_TEST_FILE), std::runtime_error);
+
+    unlink(BINARY_RECORDING_TEST_FILE);
+}
+
+TEST(BinaryRecording, seek)
+{
+    BinaryRecordingEncoder encoder;
+
+    std::string data;
+
+    encoder.begin(true, data);
+
+    auto base = BinaryRecordingEncoder::parseTimestamp("2024-01-31.00:00:00.000000");
+
+    for (uint64_t i = 0; i < 100000; i++)
+    {
+        auto line = BinaryRecordingEncoder::formatTimestamp(base + i * 1000) +
+            "|s|SAI_OBJECT_TYPE_PORT:oid:0x" + std::to_string(i + 1) + "|SAI_PORT_ATTR_MTU=" + std::to_string(i);
+
+        encoder.encode(line.data(), line.size(), data);
+    }
+
+    write_file(BINARY_RECORDING_TEST_FILE, data);
+
+    BinaryRecordingReader reader(BINARY_RECORDING_TEST_FILE);
+
+    std::string line;
+
+    for (uint64_t i: std::vector<uint64_t>{ 0, 1, 12345, 50000, 99997 })
+    {
+        reader.seek(base + i * 1000 + 1);
+
+        ASSERT_TRUE(reader.next(line));
+
+        EXPECT_EQ(reader.getTimestamp(), base + (i + 1) * 1000);
+
+        ASSERT_TRUE(reader.next(line));
+
+        EXPECT_EQ(reader.getTimestamp(), base + (i + 2) * 1000);
+    }
+
+    reader.seek(base + 100000 * 1000);
+
+    EXPECT_FALSE(reader.next(line));
+
+    reader.seek(0);
+
+    ASSERT_TRUE(reader.next(line));
+
+    EXPECT_EQ(reader.getTimestamp(), base);
+
+    unlink(BINARY_RECORDING_TEST_FILE);
+}
@@ -0,0 +1,223 @@
+#include "CapabilityCache.h"
+
+#include "swss/logger.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include <string.h>
+
+#include <unistd.h>
+
+using namespace sairedis;
+
+#define CAPABILITY_CACHE_TEST_FILE "capability_cache_test.txt"
+
+#define SWITCH_ID ((sai_object_id_t)0x21000000000000)
+
+TEST(CapabilityCache, attributeCapability)
+{
+    CapabilityCache cc;
+
+    sai_status_t status;
+    sai_attr_capability_t cap;
+
+    EXPECT_FALSE(cc.getAttributeCapability(SWITCH_ID, SAI_OBJECT_TYPE_PORT, SAI_PORT_ATTR_MTU, status, cap));
+
+    cap.create_implemented = true;
+    cap.set_implemented = false;
+    cap.get_implemented = true;
+
+    cc.setAttributeCapability(SWITCH_ID, SAI_OBJECT_TYPE_PORT, SAI_PORT_ATTR_MTU, SAI_STATUS_SUCCESS, cap);
+
+    memset(&cap, 0, sizeof(cap));
+
+    EXPECT_TRUE(cc.getAttributeCapability(SWITCH_ID, SAI_OBJECT_TYPE_PORT, SAI_PORT_ATTR_MTU, status, cap));
+
+    EXPECT_EQ(status, SAI_STATUS_SUCCESS);
+    EXPECT_TRUE(cap.create_implemented);
+    EXPECT_FALSE(cap.set_implemented);
+    EXPECT_TRUE(cap.get_implemented);
+
+    // transient failures are not cached
+
+    cc.setAttributeCapability(SWITCH_ID, SAI_OBJECT_TYPE_PORT, SAI_PORT_ATTR_SPEED, SAI_STATUS_FAILURE, cap);
+
+    EXPECT_FALSE(cc.getAttributeCapability(SWITCH_ID, SAI_OBJECT_TYPE_PORT, SAI_PORT_ATTR_SPEED, status, cap));
+
+    cc.setAttributeCapability(SWITCH_ID, SAI_OBJECT_TYPE_PORT, SAI_PORT_ATTR_SPEED, SAI_STATUS_NOT_SUPPORTED, cap);
+
+    EXPECT_TRUE(cc.getAttributeCapability(SWITCH_ID, SAI_OBJECT_TYPE_PORT, SAI_PORT_ATTR_SPEED, status, cap));
+
+    EXPECT_EQ(status, SAI_STATUS_NOT_SUPPORTED);
+
+    cc.removeSwitch(SWITCH_ID);
+
+    EXPECT_FALSE(cc.getAttributeCapability(SWITCH_ID, SAI_OBJECT_TYPE_PORT, SAI_PORT_ATTR_MTU, status, cap));
+}
+
+TEST(CapabilityCache, attributeEnumValuesCapability)
+{
+    CapabilityCache cc;
+
+    sai_status_t status;
+
+    int32_t values[] = { SAI_PACKET_ACTION_DROP, SAI_PACKET_ACTION_FORWARD, SAI_PACKET_ACTION_TRAP };
+
+    sai_s32_list_t list;
+
+    list.count = 3;
+    list.list = values;
+
+    cc.setAttributeEnumValuesCapability(SWITCH_ID, SAI_OBJECT_TYPE_ROUTE_ENTRY, SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION, SAI_STATUS_SUCCESS, list);
+
+    int32_t out[3] = { 0 };
+
+    list.count = 1;
+    list.list = out;
+
+    EXPECT_TRUE(cc.getAttributeEnumValuesCapability(SWITCH_ID, SAI_OBJECT_TYPE_ROUTE_ENTRY, SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION, status, list));
+
+    EXPECT_EQ(status, SAI_STATUS_BUFFER_OVERFLOW);
+    EXPECT_EQ(list.count, 3);
+
+    EXPECT_TRUE(cc.getAttributeEnumValuesCapability(SWITCH_ID, SAI_OBJECT_TYPE_ROUTE_ENTRY, SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION, status, list));
+
+    EXPECT_EQ(status, SAI_STATUS_SUCCESS);
+    EXPECT_EQ(list.count, 3);
+    EXPECT_EQ(out[0], SAI_PACKET_ACTION_DROP);
+    EXPECT_EQ(out[1], SAI_PACKET_ACTION_FORWARD);
+    EXPECT_EQ(out[2], SAI_PACKET_ACTION_TRAP);
+
+    cc.setEnabled(false);
+
+    EXPECT_FALSE(cc.getAttributeEnumValuesCapability(SWITCH_ID, SAI_OBJECT_TYPE_ROUTE_ENTRY, SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION, status, list));
+}
+
+TEST(CapabilityCache, statsCapability)
+{
+    CapabilityCache cc;
+
+    sai_status_t status;
+
+    sai_stat_capability_t caps[2];
+
+    caps[0].stat_enum = SAI_QUEUE_STAT_PACKETS;
+    caps[0].stat_modes = SAI_STATS_MODE_READ;
+    caps[1].stat_enum = SAI_QUEUE_STAT_BYTES;
+    caps[1].stat_modes = SAI_STATS_MODE_READ | SAI_STATS_MODE_READ_AND_CLEAR;
+
+    sai_stat_capability_list_t list;
+
+    list.count = 2;
+    list.list = caps;
+
+    EXPECT_FALSE(cc.getStatsCapability(SWITCH_ID, SAI_OBJECT_TYPE_QUEUE, status, list));
+
+    cc.setStatsCapability(SWITCH_ID, SAI_OBJECT_TYPE_QUEUE, SAI_STATUS_SUCCESS, list);
+
+    sai_stat_capability_t out[2];
+
+    memset(out, 0, sizeof(out));
+
+    list.count = 1;
+    list.list = out;
+
+    EXPECT_TRUE(cc.getStatsCapability(SWITCH_ID, SAI_OBJECT_TYPE_QUEUE, status, list));
+
+    EXPECT_EQ(status, SAI_STATUS_BUFFER_OVERFLOW);
+    EXPECT_EQ(list.count, 2);
+
+    EXPECT_TRUE(cc.getStatsCapability(SWITCH_ID, SAI_OBJECT_TYPE_QUEUE, status, list));
+
+    EXPECT_EQ(status, SAI_STATUS_SUCCESS);
+    EXPECT_EQ(list.count, 2);
+    EXPECT_EQ(out[0].stat_enum, SAI_QUEUE_STAT_PACKETS);
+    EXPECT_EQ(out[0].stat_modes, (uint32_t)SAI_STATS_MODE_READ);
+    EXPECT_EQ(out[1].stat_enum, SAI_QUEUE_STAT_BYTES);
+    EXPECT_EQ(out[1].stat_modes, (uint32_t)(SAI_STATS_MODE_READ | SAI_STATS_MODE_READ_AND_CLEAR));
+
+    cc.removeSwitch(SWITCH_ID);
+
+    EXPECT_FALSE(cc.getStatsCapability(SWITCH_ID, SAI_OBJECT_TYPE_QUEUE, status, list));
+}
+
+TEST(CapabilityCache, objectTypeAvailability)
+{
+    CapabilityCache cc;
+
+    uint64_t count = 0;
+
+    EXPECT_FALSE(cc.getObjectTypeAvailability(SWITCH_ID, SAI_OBJECT_TYPE_ROUTE_ENTRY, 0, nullptr, count));
+
+    cc.setObjectTypeAvailability(SWITCH_ID, SAI_OBJECT_TYPE_ROUTE_ENTRY, 0, nullptr, 42);
+
+    EXPECT_TRUE(cc.getObjectTypeAvailability(SWITCH_ID, SAI_OBJECT_TYPE_ROUTE_ENTRY, 0, nullptr, count));
+
+    EXPECT_EQ(count, 42);
+
+    cc.invalidateObjectTypeAvailability();
+
+    EXPECT_FALSE(cc.getObjectTypeAvailability(SWITCH_ID, SAI_OBJECT_TYPE_ROUTE_ENTRY, 0, nullptr, count));
+
+    cc.setAvailabilityTtl(1);
+
+    cc.setObjectTypeAvailability(SWITCH_ID, SAI_OBJECT_TYPE_ROUTE_ENTRY, 0, nullptr, 42);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+
+    EXPECT_FALSE(cc.getObjectTypeAvailability(SWITCH_ID, SAI_OBJECT_TYPE_ROUTE_ENTRY, 0, nullptr, count));
+
+    cc.setAvailabilityTtl(0);
+
+    cc.setObjectTypeAvailability(SWITCH_ID, SAI_OBJECT_TYPE_ROUTE_ENTRY, 0, nullptr, 42);
+
+    EXPECT_FALSE(cc.getObjectTypeAvailability(SWITCH_ID, SAI_OBJECT_TYPE_ROUTE_ENTRY, 0, nullptr, count));
+}
+
+TEST(CapabilityCache, setFile)
+{
+    unlink(CAPABILITY_CACHE_TEST_FILE);
+
+    sai_status_t status;
+    sai_attr_capability_t cap;
+
+    cap.create_implemented = true;
+    cap.set_implemented = true;
+    cap.get_implemented = true;
+
+    {
+        CapabilityCache cc;
+
+        EXPECT_TRUE(cc.setFile(CAPABILITY_CACHE_TEST_FILE, "v1"));
+
+        cc.setAttributeCapability(SWITCH_ID, SAI_OBJECT_TYPE_PORT, SAI_PORT_ATTR_MTU, SAI_STATUS_SUCCESS, cap);
+    }
+
+    {
+        CapabilityCache cc;
+
+        EXPECT_TRUE(cc.setFile(CAPABILITY_CACHE_TEST_FILE, "v1"));
+
+        EXPECT_TRUE(cc.getAttributeCapability(SWITCH_ID, SAI_OBJECT_TYPE_PORT, SAI_PORT_ATTR_MTU, status, cap));
+
+        EXPECT_EQ(status, SAI_STATUS_SUCCESS);
+    }
+
+    {
+        // different version, file is truncated
+
+        CapabilityCache cc;
+
+        EXPECT_TRUE(cc.setFile(CAPABILITY_CACHE_TEST_FILE, "v2"));
+
+        EXPECT_FALSE(cc.getAttributeCapability(SWITCH_ID, SAI_OBJECT_TYPE_PORT, SAI_PORT_ATTR_MTU, status, cap));
+    }
+
+    CapabilityCache cc;
+
+    EXPECT_FALSE(cc.setFile("/nonexisting/dir/capability_cache", "v1"));
+
+    unlink(CAPABILITY_CACHE_TEST_FILE);
+}
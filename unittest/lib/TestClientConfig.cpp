@@ -12,3 +12,18 @@ TEST(ClientConfig, loadFromFile)
 
     EXPECT_NE(ClientConfig::loadFromFile("files/client_config_ok.txt"), nullptr);
 }
+
+TEST(ClientConfig, loadFromFileRouter)
+{
+    auto cc = ClientConfig::loadFromFile("files/client_config_router_a.json");
+
+    EXPECT_TRUE(cc->m_zmqRouter);
+
+    EXPECT_EQ(cc->m_zmqIdentity, "telemetry");
+
+    cc = ClientConfig::loadFromFile("files/client_config_router_b.json");
+
+    EXPECT_TRUE(cc->m_zmqRouter);
+
+    EXPECT_EQ(cc->m_zmqIdentity, "");
+}
@@ -1,12 +1,20 @@
 #include "ClientServerSai.h"
+#include "ZeroMQBinaryChannel.h"
 
 #include "sairedis.h"
+#include "sairediscommon.h"
 
 #include "swss/logger.h"
+#include "swss/dbconnector.h"
+#include "swss/notificationproducer.h"
 
 #include <gtest/gtest.h>
 
 #include <arpa/inet.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <thread>
 
 using namespace sairedis;
 
@@ -130,25 +138,25 @@ TEST(ClientServerSai, bulkGetClearStats)
 
     EXPECT_EQ(SAI_STATUS_SUCCESS, css->apiInitialize(0, &test_services));
 
-    EXPECT_EQ(SAI_STATUS_NOT_IMPLEMENTED, css->bulkGetStats(SAI_NULL_OBJECT_ID,
-                                                            SAI_OBJECT_TYPE_PORT,
-                                                            0,
-                                                            nullptr,
-                                                            0,
-                                                            nullptr,
-                                                            SAI_STATS_MODE_BULK_READ,
-                                                            nullptr,
-                                                            nullptr));
-
-    EXPECT_EQ(SAI_STATUS_NOT_IMPLEMENTED, css->bulkClearStats(SAI_NULL_OBJECT_ID,
+    EXPECT_EQ(SAI_STATUS_INVALID_PARAMETER, css->bulkGetStats(SAI_NULL_OBJECT_ID,
                                                               SAI_OBJECT_TYPE_PORT,
                                                               0,
                                                               nullptr,
                                                               0,
                                                               nullptr,
-                                                              SAI_STATS_MODE_BULK_CLEAR,
+                                                              SAI_STATS_MODE_BULK_READ,
+                                                              nullptr,
                                                               nullptr));
 
+    EXPECT_EQ(SAI_STATUS_INVALID_PARAMETER, css->bulkClearStats(SAI_NULL_OBJECT_ID,
+                                                                SAI_OBJECT_TYPE_PORT,
+                                                                0,
+                                                                nullptr,
+                                                                0,
+                                                                nullptr,
+                                                                SAI_STATS_MODE_BULK_CLEAR,
+                                                                nullptr));
+
     css = std::make_shared<ClientServerSai>();
     EXPECT_EQ(SAI_STATUS_SUCCESS, css->apiInitialize(0, &test_client_services));
 
@@ -233,3 +241,160 @@ TEST(ClientServerSai, bulkGet)
                 statuses));
 }
 
+
+static const char* router_profile_get_value(
+        _In_ sai_switch_profile_id_t profile_id,
+        _In_ const char* variable)
+{
+    SWSS_LOG_ENTER();
+
+    if (variable != NULL && strcmp(variable, SAI_REDIS_KEY_SERVER_CONFIG) == 0)
+        return "files/server_config_router.json";
+
+    return nullptr;
+}
+
+static sai_service_method_table_t test_router_services = {
+    router_profile_get_value,
+    profile_get_next_value
+};
+
+static const char* router_client_a_profile_get_value(
+        _In_ sai_switch_profile_id_t profile_id,
+        _In_ const char* variable)
+{
+    SWSS_LOG_ENTER();
+
+    if (variable != NULL && strcmp(variable, SAI_REDIS_KEY_ENABLE_CLIENT) == 0)
+        return "true";
+
+    if (variable != NULL && strcmp(variable, SAI_REDIS_KEY_CLIENT_CONFIG) == 0)
+        return "files/client_config_router_a.json";
+
+    return nullptr;
+}
+
+static sai_service_method_table_t test_router_client_a_services = {
+    router_client_a_profile_get_value,
+    profile_get_next_value
+};
+
+static const char* router_client_b_profile_get_value(
+        _In_ sai_switch_profile_id_t profile_id,
+        _In_ const char* variable)
+{
+    SWSS_LOG_ENTER();
+
+    if (variable != NULL && strcmp(variable, SAI_REDIS_KEY_ENABLE_CLIENT) == 0)
+        return "true";
+
+    if (variable != NULL && strcmp(variable, SAI_REDIS_KEY_CLIENT_CONFIG) == 0)
+        return "files/client_config_router_b.json";
+
+    return nullptr;
+}
+
+static sai_service_method_table_t test_router_client_b_services = {
+    router_client_b_profile_get_value,
+    profile_get_next_value
+};
+
+TEST(ClientServerSai, routerMultipleClients)
+{
+    auto server = std::make_shared<ClientServerSai>();
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS, server->apiInitialize(0, &test_router_services));
+
+    auto a = std::make_shared<ClientServerSai>();
+    auto b = std::make_shared<ClientServerSai>();
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS, a->apiInitialize(0, &test_router_client_a_services));
+    EXPECT_EQ(SAI_STATUS_SUCCESS, b->apiInitialize(0, &test_router_client_b_services));
+
+    // server will answer each client, query fails since switch doesn't exist
+
+    auto query = [](std::shared_ptr<ClientServerSai> client, std::atomic<int>* answered)
+    {
+        SWSS_LOG_ENTER();
+
+        for (int i = 0; i < 10; i++)
+        {
+            uint64_t count;
+
+            if (client->objectTypeGetAvailability(SAI_NULL_OBJECT_ID, SAI_OBJECT_TYPE_PORT, 0, nullptr, &count) == SAI_STATUS_INVALID_PARAMETER)
+            {
+                (*answered)++;
+            }
+        }
+    };
+
+    std::atomic<int> answeredA(0);
+    std::atomic<int> answeredB(0);
+
+    std::thread ta(query, a, &answeredA);
+    std::thread tb(query, b, &answeredB);
+
+    ta.join();
+    tb.join();
+
+    EXPECT_EQ(answeredA.load(), 10);
+    EXPECT_EQ(answeredB.load(), 10);
+}
+
+TEST(ClientServerSai, routerNotificationFanOut)
+{
+    // server publishes notifications received by its sai from syncd
+
+    auto server = std::make_shared<ClientServerSai>();
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS, server->apiInitialize(0, &test_router_services));
+
+    std::atomic<int> receivedA(0);
+    std::atomic<int> receivedB(0);
+
+    auto ntf = [](std::atomic<int>* received, const std::string& name, const std::string& data)
+    {
+        SWSS_LOG_ENTER();
+
+        EXPECT_EQ(name, SAI_SWITCH_NOTIFICATION_NAME_SWITCH_SHUTDOWN_REQUEST);
+        EXPECT_EQ(data, "{\"switch_id\":\"oid:0x21000000000000\"}");
+
+        (*received)++;
+    };
+
+    auto ca = std::make_shared<ZeroMQBinaryChannel>(
+            "ipc:///tmp/saiServerRouter",
+            "ipc:///tmp/saiServerRouterNtf",
+            [&](const std::string& name, const std::string& data, const std::vector<swss::FieldValueTuple>& values) { ntf(&receivedA, name, data); },
+            "a");
+
+    auto cb = std::make_shared<ZeroMQBinaryChannel>(
+            "ipc:///tmp/saiServerRouter",
+            "ipc:///tmp/saiServerRouterNtf",
+            [&](const std::string& name, const std::string& data, const std::vector<swss::FieldValueTuple>& values) { ntf(&receivedB, name, data); },
+            "b");
+
+    auto db = std::make_shared<swss::DBConnector>("ASIC_DB", 0);
+
+    swss::NotificationProducer syncd(db.get(), REDIS_TABLE_NOTIFICATIONS);
+
+    std::vector<swss::FieldValueTuple> values;
+
+    // subscriptions are propagated asynchronously, so send notification
+    // until both clients receive it
+
+    for (int i = 0; i < 100 && (receivedA == 0 || receivedB == 0); i++)
+    {
+        syncd.send(SAI_SWITCH_NOTIFICATION_NAME_SWITCH_SHUTDOWN_REQUEST, "{\"switch_id\":\"oid:0x21000000000000\"}", values);
+
+        usleep(50*1000);
+    }
+
+    EXPECT_GT(receivedA.load(), 0);
+    EXPECT_GT(receivedB.load(), 0);
+
+    ca = nullptr;
+    cb = nullptr;
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS, server->apiUninitialize());
+}
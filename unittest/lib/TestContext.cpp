@@ -1,11 +1,91 @@
 #include "Context.h"
+#include "MockChannel.h"
+#include "sairediscommon.h"
+
+#include "meta/NotificationSwitchShutdownRequest.h"
 
 #include "swss/logger.h"
 
 #include <gtest/gtest.h>
 
+#include <thread>
+#include <condition_variable>
+
 using namespace sairedis;
 
+/**
+ * @brief Mock channel which blocks in wait until released.
+ */
+class BlockingChannel:
+    public MockChannel
+{
+    public:
+
+        BlockingChannel():
+            m_waiting(false),
+            m_released(false)
+        {
+            SWSS_LOG_ENTER();
+
+            // empty
+        }
+
+        virtual sai_status_t wait(
+                _In_ const std::string& command,
+                _Out_ swss::KeyOpFieldsValuesTuple& kco) override
+        {
+            SWSS_LOG_ENTER();
+
+            std::unique_lock<std::mutex> lock(m_mutex);
+
+            m_waiting = true;
+
+            m_cv.notify_all();
+
+            while (!m_released)
+            {
+                m_cv.wait(lock);
+            }
+
+            lock.unlock();
+
+            return MockChannel::wait(command, kco);
+        }
+
+        void waitForCaller()
+        {
+            SWSS_LOG_ENTER();
+
+            std::unique_lock<std::mutex> lock(m_mutex);
+
+            while (!m_waiting)
+            {
+                m_cv.wait(lock);
+            }
+        }
+
+        void release()
+        {
+            SWSS_LOG_ENTER();
+
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            m_released = true;
+
+            m_cv.notify_all();
+        }
+
+    private:
+
+        std::mutex m_mutex;
+
+        std::condition_variable m_cv;
+
+        bool m_waiting;
+
+        bool m_released;
+};
+
 static sai_switch_notifications_t handle_notification(
         _In_ std::shared_ptr<Notification> notification,
         _In_ Context* context)
@@ -38,21 +118,202 @@ TEST(Context, bulkGetClearStats)
 
     auto ctx = std::make_shared<Context>(cc, recorder,handle_notification);
 
-    EXPECT_EQ(SAI_STATUS_NOT_IMPLEMENTED, ctx->m_redisSai->bulkGetStats(SAI_NULL_OBJECT_ID,
-                                                                        SAI_OBJECT_TYPE_PORT,
-                                                                        0,
-                                                                        nullptr,
-                                                                        0,
-                                                                        nullptr,
-                                                                        SAI_STATS_MODE_BULK_READ,
-                                                                        nullptr,
-                                                                        nullptr));
-    EXPECT_EQ(SAI_STATUS_NOT_IMPLEMENTED, ctx->m_redisSai->bulkClearStats(SAI_NULL_OBJECT_ID,
+    EXPECT_EQ(SAI_STATUS_INVALID_PARAMETER, ctx->m_redisSai->bulkGetStats(SAI_NULL_OBJECT_ID,
                                                                           SAI_OBJECT_TYPE_PORT,
                                                                           0,
                                                                           nullptr,
                                                                           0,
                                                                           nullptr,
-                                                                          SAI_STATS_MODE_BULK_CLEAR,
+                                                                          SAI_STATS_MODE_BULK_READ,
+                                                                          nullptr,
                                                                           nullptr));
+    EXPECT_EQ(SAI_STATUS_INVALID_PARAMETER, ctx->m_redisSai->bulkClearStats(SAI_NULL_OBJECT_ID,
+                                                                            SAI_OBJECT_TYPE_PORT,
+                                                                            0,
+                                                                            nullptr,
+                                                                            0,
+                                                                            nullptr,
+                                                                            SAI_STATS_MODE_BULK_CLEAR,
+                                                                            nullptr));
+}
+
+TEST(Context, metaMutex)
+{
+    auto recorder = std::make_shared<Recorder>();
+
+    auto cc0 = std::make_shared<ContextConfig>(0, "syncd", "ASIC_DB", "COUNTERS_DB","FLEX_DB", "STATE_DB");
+    auto cc1 = std::make_shared<ContextConfig>(1, "syncd1", "ASIC_DB", "COUNTERS_DB","FLEX_DB", "STATE_DB");
+
+    auto ctx0 = std::make_shared<Context>(cc0, recorder, handle_notification);
+    auto ctx1 = std::make_shared<Context>(cc1, recorder, handle_notification);
+
+    ASSERT_NE(ctx0->m_metaMutex, nullptr);
+    ASSERT_NE(ctx1->m_metaMutex, nullptr);
+
+    // contexts are locked independently
+
+    std::lock_guard<std::mutex> apiLock(*ctx0->m_apiMutex);
+    std::lock_guard<std::mutex> metaLock(*ctx0->m_metaMutex);
+
+    EXPECT_TRUE(ctx1->m_apiMutex->try_lock());
+    EXPECT_TRUE(ctx1->m_metaMutex->try_lock());
+
+    ctx1->m_metaMutex->unlock();
+    ctx1->m_apiMutex->unlock();
+}
+
+TEST(Context, getWaitReleasesMetaMutex)
+{
+    auto recorder = std::make_shared<Recorder>();
+
+    auto cc0 = std::make_shared<ContextConfig>(0, "syncd", "ASIC_DB", "COUNTERS_DB","FLEX_DB", "STATE_DB");
+    auto cc1 = std::make_shared<ContextConfig>(1, "syncd1", "ASIC_DB", "COUNTERS_DB","FLEX_DB", "STATE_DB");
+
+    auto ctx0 = std::make_shared<Context>(cc0, recorder, handle_notification);
+    auto ctx1 = std::make_shared<Context>(cc1, recorder, handle_notification);
+
+    auto channel0 = std::make_shared<BlockingChannel>();
+    auto channel1 = std::make_shared<MockChannel>();
+
+    channel0->m_responses.emplace_back("SAI_STATUS_FAILURE", REDIS_ASIC_STATE_COMMAND_GETRESPONSE, std::vector<swss::FieldValueTuple>());
+    channel1->m_responses.emplace_back("SAI_STATUS_NOT_SUPPORTED", REDIS_ASIC_STATE_COMMAND_GETRESPONSE, std::vector<swss::FieldValueTuple>());
+
+    ctx0->m_redisSai->setCommunicationChannel(channel0);
+    ctx1->m_redisSai->setCommunicationChannel(channel1);
+
+    sai_status_t status0 = SAI_STATUS_SUCCESS;
+
+    // locked the same way as by Sai API call
+
+    std::thread reader([&]() {
+
+            SWSS_LOG_ENTER();
+
+            std::lock_guard<std::mutex> apiLock(*ctx0->m_apiMutex);
+            std::lock_guard<std::mutex> metaLock(*ctx0->m_metaMutex);
+
+            sai_attribute_t attr;
+
+            attr.id = SAI_SWITCH_ATTR_PORT_NUMBER;
+
+            status0 = ctx0->m_redisSai->get(SAI_OBJECT_TYPE_SWITCH, (sai_object_id_t)0x21000000000000, 1, &attr);
+    });
+
+    channel0->waitForCaller();
+
+    {
+        // notification is processed while get waits for response
+
+        std::lock_guard<std::mutex> metaLock(*ctx0->m_metaMutex);
+
+        auto ntf = std::make_shared<NotificationSwitchShutdownRequest>("{\"switch_id\":\"oid:0x21000000000000\"}");
+
+        ctx0->m_redisSai->syncProcessNotification(ntf);
+    }
+
+    {
+        // but call on other context is not blocked
+
+        std::lock_guard<std::mutex> apiLock(*ctx1->m_apiMutex);
+        std::lock_guard<std::mutex> metaLock(*ctx1->m_metaMutex);
+
+        sai_attribute_t attr;
+
+        attr.id = SAI_SWITCH_ATTR_PORT_NUMBER;
+
+        EXPECT_EQ(SAI_STATUS_NOT_SUPPORTED, ctx1->m_redisSai->get(SAI_OBJECT_TYPE_SWITCH, (sai_object_id_t)0x21000000000000, 1, &attr));
+    }
+
+    channel0->release();
+
+    reader.join();
+
+    EXPECT_EQ(status0, SAI_STATUS_FAILURE);
+
+    EXPECT_EQ(channel0->m_sent.size(), 1);
+    EXPECT_EQ(channel1->m_sent.size(), 1);
+}
+
+TEST(Context, getDoesNotBlockSetOnFullDuplexChannel)
+{
+    auto recorder = std::make_shared<Recorder>();
+
+    auto cc = std::make_shared<ContextConfig>(0, "syncd", "ASIC_DB", "COUNTERS_DB","FLEX_DB", "STATE_DB");
+
+    auto ctx = std::make_shared<Context>(cc, recorder, handle_notification);
+
+    auto channel = std::make_shared<BlockingChannel>();
+
+    ctx->m_redisSai->setCommunicationChannel(channel);
+
+    channel->m_pipelined = true;
+    channel->m_fullDuplex = true;
+
+    // set is answered before get, responses are matched by correlation id
+
+    channel->m_responses.emplace_back("SAI_STATUS_NOT_SUPPORTED", REDIS_ASIC_STATE_COMMAND_GETRESPONSE,
+            std::vector<swss::FieldValueTuple>{ { REDIS_CORRELATION_ID_FIELD, "2" } });
+
+    channel->m_responses.emplace_back("SAI_STATUS_FAILURE", REDIS_ASIC_STATE_COMMAND_GETRESPONSE,
+            std::vector<swss::FieldValueTuple>{ { REDIS_CORRELATION_ID_FIELD, "1" } });
+
+    sai_status_t getStatus = SAI_STATUS_SUCCESS;
+    sai_status_t setStatus = SAI_STATUS_SUCCESS;
+
+    // locked the same way as by Sai API call
+
+    std::thread reader([&]() {
+
+            SWSS_LOG_ENTER();
+
+            std::lock_guard<std::mutex> apiLock(*ctx->m_apiMutex);
+            std::lock_guard<std::mutex> metaLock(*ctx->m_metaMutex);
+
+            sai_attribute_t attr;
+
+            attr.id = SAI_SWITCH_ATTR_PORT_NUMBER;
+
+            getStatus = ctx->m_redisSai->get(SAI_OBJECT_TYPE_SWITCH, (sai_object_id_t)0x21000000000000, 1, &attr);
+    });
+
+    channel->waitForCaller();
+
+    std::thread writer([&]() {
+
+            SWSS_LOG_ENTER();
+
+            std::lock_guard<std::mutex> apiLock(*ctx->m_apiMutex);
+            std::lock_guard<std::mutex> metaLock(*ctx->m_metaMutex);
+
+            sai_attribute_t attr;
+
+            attr.id = SAI_SWITCH_ATTR_SRC_MAC_ADDRESS;
+
+            memset(attr.value.mac, 0, sizeof(attr.value.mac));
+
+            setStatus = ctx->m_redisSai->set(SAI_OBJECT_TYPE_SWITCH, (sai_object_id_t)0x21000000000000, &attr);
+    });
+
+    // set takes API mutex and sends its request while get still waits for
+    // response, it will wait for its own response until get receives it
+
+    while (ctx->m_redisSai->getAsyncResponseCount() < 2)
+    {
+        std::this_thread::yield();
+    }
+
+    EXPECT_EQ(channel->m_sent.size(), 2);
+
+    channel->release();
+
+    writer.join();
+    reader.join();
+
+    EXPECT_EQ(getStatus, SAI_STATUS_FAILURE);
+    EXPECT_EQ(setStatus, SAI_STATUS_NOT_SUPPORTED);
+
+    EXPECT_EQ(kfvOp(channel->m_sent.at(0)), REDIS_ASIC_STATE_COMMAND_GET);
+    EXPECT_EQ(kfvOp(channel->m_sent.at(1)), REDIS_ASIC_STATE_COMMAND_SET);
+
+    EXPECT_EQ(ctx->m_redisSai->getAsyncResponseCount(), 0);
 }
@@ -0,0 +1,111 @@
+#include "FlightRecorder.h"
+
+#include "swss/logger.h"
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <sstream>
+
+#include <unistd.h>
+
+using namespace sairedis;
+
+#define FLIGHT_RECORDER_TEST_FILE "flight_recorder_test.rec"
+
+static std::string read_file(
+        _In_ const std::string& name)
+{
+    SWSS_LOG_ENTER();
+
+    std::ifstream ifs(name);
+
+    std::stringstream ss;
+
+    ss << ifs.rdbuf();
+
+    return ss.str();
+}
+
+TEST(FlightRecorder, ctr)
+{
+    EXPECT_THROW(FlightRecorder(0), std::runtime_error);
+
+    FlightRecorder fr(1024);
+
+    EXPECT_EQ(fr.getCapacity(), 1024);
+    EXPECT_EQ(fr.getMemoryUsage(), 0);
+}
+
+TEST(FlightRecorder, dump)
+{
+    FlightRecorder fr(1024 * 1024);
+
+    std::string expected;
+
+    for (int i = 0; i < 10000; i++)
+    {
+        auto record = "s|SAI_OBJECT_TYPE_PORT:oid:0x" + std::to_string(i) + "|SAI_PORT_ATTR_MTU=9100\n";
+
+        fr.record(record);
+
+        expected += record;
+    }
+
+    EXPECT_TRUE(fr.dump(FLIGHT_RECORDER_TEST_FILE));
+
+    EXPECT_EQ(read_file(FLIGHT_RECORDER_TEST_FILE), expected);
+
+    // dump waited for compression thread, records are repetitive, so they
+    // compress well
+
+    EXPECT_LT(fr.getMemoryUsage(), expected.size() / 4);
+
+    EXPECT_EQ(fr.getDroppedChunkCount(), 0);
+
+    // records are kept after dump
+
+    fr.record("foo\n");
+
+    EXPECT_TRUE(fr.dump(FLIGHT_RECORDER_TEST_FILE));
+
+    EXPECT_EQ(read_file(FLIGHT_RECORDER_TEST_FILE), expected + "foo\n");
+
+    unlink(FLIGHT_RECORDER_TEST_FILE);
+
+    EXPECT_FALSE(fr.dump("/nonexisting/dir/file"));
+}
+
+TEST(FlightRecorder, oldestRecordsDropped)
+{
+    FlightRecorder fr(64 * 1024);
+
+    for (int i = 0; i < 100000; i++)
+    {
+        fr.record(std::to_string(i) + "|" + std::string(i % 100, 'x') + "\n");
+
+        EXPECT_LE(fr.getMemoryUsage(), 64 * 1024);
+    }
+
+    EXPECT_GT(fr.getDroppedChunkCount(), 0);
+
+    EXPECT_TRUE(fr.dump(FLIGHT_RECORDER_TEST_FILE));
+
+    auto content = read_file(FLIGHT_RECORDER_TEST_FILE);
+
+    unlink(FLIGHT_RECORDER_TEST_FILE);
+
+    // chunks end at record boundary, so dump starts with whole record
+
+    EXPECT_NE(content.find("|"), std::string::npos);
+
+    EXPECT_GT(std::stoi(content.substr(0, content.find("|"))), 0);
+
+    auto last = content.rfind("99998|");
+
+    ASSERT_NE(last, std::string::npos);
+
+    EXPECT_LT(last, content.rfind("99999|"));
+
+    EXPECT_EQ(content.back(), '\n');
+}
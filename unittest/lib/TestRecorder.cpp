@@ -1,8 +1,16 @@
 #include "Recorder.h"
+#include "BinaryRecordingReader.h"
+
+#include "swss/logger.h"
 
 #include <gtest/gtest.h>
 
 #include <memory>
+#include <fstream>
+#include <sstream>
+
+#include <unistd.h>
+#include <dirent.h>
 
 using namespace sairedis;
 
@@ -26,3 +34,189 @@ TEST(Recorder, requestLogRotate)
 
     rec.recordComment("bar");
 }
+
+static std::string read_file(
+        _In_ const std::string& name)
+{
+    SWSS_LOG_ENTER();
+
+    std::ifstream ifs(name);
+
+    std::stringstream ss;
+
+    ss << ifs.rdbuf();
+
+    return ss.str();
+}
+
+TEST(Recorder, asyncRecording)
+{
+    unlink("sairedis.rec");
+
+    Recorder rec;
+
+    rec.setAsyncBufferSize(1024 * 1024);
+
+    rec.enableRecording(true);
+
+    for (int i = 0; i < 1000; i++)
+    {
+        rec.recordComment("record " + std::to_string(i));
+    }
+
+    // disabling recording writes all buffered records
+
+    rec.enableRecording(false);
+
+    auto content = read_file("sairedis.rec");
+
+    EXPECT_NE(content.find("|#|record 0\n"), std::string::npos);
+    EXPECT_NE(content.find("|#|record 999\n"), std::string::npos);
+    EXPECT_LT(content.find("|#|record 998\n"), content.find("|#|record 999\n"));
+
+    EXPECT_EQ(rec.getDroppedRecordCount(), 0);
+}
+
+TEST(Recorder, asyncRecordingDrop)
+{
+    unlink("sairedis.rec");
+
+    Recorder rec;
+
+    rec.enableRecording(true);
+
+    rec.setAsyncBufferSize(100);
+
+    for (int i = 0; i < 100; i++)
+    {
+        rec.recordComment(std::string(80, 'x'));
+    }
+
+    rec.setAsyncBufferSize(0);
+
+    EXPECT_GT(rec.getDroppedRecordCount(), 0);
+
+    rec.recordComment("sync");
+
+    auto content = read_file("sairedis.rec");
+
+    EXPECT_NE(content.find("records, recording buffer full\n"), std::string::npos);
+    EXPECT_LT(content.find("records, recording buffer full\n"), content.find("|#|sync\n"));
+}
+
+TEST(Recorder, asyncRecordingLogRotate)
+{
+    unlink("sairedis.rec");
+
+    Recorder rec;
+
+    rec.setAsyncBufferSize(1024 * 1024);
+
+    rec.enableRecording(true);
+
+    rec.recordComment("foo");
+
+    EXPECT_EQ(rename("sairedis.rec", "sairedis.rec.1"), 0);
+
+    rec.requestLogRotate();
+
+    rec.recordComment("bar");
+
+    rec.enableRecording(false);
+
+    auto rotated = read_file("sairedis.rec.1");
+    auto content = read_file("sairedis.rec");
+
+    EXPECT_NE(rotated.find("|#|foo\n"), std::string::npos);
+    EXPECT_EQ(rotated.find("|#|bar\n"), std::string::npos);
+
+    EXPECT_NE(content.find("|#|logrotate on: ./sairedis.rec\n"), std::string::npos);
+    EXPECT_NE(content.find("|#|bar\n"), std::string::npos);
+}
+
+TEST(Recorder, flightRecorder)
+{
+    Recorder rec;
+
+    EXPECT_FALSE(rec.isRecording());
+
+    EXPECT_FALSE(rec.dumpFlightRecorder("test"));
+
+    rec.setFlightRecorderSize(1024 * 1024);
+
+    EXPECT_TRUE(rec.isRecording());
+
+    // recording to file is disabled
+
+    rec.recordComment("foo");
+
+    EXPECT_TRUE(rec.dumpFlightRecorder("test"));
+
+    std::string name;
+
+    DIR* dir = opendir(".");
+
+    ASSERT_NE(dir, nullptr);
+
+    while (struct dirent* entry = readdir(dir))
+    {
+        if (std::string(entry->d_name).find("sairedis.rec.flight.") == 0)
+        {
+            name = entry->d_name;
+        }
+    }
+
+    closedir(dir);
+
+    ASSERT_NE(name, "");
+
+    auto content = read_file(name);
+
+    unlink(name.c_str());
+
+    EXPECT_NE(content.find("|#|foo\n"), std::string::npos);
+    EXPECT_NE(content.find("|#|flight recorder dump: test\n"), std::string::npos);
+
+    rec.setFlightRecorderSize(0);
+
+    EXPECT_FALSE(rec.isRecording());
+
+    EXPECT_FALSE(rec.dumpFlightRecorder("test"));
+}
+
+TEST(Recorder, binaryRecording)
+{
+    unlink("sairedis.rec.bin");
+
+    Recorder rec;
+
+    EXPECT_FALSE(rec.setRecordingFormat((sai_redis_recording_format_t)100));
+
+    EXPECT_TRUE(rec.setRecordingFormat(SAI_REDIS_RECORDING_FORMAT_BINARY));
+
+    rec.enableRecording(true);
+
+    rec.recordComment("foo");
+
+    rec.enableRecording(false);
+
+    BinaryRecordingReader reader("sairedis.rec.bin");
+
+    std::string line;
+
+    std::vector<std::string> lines;
+
+    while (reader.next(line))
+    {
+        lines.push_back(line);
+    }
+
+    ASSERT_EQ(lines.size(), 2);
+
+    EXPECT_NE(lines[0].find("|#|recording on: ./sairedis.rec.bin"), std::string::npos);
+    EXPECT_NE(lines[1].find("|#|foo"), std::string::npos);
+
+    EXPECT_TRUE(rec.setRecordingFormat(SAI_REDIS_RECORDING_FORMAT_TEXT));
+
+    unlink("sairedis.rec.bin");
+}
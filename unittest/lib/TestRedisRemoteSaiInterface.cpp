@@ -1,10 +1,43 @@
 #include "RedisRemoteSaiInterface.h"
 #include "ContextConfigContainer.h"
+#include "MockChannel.h"
+
+#include "meta/sai_serialize.h"
 
 #include <gtest/gtest.h>
 
+#include <fstream>
+
+#include <string.h>
+#include <unistd.h>
+
 using namespace sairedis;
 
+static swss::KeyOpFieldsValuesTuple make_response(
+        _In_ sai_status_t status,
+        _In_ uint64_t correlationId)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<swss::FieldValueTuple> values;
+
+    values.emplace_back(REDIS_CORRELATION_ID_FIELD, std::to_string(correlationId));
+
+    return swss::KeyOpFieldsValuesTuple(sai_serialize_status(status), REDIS_ASIC_STATE_COMMAND_GETRESPONSE, values);
+}
+
+static sai_attribute_t admin_state_attr()
+{
+    SWSS_LOG_ENTER();
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_PORT_ATTR_ADMIN_STATE;
+    attr.value.booldata = true;
+
+    return attr;
+}
+
 TEST(RedisRemoteSaiInterface, bulkGet)
 {
     auto ctx = ContextConfigContainer::loadFromFile("foo");
@@ -28,3 +61,307 @@ TEST(RedisRemoteSaiInterface, bulkGet)
                 statuses));
 }
 
+
+TEST(RedisRemoteSaiInterface, asyncOutOfOrderResponses)
+{
+    auto ctx = ContextConfigContainer::loadFromFile("foo");
+    auto rec = std::make_shared<Recorder>();
+
+    RedisRemoteSaiInterface sai(ctx->get(0), nullptr, rec);
+
+    auto channel = std::make_shared<MockChannel>();
+
+    channel->m_pipelined = true;
+
+    sai.setCommunicationChannel(channel);
+
+    auto attr = admin_state_attr();
+
+    auto f1 = sai.setAsync(SAI_OBJECT_TYPE_PORT, "oid:0x1000000000001", &attr);
+    auto f2 = sai.removeAsync(SAI_OBJECT_TYPE_PORT, "oid:0x1000000000002");
+    auto f3 = sai.createAsync(SAI_OBJECT_TYPE_VLAN, "oid:0x26000000000001", 0, nullptr);
+
+    EXPECT_EQ(channel->m_sent.size(), 3);
+    EXPECT_EQ(sai.getAsyncResponseCount(), 3);
+
+    channel->m_responses.push_back(make_response(SAI_STATUS_SUCCESS, 3));
+    channel->m_responses.push_back(make_response(SAI_STATUS_FAILURE, 1));
+    channel->m_responses.push_back(make_response(SAI_STATUS_INVALID_PARAMETER, 2));
+
+    // responses of requests 3 and 1 are received before one of request 2
+
+    EXPECT_EQ(f2.get(), SAI_STATUS_INVALID_PARAMETER);
+
+    EXPECT_TRUE(channel->m_responses.empty());
+    EXPECT_EQ(sai.getAsyncResponseCount(), 2);
+
+    EXPECT_EQ(f3.get(), SAI_STATUS_SUCCESS);
+    EXPECT_EQ(f1.get(), SAI_STATUS_FAILURE);
+
+    EXPECT_EQ(sai.getAsyncResponseCount(), 0);
+}
+
+TEST(RedisRemoteSaiInterface, asyncTimeoutFailsAllInFlight)
+{
+    auto ctx = ContextConfigContainer::loadFromFile("foo");
+    auto rec = std::make_shared<Recorder>();
+
+    RedisRemoteSaiInterface sai(ctx->get(0), nullptr, rec);
+
+    auto channel = std::make_shared<MockChannel>();
+
+    channel->m_pipelined = true;
+
+    sai.setCommunicationChannel(channel);
+
+    auto attr = admin_state_attr();
+
+    auto f1 = sai.setAsync(SAI_OBJECT_TYPE_PORT, "oid:0x1000000000001", &attr);
+    auto f2 = sai.setAsync(SAI_OBJECT_TYPE_PORT, "oid:0x1000000000002", &attr);
+    auto f3 = sai.removeAsync(SAI_OBJECT_TYPE_PORT, "oid:0x1000000000003");
+
+    // no responses queued, so channel wait times out
+
+    EXPECT_EQ(f2.get(), SAI_STATUS_FAILURE);
+
+    EXPECT_EQ(sai.getAsyncResponseCount(), 2);
+
+    EXPECT_EQ(f1.get(), SAI_STATUS_FAILURE);
+    EXPECT_EQ(f3.get(), SAI_STATUS_FAILURE);
+
+    EXPECT_EQ(sai.getAsyncResponseCount(), 0);
+}
+
+TEST(RedisRemoteSaiInterface, asyncAbandonedFuture)
+{
+    auto ctx = ContextConfigContainer::loadFromFile("foo");
+    auto rec = std::make_shared<Recorder>();
+
+    RedisRemoteSaiInterface sai(ctx->get(0), nullptr, rec);
+
+    auto channel = std::make_shared<MockChannel>();
+
+    channel->m_pipelined = true;
+
+    sai.setCommunicationChannel(channel);
+
+    auto attr = admin_state_attr();
+
+    {
+        // future destroyed while request is in flight
+
+        auto f = sai.setAsync(SAI_OBJECT_TYPE_PORT, "oid:0x1000000000001", &attr);
+    }
+
+    auto f2 = sai.setAsync(SAI_OBJECT_TYPE_PORT, "oid:0x1000000000002", &attr);
+
+    channel->m_responses.push_back(make_response(SAI_STATUS_SUCCESS, 1));
+    channel->m_responses.push_back(make_response(SAI_STATUS_SUCCESS, 2));
+
+    EXPECT_EQ(f2.get(), SAI_STATUS_SUCCESS);
+
+    EXPECT_EQ(sai.getAsyncResponseCount(), 0);
+
+    {
+        // future destroyed after response was received
+
+        auto f3 = sai.setAsync(SAI_OBJECT_TYPE_PORT, "oid:0x1000000000003", &attr);
+        auto f4 = sai.setAsync(SAI_OBJECT_TYPE_PORT, "oid:0x1000000000004", &attr);
+
+        channel->m_responses.push_back(make_response(SAI_STATUS_SUCCESS, 3));
+        channel->m_responses.push_back(make_response(SAI_STATUS_SUCCESS, 4));
+
+        EXPECT_EQ(f4.get(), SAI_STATUS_SUCCESS);
+
+        EXPECT_EQ(sai.getAsyncResponseCount(), 1);
+    }
+
+    // next request drops response nobody will collect
+
+    auto f5 = sai.removeAsync(SAI_OBJECT_TYPE_PORT, "oid:0x1000000000005");
+
+    EXPECT_EQ(sai.getAsyncResponseCount(), 1);
+
+    channel->m_responses.push_back(make_response(SAI_STATUS_SUCCESS, 5));
+
+    EXPECT_EQ(f5.get(), SAI_STATUS_SUCCESS);
+
+    EXPECT_EQ(sai.getAsyncResponseCount(), 0);
+}
+
+TEST(RedisRemoteSaiInterface, asyncNotPipelined)
+{
+    auto ctx = ContextConfigContainer::loadFromFile("foo");
+    auto rec = std::make_shared<Recorder>();
+
+    RedisRemoteSaiInterface sai(ctx->get(0), nullptr, rec);
+
+    auto channel = std::make_shared<MockChannel>();
+
+    sai.setCommunicationChannel(channel);
+
+    // response is collected before future is returned
+
+    channel->m_responses.push_back(make_response(SAI_STATUS_NOT_SUPPORTED, 1));
+
+    auto f = sai.removeAsync(SAI_OBJECT_TYPE_PORT, "oid:0x1000000000001");
+
+    EXPECT_TRUE(channel->m_responses.empty());
+    EXPECT_EQ(sai.getAsyncResponseCount(), 0);
+
+    EXPECT_EQ(f.get(), SAI_STATUS_NOT_SUPPORTED);
+}
+
+TEST(RedisRemoteSaiInterface, toggleBatchingWithRequestsInFlight)
+{
+    auto ctx = ContextConfigContainer::loadFromFile("foo");
+    auto rec = std::make_shared<Recorder>();
+
+    RedisRemoteSaiInterface sai(ctx->get(0), nullptr, rec);
+
+    auto channel = std::make_shared<MockChannel>();
+
+    channel->m_pipelined = true;
+
+    sai.setCommunicationChannel(channel);
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_REDIS_SWITCH_ATTR_AUTO_BATCH_TIMEOUT;
+    attr.value.u64 = 0;
+
+    EXPECT_EQ(sai.set(SAI_OBJECT_TYPE_SWITCH, SAI_NULL_OBJECT_ID, &attr), SAI_STATUS_SUCCESS);
+
+    attr.id = SAI_REDIS_SWITCH_ATTR_AUTO_BATCH_SIZE;
+    attr.value.u32 = 4;
+
+    EXPECT_EQ(sai.set(SAI_OBJECT_TYPE_SWITCH, SAI_NULL_OBJECT_ID, &attr), SAI_STATUS_SUCCESS);
+
+    auto f1 = sai.createAsync(SAI_OBJECT_TYPE_ROUTE_ENTRY, "{\"dest\":\"10.0.0.1/32\"}", 0, nullptr);
+    auto f2 = sai.createAsync(SAI_OBJECT_TYPE_ROUTE_ENTRY, "{\"dest\":\"10.0.0.2/32\"}", 0, nullptr);
+
+    EXPECT_EQ(channel->m_sent.size(), 0);
+    EXPECT_EQ(sai.getAsyncResponseCount(), 2);
+
+    std::vector<swss::FieldValueTuple> values;
+
+    values.emplace_back(sai_serialize_status(SAI_STATUS_SUCCESS), "");
+    values.emplace_back(sai_serialize_status(SAI_STATUS_INVALID_PARAMETER), "");
+
+    channel->m_responses.emplace_back(sai_serialize_status(SAI_STATUS_FAILURE), REDIS_ASIC_STATE_COMMAND_GETRESPONSE, values);
+
+    // batch is sent as bulk create and its response is split before
+    // batching channel is removed
+
+    attr.value.u32 = 0;
+
+    EXPECT_EQ(sai.set(SAI_OBJECT_TYPE_SWITCH, SAI_NULL_OBJECT_ID, &attr), SAI_STATUS_SUCCESS);
+
+    ASSERT_EQ(channel->m_sent.size(), 1);
+    EXPECT_EQ(kfvOp(channel->m_sent[0]), REDIS_ASIC_STATE_COMMAND_BULK_CREATE);
+
+    EXPECT_TRUE(channel->m_responses.empty());
+
+    EXPECT_EQ(f1.get(), SAI_STATUS_SUCCESS);
+    EXPECT_EQ(f2.get(), SAI_STATUS_INVALID_PARAMETER);
+
+    EXPECT_EQ(sai.getAsyncResponseCount(), 0);
+}
+
+TEST(RedisRemoteSaiInterface, capabilityCacheFileVersion)
+{
+    auto ctx = ContextConfigContainer::loadFromFile("foo");
+    auto rec = std::make_shared<Recorder>();
+
+    RedisRemoteSaiInterface sai(ctx->get(0), nullptr, rec);
+
+    const char* fileName = "capability_cache_version_test.txt";
+
+    unlink(fileName);
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_REDIS_SWITCH_ATTR_CAPABILITY_CACHE_FILE;
+    attr.value.s8list.count = (uint32_t)strlen(fileName);
+    attr.value.s8list.list = (int8_t*)const_cast<char*>(fileName);
+
+    EXPECT_EQ(sai.set(SAI_OBJECT_TYPE_SWITCH, SAI_NULL_OBJECT_ID, &attr), SAI_STATUS_SUCCESS);
+
+    std::ifstream bootIdFile("/proc/sys/kernel/random/boot_id");
+    std::ifstream file(fileName);
+
+    std::string bootId;
+    std::string header;
+
+    std::getline(bootIdFile, bootId);
+    std::getline(file, header);
+
+    // file written before reboot is truncated
+
+    ASSERT_FALSE(bootId.empty());
+    EXPECT_NE(header.find("/" + bootId), std::string::npos);
+
+    attr.value.s8list.count = 0;
+
+    EXPECT_EQ(sai.set(SAI_OBJECT_TYPE_SWITCH, SAI_NULL_OBJECT_ID, &attr), SAI_STATUS_SUCCESS);
+
+    unlink(fileName);
+}
+
+TEST(RedisRemoteSaiInterface, bulkGetStatsSerialize)
+{
+    auto ctx = ContextConfigContainer::loadFromFile("foo");
+    auto rec = std::make_shared<Recorder>();
+
+    RedisRemoteSaiInterface sai(ctx->get(0), nullptr, rec);
+
+    auto channel = std::make_shared<MockChannel>();
+
+    sai.setCommunicationChannel(channel);
+
+    sai_object_key_t keys[2];
+
+    keys[0].key.object_id = 0x15000000000001;
+    keys[1].key.object_id = 0x15000000000002;
+
+    sai_stat_id_t ids[2] = { SAI_QUEUE_STAT_PACKETS, SAI_QUEUE_STAT_BYTES };
+
+    sai_status_t statuses[2] = { SAI_STATUS_SUCCESS, SAI_STATUS_SUCCESS };
+    uint64_t counters[4];
+
+    // invalid arguments are not sent to syncd
+
+    EXPECT_EQ(SAI_STATUS_INVALID_PARAMETER,
+            sai.bulkGetStats(0x21000000000000, SAI_OBJECT_TYPE_QUEUE, 0, keys, 2, ids, SAI_STATS_MODE_READ, statuses, counters));
+
+    EXPECT_EQ(SAI_STATUS_INVALID_PARAMETER,
+            sai.bulkGetStats(0x21000000000000, SAI_OBJECT_TYPE_ROUTE_ENTRY, 2, keys, 2, ids, SAI_STATS_MODE_READ, statuses, counters));
+
+    EXPECT_EQ(channel->m_sent.size(), 0);
+
+    // no response, whole request fails
+
+    EXPECT_EQ(SAI_STATUS_FAILURE,
+            sai.bulkGetStats(0x21000000000000, SAI_OBJECT_TYPE_QUEUE, 2, keys, 2, ids, SAI_STATS_MODE_READ, statuses, counters));
+
+    EXPECT_EQ(statuses[0], SAI_STATUS_FAILURE);
+    EXPECT_EQ(statuses[1], SAI_STATUS_FAILURE);
+
+    ASSERT_EQ(channel->m_sent.size(), 1);
+
+    auto& kco = channel->m_sent[0];
+
+    EXPECT_EQ(kfvKey(kco), "SAI_OBJECT_TYPE_QUEUE:oid:0x21000000000000");
+    EXPECT_EQ(kfvOp(kco), REDIS_ASIC_STATE_COMMAND_BULK_GET_STATS);
+
+    auto& values = kfvFieldsValues(kco);
+
+    ASSERT_EQ(values.size(), 4);
+
+    EXPECT_EQ(fvField(values[0]), REDIS_STATS_MODE_FIELD);
+    EXPECT_EQ(fvValue(values[0]), "SAI_STATS_MODE_READ");
+    EXPECT_EQ(fvField(values[1]), REDIS_STATS_COUNTERS_FIELD);
+    EXPECT_EQ(fvValue(values[1]), "SAI_QUEUE_STAT_PACKETS,SAI_QUEUE_STAT_BYTES");
+    EXPECT_EQ(fvField(values[2]), "oid:0x15000000000001");
+    EXPECT_EQ(fvField(values[3]), "oid:0x15000000000002");
+}
@@ -14,3 +14,44 @@ TEST(RedisVidIndexGenerator, reset)
 
     g.reset();
 }
+
+TEST(RedisVidIndexGenerator, lease)
+{
+    auto db = std::make_shared<swss::DBConnector>("ASIC_DB", 0);
+
+    db->del("FOO");
+
+    RedisVidIndexGenerator g(db, "FOO");
+
+    EXPECT_EQ(g.increment(), 1);
+
+    g.setLeaseSize(10);
+
+    EXPECT_EQ(g.getLeaseSize(), 10);
+
+    EXPECT_EQ(g.increment(), 2);
+    EXPECT_EQ(g.increment(), 3);
+
+    // other allocator gets index after leased range
+
+    EXPECT_EQ(db->incr("FOO"), 12);
+
+    for (uint64_t idx = 4; idx <= 11; idx++)
+    {
+        EXPECT_EQ(g.increment(), idx);
+    }
+
+    EXPECT_EQ(g.increment(), 13);
+
+    // rest of the range is abandoned
+
+    g.reset();
+
+    EXPECT_EQ(g.increment(), 23);
+
+    g.setLeaseSize(0);
+
+    EXPECT_EQ(g.increment(), 33);
+
+    db->del("FOO");
+}
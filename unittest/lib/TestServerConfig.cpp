@@ -13,3 +13,14 @@ TEST(ServerConfig, loadFromFile)
     EXPECT_NE(ServerConfig::loadFromFile("files/server_config_ok.json"), nullptr);
     EXPECT_NE(ServerConfig::loadFromFile("files/server_config_bad.json"), nullptr);
 }
+
+TEST(ServerConfig, loadFromFileRouter)
+{
+    auto sc = ServerConfig::loadFromFile("files/server_config_router.json");
+
+    EXPECT_TRUE(sc->m_zmqRouter);
+
+    EXPECT_EQ(sc->m_zmqClientWeights.at("telemetry"), 2);
+
+    EXPECT_FALSE(ServerConfig::loadFromFile("files/server_config_ok.json")->m_zmqRouter);
+}
@@ -0,0 +1,151 @@
+#include "WriteCombiningChannel.h"
+#include "MockChannel.h"
+#include "sairediscommon.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include <unistd.h>
+
+using namespace sairedis;
+
+#define ROUTE_KEY "SAI_OBJECT_TYPE_ROUTE_ENTRY:{\"dest\":\"10.0.0.1/32\",\"switch_id\":\"oid:0x21000000000000\",\"vr\":\"oid:0x3000000000022\"}"
+#define NH_KEY "SAI_OBJECT_TYPE_NEXT_HOP:oid:0x40000000000001"
+
+static std::vector<swss::FieldValueTuple> nh_values(
+        _In_ const std::string& nh)
+{
+    SWSS_LOG_ENTER();
+
+    return { swss::FieldValueTuple("SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID", nh) };
+}
+
+TEST(WriteCombiningChannel, ctr)
+{
+    EXPECT_THROW(std::make_shared<WriteCombiningChannel>(nullptr, 1000), std::runtime_error);
+
+    EXPECT_THROW(std::make_shared<WriteCombiningChannel>(std::make_shared<MockChannel>(), 0), std::runtime_error);
+}
+
+TEST(WriteCombiningChannel, combineSet)
+{
+    auto mock = std::make_shared<MockChannel>();
+
+    WriteCombiningChannel c(mock, 1000 * 1000);
+
+    c.set(ROUTE_KEY, nh_values("oid:0x1"), REDIS_ASIC_STATE_COMMAND_SET);
+    c.set(ROUTE_KEY, nh_values("oid:0x2"), REDIS_ASIC_STATE_COMMAND_SET);
+    c.set(ROUTE_KEY, nh_values("oid:0x3"), REDIS_ASIC_STATE_COMMAND_SET);
+
+    EXPECT_EQ(mock->m_sent.size(), 0);
+
+    c.flush();
+
+    ASSERT_EQ(mock->m_sent.size(), 1);
+
+    EXPECT_EQ(fvValue(kfvFieldsValues(mock->m_sent[0])[0]), "oid:0x3");
+
+    EXPECT_EQ(c.getCombinedCount(), 2);
+    EXPECT_EQ(c.getRequestCorrelationId(), 3);
+}
+
+TEST(WriteCombiningChannel, barrier)
+{
+    auto mock = std::make_shared<MockChannel>();
+
+    WriteCombiningChannel c(mock, 1000 * 1000);
+
+    c.set(ROUTE_KEY, nh_values("oid:0x1"), REDIS_ASIC_STATE_COMMAND_SET);
+    c.del(NH_KEY, REDIS_ASIC_STATE_COMMAND_REMOVE);
+    c.set(ROUTE_KEY, nh_values("oid:0x2"), REDIS_ASIC_STATE_COMMAND_SET);
+
+    c.flush();
+
+    EXPECT_EQ(mock->m_sent.size(), 3);
+
+    EXPECT_EQ(c.getCombinedCount(), 0);
+}
+
+TEST(WriteCombiningChannel, cancelCreateRemove)
+{
+    auto mock = std::make_shared<MockChannel>();
+
+    WriteCombiningChannel c(mock, 1000 * 1000);
+
+    c.set(ROUTE_KEY, nh_values("oid:0x1"), REDIS_ASIC_STATE_COMMAND_CREATE);
+    c.set(ROUTE_KEY, nh_values("oid:0x2"), REDIS_ASIC_STATE_COMMAND_SET);
+    c.del(ROUTE_KEY, REDIS_ASIC_STATE_COMMAND_REMOVE);
+
+    c.flush();
+
+    EXPECT_EQ(mock->m_sent.size(), 0);
+
+    EXPECT_EQ(c.getCombinedCount(), 3);
+
+    // remove followed by create is not combined
+
+    c.del(ROUTE_KEY, REDIS_ASIC_STATE_COMMAND_REMOVE);
+    c.set(ROUTE_KEY, nh_values("oid:0x1"), REDIS_ASIC_STATE_COMMAND_CREATE);
+
+    c.flush();
+
+    ASSERT_EQ(mock->m_sent.size(), 2);
+
+    EXPECT_EQ(kfvOp(mock->m_sent[0]), REDIS_ASIC_STATE_COMMAND_REMOVE);
+    EXPECT_EQ(kfvOp(mock->m_sent[1]), REDIS_ASIC_STATE_COMMAND_CREATE);
+}
+
+TEST(WriteCombiningChannel, flushOnOtherMessage)
+{
+    auto mock = std::make_shared<MockChannel>();
+
+    WriteCombiningChannel c(mock, 1000 * 1000);
+
+    c.set(ROUTE_KEY, nh_values("oid:0x1"), REDIS_ASIC_STATE_COMMAND_SET);
+
+    c.set(ROUTE_KEY, {}, REDIS_ASIC_STATE_COMMAND_GET);
+
+    ASSERT_EQ(mock->m_sent.size(), 2);
+
+    EXPECT_EQ(kfvOp(mock->m_sent[0]), REDIS_ASIC_STATE_COMMAND_SET);
+    EXPECT_EQ(kfvOp(mock->m_sent[1]), REDIS_ASIC_STATE_COMMAND_GET);
+}
+
+TEST(WriteCombiningChannel, window)
+{
+    auto mock = std::make_shared<MockChannel>();
+
+    auto c = std::make_shared<WriteCombiningChannel>(mock, 50 * 1000);
+
+    c->set(ROUTE_KEY, nh_values("oid:0x1"), REDIS_ASIC_STATE_COMMAND_SET);
+    c->set(ROUTE_KEY, nh_values("oid:0x2"), REDIS_ASIC_STATE_COMMAND_SET);
+
+    usleep(200*1000);
+
+    ASSERT_EQ(mock->m_sent.size(), 1);
+
+    EXPECT_EQ(fvValue(kfvFieldsValues(mock->m_sent[0])[0]), "oid:0x2");
+
+    EXPECT_EQ(mock->m_flushCount, 0);
+}
+
+TEST(WriteCombiningChannel, windowBuffered)
+{
+    auto mock = std::make_shared<MockChannel>();
+
+    auto c = std::make_shared<WriteCombiningChannel>(mock, 50 * 1000);
+
+    c->setBuffered(true);
+
+    c->set(ROUTE_KEY, nh_values("oid:0x1"), REDIS_ASIC_STATE_COMMAND_SET);
+    c->set(ROUTE_KEY, nh_values("oid:0x2"), REDIS_ASIC_STATE_COMMAND_SET);
+
+    usleep(200*1000);
+
+    ASSERT_EQ(mock->m_sent.size(), 1);
+
+    // operations sent by timer are also flushed from underlying channel buffer
+
+    EXPECT_EQ(mock->m_flushCount, 1);
+}
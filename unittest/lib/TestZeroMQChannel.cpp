@@ -1,9 +1,18 @@
 #include "ZeroMQChannel.h"
+#include "ZeroMQSelectableChannel.h"
+#include "sairediscommon.h"
+
+#include "meta/NotificationFactory.h"
 
 #include "swss/logger.h"
+#include "swss/json.h"
 
 #include <gtest/gtest.h>
 
+#include <zmq.h>
+#include <unistd.h>
+
+#include <atomic>
 #include <memory>
 
 using namespace sairedis;
@@ -32,3 +41,140 @@ TEST(ZeroMQChannel, wait)
 
     EXPECT_NE(c->wait("foo", kco), SAI_STATUS_SUCCESS);
 }
+
+TEST(ZeroMQChannel, correlationId)
+{
+    ZeroMQSelectableChannel server("ipc:///tmp/zmq_correlation_ep");
+
+    auto c = std::make_shared<ZeroMQChannel>("ipc:///tmp/zmq_correlation_ep", "ipc:///tmp/zmq_correlation_ntf_ep", nullptr);
+
+    c->setResponseTimeout(1000);
+
+    EXPECT_EQ(c->getRequestCorrelationId(), Channel::NO_CORRELATION_ID);
+
+    std::vector<swss::FieldValueTuple> values;
+
+    values.emplace_back("SAI_PORT_ATTR_ADMIN_STATE", "true");
+
+    c->set("SAI_OBJECT_TYPE_PORT:oid:0x1", values, REDIS_ASIC_STATE_COMMAND_SET);
+
+    EXPECT_EQ(c->getRequestCorrelationId(), 1);
+
+    server.readData();
+
+    swss::KeyOpFieldsValuesTuple kco;
+
+    server.pop(kco, false);
+
+    // correlation id is not passed to request consumer
+
+    EXPECT_EQ(kfvKey(kco), "SAI_OBJECT_TYPE_PORT:oid:0x1");
+    EXPECT_EQ(kfvOp(kco), REDIS_ASIC_STATE_COMMAND_SET);
+    EXPECT_EQ(kfvFieldsValues(kco), values);
+
+    server.set("SAI_STATUS_SUCCESS", {}, REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
+
+    EXPECT_EQ(c->wait(REDIS_ASIC_STATE_COMMAND_GETRESPONSE, kco), SAI_STATUS_SUCCESS);
+
+    EXPECT_EQ(kfvFieldsValues(kco).size(), 0);
+
+    EXPECT_EQ(c->getResponseCorrelationId(), 1);
+
+    EXPECT_FALSE(c->isPipelined());
+}
+
+static std::string fdb_event(
+        _In_ int idx)
+{
+    SWSS_LOG_ENTER();
+
+    char mac[32];
+
+    snprintf(mac, sizeof(mac), "52:54:00:%02X:%02X:%02X", (idx >> 16) & 0xff, (idx >> 8) & 0xff, idx & 0xff);
+
+    return std::string("{\"fdb_entry\":\"{\\\"bvid\\\":\\\"oid:0x260000000005be\\\",\\\"mac\\\":\\\"") + mac +
+        "\\\",\\\"switch_id\\\":\\\"oid:0x21000000000000\\\"}\","
+        "\"fdb_event\":\"SAI_FDB_EVENT_LEARNED\","
+        "\"list\":[{\"id\":\"SAI_FDB_ENTRY_ATTR_TYPE\",\"value\":\"SAI_FDB_ENTRY_TYPE_DYNAMIC\"},"
+        "{\"id\":\"SAI_FDB_ENTRY_ATTR_BRIDGE_PORT_ID\",\"value\":\"oid:0x3a000000000660\"}]}";
+}
+
+TEST(ZeroMQChannel, notificationStress)
+{
+    const int count = 100000;
+
+    const int bigCount = 40000;
+
+    std::atomic<int> received(0);
+    std::atomic<int> deserialized(0);
+    std::atomic<size_t> maxSize(0);
+
+    auto callback = [&](
+            const std::string& name,
+            const std::string& data,
+            const std::vector<swss::FieldValueTuple>& values)
+    {
+        if (NotificationFactory::deserialize(name, data))
+        {
+            deserialized++;
+        }
+
+        if (data.size() > maxSize)
+        {
+            maxSize = data.size();
+        }
+
+        received++;
+    };
+
+    auto c = std::make_shared<ZeroMQChannel>("ipc:///tmp/zmq_stress_ep", "ipc:///tmp/zmq_stress_ntf_ep", callback);
+
+    void* ctx = zmq_ctx_new();
+    void* socket = zmq_socket(ctx, ZMQ_PUSH);
+
+    ASSERT_EQ(zmq_connect(socket, "ipc:///tmp/zmq_stress_ntf_ep"), 0);
+
+    for (int i = 0; i < count; i++)
+    {
+        std::vector<swss::FieldValueTuple> vals;
+
+        vals.emplace_back(SAI_SWITCH_NOTIFICATION_NAME_FDB_EVENT, "[" + fdb_event(i) + "]");
+
+        std::string msg = swss::JSon::buildJson(vals);
+
+        ASSERT_EQ(zmq_send(socket, msg.data(), msg.size(), 0), (int)msg.size());
+    }
+
+    // single FDB flush notification larger than old 4 MB receive buffer
+
+    std::string big = "[";
+
+    for (int i = 0; i < bigCount; i++)
+    {
+        big += (i ? "," : "") + fdb_event(i);
+    }
+
+    big += "]";
+
+    std::vector<swss::FieldValueTuple> vals;
+
+    vals.emplace_back(SAI_SWITCH_NOTIFICATION_NAME_FDB_EVENT, big);
+
+    std::string msg = swss::JSon::buildJson(vals);
+
+    EXPECT_GT(msg.size(), 4 * 1024 * 1024);
+
+    ASSERT_EQ(zmq_send(socket, msg.data(), msg.size(), 0), (int)msg.size());
+
+    for (int i = 0; i < 600 && received < count + 1; i++)
+    {
+        usleep(100 * 1000);
+    }
+
+    EXPECT_EQ(received.load(), count + 1);
+    EXPECT_EQ(deserialized.load(), count + 1);
+    EXPECT_EQ(maxSize.load(), big.size());
+
+    zmq_close(socket);
+    zmq_ctx_destroy(ctx);
+}
@@ -25,7 +25,9 @@ TEST(AttrKeyMap, clear)
 
     EXPECT_EQ(akm.getAllKeys().size(), 0);
 
-    akm.insert("foo", "bar");
+    sai_object_meta_key_t mk = { .objecttype = SAI_OBJECT_TYPE_PORT, .objectkey = { .key = { .object_id = 0x1000000000001 } } };
+
+    akm.insert(mk, "bar");
 
     EXPECT_EQ(akm.getAllKeys().size(), 1);
 
@@ -33,3 +35,76 @@ TEST(AttrKeyMap, clear)
 
     EXPECT_EQ(akm.getAllKeys().size(), 0);
 }
+
+TEST(AttrKeyMap, constructBinaryKey)
+{
+    sai_object_meta_key_t mk = { .objecttype = SAI_OBJECT_TYPE_PORT, .objectkey = { .key = { .object_id = 0 } } };
+
+    uint32_t list[4] = {1,2,3,4};
+
+    sai_attribute_t attrs[2];
+
+    attrs[0].id = SAI_PORT_ATTR_SPEED;
+    attrs[0].value.u32 = 10000;
+
+    attrs[1].id = SAI_PORT_ATTR_HW_LANE_LIST;
+    attrs[1].value.u32list.count = 4;
+    attrs[1].value.u32list.list = list;
+
+    sai_object_id_t switchId = 0x21000000000000;
+
+    auto key = AttrKeyMap::constructBinaryKey(switchId, mk, 2, attrs);
+
+    // only key attributes are used
+
+    EXPECT_EQ(key, AttrKeyMap::constructBinaryKey(switchId, mk, 1, &attrs[1]));
+
+    // different switch
+
+    EXPECT_NE(key, AttrKeyMap::constructBinaryKey(0x22000000000000, mk, 2, attrs));
+
+    list[3] = 5;
+
+    EXPECT_NE(key, AttrKeyMap::constructBinaryKey(switchId, mk, 2, attrs));
+
+    EXPECT_THROW(AttrKeyMap::constructBinaryKey(SAI_NULL_OBJECT_ID, mk, 2, attrs), std::runtime_error);
+}
+
+TEST(AttrKeyMap, attrKeyExists)
+{
+    AttrKeyMap akm;
+
+    sai_object_meta_key_t mk1 = { .objecttype = SAI_OBJECT_TYPE_PORT, .objectkey = { .key = { .object_id = 0x1000000000001 } } };
+    sai_object_meta_key_t mk2 = { .objecttype = SAI_OBJECT_TYPE_PORT, .objectkey = { .key = { .object_id = 0x1000000000002 } } };
+
+    akm.insert(mk1, "foo");
+    akm.insert(mk2, "bar");
+
+    EXPECT_TRUE(akm.attrKeyExists("foo"));
+    EXPECT_TRUE(akm.attrKeyExists("bar"));
+    EXPECT_FALSE(akm.attrKeyExists("baz"));
+
+    EXPECT_EQ(akm.size(), 2);
+
+    // replace key of existing object
+
+    akm.insert(mk1, "baz");
+
+    EXPECT_FALSE(akm.attrKeyExists("foo"));
+    EXPECT_TRUE(akm.attrKeyExists("baz"));
+
+    EXPECT_EQ(akm.size(), 2);
+
+    akm.eraseMetaKey(mk1);
+
+    EXPECT_FALSE(akm.attrKeyExists("baz"));
+    EXPECT_TRUE(akm.attrKeyExists("bar"));
+
+    EXPECT_EQ(akm.getAllMetaKeys().size(), 1);
+
+    // erase of not existing key is noop
+
+    akm.eraseMetaKey(mk1);
+
+    EXPECT_EQ(akm.size(), 1);
+}
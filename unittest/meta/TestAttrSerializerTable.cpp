@@ -0,0 +1,133 @@
+#include "AttrSerializerTable.h"
+
+#include "sai_serialize.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+using namespace saimeta;
+
+TEST(AttrSerializerTable, find)
+{
+    auto& table = AttrSerializerTable::getInstance();
+
+    EXPECT_EQ(table.size(), sai_metadata_attr_sorted_by_id_name_count);
+
+    for (size_t idx = 0; idx < sai_metadata_attr_sorted_by_id_name_count; ++idx)
+    {
+        auto meta = sai_metadata_attr_sorted_by_id_name[idx];
+
+        auto entry = table.find(*meta);
+
+        ASSERT_NE(entry, nullptr);
+
+        EXPECT_EQ(entry->meta, meta);
+
+        EXPECT_EQ(table.find(meta->objecttype, meta->attrid), entry);
+
+        EXPECT_EQ(table.findByName(meta->attridname), entry);
+    }
+
+    EXPECT_EQ(table.find(SAI_OBJECT_TYPE_NULL, 0), nullptr);
+
+    EXPECT_EQ(table.find(SAI_OBJECT_TYPE_PORT, SAI_PORT_ATTR_CUSTOM_RANGE_END), nullptr);
+
+    EXPECT_EQ(table.findByName("SAI_PORT_ATTR_FOO"), nullptr);
+}
+
+TEST(AttrSerializerTable, find_local_meta)
+{
+    auto& table = AttrSerializerTable::getInstance();
+
+    // copy of metadata may have different flags, so it can't use table
+
+    sai_attr_metadata_t meta = *sai_metadata_get_attr_metadata(SAI_OBJECT_TYPE_PORT, SAI_PORT_ATTR_ADMIN_STATE);
+
+    EXPECT_EQ(table.find(meta), nullptr);
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_PORT_ATTR_ADMIN_STATE;
+    attr.value.booldata = true;
+
+    EXPECT_EQ(sai_serialize_attr_value(meta, attr), "true");
+
+    std::string buf;
+
+    sai_serialize_attr_value(buf, meta, attr);
+
+    EXPECT_EQ(buf, "true");
+
+    attr.value.booldata = false;
+
+    sai_deserialize_attr_value("true", meta, attr);
+
+    EXPECT_TRUE(attr.value.booldata);
+}
+
+TEST(AttrSerializerTable, serialize)
+{
+    auto& table = AttrSerializerTable::getInstance();
+
+    auto meta = sai_metadata_get_attr_metadata(SAI_OBJECT_TYPE_PORT, SAI_PORT_ATTR_OPER_STATUS);
+
+    auto entry = table.find(*meta);
+
+    ASSERT_NE(entry, nullptr);
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_PORT_ATTR_OPER_STATUS;
+    attr.value.s32 = SAI_PORT_OPER_STATUS_UP;
+
+    EXPECT_EQ(entry->serialize(*meta, attr, false), "SAI_PORT_OPER_STATUS_UP");
+
+    std::string buf = "x=";
+
+    entry->serializeAppend(buf, *meta, attr, false);
+
+    EXPECT_EQ(buf, "x=SAI_PORT_OPER_STATUS_UP");
+
+    attr.value.s32 = 0;
+
+    entry->deserialize("SAI_PORT_OPER_STATUS_DOWN", *meta, attr, false);
+
+    EXPECT_EQ(attr.value.s32, SAI_PORT_OPER_STATUS_DOWN);
+}
+
+TEST(AttrSerializerTable, serialize_all)
+{
+    auto& table = AttrSerializerTable::getInstance();
+
+    // table functions must give the same output as generic functions
+
+    for (size_t idx = 0; idx < sai_metadata_attr_sorted_by_id_name_count; ++idx)
+    {
+        auto meta = sai_metadata_attr_sorted_by_id_name[idx];
+
+        auto entry = table.find(*meta);
+
+        ASSERT_NE(entry, nullptr);
+
+        EXPECT_EQ(entry->serialize == nullptr, sai_get_attr_value_serializer(*meta) == nullptr);
+        EXPECT_EQ(entry->serializeAppend == nullptr, entry->serialize == nullptr);
+
+        if (entry->serialize == nullptr || meta->attrvaluetype == SAI_ATTR_VALUE_TYPE_POINTER)
+        {
+            continue;
+        }
+
+        sai_attribute_t attr;
+
+        memset(&attr, 0, sizeof(attr));
+
+        attr.id = meta->attrid;
+
+        std::string buf;
+
+        entry->serializeAppend(buf, *meta, attr, true);
+
+        EXPECT_EQ(buf, entry->serialize(*meta, attr, true)) << meta->attridname;
+    }
+}
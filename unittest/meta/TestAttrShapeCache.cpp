@@ -0,0 +1,96 @@
+#include "AttrShapeCache.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+using namespace saimeta;
+
+TEST(AttrShapeCache, find)
+{
+    AttrShapeCache cache;
+
+    sai_attribute_t attrs[2];
+
+    attrs[0].id = SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION;
+    attrs[1].id = SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID;
+
+    AttrShapeCache::Shape shape = { .haskeys = true, .conditionsOnValues = true };
+
+    EXPECT_FALSE(cache.find(SAI_OBJECT_TYPE_ROUTE_ENTRY, 2, attrs, shape));
+
+    EXPECT_EQ(cache.getMissCount(), 1);
+
+    shape.haskeys = false;
+    shape.conditionsOnValues = false;
+
+    cache.insert(SAI_OBJECT_TYPE_ROUTE_ENTRY, 2, attrs, shape, 1000);
+
+    EXPECT_EQ(cache.size(), 1);
+
+    // attribute order don't matter
+
+    std::swap(attrs[0], attrs[1]);
+
+    shape.haskeys = true;
+
+    EXPECT_TRUE(cache.find(SAI_OBJECT_TYPE_ROUTE_ENTRY, 2, attrs, shape));
+
+    EXPECT_FALSE(shape.haskeys);
+
+    EXPECT_EQ(cache.getHitCount(), 1);
+
+    EXPECT_EQ(cache.getSavedTimeNs(), 1000);
+
+    // different object type
+
+    EXPECT_FALSE(cache.find(SAI_OBJECT_TYPE_NEIGHBOR_ENTRY, 2, attrs, shape));
+
+    // different attribute set
+
+    EXPECT_FALSE(cache.find(SAI_OBJECT_TYPE_ROUTE_ENTRY, 1, attrs, shape));
+
+    EXPECT_EQ(cache.getMissCount(), 3);
+}
+
+TEST(AttrShapeCache, maxSize)
+{
+    AttrShapeCache cache(1);
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION;
+
+    AttrShapeCache::Shape shape = { .haskeys = false, .conditionsOnValues = false };
+
+    cache.insert(SAI_OBJECT_TYPE_ROUTE_ENTRY, 1, &attr, shape, 0);
+    cache.insert(SAI_OBJECT_TYPE_ROUTE_ENTRY, 0, &attr, shape, 0);
+
+    EXPECT_EQ(cache.size(), 1);
+
+    EXPECT_TRUE(cache.find(SAI_OBJECT_TYPE_ROUTE_ENTRY, 1, &attr, shape));
+    EXPECT_FALSE(cache.find(SAI_OBJECT_TYPE_ROUTE_ENTRY, 0, &attr, shape));
+}
+
+TEST(AttrShapeCache, clear)
+{
+    AttrShapeCache cache;
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION;
+
+    AttrShapeCache::Shape shape = { .haskeys = false, .conditionsOnValues = false };
+
+    cache.insert(SAI_OBJECT_TYPE_ROUTE_ENTRY, 1, &attr, shape, 10);
+
+    EXPECT_TRUE(cache.find(SAI_OBJECT_TYPE_ROUTE_ENTRY, 1, &attr, shape));
+
+    cache.clear();
+
+    EXPECT_EQ(cache.size(), 0);
+    EXPECT_EQ(cache.getHitCount(), 0);
+    EXPECT_EQ(cache.getSavedTimeNs(), 0);
+
+    EXPECT_FALSE(cache.find(SAI_OBJECT_TYPE_ROUTE_ENTRY, 1, &attr, shape));
+}
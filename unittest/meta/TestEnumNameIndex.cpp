@@ -0,0 +1,114 @@
+#include "EnumNameIndex.h"
+#include "sai_serialize.h"
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+using namespace saimeta;
+
+TEST(EnumNameIndex, find)
+{
+    EnumNameIndex index(&sai_metadata_enum_sai_port_stat_t);
+
+    EXPECT_EQ(index.size(), sai_metadata_enum_sai_port_stat_t.valuescount);
+
+    int32_t value;
+    bool ignored;
+
+    EXPECT_TRUE(index.find("SAI_PORT_STAT_IF_IN_OCTETS", value, ignored));
+
+    EXPECT_EQ(value, SAI_PORT_STAT_IF_IN_OCTETS);
+    EXPECT_FALSE(ignored);
+
+    EXPECT_FALSE(index.find("SAI_PORT_STAT_IF_IN_OCTET", value, ignored));
+    EXPECT_FALSE(index.find("", value, ignored));
+    EXPECT_FALSE(index.find("SAI_QUEUE_STAT_PACKETS", value, ignored));
+}
+
+TEST(EnumNameIndex, find_all)
+{
+    for (size_t i = 0; i < sai_metadata_all_enums_count; i++)
+    {
+        auto* meta = sai_metadata_all_enums[i];
+
+        if (meta == nullptr)
+        {
+            continue;
+        }
+
+        auto* index = EnumNameIndex::getIndex(meta);
+
+        ASSERT_NE(index, nullptr);
+
+        for (size_t j = 0; j < meta->valuescount; j++)
+        {
+            int32_t value;
+            bool ignored;
+
+            EXPECT_TRUE(index->find(meta->valuesnames[j], value, ignored));
+
+            EXPECT_EQ(value, meta->values[j]);
+            EXPECT_FALSE(ignored);
+        }
+
+        if (meta->ignorevaluesnames == nullptr)
+        {
+            continue;
+        }
+
+        for (size_t j = 0; meta->ignorevaluesnames[j] != NULL; j++)
+        {
+            int32_t value;
+            bool ignored;
+
+            EXPECT_TRUE(index->find(meta->ignorevaluesnames[j], value, ignored));
+        }
+    }
+}
+
+TEST(EnumNameIndex, getIndex)
+{
+    EXPECT_NE(EnumNameIndex::getIndex(&sai_metadata_enum_sai_object_type_t), nullptr);
+
+    sai_enum_metadata_t meta;
+
+    memset(&meta, 0, sizeof(meta));
+
+    EXPECT_EQ(EnumNameIndex::getIndex(&meta), nullptr);
+
+    EXPECT_EQ(EnumNameIndex::getIndex(nullptr), nullptr);
+}
+
+TEST(EnumNameIndex, sai_deserialize_enum_name)
+{
+    int32_t value;
+
+    EXPECT_TRUE(sai_deserialize_enum_name("SAI_OBJECT_TYPE_PORT", &sai_metadata_enum_sai_object_type_t, value));
+
+    EXPECT_EQ(value, SAI_OBJECT_TYPE_PORT);
+
+    EXPECT_FALSE(sai_deserialize_enum_name("SAI_OBJECT_TYPE_FOO", &sai_metadata_enum_sai_object_type_t, value));
+
+    // enums outside SAI metadata are not indexed
+
+    const int values[] = { 7, 8 };
+    const char* const names[] = { "FOO_A", "FOO_B", NULL };
+
+    sai_enum_metadata_t meta;
+
+    memset(&meta, 0, sizeof(meta));
+
+    meta.name = "foo_t";
+    meta.valuescount = 2;
+    meta.values = values;
+    meta.valuesnames = names;
+
+    EXPECT_TRUE(sai_deserialize_enum_name("FOO_B", &meta, value));
+
+    EXPECT_EQ(value, 8);
+
+    EXPECT_FALSE(sai_deserialize_enum_name("FOO_C", &meta, value));
+
+    EXPECT_FALSE(sai_deserialize_enum_name("SAI_OBJECT_TYPE_PORT", nullptr, value));
+}
@@ -0,0 +1,78 @@
+#include "JsonFieldValueParser.h"
+
+#include "swss/json.h"
+
+#include <gtest/gtest.h>
+
+using namespace sairedis;
+
+TEST(JsonFieldValueParser, parse)
+{
+    std::vector<swss::FieldValueTuple> values;
+
+    values.emplace_back("fdb_event", "[{\"fdb_entry\":\"{\\\"mac\\\":\\\"52:54:00:86:DD:7A\\\"}\"}]");
+    values.emplace_back("ctrl", std::string("\b\f\n\r\t/\x01", 7));
+    values.emplace_back("utf8", "za\xc5\xbc\xc3\xb3\xc5\x82\xc4\x87 \xf0\x9f\x98\x80");
+    values.emplace_back("", "");
+
+    std::string json = swss::JSon::buildJson(values);
+
+    std::vector<swss::FieldValueTuple> parsed;
+
+    JsonFieldValueParser::parse(json.data(), json.size(), parsed);
+
+    EXPECT_EQ(parsed, values);
+
+    // same result as swss parser
+
+    std::vector<swss::FieldValueTuple> expected;
+
+    swss::JSon::readJson(json, expected);
+
+    EXPECT_EQ(parsed, expected);
+}
+
+TEST(JsonFieldValueParser, escapes)
+{
+    std::string json = " [ \"a\\u0041\\u00e9\\ud83d\\ude00\" , \"\\/\\\\\" ] ";
+
+    std::vector<swss::FieldValueTuple> values;
+
+    JsonFieldValueParser::parse(json.data(), json.size(), values);
+
+    ASSERT_EQ(values.size(), 1);
+
+    EXPECT_EQ(fvField(values[0]), "aA\xc3\xa9\xf0\x9f\x98\x80");
+    EXPECT_EQ(fvValue(values[0]), "/\\");
+
+    json = "[]";
+
+    JsonFieldValueParser::parse(json.data(), json.size(), values);
+
+    EXPECT_EQ(values.size(), 0);
+}
+
+TEST(JsonFieldValueParser, invalid)
+{
+    std::vector<swss::FieldValueTuple> values;
+
+    std::vector<std::string> invalid = {
+        "",
+        "{}",
+        "[",
+        "[\"a\"]",
+        "[\"a\",\"b\"",
+        "[\"a\",\"b\",]",
+        "[\"a\",1]",
+        "[\"a\",\"b\"] x",
+        "[\"a\\x\",\"b\"]",
+        "[\"a\\u00\",\"b\"]",
+        "[\"a\\ud83d\",\"b\"]",
+        "[\"a,\"b\"]",
+    };
+
+    for (const auto& json: invalid)
+    {
+        EXPECT_THROW(JsonFieldValueParser::parse(json.data(), json.size(), values), std::runtime_error) << json;
+    }
+}
@@ -1156,6 +1156,142 @@ TEST(Meta, quad_bulk_route_entry)
     EXPECT_EQ(SAI_STATUS_SUCCESS, m.bulkRemove(2, e, SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, statuses));
 }
 
+TEST(Meta, bulkCreate_route_entry_parallel_validation)
+{
+    Meta m(std::make_shared<MetaTestSaiInterface>());
+
+    m.setBulkValidationThreads(4);
+
+    EXPECT_EQ(m.getBulkValidationThreads(), 4);
+
+    sai_object_id_t switchId = 0;
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_SWITCH_ATTR_INIT_SWITCH;
+    attr.value.booldata = true;
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS, m.create(SAI_OBJECT_TYPE_SWITCH, &switchId, SAI_NULL_OBJECT_ID, 1, &attr));
+
+    sai_object_id_t vrId = 0;
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS, m.create(SAI_OBJECT_TYPE_VIRTUAL_ROUTER, &vrId, switchId, 0, &attr));
+
+    const uint32_t count = 1000;
+
+    std::vector<sai_route_entry_t> e(count);
+
+    memset(e.data(), 0, sizeof(sai_route_entry_t) * count);
+
+    for (uint32_t idx = 0; idx < count; idx++)
+    {
+        e[idx].switch_id = switchId;
+        e[idx].vr_id = vrId;
+        e[idx].destination.addr.ip4 = htonl(0x0a000000 + idx);
+        e[idx].destination.mask.ip4 = 0xffffffff;
+    }
+
+    std::vector<uint32_t> attr_count(count, 0);
+
+    std::vector<const sai_attribute_t*> attr_list(count, &attr);
+
+    std::vector<sai_status_t> statuses(count);
+
+    // duplicate key inside the same bulk
+
+    e[700] = e[300];
+
+    EXPECT_EQ(SAI_STATUS_ITEM_ALREADY_EXISTS, m.bulkCreate(count, e.data(), attr_count.data(), attr_list.data(), SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, statuses.data()));
+
+    // invalid item before duplicate, error of lower index is returned
+
+    e[500].vr_id = SAI_NULL_OBJECT_ID;
+
+    EXPECT_EQ(SAI_STATUS_INVALID_PARAMETER, m.bulkCreate(count, e.data(), attr_count.data(), attr_list.data(), SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, statuses.data()));
+
+    e[500].vr_id = vrId;
+    e[700].destination.addr.ip4 = htonl(0x0a000000 + 700);
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS, m.bulkCreate(count, e.data(), attr_count.data(), attr_list.data(), SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, statuses.data()));
+
+    // all entries exist now
+
+    EXPECT_EQ(SAI_STATUS_ITEM_ALREADY_EXISTS, m.bulkCreate(count, e.data(), attr_count.data(), attr_list.data(), SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, statuses.data()));
+
+    e[999] = e[0];
+
+    EXPECT_EQ(SAI_STATUS_INVALID_PARAMETER, m.bulkRemove(count, e.data(), SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, statuses.data()));
+
+    e[999].destination.addr.ip4 = htonl(0x0a000000 + 999);
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS, m.bulkRemove(count, e.data(), SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, statuses.data()));
+}
+
+TEST(Meta, create_route_entry_attr_shape_cache)
+{
+    Meta m(std::make_shared<MetaTestSaiInterface>());
+
+    sai_object_id_t switchId = 0;
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_SWITCH_ATTR_INIT_SWITCH;
+    attr.value.booldata = true;
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS, m.create(SAI_OBJECT_TYPE_SWITCH, &switchId, SAI_NULL_OBJECT_ID, 1, &attr));
+
+    sai_object_id_t vrId = 0;
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS, m.create(SAI_OBJECT_TYPE_VIRTUAL_ROUTER, &vrId, switchId, 0, &attr));
+
+    auto& cache = m.getAttrShapeCache();
+
+    auto hits = cache.getHitCount();
+
+    sai_route_entry_t e;
+
+    memset(&e, 0, sizeof(e));
+
+    e.switch_id = switchId;
+    e.vr_id = vrId;
+    e.destination.mask.ip4 = 0xffffffff;
+
+    attr.id = SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION;
+    attr.value.s32 = SAI_PACKET_ACTION_DROP;
+
+    e.destination.addr.ip4 = htonl(0x0a000001);
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS, m.create(&e, 1, &attr));
+
+    e.destination.addr.ip4 = htonl(0x0a000002);
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS, m.create(&e, 1, &attr));
+
+    EXPECT_EQ(cache.getHitCount(), hits + 1);
+
+    // value checks are still executed on cached shape
+
+    e.destination.addr.ip4 = htonl(0x0a000003);
+
+    attr.value.s32 = 1000;
+
+    EXPECT_EQ(SAI_STATUS_INVALID_PARAMETER, m.create(&e, 1, &attr));
+
+    EXPECT_EQ(cache.getHitCount(), hits + 2);
+
+    // invalid shape is never cached
+
+    sai_attribute_t attrs[2] = { attr, attr };
+
+    attrs[0].value.s32 = SAI_PACKET_ACTION_DROP;
+    attrs[1].value.s32 = SAI_PACKET_ACTION_DROP;
+
+    EXPECT_EQ(SAI_STATUS_INVALID_PARAMETER, m.create(&e, 2, attrs));
+    EXPECT_EQ(SAI_STATUS_INVALID_PARAMETER, m.create(&e, 2, attrs));
+
+    EXPECT_EQ(cache.getHitCount(), hits + 2);
+}
+
 sai_object_id_t create_port(
         _In_ Meta &m,
         _In_ sai_object_id_t switch_id)
@@ -1681,23 +1817,82 @@ TEST(Meta, populate)
 TEST(Meta, bulkGetClearStats)
 {
     Meta m(std::make_shared<MetaTestSaiInterface>());
-    EXPECT_EQ(SAI_STATUS_NOT_IMPLEMENTED, m.bulkGetStats(SAI_NULL_OBJECT_ID,
-                                                         SAI_OBJECT_TYPE_PORT,
-                                                         0,
-                                                         nullptr,
-                                                         0,
-                                                         nullptr,
-                                                         SAI_STATS_MODE_BULK_READ,
-                                                         nullptr,
-                                                         nullptr));
-    EXPECT_EQ(SAI_STATUS_NOT_IMPLEMENTED, m.bulkClearStats(SAI_NULL_OBJECT_ID,
+    EXPECT_EQ(SAI_STATUS_INVALID_PARAMETER, m.bulkGetStats(SAI_NULL_OBJECT_ID,
                                                            SAI_OBJECT_TYPE_PORT,
                                                            0,
                                                            nullptr,
                                                            0,
                                                            nullptr,
-                                                           SAI_STATS_MODE_BULK_CLEAR,
+                                                           SAI_STATS_MODE_BULK_READ,
+                                                           nullptr,
                                                            nullptr));
+    EXPECT_EQ(SAI_STATUS_INVALID_PARAMETER, m.bulkClearStats(SAI_NULL_OBJECT_ID,
+                                                             SAI_OBJECT_TYPE_PORT,
+                                                             0,
+                                                             nullptr,
+                                                             0,
+                                                             nullptr,
+                                                             SAI_STATS_MODE_BULK_CLEAR,
+                                                             nullptr));
+
+    sai_object_id_t switchId = 0;
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_SWITCH_ATTR_INIT_SWITCH;
+    attr.value.booldata = true;
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS, m.create(SAI_OBJECT_TYPE_SWITCH, &switchId, SAI_NULL_OBJECT_ID, 1, &attr));
+
+    sai_object_key_t key;
+
+    key.key.object_id = switchId;
+
+    sai_stat_id_t counter_ids[2];
+
+    counter_ids[0] = SAI_SWITCH_STAT_IN_CONFIGURED_DROP_REASONS_0_DROPPED_PKTS;
+    counter_ids[1] = SAI_SWITCH_STAT_IN_CONFIGURED_DROP_REASONS_1_DROPPED_PKTS;
+
+    sai_status_t statuses[1];
+
+    uint64_t counters[2];
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS, m.bulkGetStats(switchId, SAI_OBJECT_TYPE_SWITCH, 1, &key, 2, counter_ids, SAI_STATS_MODE_BULK_READ, statuses, counters));
+
+    EXPECT_EQ(SAI_STATUS_INVALID_PARAMETER, m.bulkGetStats(switchId, SAI_OBJECT_TYPE_SWITCH, 1, &key, 2, counter_ids, SAI_STATS_MODE_BULK_READ, statuses, nullptr));
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS, m.bulkClearStats(switchId, SAI_OBJECT_TYPE_SWITCH, 1, &key, 2, counter_ids, SAI_STATS_MODE_BULK_CLEAR, statuses));
+
+    // object type don't match object
+
+    EXPECT_EQ(SAI_STATUS_INVALID_PARAMETER, m.bulkClearStats(switchId, SAI_OBJECT_TYPE_PORT, 1, &key, 2, counter_ids, SAI_STATS_MODE_BULK_CLEAR, statuses));
+}
+
+TEST(Meta, queryStatsCapability)
+{
+    Meta m(std::make_shared<MetaTestSaiInterface>());
+
+    sai_object_id_t switchId = 0;
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_SWITCH_ATTR_INIT_SWITCH;
+    attr.value.booldata = true;
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS, m.create(SAI_OBJECT_TYPE_SWITCH, &switchId, SAI_NULL_OBJECT_ID, 1, &attr));
+
+    sai_stat_capability_list_t list;
+
+    list.count = 0;
+    list.list = nullptr;
+
+    EXPECT_EQ(SAI_STATUS_INVALID_PARAMETER, m.queryStatsCapability(switchId, SAI_OBJECT_TYPE_QUEUE, nullptr));
+
+    EXPECT_EQ(SAI_STATUS_INVALID_PARAMETER, m.queryStatsCapability(SAI_NULL_OBJECT_ID, SAI_OBJECT_TYPE_QUEUE, &list));
+
+    EXPECT_EQ(SAI_STATUS_INVALID_PARAMETER, m.queryStatsCapability(switchId, SAI_OBJECT_TYPE_NULL, &list));
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS, m.queryStatsCapability(switchId, SAI_OBJECT_TYPE_QUEUE, &list));
 }
 
 TEST(Meta, quad_ars)
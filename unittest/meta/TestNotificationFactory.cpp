@@ -26,6 +26,8 @@ TEST(NotificationFactory, deserialize_fdb_event)
             "\"list\":[{\"id\":\"SAI_FDB_ENTRY_ATTR_TYPE\",\"value\":\"SAI_FDB_ENTRY_TYPE_DYNAMIC\"},{\"id\":\"SAI_FDB_ENTRY_ATTR_BRIDGE_PORT_ID\",\"value\":\"oid:0x3a000000000660\"}]}]");
 
     EXPECT_EQ(ntf->getNotificationType(), SAI_SWITCH_NOTIFICATION_TYPE_FDB_EVENT);
+
+    EXPECT_EQ(NotificationFactory::getName(*ntf), SAI_SWITCH_NOTIFICATION_NAME_FDB_EVENT);
 }
 
 TEST(NotificationFactory, deserialize_nat_event)
@@ -88,3 +88,93 @@ TEST(OidRefCounter, objectReferenceClear)
 
     EXPECT_THROW(c.objectReferenceClear(2), std::runtime_error);
 }
+
+TEST(OidRefCounter, objectReferenceIncrement_vector)
+{
+    OidRefCounter c;
+
+    c.objectReferenceInsert(1);
+    c.objectReferenceInsert(2);
+
+    c.objectReferenceIncrement(std::vector<sai_object_id_t>{1, 2, 2, SAI_NULL_OBJECT_ID});
+
+    EXPECT_EQ(c.getObjectReferenceCount(1), 1);
+    EXPECT_EQ(c.getObjectReferenceCount(2), 2);
+
+    // nothing is modified when any object is missing
+
+    EXPECT_THROW(c.objectReferenceIncrement(std::vector<sai_object_id_t>{1, 3}), std::runtime_error);
+
+    EXPECT_EQ(c.getObjectReferenceCount(1), 1);
+}
+
+TEST(OidRefCounter, objectReferenceDecrement_vector)
+{
+    OidRefCounter c;
+
+    c.objectReferenceInsert(1);
+    c.objectReferenceInsert(2);
+
+    c.objectReferenceIncrement(std::vector<sai_object_id_t>{1, 2, 2});
+
+    EXPECT_THROW(c.objectReferenceDecrement(std::vector<sai_object_id_t>{2, 3}), std::runtime_error);
+
+    EXPECT_EQ(c.getObjectReferenceCount(2), 2);
+
+    // nothing is modified when any count would become negative
+
+    EXPECT_THROW(c.objectReferenceDecrement(std::vector<sai_object_id_t>{2, 1, 1}), std::runtime_error);
+
+    EXPECT_EQ(c.getObjectReferenceCount(1), 1);
+    EXPECT_EQ(c.getObjectReferenceCount(2), 2);
+
+    c.objectReferenceDecrement(std::vector<sai_object_id_t>{2, 1, 2});
+
+    EXPECT_FALSE(c.isObjectInUse(1));
+    EXPECT_FALSE(c.isObjectInUse(2));
+}
+
+TEST(OidRefCounter, objectReferenceInsert_null)
+{
+    OidRefCounter c;
+
+    c.objectReferenceInsert(SAI_NULL_OBJECT_ID);
+
+    EXPECT_TRUE(c.objectReferenceExists(SAI_NULL_OBJECT_ID));
+    EXPECT_EQ(c.getAllOids().size(), 1);
+
+    c.objectReferenceRemove(SAI_NULL_OBJECT_ID);
+
+    EXPECT_FALSE(c.objectReferenceExists(SAI_NULL_OBJECT_ID));
+}
+
+TEST(OidRefCounter, rehash)
+{
+    OidRefCounter c;
+
+    for (sai_object_id_t oid = 1; oid <= 10000; oid++)
+    {
+        c.objectReferenceInsert(oid);
+        c.objectReferenceIncrement(oid);
+    }
+
+    EXPECT_EQ(c.getAllReferences().size(), 10000);
+
+    // remove every other object, rest must be still reachable
+
+    for (sai_object_id_t oid = 1; oid <= 10000; oid += 2)
+    {
+        c.objectReferenceClear(oid);
+    }
+
+    for (sai_object_id_t oid = 1; oid <= 10000; oid++)
+    {
+        EXPECT_EQ(c.objectReferenceExists(oid), oid % 2 == 0);
+    }
+
+    EXPECT_EQ(c.getAllOids().size(), 5000);
+
+    c.clear();
+
+    EXPECT_EQ(c.getAllOids().size(), 0);
+}
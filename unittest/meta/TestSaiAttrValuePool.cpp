@@ -0,0 +1,122 @@
+#include "SaiAttrValuePool.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+using namespace saimeta;
+
+TEST(SaiAttrValuePool, intern)
+{
+    SaiAttrValuePool pool;
+
+    EXPECT_THROW(pool.intern(nullptr, sai_attribute_t()), std::runtime_error);
+
+    auto meta = sai_metadata_get_attr_metadata(
+            SAI_OBJECT_TYPE_ROUTE_ENTRY,
+            SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID);
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID;
+    attr.value.oid = 0x1234;
+
+    auto a = pool.intern(meta, attr);
+    auto b = pool.intern(meta, attr);
+
+    EXPECT_EQ(a, b);
+    EXPECT_EQ(pool.size(), 1);
+    EXPECT_EQ(pool.getHitCount(), 1);
+    EXPECT_EQ(pool.getMissCount(), 1);
+
+    attr.value.oid = 0x5678;
+
+    auto c = pool.intern(meta, attr);
+
+    EXPECT_NE(a, c);
+    EXPECT_EQ(c->getSaiAttr()->value.oid, 0x5678);
+    EXPECT_EQ(pool.size(), 2);
+}
+
+TEST(SaiAttrValuePool, intern_different_attr)
+{
+    SaiAttrValuePool pool;
+
+    auto meta1 = sai_metadata_get_attr_metadata(
+            SAI_OBJECT_TYPE_ROUTE_ENTRY,
+            SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION);
+
+    auto meta2 = sai_metadata_get_attr_metadata(
+            SAI_OBJECT_TYPE_NEIGHBOR_ENTRY,
+            SAI_NEIGHBOR_ENTRY_ATTR_PACKET_ACTION);
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION;
+    attr.value.s32 = SAI_PACKET_ACTION_FORWARD;
+
+    auto a = pool.intern(meta1, attr);
+
+    attr.id = SAI_NEIGHBOR_ENTRY_ATTR_PACKET_ACTION;
+
+    auto b = pool.intern(meta2, attr);
+
+    EXPECT_NE(a, b);
+    EXPECT_EQ(pool.size(), 2);
+}
+
+TEST(SaiAttrValuePool, release)
+{
+    SaiAttrValuePool pool;
+
+    auto meta = sai_metadata_get_attr_metadata(
+            SAI_OBJECT_TYPE_ROUTE_ENTRY,
+            SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID);
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID;
+    attr.value.oid = 0x1234;
+
+    auto a = pool.intern(meta, attr);
+    auto b = pool.intern(meta, attr);
+
+    a = nullptr;
+
+    EXPECT_EQ(pool.size(), 1);
+
+    b = nullptr;
+
+    EXPECT_EQ(pool.size(), 0);
+}
+
+TEST(SaiAttrValuePool, clear)
+{
+    auto pool = std::make_shared<SaiAttrValuePool>();
+
+    auto meta = sai_metadata_get_attr_metadata(
+            SAI_OBJECT_TYPE_ROUTE_ENTRY,
+            SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID);
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID;
+    attr.value.oid = 0x1234;
+
+    auto a = pool->intern(meta, attr);
+
+    pool->clear();
+
+    EXPECT_EQ(pool->size(), 0);
+
+    auto b = pool->intern(meta, attr);
+
+    EXPECT_NE(a, b);
+
+    pool = nullptr;
+
+    // wrappers can outlive the pool
+
+    EXPECT_EQ(a->getSaiAttr()->value.oid, 0x1234);
+    EXPECT_EQ(b->getSaiAttr()->value.oid, 0x1234);
+}
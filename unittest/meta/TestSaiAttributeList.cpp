@@ -1,4 +1,5 @@
 #include "SaiAttributeList.h"
+#include "Globals.h"
 
 #include <gtest/gtest.h>
 
@@ -44,3 +45,53 @@ TEST(SaiAttributeList, ctr_hash)
     EXPECT_THROW(std::make_shared<SaiAttributeList>((sai_object_type_t)-1, hash, false), std::runtime_error);
 #pragma GCC diagnostic pop
 }
+
+TEST(SaiAttributeList, serialize_attr_list_append)
+{
+    sai_object_id_t list[2] = { 0x1000000000001, 0x1000000000002 };
+
+    sai_attribute_t attrs[4];
+
+    attrs[0].id = SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION;
+    attrs[0].value.s32 = SAI_PACKET_ACTION_FORWARD;
+
+    attrs[1].id = SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID;
+    attrs[1].value.oid = 0x4000000000123;
+
+    attrs[2].id = SAI_ROUTE_ENTRY_ATTR_META_DATA;
+    attrs[2].value.u32 = 1234567;
+
+    attrs[3].id = SAI_ROUTE_ENTRY_ATTR_COUNTER_ID;
+    attrs[3].value.oid = SAI_NULL_OBJECT_ID;
+
+    auto entry = SaiAttributeList::serialize_attr_list(SAI_OBJECT_TYPE_ROUTE_ENTRY, 4, attrs, false);
+
+    std::string buf = "prefix|";
+
+    SaiAttributeList::serialize_attr_list(buf, SAI_OBJECT_TYPE_ROUTE_ENTRY, 4, attrs, false);
+
+    EXPECT_EQ(buf, "prefix|" + Globals::joinFieldValues(entry));
+
+    EXPECT_EQ(buf, "prefix|SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION=SAI_PACKET_ACTION_FORWARD"
+            "|SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID=oid:0x4000000000123"
+            "|SAI_ROUTE_ENTRY_ATTR_META_DATA=1234567"
+            "|SAI_ROUTE_ENTRY_ATTR_COUNTER_ID=oid:0x0");
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_PORT_ATTR_EGRESS_MIRROR_SESSION;
+    attr.value.objlist.count = 2;
+    attr.value.objlist.list = list;
+
+    buf.clear();
+
+    SaiAttributeList::serialize_attr_list(buf, SAI_OBJECT_TYPE_PORT, 1, &attr, false);
+
+    EXPECT_EQ(buf, "SAI_PORT_ATTR_EGRESS_MIRROR_SESSION=2:oid:0x1000000000001,oid:0x1000000000002");
+
+    buf.clear();
+
+    SaiAttributeList::serialize_attr_list(buf, SAI_OBJECT_TYPE_PORT, 1, &attr, true);
+
+    EXPECT_EQ(buf, "SAI_PORT_ATTR_EGRESS_MIRROR_SESSION=2");
+}
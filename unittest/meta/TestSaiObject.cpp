@@ -3,6 +3,7 @@
 #include <gtest/gtest.h>
 
 #include <memory>
+#include <cstring>
 
 using namespace saimeta;
 
@@ -41,3 +42,44 @@ TEST(SaiObject, setAttr)
 
     so.setAttr(a);
 }
+
+TEST(SaiObject, getAttributes)
+{
+    sai_object_meta_key_t mk = { .objecttype = SAI_OBJECT_TYPE_SWITCH, .objectkey = { .key = { .object_id = 0 } } };
+
+    SaiObject so(mk);
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_SWITCH_ATTR_INIT_SWITCH;
+    attr.value.booldata = true;
+
+    auto meta = sai_metadata_get_attr_metadata(SAI_OBJECT_TYPE_SWITCH, SAI_SWITCH_ATTR_INIT_SWITCH);
+
+    so.setAttr(meta, &attr);
+
+    attr.id = SAI_SWITCH_ATTR_SRC_MAC_ADDRESS;
+    memset(attr.value.mac, 0, sizeof(sai_mac_t));
+
+    meta = sai_metadata_get_attr_metadata(SAI_OBJECT_TYPE_SWITCH, SAI_SWITCH_ATTR_SRC_MAC_ADDRESS);
+
+    so.setAttr(meta, &attr);
+
+    attr.id = SAI_SWITCH_ATTR_INIT_SWITCH;
+    attr.value.booldata = false;
+
+    meta = sai_metadata_get_attr_metadata(SAI_OBJECT_TYPE_SWITCH, SAI_SWITCH_ATTR_INIT_SWITCH);
+
+    so.setAttr(meta, &attr);
+
+    auto attrs = so.getAttributes();
+
+    ASSERT_EQ(attrs.size(), 2);
+
+    // attributes are kept sorted by id
+
+    EXPECT_LT(attrs[0]->getAttrId(), attrs[1]->getAttrId());
+
+    EXPECT_TRUE(so.hasAttr(SAI_SWITCH_ATTR_INIT_SWITCH));
+    EXPECT_EQ(so.getAttr(SAI_SWITCH_ATTR_INIT_SWITCH)->getSaiAttr()->value.booldata, false);
+}
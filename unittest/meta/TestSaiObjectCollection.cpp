@@ -4,6 +4,9 @@
 
 #include <memory>
 
+#include <string.h>
+#include <arpa/inet.h>
+
 using namespace saimeta;
 
 TEST(SaiObjectCollection, createObject)
@@ -56,3 +59,98 @@ TEST(SaiObjectCollection, getObject)
 
     EXPECT_THROW(oc.getObject(mk), std::runtime_error);
 }
+
+TEST(SaiObjectCollection, setObjectAttr_shared_value)
+{
+    sai_object_meta_key_t mk1 = { .objecttype = SAI_OBJECT_TYPE_SWITCH, .objectkey = { .key = { .object_id = 1 } } };
+    sai_object_meta_key_t mk2 = { .objecttype = SAI_OBJECT_TYPE_SWITCH, .objectkey = { .key = { .object_id = 2 } } };
+
+    SaiObjectCollection oc;
+
+    oc.createObject(mk1);
+    oc.createObject(mk2);
+
+    auto meta = sai_metadata_get_attr_metadata(
+            SAI_OBJECT_TYPE_SWITCH,
+            SAI_SWITCH_ATTR_INIT_SWITCH);
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_SWITCH_ATTR_INIT_SWITCH;
+    attr.value.booldata = true;
+
+    oc.setObjectAttr(mk1, *meta, &attr);
+    oc.setObjectAttr(mk2, *meta, &attr);
+
+    EXPECT_EQ(oc.getObjectAttr(mk1, attr.id), oc.getObjectAttr(mk2, attr.id));
+    EXPECT_EQ(oc.getAttrValuePool().size(), 1);
+
+    oc.removeObject(mk1);
+    oc.removeObject(mk2);
+
+    EXPECT_EQ(oc.getAttrValuePool().size(), 0);
+}
+
+TEST(SaiObjectCollection, getObjectsByObjectType)
+{
+    sai_object_meta_key_t mk1 = { .objecttype = SAI_OBJECT_TYPE_SWITCH, .objectkey = { .key = { .object_id = 1 } } };
+    sai_object_meta_key_t mk2 = { .objecttype = SAI_OBJECT_TYPE_PORT, .objectkey = { .key = { .object_id = 2 } } };
+
+    SaiObjectCollection oc;
+
+    oc.createObject(mk1);
+    oc.createObject(mk2);
+
+    EXPECT_EQ(oc.getObjectsByObjectType(SAI_OBJECT_TYPE_PORT).size(), 1);
+    EXPECT_EQ(oc.getObjectsByObjectType(SAI_OBJECT_TYPE_VLAN).size(), 0);
+    EXPECT_EQ(oc.getAllKeys().size(), 2);
+}
+
+TEST(SaiObjectCollection, createRemoveMany)
+{
+    SaiObjectCollection oc;
+
+    std::vector<sai_object_meta_key_t> keys;
+
+    for (uint32_t i = 0; i < 1000; i++)
+    {
+        sai_object_meta_key_t mk;
+
+        memset(&mk, 0, sizeof(mk));
+
+        mk.objecttype = SAI_OBJECT_TYPE_ROUTE_ENTRY;
+        mk.objectkey.key.route_entry.switch_id = 0x21000000000000;
+        mk.objectkey.key.route_entry.vr_id = 0x3000000000022;
+        mk.objectkey.key.route_entry.destination.addr_family = SAI_IP_ADDR_FAMILY_IPV4;
+        mk.objectkey.key.route_entry.destination.addr.ip4 = htonl(0x0a000000 + i);
+        mk.objectkey.key.route_entry.destination.mask.ip4 = 0xffffffff;
+
+        keys.push_back(mk);
+
+        oc.createObject(mk);
+    }
+
+    // remove every other object, last objects are moved into the gaps
+
+    for (size_t i = 0; i < keys.size(); i += 2)
+    {
+        oc.removeObject(keys[i]);
+    }
+
+    for (size_t i = 0; i < keys.size(); i++)
+    {
+        EXPECT_EQ(oc.objectExists(keys[i]), (i % 2) == 1);
+    }
+
+    EXPECT_EQ(oc.getObjectsByObjectType(SAI_OBJECT_TYPE_ROUTE_ENTRY).size(), 500);
+
+    for (size_t i = 1; i < keys.size(); i += 2)
+    {
+        EXPECT_EQ(oc.getObject(keys[i])->getMetaKey().objectkey.key.route_entry.destination.addr.ip4,
+                keys[i].objectkey.key.route_entry.destination.addr.ip4);
+
+        oc.removeObject(keys[i]);
+    }
+
+    EXPECT_EQ(oc.getAllKeys().size(), 0);
+}
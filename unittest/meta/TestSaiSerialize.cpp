@@ -171,6 +171,14 @@ TEST(SaiSerialize, sai_deserialize_redis_communication_mode)
     sai_deserialize_redis_communication_mode(REDIS_COMMUNICATION_MODE_ZMQ_SYNC_STRING, value);
 
     EXPECT_EQ(value, SAI_REDIS_COMMUNICATION_MODE_ZMQ_SYNC);
+
+    sai_deserialize_redis_communication_mode(REDIS_COMMUNICATION_MODE_ZMQ_V2_SYNC_STRING, value);
+
+    EXPECT_EQ(value, SAI_REDIS_COMMUNICATION_MODE_ZMQ_V2_SYNC);
+
+    sai_deserialize_redis_communication_mode(REDIS_COMMUNICATION_MODE_SHM_SYNC_STRING, value);
+
+    EXPECT_EQ(value, SAI_REDIS_COMMUNICATION_MODE_SHM_SYNC);
 }
 
 TEST(SaiSerialize, sai_deserialize_ingress_priority_group_attr)
@@ -541,6 +549,12 @@ TEST(SaiSerialize, sai_serialize_redis_communication_mode)
 {
     EXPECT_EQ(sai_serialize_redis_communication_mode(SAI_REDIS_COMMUNICATION_MODE_REDIS_SYNC),
             REDIS_COMMUNICATION_MODE_REDIS_SYNC_STRING);
+
+    EXPECT_EQ(sai_serialize_redis_communication_mode(SAI_REDIS_COMMUNICATION_MODE_ZMQ_V2_SYNC),
+            REDIS_COMMUNICATION_MODE_ZMQ_V2_SYNC_STRING);
+
+    EXPECT_EQ(sai_serialize_redis_communication_mode(SAI_REDIS_COMMUNICATION_MODE_SHM_SYNC),
+            REDIS_COMMUNICATION_MODE_SHM_SYNC_STRING);
 }
 
 TEST(SaiSerialize, sai_serialize_redis_port_attr_id)
@@ -1347,3 +1361,232 @@ TEST(SaiSerialize, serialize_number)
     EXPECT_EQ(sn, -0x12345678);
     EXPECT_EQ(u,   0x12345678);
 }
+
+TEST(SaiSerialize, sai_deserialize_fdb_entry)
+{
+    sai_fdb_entry_t fe;
+
+    memset(&fe, 0, sizeof(fe));
+
+    fe.switch_id = 0x21000000000000;
+    fe.bv_id = 0x26000000000001;
+    fe.mac_address[5] = 0x11;
+
+    auto s = sai_serialize_fdb_entry(fe);
+
+    EXPECT_EQ(s, "{\"bvid\":\"oid:0x26000000000001\",\"mac\":\"00:00:00:00:00:11\",\"switch_id\":\"oid:0x21000000000000\"}");
+
+    sai_fdb_entry_t dfe;
+
+    memset(&dfe, 0, sizeof(dfe));
+
+    sai_deserialize_fdb_entry(s, dfe);
+
+    EXPECT_EQ(memcmp(&fe, &dfe, sizeof(fe)), 0);
+
+    // not canonical form is handled by json parser
+
+    memset(&dfe, 0, sizeof(dfe));
+
+    sai_deserialize_fdb_entry("{ \"switch_id\":\"oid:0x21000000000000\", \"mac\":\"00:00:00:00:00:11\", \"bvid\":\"oid:0x26000000000001\" }", dfe);
+
+    EXPECT_EQ(memcmp(&fe, &dfe, sizeof(fe)), 0);
+
+    EXPECT_THROW(sai_deserialize_fdb_entry("{\"bvid\":\"oid:0x26000000000001\",\"mac\":\"00:00:00:00:11\",\"switch_id\":\"oid:0x21000000000000\"}", dfe), std::runtime_error);
+}
+
+TEST(SaiSerialize, sai_deserialize_neighbor_entry)
+{
+    sai_neighbor_entry_t ne;
+
+    memset(&ne, 0, sizeof(ne));
+
+    ne.switch_id = 0x21000000000000;
+    ne.rif_id = 0x6000000000001;
+    ne.ip_address.addr_family = SAI_IP_ADDR_FAMILY_IPV4;
+    ne.ip_address.addr.ip4 = htonl(0x0a000001);
+
+    auto s = sai_serialize_neighbor_entry(ne);
+
+    EXPECT_EQ(s, "{\"ip\":\"10.0.0.1\",\"rif\":\"oid:0x6000000000001\",\"switch_id\":\"oid:0x21000000000000\"}");
+
+    sai_neighbor_entry_t dne;
+
+    memset(&dne, 0, sizeof(dne));
+
+    sai_deserialize_neighbor_entry(s, dne);
+
+    EXPECT_EQ(memcmp(&ne, &dne, sizeof(ne)), 0);
+
+    EXPECT_THROW(sai_deserialize_neighbor_entry("{\"ip\":\"10.0.0.1\",\"rif\":\"0x6000000000001\",\"switch_id\":\"oid:0x21000000000000\"}", dne), std::runtime_error);
+}
+
+TEST(SaiSerialize, sai_deserialize_nat_entry)
+{
+    sai_nat_entry_t ne;
+
+    memset(&ne, 0, sizeof(ne));
+
+    ne.switch_id = 0x21000000000000;
+    ne.vr_id = 0x3000000000001;
+    ne.nat_type = SAI_NAT_TYPE_SOURCE_NAT;
+    ne.data.key.src_ip = htonl(0x0a000001);
+    ne.data.key.proto = 6;
+    ne.data.key.l4_src_port = 1234;
+    ne.data.mask.src_ip = 0xffffffff;
+    ne.data.mask.proto = 0xff;
+    ne.data.mask.l4_src_port = 0xffff;
+
+    auto s = sai_serialize_nat_entry(ne);
+
+    sai_nat_entry_t dne;
+
+    memset(&dne, 0, sizeof(dne));
+
+    sai_deserialize_nat_entry(s, dne);
+
+    EXPECT_EQ(memcmp(&ne, &dne, sizeof(ne)), 0);
+
+    EXPECT_EQ(sai_serialize_nat_entry(dne), s);
+
+    // reordered keys are handled by json parser
+
+    memset(&dne, 0, sizeof(dne));
+
+    sai_deserialize_nat_entry(json::parse(s).dump(4), dne);
+
+    EXPECT_EQ(memcmp(&ne, &dne, sizeof(ne)), 0);
+}
+
+TEST(SaiSerialize, sai_deserialize_inseg_entry)
+{
+    sai_inseg_entry_t ie;
+
+    memset(&ie, 0, sizeof(ie));
+
+    ie.switch_id = 0x21000000000000;
+    ie.label = 100;
+
+    auto s = sai_serialize_inseg_entry(ie);
+
+    sai_inseg_entry_t die;
+
+    memset(&die, 0, sizeof(die));
+
+    sai_deserialize_inseg_entry(s, die);
+
+    EXPECT_EQ(memcmp(&ie, &die, sizeof(ie)), 0);
+}
+
+TEST(SaiSerialize, serialize_append)
+{
+    std::string buf;
+
+    sai_serialize_number(buf, 0);
+    sai_serialize_number(buf, 18446744073709551615ULL);
+    sai_serialize_number(buf, 0x12ab, true);
+
+    EXPECT_EQ(buf, "0184467440737095516150x12ab");
+
+    buf.clear();
+
+    sai_serialize_object_id(buf, 0x21000000000000);
+
+    EXPECT_EQ(buf, sai_serialize_object_id(0x21000000000000));
+
+    buf.clear();
+
+    sai_mac_t mac = { 0x01, 0x23, 0x45, 0xab, 0xcd, 0xef };
+
+    sai_serialize_mac(buf, mac);
+
+    EXPECT_EQ(buf, sai_serialize_mac(mac));
+
+    buf.clear();
+
+    sai_serialize_enum(buf, SAI_OBJECT_TYPE_PORT, &sai_metadata_enum_sai_object_type_t);
+    sai_serialize_enum(buf, -1, nullptr);
+
+    EXPECT_EQ(buf, "SAI_OBJECT_TYPE_PORT-1");
+
+    // all value types which are appended directly must match string version
+
+    sai_attribute_t attr;
+
+    memset(&attr, 0, sizeof(attr));
+
+    attr.id = SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID;
+    attr.value.oid = 0x123;
+
+    auto meta = sai_metadata_get_attr_metadata(SAI_OBJECT_TYPE_ROUTE_ENTRY, SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID);
+
+    buf.clear();
+
+    sai_serialize_attr_value(buf, *meta, attr);
+
+    EXPECT_EQ(buf, sai_serialize_attr_value(*meta, attr));
+
+    sai_attr_metadata_t m = *meta;
+
+    sai_attr_value_type_t types[] = {
+        SAI_ATTR_VALUE_TYPE_BOOL,
+        SAI_ATTR_VALUE_TYPE_UINT8,
+        SAI_ATTR_VALUE_TYPE_UINT16,
+        SAI_ATTR_VALUE_TYPE_UINT32,
+        SAI_ATTR_VALUE_TYPE_UINT64,
+        SAI_ATTR_VALUE_TYPE_MAC,
+        SAI_ATTR_VALUE_TYPE_IPV4,
+        SAI_ATTR_VALUE_TYPE_IPV6,
+        SAI_ATTR_VALUE_TYPE_OBJECT_ID,
+    };
+
+    memset(&attr.value, 0xab, sizeof(attr.value));
+
+    attr.value.booldata = true;
+
+    for (auto type: types)
+    {
+        m.attrvaluetype = type;
+
+        buf.clear();
+
+        sai_serialize_attr_value(buf, m, attr);
+
+        EXPECT_EQ(buf, sai_serialize_attr_value(m, attr));
+    }
+
+    m.attrvaluetype = SAI_ATTR_VALUE_TYPE_IP_PREFIX;
+
+    attr.value.ipprefix.addr_family = SAI_IP_ADDR_FAMILY_IPV6;
+
+    memset(attr.value.ipprefix.mask.ip6, 0xff, 8);
+    memset(attr.value.ipprefix.mask.ip6 + 8, 0, 8);
+
+    buf.clear();
+
+    sai_serialize_attr_value(buf, m, attr);
+
+    EXPECT_EQ(buf, sai_serialize_attr_value(m, attr));
+
+    m.attrvaluetype = SAI_ATTR_VALUE_TYPE_UINT32_LIST;
+
+    uint32_t list[3] = { 1, 2, 3 };
+
+    attr.value.u32list.count = 3;
+    attr.value.u32list.list = list;
+
+    buf.clear();
+
+    sai_serialize_attr_value(buf, m, attr);
+
+    EXPECT_EQ(buf, "3:1,2,3");
+    EXPECT_EQ(buf, sai_serialize_attr_value(m, attr));
+
+    attr.value.u32list.list = nullptr;
+
+    buf.clear();
+
+    sai_serialize_attr_value(buf, m, attr);
+
+    EXPECT_EQ(buf, sai_serialize_attr_value(m, attr));
+}
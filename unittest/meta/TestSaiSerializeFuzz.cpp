@@ -0,0 +1,306 @@
+#include "sai_serialize.h"
+
+#include <gtest/gtest.h>
+
+#include <arpa/inet.h>
+
+#include <random>
+#include <string>
+#include <cstring>
+#include <cerrno>
+
+/*
+ * Compare fast path scalar deserializers with generic parsing on random and
+ * mutated inputs. Fast path must give the same value for valid input, and
+ * invalid input must still throw.
+ */
+
+#define FUZZ_ITERATIONS 200000
+
+static std::string random_string(
+        std::mt19937& rng,
+        const std::string& alphabet,
+        size_t maxLen)
+{
+    SWSS_LOG_ENTER();
+
+    std::string s;
+
+    size_t len = rng() % (maxLen + 1);
+
+    for (size_t i = 0; i < len; i++)
+    {
+        s += alphabet[rng() % alphabet.size()];
+    }
+
+    return s;
+}
+
+static std::string mutate(
+        std::mt19937& rng,
+        std::string s,
+        const std::string& alphabet)
+{
+    SWSS_LOG_ENTER();
+
+    int count = rng() % 3;
+
+    for (int i = 0; i < count && !s.empty(); i++)
+    {
+        size_t pos = rng() % s.size();
+
+        switch (rng() % 3)
+        {
+            case 0:
+                s[pos] = alphabet[rng() % alphabet.size()];
+                break;
+
+            case 1:
+                s.erase(pos, 1);
+                break;
+
+            default:
+                s.insert(pos, 1, alphabet[rng() % alphabet.size()]);
+                break;
+        }
+    }
+
+    return s;
+}
+
+static bool reference_object_id(
+        const std::string& s,
+        sai_object_id_t& oid)
+{
+    SWSS_LOG_ENTER();
+
+    if (s.find("oid:0x") != 0)
+    {
+        return false;
+    }
+
+    errno = 0;
+
+    char *endptr = NULL;
+
+    oid = (sai_object_id_t)strtoull(s.c_str() + 4, &endptr, 16);
+
+    return errno == 0 && endptr == s.c_str() + s.length();
+}
+
+static bool reference_mac(
+        const std::string& s,
+        sai_mac_t& mac)
+{
+    SWSS_LOG_ENTER();
+
+    if (s.length() != 17)
+    {
+        return false;
+    }
+
+    for (int j = 0, i = 0; j < 6; j++, i += 3)
+    {
+        unsigned int h, l;
+
+        if (!isxdigit(s[i]) || !isxdigit(s[i + 1]))
+        {
+            return false;
+        }
+
+        sscanf(s.substr(i, 1).c_str(), "%x", &h);
+        sscanf(s.substr(i + 1, 1).c_str(), "%x", &l);
+
+        mac[j] = (uint8_t)((h << 4) | l);
+    }
+
+    return true;
+}
+
+TEST(SaiSerializeFuzz, object_id)
+{
+    std::mt19937 rng(1);
+
+    const std::string alphabet = "0123456789abcdefABCDEFx:-+ oid";
+
+    for (int i = 0; i < FUZZ_ITERATIONS; i++)
+    {
+        std::string s = (rng() % 2)
+            ? mutate(rng, sai_serialize_object_id(((uint64_t)rng() << 32) | rng()), alphabet)
+            : "oid:0x" + random_string(rng, alphabet, 20);
+
+        sai_object_id_t expected = 0;
+        sai_object_id_t oid = 0;
+
+        if (reference_object_id(s, expected))
+        {
+            EXPECT_NO_THROW(sai_deserialize_object_id(s, oid)) << s;
+            EXPECT_EQ(oid, expected) << s;
+        }
+        else
+        {
+            EXPECT_THROW(sai_deserialize_object_id(s, oid), std::runtime_error) << s;
+        }
+    }
+}
+
+TEST(SaiSerializeFuzz, mac)
+{
+    std::mt19937 rng(2);
+
+    const std::string alphabet = "0123456789abcdefABCDEFg:-";
+
+    for (int i = 0; i < FUZZ_ITERATIONS; i++)
+    {
+        sai_mac_t mac = { (uint8_t)rng(), (uint8_t)rng(), (uint8_t)rng(), (uint8_t)rng(), (uint8_t)rng(), (uint8_t)rng() };
+
+        std::string s = mutate(rng, sai_serialize_mac(mac), alphabet);
+
+        sai_mac_t expected;
+        sai_mac_t result;
+
+        if (reference_mac(s, expected))
+        {
+            EXPECT_NO_THROW(sai_deserialize_mac(s, result)) << s;
+            EXPECT_EQ(memcmp(result, expected, sizeof(sai_mac_t)), 0) << s;
+        }
+        else
+        {
+            EXPECT_THROW(sai_deserialize_mac(s, result), std::runtime_error) << s;
+        }
+    }
+}
+
+TEST(SaiSerializeFuzz, ip_address)
+{
+    std::mt19937 rng(3);
+
+    const std::string alphabet = "0123456789abcdefABCDEF:.g";
+
+    for (int i = 0; i < FUZZ_ITERATIONS; i++)
+    {
+        sai_ip_address_t ip;
+
+        memset(&ip, 0, sizeof(ip));
+
+        if (rng() % 2)
+        {
+            ip.addr_family = SAI_IP_ADDR_FAMILY_IPV4;
+            ip.addr.ip4 = rng();
+        }
+        else
+        {
+            ip.addr_family = SAI_IP_ADDR_FAMILY_IPV6;
+
+            for (int j = 0; j < 16; j++)
+            {
+                // zeros make "::" compression more likely
+                ip.addr.ip6[j] = (rng() % 3) ? 0 : (uint8_t)rng();
+            }
+        }
+
+        std::string s = (rng() % 4)
+            ? mutate(rng, sai_serialize_ip_address(ip), alphabet)
+            : random_string(rng, alphabet, 40);
+
+        sai_ip_address_t result;
+
+        uint8_t expected[16];
+
+        if (inet_pton(AF_INET, s.c_str(), expected) == 1)
+        {
+            EXPECT_NO_THROW(sai_deserialize_ip_address(s, result)) << s;
+            EXPECT_EQ(result.addr_family, SAI_IP_ADDR_FAMILY_IPV4) << s;
+            EXPECT_EQ(memcmp(&result.addr.ip4, expected, 4), 0) << s;
+        }
+        else if (inet_pton(AF_INET6, s.c_str(), expected) == 1)
+        {
+            EXPECT_NO_THROW(sai_deserialize_ip_address(s, result)) << s;
+            EXPECT_EQ(result.addr_family, SAI_IP_ADDR_FAMILY_IPV6) << s;
+            EXPECT_EQ(memcmp(result.addr.ip6, expected, 16), 0) << s;
+        }
+        else
+        {
+            EXPECT_THROW(sai_deserialize_ip_address(s, result), std::runtime_error) << s;
+        }
+    }
+}
+
+TEST(SaiSerializeFuzz, ip_prefix)
+{
+    std::mt19937 rng(4);
+
+    const std::string alphabet = "0123456789abcdef:./";
+
+    for (int i = 0; i < FUZZ_ITERATIONS; i++)
+    {
+        bool v4 = rng() % 2;
+
+        std::string s = (v4 ? "10.0.0.0/" : "fc00::/") + std::to_string(rng() % (v4 ? 40 : 140));
+
+        s = mutate(rng, s, alphabet);
+
+        sai_ip_prefix_t result;
+
+        auto slash = s.find('/');
+
+        if (slash == std::string::npos || s.find('/', slash + 1) != std::string::npos)
+        {
+            EXPECT_THROW(sai_deserialize_ip_prefix(s, result), std::runtime_error) << s;
+            continue;
+        }
+
+        std::string sip = s.substr(0, slash);
+        std::string smask = s.substr(slash + 1);
+
+        uint8_t addr[16];
+
+        int family = AF_UNSPEC;
+
+        if (inet_pton(AF_INET, sip.c_str(), addr) == 1)
+        {
+            family = AF_INET;
+        }
+        else if (inet_pton(AF_INET6, sip.c_str(), addr) == 1)
+        {
+            family = AF_INET6;
+        }
+
+        if (family == AF_UNSPEC)
+        {
+            EXPECT_THROW(sai_deserialize_ip_prefix(s, result), std::runtime_error) << s;
+            continue;
+        }
+
+        if (smask.empty() || smask.size() > 3 || smask.find_first_not_of("0123456789") != std::string::npos)
+        {
+            // mask format is left to generic number deserialize
+            continue;
+        }
+
+        int bits = std::stoi(smask);
+
+        if (bits > (family == AF_INET ? 32 : 128))
+        {
+            EXPECT_THROW(sai_deserialize_ip_prefix(s, result), std::runtime_error) << s;
+            continue;
+        }
+
+        EXPECT_NO_THROW(sai_deserialize_ip_prefix(s, result)) << s;
+
+        if (family == AF_INET)
+        {
+            EXPECT_EQ(result.addr_family, SAI_IP_ADDR_FAMILY_IPV4) << s;
+            EXPECT_EQ(memcmp(&result.addr.ip4, addr, 4), 0) << s;
+        }
+        else
+        {
+            EXPECT_EQ(result.addr_family, SAI_IP_ADDR_FAMILY_IPV6) << s;
+            EXPECT_EQ(memcmp(result.addr.ip6, addr, 16), 0) << s;
+        }
+
+        std::string serialized = sai_serialize_ip_prefix(result);
+
+        EXPECT_EQ(serialized.substr(serialized.find('/') + 1), std::to_string(bits)) << s;
+    }
+}
@@ -0,0 +1,328 @@
+#include "SharedMemorySelectableChannel.h"
+#include "SharedMemoryRing.h"
+#include "SharedMemoryChannel.h"
+
+#include "sairediscommon.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <vector>
+
+#include <unistd.h>
+#include <string.h>
+
+#define SHM_TEST_ENDPOINT "/tmp/sai_shm_test_ep"
+
+using namespace sairedis;
+
+TEST(SharedMemoryRing, ctr)
+{
+    alignas(64) uint8_t memory[256];
+
+    EXPECT_THROW(SharedMemoryRing(nullptr, sizeof(memory), true), std::runtime_error);
+
+    EXPECT_THROW(SharedMemoryRing(memory + 1, sizeof(memory) - 1, true), std::runtime_error);
+
+    EXPECT_THROW(SharedMemoryRing(memory, 16, true), std::runtime_error);
+
+    memset(memory, 0, sizeof(memory));
+
+    // not initialized
+
+    EXPECT_THROW(SharedMemoryRing(memory, sizeof(memory), false), std::runtime_error);
+}
+
+TEST(SharedMemoryRing, pushPop)
+{
+    std::vector<uint64_t> memory(SharedMemoryRing::getMemorySize(1024) / sizeof(uint64_t) + 8);
+
+    void* base = (void*)(((uintptr_t)memory.data() + 63) & ~(uintptr_t)63);
+
+    size_t size = SharedMemoryRing::getMemorySize(1024);
+
+    SharedMemoryRing producer(base, size, true);
+    SharedMemoryRing consumer(base, size, false);
+
+    EXPECT_EQ(consumer.getCapacity(), 1024);
+
+    std::string record;
+
+    EXPECT_TRUE(consumer.empty());
+    EXPECT_FALSE(consumer.pop(record));
+
+    EXPECT_THROW(producer.push(std::string(600, 'x')), std::runtime_error);
+
+    // records wrap around ring many times
+
+    size_t pushed = 0;
+    size_t popped = 0;
+
+    for (int round = 0; round < 100; round++)
+    {
+        while (producer.push(std::to_string(pushed) + std::string(pushed % 300, 'x')))
+        {
+            pushed++;
+        }
+
+        EXPECT_FALSE(consumer.empty());
+
+        // leave some records in ring, so head and tail are not aligned
+
+        while (popped + 2 < pushed && consumer.pop(record))
+        {
+            EXPECT_EQ(record, std::to_string(popped) + std::string(popped % 300, 'x'));
+
+            popped++;
+        }
+    }
+
+    while (consumer.pop(record))
+    {
+        EXPECT_EQ(record, std::to_string(popped) + std::string(popped % 300, 'x'));
+
+        popped++;
+    }
+
+    EXPECT_EQ(pushed, popped);
+    EXPECT_TRUE(consumer.empty());
+
+    EXPECT_TRUE(producer.push(""));
+    EXPECT_TRUE(consumer.pop(record));
+    EXPECT_EQ(record, "");
+}
+
+TEST(SharedMemorySelectableChannel, empty)
+{
+    SharedMemorySelectableChannel c(SHM_TEST_ENDPOINT, 64 * 1024);
+
+    EXPECT_TRUE(c.empty());
+    EXPECT_FALSE(c.hasData());
+    EXPECT_FALSE(c.hasCachedData());
+
+    swss::KeyOpFieldsValuesTuple kco;
+
+    EXPECT_THROW(c.pop(kco, false), std::runtime_error);
+}
+
+TEST(SharedMemorySelectableChannel, roundTrip)
+{
+    SharedMemorySelectableChannel server(SHM_TEST_ENDPOINT, 64 * 1024);
+
+    std::atomic<int> notifications(0);
+
+    SharedMemoryChannel client(SHM_TEST_ENDPOINT,
+            [&](const std::string& op, const std::string& data, const std::vector<swss::FieldValueTuple>& values) {
+
+            EXPECT_EQ(op, "port_state_change");
+            EXPECT_EQ(data, "[]");
+
+            notifications++;
+    });
+
+    // only one client can use rings
+
+    EXPECT_THROW(std::make_shared<SharedMemoryChannel>(SHM_TEST_ENDPOINT, nullptr), std::runtime_error);
+
+    EXPECT_TRUE(client.isPipelined());
+
+    client.setBuffered(true);
+
+    for (int i = 0; i < 100; i++)
+    {
+        client.set("SAI_OBJECT_TYPE_PORT:oid:0x" + std::to_string(i + 1), { swss::FieldValueTuple("SAI_PORT_ATTR_MTU", "9100") }, REDIS_ASIC_STATE_COMMAND_SET);
+    }
+
+    client.flush();
+
+    EXPECT_TRUE(server.hasData());
+
+    server.readData();
+
+    int count = 0;
+
+    while (!server.empty())
+    {
+        swss::KeyOpFieldsValuesTuple kco;
+
+        server.pop(kco, false);
+
+        EXPECT_EQ(kfvKey(kco), "SAI_OBJECT_TYPE_PORT:oid:0x" + std::to_string(count + 1));
+        EXPECT_EQ(kfvOp(kco), REDIS_ASIC_STATE_COMMAND_SET);
+
+        server.set("SAI_STATUS_SUCCESS", {}, REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
+
+        count++;
+    }
+
+    EXPECT_EQ(count, 100);
+
+    for (int i = 0; i < 100; i++)
+    {
+        swss::KeyOpFieldsValuesTuple kco;
+
+        EXPECT_EQ(client.wait(REDIS_ASIC_STATE_COMMAND_GETRESPONSE, kco), SAI_STATUS_SUCCESS);
+
+        EXPECT_EQ(client.getResponseCorrelationId(), (uint64_t)i + 1);
+    }
+
+    client.setResponseTimeout(50);
+
+    swss::KeyOpFieldsValuesTuple kco;
+
+    EXPECT_EQ(client.wait(REDIS_ASIC_STATE_COMMAND_GETRESPONSE, kco), SAI_STATUS_FAILURE);
+
+    server.sendNotification("port_state_change", "[]", {});
+
+    for (int i = 0; i < 100 && notifications == 0; i++)
+    {
+        usleep(10 * 1000);
+    }
+
+    EXPECT_EQ(notifications, 1);
+}
+
+TEST(SharedMemorySelectableChannel, reconnect)
+{
+    SharedMemorySelectableChannel server(SHM_TEST_ENDPOINT, 64 * 1024);
+
+    {
+        SharedMemoryChannel client(SHM_TEST_ENDPOINT, nullptr);
+
+        client.del("SAI_OBJECT_TYPE_PORT:oid:0x1", REDIS_ASIC_STATE_COMMAND_REMOVE);
+
+        swss::KeyOpFieldsValuesTuple kco;
+
+        server.pop(kco, false);
+
+        // response is never read by this client
+
+        server.set("SAI_STATUS_SUCCESS", {}, REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
+    }
+
+    // server needs to notice closed connection
+
+    for (int i = 0; true; i++)
+    {
+        try
+        {
+            SharedMemoryChannel client(SHM_TEST_ENDPOINT, nullptr);
+
+            client.setResponseTimeout(50);
+
+            swss::KeyOpFieldsValuesTuple kco;
+
+            // stale response was dropped on connect
+
+            EXPECT_EQ(client.wait(REDIS_ASIC_STATE_COMMAND_GETRESPONSE, kco), SAI_STATUS_FAILURE);
+
+            break;
+        }
+        catch (const std::exception&)
+        {
+            ASSERT_LT(i, 100);
+
+            usleep(10 * 1000);
+        }
+    }
+}
+
+TEST(SharedMemorySelectableChannel, lateResponse)
+{
+    SharedMemorySelectableChannel server(SHM_TEST_ENDPOINT, 64 * 1024);
+
+    SharedMemoryChannel client(SHM_TEST_ENDPOINT, nullptr);
+
+    client.setResponseTimeout(50);
+
+    swss::KeyOpFieldsValuesTuple kco;
+
+    client.del("SAI_OBJECT_TYPE_PORT:oid:0x1", REDIS_ASIC_STATE_COMMAND_REMOVE);
+
+    server.pop(kco, false);
+
+    // response is not sent in time
+
+    EXPECT_EQ(client.wait(REDIS_ASIC_STATE_COMMAND_GETRESPONSE, kco), SAI_STATUS_FAILURE);
+
+    EXPECT_EQ(kfvOp(kco), "");
+
+    server.set("SAI_STATUS_SUCCESS", {}, REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
+
+    std::vector<swss::FieldValueTuple> values = { swss::FieldValueTuple("SAI_PORT_ATTR_MTU", "9100") };
+
+    client.set("SAI_OBJECT_TYPE_PORT:oid:0x2", values, REDIS_ASIC_STATE_COMMAND_GET);
+
+    server.pop(kco, false);
+
+    EXPECT_EQ(kfvOp(kco), REDIS_ASIC_STATE_COMMAND_GET);
+
+    server.set("SAI_STATUS_BUFFER_OVERFLOW", values, REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
+
+    // late response to remove is discarded, get receives its own response
+
+    client.setResponseTimeout(1000);
+
+    EXPECT_EQ(client.wait(REDIS_ASIC_STATE_COMMAND_GETRESPONSE, kco), SAI_STATUS_BUFFER_OVERFLOW);
+
+    EXPECT_EQ(client.getResponseCorrelationId(), 2);
+    EXPECT_EQ(kfvFieldsValues(kco), values);
+}
+
+TEST(SharedMemorySelectableChannel, reconnectStaleRequests)
+{
+    SharedMemorySelectableChannel server(SHM_TEST_ENDPOINT, 64 * 1024);
+
+    swss::KeyOpFieldsValuesTuple kco;
+
+    {
+        SharedMemoryChannel client(SHM_TEST_ENDPOINT, nullptr);
+
+        client.del("SAI_OBJECT_TYPE_PORT:oid:0x1", REDIS_ASIC_STATE_COMMAND_REMOVE);
+        client.del("SAI_OBJECT_TYPE_PORT:oid:0x2", REDIS_ASIC_STATE_COMMAND_REMOVE);
+
+        server.pop(kco, false);
+
+        EXPECT_EQ(kfvKey(kco), "SAI_OBJECT_TYPE_PORT:oid:0x1");
+    }
+
+    // server needs to notice closed connection
+
+    std::shared_ptr<SharedMemoryChannel> client;
+
+    for (int i = 0; !client; i++)
+    {
+        try
+        {
+            client = std::make_shared<SharedMemoryChannel>(SHM_TEST_ENDPOINT, nullptr);
+        }
+        catch (const std::exception&)
+        {
+            ASSERT_LT(i, 100);
+
+            usleep(10 * 1000);
+        }
+    }
+
+    // response to request of previous client is sent after new client connected
+
+    server.set("SAI_STATUS_SUCCESS", {}, REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
+
+    client->del("SAI_OBJECT_TYPE_PORT:oid:0x3", REDIS_ASIC_STATE_COMMAND_REMOVE);
+
+    // request of previous client left in ring is skipped
+
+    server.pop(kco, false);
+
+    EXPECT_EQ(kfvKey(kco), "SAI_OBJECT_TYPE_PORT:oid:0x3");
+
+    EXPECT_TRUE(server.empty());
+
+    server.set("SAI_STATUS_OBJECT_IN_USE", {}, REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
+
+    client->setResponseTimeout(1000);
+
+    EXPECT_EQ(client->wait(REDIS_ASIC_STATE_COMMAND_GETRESPONSE, kco), SAI_STATUS_OBJECT_IN_USE);
+
+    EXPECT_EQ(client->getResponseCorrelationId(), 1);
+}
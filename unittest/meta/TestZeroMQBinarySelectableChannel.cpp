@@ -0,0 +1,309 @@
+#include "ZeroMQBinarySelectableChannel.h"
+#include "ZeroMQFrameCodec.h"
+#include "ZeroMQBinaryChannel.h"
+
+#include "sairediscommon.h"
+
+#include "swss/select.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <thread>
+
+#include <unistd.h>
+
+using namespace sairedis;
+
+TEST(ZeroMQFrameCodec, encodeDecode)
+{
+    std::vector<swss::FieldValueTuple> values;
+
+    values.emplace_back("SAI_PORT_ATTR_ADMIN_STATE", "true");
+    values.emplace_back("NULL", std::string("a\0b", 3));
+
+    std::string frame;
+
+    ZeroMQFrameCodec::encode("SAI_OBJECT_TYPE_PORT:oid:0x1", "set", values, 0x1234567890, frame);
+
+    swss::KeyOpFieldsValuesTuple kco;
+
+    uint64_t correlationId;
+
+    ZeroMQFrameCodec::decode(frame.data(), frame.size(), kco, correlationId);
+
+    EXPECT_EQ(kfvKey(kco), "SAI_OBJECT_TYPE_PORT:oid:0x1");
+    EXPECT_EQ(kfvOp(kco), "set");
+    EXPECT_EQ(kfvFieldsValues(kco), values);
+    EXPECT_EQ(correlationId, 0x1234567890);
+}
+
+TEST(ZeroMQFrameCodec, decodeInvalid)
+{
+    std::string frame;
+
+    ZeroMQFrameCodec::encode("key", "op", { swss::FieldValueTuple("f", "v") }, 1, frame);
+
+    swss::KeyOpFieldsValuesTuple kco;
+
+    uint64_t correlationId;
+
+    EXPECT_THROW(ZeroMQFrameCodec::decode(frame.data(), frame.size() - 1, kco, correlationId), std::runtime_error);
+
+    EXPECT_THROW(ZeroMQFrameCodec::decode((frame + "x").data(), frame.size() + 1, kco, correlationId), std::runtime_error);
+
+    EXPECT_THROW(ZeroMQFrameCodec::decode(frame.data(), 0, kco, correlationId), std::runtime_error);
+
+    frame[0] = 1;
+
+    EXPECT_THROW(ZeroMQFrameCodec::decode(frame.data(), frame.size(), kco, correlationId), std::runtime_error);
+}
+
+TEST(ZeroMQBinarySelectableChannel, ctr)
+{
+    EXPECT_THROW(std::make_shared<ZeroMQBinarySelectableChannel>("/dev_not/foo"), std::runtime_error);
+}
+
+TEST(ZeroMQBinarySelectableChannel, empty)
+{
+    ZeroMQBinarySelectableChannel c("ipc:///tmp/zmq_binary_test");
+
+    EXPECT_EQ(c.empty(), true);
+
+    swss::KeyOpFieldsValuesTuple kco;
+
+    EXPECT_THROW(c.pop(kco, false), std::runtime_error);
+
+    // no request popped, response can't be routed
+
+    EXPECT_THROW(c.set("key", {}, "op"), std::runtime_error);
+}
+
+TEST(ZeroMQBinarySelectableChannel, pipelined)
+{
+    ZeroMQBinaryChannel main("ipc:///tmp/zmq_binary_test", "ipc:///tmp/zmq_binary_test_ntf", nullptr);
+
+    ZeroMQBinarySelectableChannel c("ipc:///tmp/zmq_binary_test");
+
+    EXPECT_TRUE(main.isPipelined());
+
+    main.setResponseTimeout(1000);
+
+    main.setBuffered(true);
+
+    std::vector<swss::FieldValueTuple> values;
+
+    values.emplace_back("SAI_PORT_ATTR_ADMIN_STATE", "true");
+
+    for (int i = 0; i < 3; i++)
+    {
+        main.set("SAI_OBJECT_TYPE_PORT:oid:0x" + std::to_string(i + 1), values, REDIS_ASIC_STATE_COMMAND_SET);
+    }
+
+    // all 3 requests will be sent in single multipart message
+
+    main.flush();
+
+    swss::Select ss;
+
+    ss.addSelectable(&c);
+
+    swss::Selectable *sel = NULL;
+
+    EXPECT_EQ(ss.select(&sel, 1000), swss::Select::OBJECT);
+
+    for (int i = 0; i < 3; i++)
+    {
+        ASSERT_FALSE(c.empty());
+
+        swss::KeyOpFieldsValuesTuple kco;
+
+        c.pop(kco, false);
+
+        EXPECT_EQ(kfvKey(kco), "SAI_OBJECT_TYPE_PORT:oid:0x" + std::to_string(i + 1));
+        EXPECT_EQ(kfvOp(kco), REDIS_ASIC_STATE_COMMAND_SET);
+        EXPECT_EQ(kfvFieldsValues(kco), values);
+
+        c.set("SAI_STATUS_SUCCESS", {}, REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
+    }
+
+    EXPECT_TRUE(c.empty());
+
+    for (uint64_t id = 1; id <= 3; id++)
+    {
+        swss::KeyOpFieldsValuesTuple kco;
+
+        EXPECT_EQ(main.wait(REDIS_ASIC_STATE_COMMAND_GETRESPONSE, kco), SAI_STATUS_SUCCESS);
+
+        EXPECT_EQ(main.getResponseCorrelationId(), id);
+    }
+}
+
+TEST(ZeroMQBinarySelectableChannel, lateResponse)
+{
+    ZeroMQBinaryChannel main("ipc:///tmp/zmq_binary_test", "ipc:///tmp/zmq_binary_test_ntf", nullptr);
+
+    ZeroMQBinarySelectableChannel c("ipc:///tmp/zmq_binary_test");
+
+    main.setResponseTimeout(100);
+
+    swss::Select ss;
+
+    ss.addSelectable(&c);
+
+    swss::Selectable *sel = NULL;
+
+    swss::KeyOpFieldsValuesTuple kco;
+
+    main.set("SAI_OBJECT_TYPE_PORT:oid:0x1", {}, REDIS_ASIC_STATE_COMMAND_REMOVE);
+
+    EXPECT_EQ(ss.select(&sel, 1000), swss::Select::OBJECT);
+
+    c.pop(kco, false);
+
+    // response is not sent in time
+
+    EXPECT_EQ(main.wait(REDIS_ASIC_STATE_COMMAND_GETRESPONSE, kco), SAI_STATUS_FAILURE);
+
+    EXPECT_EQ(kfvOp(kco), "");
+
+    c.set("SAI_STATUS_SUCCESS", {}, REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
+
+    std::vector<swss::FieldValueTuple> values;
+
+    values.emplace_back("SAI_PORT_ATTR_ADMIN_STATE", "true");
+
+    main.set("SAI_OBJECT_TYPE_PORT:oid:0x2", values, REDIS_ASIC_STATE_COMMAND_GET);
+
+    EXPECT_EQ(ss.select(&sel, 1000), swss::Select::OBJECT);
+
+    c.pop(kco, false);
+
+    EXPECT_EQ(kfvOp(kco), REDIS_ASIC_STATE_COMMAND_GET);
+
+    c.set("SAI_STATUS_BUFFER_OVERFLOW", values, REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
+
+    // late response to remove is discarded, get receives its own response
+
+    main.setResponseTimeout(1000);
+
+    EXPECT_EQ(main.wait(REDIS_ASIC_STATE_COMMAND_GETRESPONSE, kco), SAI_STATUS_BUFFER_OVERFLOW);
+
+    EXPECT_EQ(main.getResponseCorrelationId(), 2);
+    EXPECT_EQ(kfvFieldsValues(kco), values);
+}
+
+TEST(ZeroMQBinarySelectableChannel, weightedRoundRobin)
+{
+    ZeroMQBinarySelectableChannel c("ipc:///tmp/zmq_binary_test");
+
+    EXPECT_THROW(c.setClientWeight("a", 0), std::runtime_error);
+
+    c.setClientWeight("a", 2);
+
+    ZeroMQBinaryChannel a("ipc:///tmp/zmq_binary_test", "ipc:///tmp/zmq_binary_test_ntf", nullptr, "a");
+    ZeroMQBinaryChannel b("ipc:///tmp/zmq_binary_test", "ipc:///tmp/zmq_binary_test_ntf", nullptr, "b");
+
+    a.setBuffered(true);
+    b.setBuffered(true);
+
+    for (int i = 0; i < 4; i++)
+    {
+        a.set("a", {}, REDIS_ASIC_STATE_COMMAND_GET);
+        b.set("b", {}, REDIS_ASIC_STATE_COMMAND_GET);
+    }
+
+    a.flush();
+    b.flush();
+
+    usleep(200*1000);
+
+    std::string order;
+
+    while (!c.empty())
+    {
+        swss::KeyOpFieldsValuesTuple kco;
+
+        c.pop(kco, false);
+
+        order += kfvKey(kco);
+    }
+
+    ASSERT_EQ(order.size(), 8);
+
+    // "a" can pop 2 requests in a row, "b" only 1, until one runs out
+
+    EXPECT_EQ(std::count(order.begin(), order.begin() + 6, 'a'), 4);
+    EXPECT_EQ(order.substr(6), "bb");
+}
+
+TEST(ZeroMQBinarySelectableChannel, weightedRoundRobinConcurrentClients)
+{
+    ZeroMQBinarySelectableChannel c("ipc:///tmp/zmq_binary_test");
+
+    c.setClientWeight("a", 3);
+
+    auto submit = [](const std::string& identity) {
+
+        ZeroMQBinaryChannel channel("ipc:///tmp/zmq_binary_test", "ipc:///tmp/zmq_binary_test_ntf", nullptr, identity);
+
+        for (int i = 0; i < 6; i++)
+        {
+            channel.set(identity + std::to_string(i), {}, REDIS_ASIC_STATE_COMMAND_GET);
+        }
+
+        // keep connection open until requests are queued by server
+
+        usleep(300*1000);
+    };
+
+    std::thread ta(submit, "a");
+    std::thread tb(submit, "b");
+
+    usleep(200*1000);
+
+    std::vector<std::string> order;
+
+    while (!c.empty())
+    {
+        swss::KeyOpFieldsValuesTuple kco;
+
+        c.pop(kco, false);
+
+        order.push_back(kfvKey(kco));
+    }
+
+    ta.join();
+    tb.join();
+
+    ASSERT_EQ(order.size(), 12);
+
+    // client which was queued first is served first, then "a" pops up to 3
+    // requests in a row and "b" 1, each in its own send order
+
+    std::vector<std::string> expected;
+
+    int na = 0;
+    int nb = 0;
+
+    bool aTurn = order[0][0] == 'a';
+
+    while (na < 6 || nb < 6)
+    {
+        if (aTurn)
+        {
+            for (int i = 0; i < 3 && na < 6; i++)
+            {
+                expected.push_back("a" + std::to_string(na++));
+            }
+        }
+        else if (nb < 6)
+        {
+            expected.push_back("b" + std::to_string(nb++));
+        }
+
+        aTurn = !aTurn;
+    }
+
+    EXPECT_EQ(order, expected);
+}
@@ -25,7 +25,7 @@ R"(Usage: syncd [-d] [-p profile] [-t type] [-u] [-S] [-U] [-C] [-s] [-z mode] [
     -s --syncMode
         Enable synchronous mode (depreacated, use -z)
     -z --redisCommunicationMode
-        Redis communication mode (redis_async|redis_sync|zmq_sync), default: redis_async
+        Redis communication mode (redis_async|redis_sync|zmq_sync|zmq_v2_sync|shm_sync), default: redis_async
     -l --enableBulk
         Enable SAI Bulk support
     -g --globalContext
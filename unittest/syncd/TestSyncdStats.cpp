@@ -0,0 +1,415 @@
+#include "Syncd.h"
+#include "RedisClient.h"
+#include "CommandLineOptions.h"
+#include "MockableSaiInterface.h"
+#include "lib/RedisRemoteSaiInterface.h"
+#include "lib/ContextConfigContainer.h"
+#include "lib/sairediscommon.h"
+#include "meta/RedisSelectableChannel.h"
+#include "meta/sai_serialize.h"
+
+#include "swss/select.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace syncd;
+
+// use switch index 1, so we don't collide with other tests VID/RID maps
+
+#define SWITCH_VID  ((sai_object_id_t)0x21010000000000)
+#define SWITCH_RID  ((sai_object_id_t)0x2100000001)
+#define QUEUE_VID_1 ((sai_object_id_t)0x15010000000001)
+#define QUEUE_RID_1 ((sai_object_id_t)0x1500000001)
+#define QUEUE_VID_2 ((sai_object_id_t)0x15010000000002)
+#define QUEUE_RID_2 ((sai_object_id_t)0x1500000002)
+#define QUEUE_VID_3 ((sai_object_id_t)0x15010000000003) // not in VIDTORID map
+
+/*
+ * Round trip of stats requests: client serializes request to redis, syncd
+ * processes it on mockable vendor SAI, and client parses syncd response.
+ */
+class SyncdStatsTest : public ::testing::Test
+{
+public:
+    SyncdStatsTest() = default;
+    virtual ~SyncdStatsTest() = default;
+
+public:
+    virtual void SetUp() override
+    {
+        SWSS_LOG_ENTER();
+
+        m_dbAsic = std::make_shared<swss::DBConnector>("ASIC_DB", 0);
+        m_client = std::make_shared<RedisClient>(m_dbAsic);
+
+        m_client->insertVidAndRid(SWITCH_VID, SWITCH_RID);
+        m_client->insertVidAndRid(QUEUE_VID_1, QUEUE_RID_1);
+        m_client->insertVidAndRid(QUEUE_VID_2, QUEUE_RID_2);
+
+        m_keys[0].key.object_id = QUEUE_VID_1;
+        m_keys[1].key.object_id = QUEUE_VID_2;
+
+        m_vendorSai = std::make_shared<MockableSaiInterface>();
+
+        auto cmd = std::make_shared<CommandLineOptions>();
+
+        m_syncd = std::make_shared<Syncd>(m_vendorSai, cmd, false);
+
+        m_consumer = std::make_shared<sairedis::RedisSelectableChannel>(
+                m_dbAsic,
+                ASIC_STATE_TABLE,
+                REDIS_TABLE_GETRESPONSE,
+                TEMP_PREFIX,
+                false);
+
+        auto ccc = sairedis::ContextConfigContainer::loadFromFile("");
+
+        m_sai = std::make_shared<sairedis::RedisRemoteSaiInterface>(ccc->get(0), nullptr, std::make_shared<sairedis::Recorder>());
+
+        m_runThread = true;
+
+        m_syncdThread = std::make_shared<std::thread>(&SyncdStatsTest::syncdThread, this);
+    }
+
+    virtual void TearDown() override
+    {
+        SWSS_LOG_ENTER();
+
+        m_runThread = false;
+
+        m_syncdThread->join();
+
+        m_sai = nullptr;
+        m_syncd = nullptr;
+
+        m_client->removeVidAndRid(SWITCH_VID, SWITCH_RID);
+        m_client->removeVidAndRid(QUEUE_VID_1, QUEUE_RID_1);
+        m_client->removeVidAndRid(QUEUE_VID_2, QUEUE_RID_2);
+    }
+
+    void syncdThread()
+    {
+        SWSS_LOG_ENTER();
+
+        swss::Select s;
+
+        s.addSelectable(m_consumer.get());
+
+        while (m_runThread)
+        {
+            swss::Selectable *sel = nullptr;
+
+            if (s.select(&sel, 100) == swss::Select::OBJECT)
+            {
+                m_syncd->processEvent(*m_consumer);
+            }
+        }
+    }
+
+protected:
+    std::shared_ptr<swss::DBConnector> m_dbAsic;
+
+    std::shared_ptr<RedisClient> m_client;
+
+    std::shared_ptr<MockableSaiInterface> m_vendorSai;
+
+    std::shared_ptr<Syncd> m_syncd;
+
+    std::shared_ptr<sairedis::RedisSelectableChannel> m_consumer;
+
+    std::shared_ptr<sairedis::RedisRemoteSaiInterface> m_sai;
+
+    std::shared_ptr<std::thread> m_syncdThread;
+
+    std::atomic<bool> m_runThread;
+
+    sai_object_key_t m_keys[2];
+
+    sai_stat_id_t m_ids[2] = { SAI_QUEUE_STAT_PACKETS, SAI_QUEUE_STAT_BYTES };
+};
+
+TEST_F(SyncdStatsTest, bulkGetStats)
+{
+    int calls = 0;
+
+    m_vendorSai->mock_bulkGetStats = [&](sai_object_id_t switchId, sai_object_type_t objectType, uint32_t objectCount,
+            const sai_object_key_t *objectKey, uint32_t numberOfCounters, const sai_stat_id_t *counterIds,
+            sai_stats_mode_t mode, sai_status_t *objectStatuses, uint64_t *counters) -> sai_status_t
+    {
+        calls++;
+
+        EXPECT_EQ(switchId, SWITCH_RID);
+        EXPECT_EQ(objectType, SAI_OBJECT_TYPE_QUEUE);
+        EXPECT_EQ(objectCount, 2);
+        EXPECT_EQ(objectKey[0].key.object_id, QUEUE_RID_1);
+        EXPECT_EQ(objectKey[1].key.object_id, QUEUE_RID_2);
+        EXPECT_EQ(numberOfCounters, 2);
+        EXPECT_EQ(counterIds[0], SAI_QUEUE_STAT_PACKETS);
+        EXPECT_EQ(counterIds[1], SAI_QUEUE_STAT_BYTES);
+        EXPECT_EQ(mode, SAI_STATS_MODE_BULK_READ);
+
+        objectStatuses[0] = SAI_STATUS_SUCCESS;
+        objectStatuses[1] = SAI_STATUS_INVALID_PARAMETER;
+
+        counters[0] = 10;
+        counters[1] = 1000;
+
+        return SAI_STATUS_FAILURE;
+    };
+
+    sai_status_t statuses[2];
+    uint64_t counters[4] = { 0 };
+
+    auto status = m_sai->bulkGetStats(SWITCH_VID, SAI_OBJECT_TYPE_QUEUE, 2, m_keys, 2, m_ids, SAI_STATS_MODE_BULK_READ, statuses, counters);
+
+    EXPECT_EQ(calls, 1);
+    EXPECT_EQ(status, SAI_STATUS_FAILURE);
+    EXPECT_EQ(statuses[0], SAI_STATUS_SUCCESS);
+    EXPECT_EQ(statuses[1], SAI_STATUS_INVALID_PARAMETER);
+    EXPECT_EQ(counters[0], 10);
+    EXPECT_EQ(counters[1], 1000);
+}
+
+TEST_F(SyncdStatsTest, bulkGetStatsFallback)
+{
+    m_vendorSai->mock_bulkGetStats = [](sai_object_id_t, sai_object_type_t, uint32_t, const sai_object_key_t *,
+            uint32_t, const sai_stat_id_t *, sai_stats_mode_t, sai_status_t *, uint64_t *) -> sai_status_t
+    {
+        return SAI_STATUS_NOT_IMPLEMENTED;
+    };
+
+    std::vector<sai_object_id_t> readObjects;
+
+    m_vendorSai->mock_getStats = [&](sai_object_type_t objectType, sai_object_id_t objectId, uint32_t numberOfCounters,
+            const sai_stat_id_t *counterIds, uint64_t *counters) -> sai_status_t
+    {
+        EXPECT_EQ(objectType, SAI_OBJECT_TYPE_QUEUE);
+        EXPECT_EQ(numberOfCounters, 2);
+
+        readObjects.push_back(objectId);
+
+        counters[0] = objectId;
+        counters[1] = objectId + 1;
+
+        return SAI_STATUS_SUCCESS;
+    };
+
+    std::vector<sai_stats_mode_t> modes;
+
+    m_vendorSai->mock_getStatsExt = [&](sai_object_type_t objectType, sai_object_id_t objectId, uint32_t numberOfCounters,
+            const sai_stat_id_t *counterIds, sai_stats_mode_t mode, uint64_t *counters) -> sai_status_t
+    {
+        modes.push_back(mode);
+
+        counters[0] = 7;
+        counters[1] = 8;
+
+        return objectId == QUEUE_RID_2 ? SAI_STATUS_NOT_SUPPORTED : SAI_STATUS_SUCCESS;
+    };
+
+    sai_status_t statuses[2];
+    uint64_t counters[4] = { 0 };
+
+    // bulk read is executed as get stats on each object
+
+    auto status = m_sai->bulkGetStats(SWITCH_VID, SAI_OBJECT_TYPE_QUEUE, 2, m_keys, 2, m_ids, SAI_STATS_MODE_BULK_READ, statuses, counters);
+
+    EXPECT_EQ(status, SAI_STATUS_SUCCESS);
+    EXPECT_EQ(readObjects, std::vector<sai_object_id_t>({ QUEUE_RID_1, QUEUE_RID_2 }));
+    EXPECT_EQ(statuses[0], SAI_STATUS_SUCCESS);
+    EXPECT_EQ(statuses[1], SAI_STATUS_SUCCESS);
+    EXPECT_EQ(counters[0], QUEUE_RID_1);
+    EXPECT_EQ(counters[1], QUEUE_RID_1 + 1);
+    EXPECT_EQ(counters[2], QUEUE_RID_2);
+    EXPECT_EQ(counters[3], QUEUE_RID_2 + 1);
+
+    // bulk read and clear is executed as get stats ext with read and clear
+
+    status = m_sai->bulkGetStats(SWITCH_VID, SAI_OBJECT_TYPE_QUEUE, 2, m_keys, 2, m_ids, SAI_STATS_MODE_BULK_READ_AND_CLEAR, statuses, counters);
+
+    EXPECT_EQ(status, SAI_STATUS_FAILURE);
+    EXPECT_EQ(modes, std::vector<sai_stats_mode_t>({ SAI_STATS_MODE_READ_AND_CLEAR, SAI_STATS_MODE_READ_AND_CLEAR }));
+    EXPECT_EQ(statuses[0], SAI_STATUS_SUCCESS);
+    EXPECT_EQ(statuses[1], SAI_STATUS_NOT_SUPPORTED);
+    EXPECT_EQ(counters[0], 7);
+    EXPECT_EQ(counters[1], 8);
+}
+
+TEST_F(SyncdStatsTest, bulkGetStatsInvalidObject)
+{
+    int calls = 0;
+
+    m_vendorSai->mock_bulkGetStats = [&](sai_object_id_t, sai_object_type_t, uint32_t, const sai_object_key_t *,
+            uint32_t, const sai_stat_id_t *, sai_stats_mode_t, sai_status_t *, uint64_t *) -> sai_status_t
+    {
+        calls++;
+
+        return SAI_STATUS_SUCCESS;
+    };
+
+    // whole request fails, since one of objects don't exist
+
+    m_keys[1].key.object_id = QUEUE_VID_3;
+
+    sai_status_t statuses[2];
+    uint64_t counters[4] = { 0 };
+
+    auto status = m_sai->bulkGetStats(SWITCH_VID, SAI_OBJECT_TYPE_QUEUE, 2, m_keys, 2, m_ids, SAI_STATS_MODE_READ, statuses, counters);
+
+    EXPECT_EQ(calls, 0);
+    EXPECT_EQ(status, SAI_STATUS_INVALID_OBJECT_ID);
+    EXPECT_EQ(statuses[0], SAI_STATUS_INVALID_OBJECT_ID);
+    EXPECT_EQ(statuses[1], SAI_STATUS_INVALID_OBJECT_ID);
+}
+
+TEST_F(SyncdStatsTest, bulkClearStats)
+{
+    m_vendorSai->mock_bulkClearStats = [](sai_object_id_t switchId, sai_object_type_t objectType, uint32_t objectCount,
+            const sai_object_key_t *objectKey, uint32_t numberOfCounters, const sai_stat_id_t *counterIds,
+            sai_stats_mode_t mode, sai_status_t *objectStatuses) -> sai_status_t
+    {
+        EXPECT_EQ(switchId, SWITCH_RID);
+        EXPECT_EQ(objectType, SAI_OBJECT_TYPE_QUEUE);
+        EXPECT_EQ(objectCount, 2);
+        EXPECT_EQ(objectKey[1].key.object_id, QUEUE_RID_2);
+        EXPECT_EQ(numberOfCounters, 2);
+        EXPECT_EQ(mode, SAI_STATS_MODE_BULK_CLEAR);
+
+        objectStatuses[0] = SAI_STATUS_SUCCESS;
+        objectStatuses[1] = SAI_STATUS_SUCCESS;
+
+        return SAI_STATUS_SUCCESS;
+    };
+
+    sai_status_t statuses[2] = { SAI_STATUS_FAILURE, SAI_STATUS_FAILURE };
+
+    auto status = m_sai->bulkClearStats(SWITCH_VID, SAI_OBJECT_TYPE_QUEUE, 2, m_keys, 2, m_ids, SAI_STATS_MODE_BULK_CLEAR, statuses);
+
+    EXPECT_EQ(status, SAI_STATUS_SUCCESS);
+    EXPECT_EQ(statuses[0], SAI_STATUS_SUCCESS);
+    EXPECT_EQ(statuses[1], SAI_STATUS_SUCCESS);
+
+    // vendor without bulk clear, objects are cleared one by one
+
+    m_vendorSai->mock_bulkClearStats = [](sai_object_id_t, sai_object_type_t, uint32_t, const sai_object_key_t *,
+            uint32_t, const sai_stat_id_t *, sai_stats_mode_t, sai_status_t *) -> sai_status_t
+    {
+        return SAI_STATUS_NOT_SUPPORTED;
+    };
+
+    std::vector<sai_object_id_t> cleared;
+
+    m_vendorSai->mock_clearStats = [&](sai_object_type_t objectType, sai_object_id_t objectId, uint32_t numberOfCounters,
+            const sai_stat_id_t *counterIds) -> sai_status_t
+    {
+        cleared.push_back(objectId);
+
+        return SAI_STATUS_SUCCESS;
+    };
+
+    status = m_sai->bulkClearStats(SWITCH_VID, SAI_OBJECT_TYPE_QUEUE, 2, m_keys, 2, m_ids, SAI_STATS_MODE_BULK_CLEAR, statuses);
+
+    EXPECT_EQ(status, SAI_STATUS_SUCCESS);
+    EXPECT_EQ(cleared, std::vector<sai_object_id_t>({ QUEUE_RID_1, QUEUE_RID_2 }));
+}
+
+TEST_F(SyncdStatsTest, getStatsExt)
+{
+    m_vendorSai->mock_getStatsExt = [](sai_object_type_t objectType, sai_object_id_t objectId, uint32_t numberOfCounters,
+            const sai_stat_id_t *counterIds, sai_stats_mode_t mode, uint64_t *counters) -> sai_status_t
+    {
+        EXPECT_EQ(objectType, SAI_OBJECT_TYPE_QUEUE);
+        EXPECT_EQ(objectId, QUEUE_RID_1);
+        EXPECT_EQ(numberOfCounters, 2);
+        EXPECT_EQ(counterIds[0], SAI_QUEUE_STAT_PACKETS);
+        EXPECT_EQ(counterIds[1], SAI_QUEUE_STAT_BYTES);
+        EXPECT_EQ(mode, SAI_STATS_MODE_READ_AND_CLEAR);
+
+        counters[0] = 3;
+        counters[1] = 300;
+
+        return SAI_STATUS_SUCCESS;
+    };
+
+    uint64_t counters[2] = { 0 };
+
+    auto status = m_sai->getStatsExt(SAI_OBJECT_TYPE_QUEUE, QUEUE_VID_1, 2, m_ids, SAI_STATS_MODE_READ_AND_CLEAR, counters);
+
+    EXPECT_EQ(status, SAI_STATUS_SUCCESS);
+    EXPECT_EQ(counters[0], 3);
+    EXPECT_EQ(counters[1], 300);
+}
+
+TEST_F(SyncdStatsTest, queryStatsCapability)
+{
+    int calls = 0;
+
+    m_vendorSai->mock_queryStatsCapability = [&](sai_object_id_t switchId, sai_object_type_t objectType,
+            sai_stat_capability_list_t *statsCapability) -> sai_status_t
+    {
+        calls++;
+
+        EXPECT_EQ(switchId, SWITCH_RID);
+
+        if (objectType != SAI_OBJECT_TYPE_QUEUE)
+        {
+            return SAI_STATUS_FAILURE;
+        }
+
+        if (statsCapability->count < 2)
+        {
+            statsCapability->count = 2;
+
+            return SAI_STATUS_BUFFER_OVERFLOW;
+        }
+
+        statsCapability->count = 2;
+        statsCapability->list[0].stat_enum = SAI_QUEUE_STAT_PACKETS;
+        statsCapability->list[0].stat_modes = SAI_STATS_MODE_READ;
+        statsCapability->list[1].stat_enum = SAI_QUEUE_STAT_BYTES;
+        statsCapability->list[1].stat_modes = SAI_STATS_MODE_READ | SAI_STATS_MODE_READ_AND_CLEAR;
+
+        return SAI_STATUS_SUCCESS;
+    };
+
+    sai_stat_capability_t caps[2];
+
+    sai_stat_capability_list_t list;
+
+    list.count = 0;
+    list.list = nullptr;
+
+    auto status = m_sai->queryStatsCapability(SWITCH_VID, SAI_OBJECT_TYPE_QUEUE, &list);
+
+    EXPECT_EQ(status, SAI_STATUS_BUFFER_OVERFLOW);
+    EXPECT_EQ(list.count, 2);
+
+    list.list = caps;
+
+    status = m_sai->queryStatsCapability(SWITCH_VID, SAI_OBJECT_TYPE_QUEUE, &list);
+
+    EXPECT_EQ(status, SAI_STATUS_SUCCESS);
+    EXPECT_EQ(list.count, 2);
+    EXPECT_EQ(caps[0].stat_enum, SAI_QUEUE_STAT_PACKETS);
+    EXPECT_EQ(caps[0].stat_modes, (uint32_t)SAI_STATS_MODE_READ);
+    EXPECT_EQ(caps[1].stat_enum, SAI_QUEUE_STAT_BYTES);
+    EXPECT_EQ(caps[1].stat_modes, (uint32_t)(SAI_STATS_MODE_READ | SAI_STATS_MODE_READ_AND_CLEAR));
+
+    // success is answered from capability cache
+
+    status = m_sai->queryStatsCapability(SWITCH_VID, SAI_OBJECT_TYPE_QUEUE, &list);
+
+    EXPECT_EQ(status, SAI_STATUS_SUCCESS);
+    EXPECT_EQ(calls, 2);
+
+    // failure carries no payload
+
+    status = m_sai->queryStatsCapability(SWITCH_VID, SAI_OBJECT_TYPE_PORT, &list);
+
+    EXPECT_EQ(status, SAI_STATUS_FAILURE);
+    EXPECT_EQ(calls, 3);
+}